@@ -142,6 +142,17 @@ OD_find(OD_t* od, uint16_t index) {
         return NULL;
     }
 
+    /* direct index: page by high byte, slot by low byte */
+    const OD_lookup_t* lookup = od->lookup;
+    if (lookup != NULL) {
+        uint8_t page = lookup->page[index >> 8];
+        if (page == OD_LOOKUP_NO_PAGE) {
+            return NULL;
+        }
+        uint16_t pos = lookup->slots[page][index & 0xFFU];
+        return (pos != 0U) ? &od->list[pos - 1U] : NULL;
+    }
+
     uint16_t min = 0;
     uint16_t max = od->size - 1U;
 
@@ -173,6 +184,55 @@ OD_find(OD_t* od, uint16_t index) {
     return NULL; /* entry does not exist in OD */
 }
 
+uint16_t
+OD_lookupPages(const OD_t* od) {
+    uint16_t pages = 0;
+    uint8_t hasPage[256 / 8] = {0};
+
+    if (od == NULL) {
+        return 0;
+    }
+    for (uint16_t i = 0; i < od->size; i++) {
+        uint8_t high = (uint8_t)(od->list[i].index >> 8);
+        uint8_t mask = (uint8_t)(1U << (high & 0x07U));
+        if ((hasPage[high >> 3] & mask) == 0U) {
+            hasPage[high >> 3] |= mask;
+            pages++;
+        }
+    }
+    return pages;
+}
+
+ODR_t
+OD_initLookup(OD_t* od, OD_lookup_t* lookup, uint16_t (*slots)[256], uint16_t pagesCount) {
+    if ((od == NULL) || (lookup == NULL) || (slots == NULL) || (od->size == 0xFFFFU)) {
+        return ODR_DEV_INCOMPAT;
+    }
+
+    od->lookup = NULL;
+    (void)memset(lookup->page, OD_LOOKUP_NO_PAGE, sizeof(lookup->page));
+    uint16_t pagesUsed = 0;
+
+    for (uint16_t i = 0; i < od->size; i++) {
+        uint16_t index = od->list[i].index;
+        uint8_t* page = &lookup->page[index >> 8];
+
+        if (*page == OD_LOOKUP_NO_PAGE) {
+            if ((pagesUsed >= pagesCount) || (pagesUsed >= OD_LOOKUP_NO_PAGE)) {
+                return ODR_OUT_OF_MEM;
+            }
+            (void)memset(slots[pagesUsed], 0, sizeof(slots[pagesUsed]));
+            *page = (uint8_t)pagesUsed;
+            pagesUsed++;
+        }
+        slots[*page][index & 0xFFU] = i + 1U;
+    }
+
+    lookup->slots = (const uint16_t(*)[256])slots;
+    od->lookup = lookup;
+    return ODR_OK;
+}
+
 ODR_t
 OD_getSub(const OD_entry_t* entry, uint8_t subIndex, OD_IO_t* io, bool_t odOrig) {
     if ((entry == NULL) || (entry->odObject == NULL)) {
@@ -221,10 +281,15 @@ OD_getSub(const OD_entry_t* entry, uint8_t subIndex, OD_IO_t* io, bool_t odOrig)
         case ODT_REC: {
             CO_PROGMEM OD_obj_record_t* odoArr = entry->odObject;
             CO_PROGMEM OD_obj_record_t* odo = NULL;
-            for (uint8_t i = 0; i < entry->subEntriesCount; i++) {
-                if (odoArr[i].subIndex == subIndex) {
-                    odo = &odoArr[i];
-                    break;
+            /* records are usually dense (sub-object at position subIndex), otherwise search */
+            if ((subIndex < entry->subEntriesCount) && (odoArr[subIndex].subIndex == subIndex)) {
+                odo = &odoArr[subIndex];
+            } else {
+                for (uint8_t i = 0; i < entry->subEntriesCount; i++) {
+                    if (odoArr[i].subIndex == subIndex) {
+                        odo = &odoArr[i];
+                        break;
+                    }
                 }
             }
             if (odo == NULL) {
@@ -343,7 +408,17 @@ OD_set_value(const OD_entry_t* entry, uint8_t subIndex, void* val, OD_size_t len
         return ODR_TYPE_MISMATCH;
     }
 
+#if (OD_SET_VALUE_REQUEST_TPDO != 0) && (OD_FLAGS_PDO_SIZE > 0)
+    bool_t changed = (stream->dataOrig == NULL) || (memcmp(stream->dataOrig, val, len) != 0);
+
+    ret = io.write(stream, val, len, &countWritten);
+    if ((ret == ODR_OK) && changed) {
+        OD_requestTPDO((OD_entry_t*)entry, subIndex);
+    }
+    return ret;
+#else
     return io.write(stream, val, len, &countWritten);
+#endif
 }
 
 void*
@@ -45,6 +45,12 @@ typedef uint8_t OD_attr_t;  /**< Type (and size) of Object Dictionary attribute
 #define OD_FLAGS_PDO_SIZE 4U /**< Size of of flagsPDO variable inside @ref OD_extension_t, from 0 to 32. */
 #endif
 
+#ifndef OD_SET_VALUE_REQUEST_TPDO
+/** If 1, @ref OD_set_value() calls @ref OD_requestTPDO() after successful write, if the new value differs from the
+ * value in the OD variable (or OD variable has no memory location). Change-of-state for event driven TPDOs. */
+#define OD_SET_VALUE_REQUEST_TPDO 0
+#endif
+
 #ifndef CO_PROGMEM
 /** Modifier for OD objects. This is large amount of data and is specified in Object Dictionary (OD.c file usually) */
 #define CO_PROGMEM const
@@ -278,12 +284,29 @@ typedef struct {
     OD_extension_t* extension; /**< Extension to OD, specified by application */
 } OD_entry_t;
 
+/** Value of @ref OD_lookup_t page for high byte of index without OD entries */
+#define OD_LOOKUP_NO_PAGE 0xFFU
+
+/**
+ * Direct-index lookup table for @ref OD_find()
+ *
+ * Two levels, keyed by the 16-bit index: high byte selects the page, low byte selects the slot inside the page. Slot
+ * contains position of the entry in the OD list + 1, or 0 if there is no entry. Only pages with OD entries are
+ * allocated (512 bytes each). Table may be generated together with the Object Dictionary (constant) or built in RAM
+ * with @ref OD_initLookup().
+ */
+typedef struct {
+    uint8_t page[256];            /**< Page number for each high byte of index or @ref OD_LOOKUP_NO_PAGE */
+    const uint16_t (*slots)[256]; /**< Pages with slots for each low byte of index */
+} OD_lookup_t;
+
 /**
  * Object Dictionary
  */
 typedef struct {
-    uint16_t size;    /**< Number of elements in the list, without last element, which is blank */
-    OD_entry_t* list; /**< List OD entries (table of contents), ordered by index */
+    uint16_t size;             /**< Number of elements in the list, without last element, which is blank */
+    OD_entry_t* list;          /**< List OD entries (table of contents), ordered by index */
+    const OD_lookup_t* lookup; /**< Optional direct-index table for @ref OD_find(). If NULL, binary search is used. */
 } OD_t;
 
 /**
@@ -314,6 +337,30 @@ ODR_t OD_writeOriginal(OD_stream_t* stream, const void* buf, OD_size_t count, OD
  */
 OD_entry_t* OD_find(OD_t* od, uint16_t index);
 
+/**
+ * Get number of pages, required by @ref OD_initLookup()
+ *
+ * @param od Object Dictionary
+ *
+ * @return Number of different high bytes of indexes in the Object Dictionary
+ */
+uint16_t OD_lookupPages(const OD_t* od);
+
+/**
+ * Build direct-index lookup table for @ref OD_find() in RAM and assign it to the Object Dictionary
+ *
+ * Must be called again, if the OD list is changed. If function fails, od->lookup is set to NULL and @ref OD_find()
+ * uses binary search.
+ *
+ * @param od Object Dictionary
+ * @param lookup Lookup table, must exist as long as od.
+ * @param slots Storage for pages, must exist as long as od.
+ * @param pagesCount Number of pages in slots, see @ref OD_lookupPages().
+ *
+ * @return ODR_OK on success, ODR_OUT_OF_MEM if pagesCount is too small, ODR_DEV_INCOMPAT on wrong arguments.
+ */
+ODR_t OD_initLookup(OD_t* od, OD_lookup_t* lookup, uint16_t (*slots)[256], uint16_t pagesCount);
+
 /**
  * Find sub-object with specified sub-index on OD entry returned by OD_find. Function populates io structure with
  * sub-object data.
@@ -136,6 +136,51 @@ PDOconfigMap(CO_PDO_common_t* PDO, uint32_t map, uint8_t mapIndex, bool_t isRPDO
     return ODR_OK;
 }
 
+/*
+ * Compile copy plan from the valid mapping (OD_IO and mappedObjectsCount)
+ *
+ * Mapped OD variable is copied with memcpy, if it uses original IO function, is fully mapped and has no multibyte
+ * swapping. Such adjacent variables, contiguous in memory, are merged into single step. Other variables use OD_IO.
+ *
+ * @param PDO This object.
+ * @param isRPDO True for RPDO and false for TPDO.
+ */
+static void
+PDO_compileCopyPlan(CO_PDO_common_t* PDO, bool_t isRPDO) {
+    CO_PDO_copyStep_t* step = NULL;
+    uint8_t stepCount = 0;
+
+    for (uint8_t i = 0; i < PDO->mappedObjectsCount; i++) {
+        OD_IO_t* OD_IO = &PDO->OD_IO[i];
+        OD_stream_t* stream = &OD_IO->stream;
+        uint8_t mappedLength = (uint8_t)stream->dataOffset;
+        uint8_t* dataOD = NULL;
+
+        bool_t originalIO = isRPDO ? (OD_IO->write == OD_writeOriginal) : (OD_IO->read == OD_readOriginal);
+        if (originalIO && (stream->dataOrig != NULL) && (stream->dataLength == (OD_size_t)mappedLength)
+#ifdef CO_BIG_ENDIAN
+            && ((stream->attribute & ODA_MB) == 0U)
+#endif
+        ) {
+            dataOD = (uint8_t*)stream->dataOrig;
+        }
+
+        /* merge with previous memcpy step, if contiguous */
+        if ((dataOD != NULL) && (step != NULL) && (step->dataOD != NULL) && ((step->dataOD + step->length) == dataOD)) {
+            step->length += mappedLength;
+            continue;
+        }
+
+        step = &PDO->copyPlan[stepCount];
+        stepCount++;
+        step->dataOD = dataOD;
+        step->length = mappedLength;
+        step->mapIndex = i;
+    }
+
+    PDO->copyPlanCount = stepCount;
+}
+
 /*
  * Initialize PDO mapping parameters
  *
@@ -202,6 +247,7 @@ PDO_initMapping(CO_PDO_common_t* PDO, OD_t* OD, OD_entry_t* OD_PDOMapPar, bool_t
     if (*erroneousMap == 0U) {
         PDO->dataLength = (CO_PDO_size_t)pdoDataLength;
         PDO->mappedObjectsCount = mappedObjectsCount;
+        PDO_compileCopyPlan(PDO, isRPDO);
     }
 
     return CO_ERROR_NO;
@@ -259,6 +305,7 @@ OD_write_PDO_mapping(OD_stream_t* stream, const void* buf, OD_size_t count, OD_s
         /* success, update PDO */
         PDO->dataLength = (CO_PDO_size_t)pdoDataLength;
         PDO->mappedObjectsCount = mappedObjectsCount;
+        PDO_compileCopyPlan(PDO, PDO->isRPDO);
     } else {
         uint32_t val = CO_getUint32(buf);
         ODR_t odRet = PDOconfigMap(PDO, val, stream->subIndex - 1U, PDO->isRPDO, PDO->OD);
@@ -365,6 +412,25 @@ PDO_initMapping(CO_PDO_common_t* PDO, OD_t* OD, OD_entry_t* OD_PDOMapPar, bool_t
     }
 
     PDO->dataLength = PDO->mappedObjectsCount = pdoDataLength;
+
+    /* compile copy plan: memcpy runs of PDO bytes, mapped to ascending contiguous OD memory */
+    uint8_t stepCount = 0;
+    for (uint8_t i = 0; i < pdoDataLength; i++) {
+        CO_PDO_copyStep_t* step;
+        if (stepCount > 0) {
+            step = &PDO->copyPlan[stepCount - 1];
+            if ((step->dataOD + step->length) == PDO->mapPointer[i]) {
+                step->length++;
+                continue;
+            }
+        }
+        step = &PDO->copyPlan[stepCount++];
+        step->dataOD = PDO->mapPointer[i];
+        step->length = 1;
+        step->mapIndex = i;
+    }
+    PDO->copyPlanCount = stepCount;
+
     return CO_ERROR_NO;
 }
 
@@ -746,20 +812,29 @@ CO_RPDO_process(CO_RPDO_t* RPDO,
              * by receive thread, then copy the latest data again. */
             CO_FLAG_CLEAR(RPDO->CANrxNew[bufNo]);
 
-#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) != 0
-            for (uint8_t i = 0; i < PDO->mappedObjectsCount; i++) {
-                OD_IO_t* OD_IO = &PDO->OD_IO[i];
-
-                /* get mappedLength from temporary storage */
-                OD_size_t* dataOffset = &OD_IO->stream.dataOffset;
-                uint8_t mappedLength = (uint8_t)(*dataOffset);
+            for (uint8_t s = 0; s < PDO->copyPlanCount; s++) {
+                const CO_PDO_copyStep_t* step = &PDO->copyPlan[s];
 
                 /* additional safety check. */
-                verifyLength += (OD_size_t)mappedLength;
+                verifyLength += (OD_size_t)step->length;
                 if (verifyLength > CO_PDO_MAX_SIZE) {
                     break;
                 }
 
+                /* contiguous OD variables with original IO */
+                if (step->dataOD != NULL) {
+                    (void)memcpy(step->dataOD, dataRPDO, step->length);
+                    dataRPDO += step->length;
+                    continue;
+                }
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) != 0
+                OD_IO_t* OD_IO = &PDO->OD_IO[step->mapIndex];
+
+                /* get mappedLength from temporary storage */
+                OD_size_t* dataOffset = &OD_IO->stream.dataOffset;
+                uint8_t mappedLength = (uint8_t)(*dataOffset);
+
                 /* length of OD variable may be larger than mappedLength */
                 OD_size_t ODdataLength = OD_IO->stream.dataLength;
                 if (ODdataLength > CO_PDO_MAX_SIZE) {
@@ -798,14 +873,8 @@ CO_RPDO_process(CO_RPDO_t* RPDO,
                 *dataOffset = mappedLength;
 
                 dataRPDO += mappedLength;
-            }
-
-#else
-            verifyLength = (OD_size_t)PDO->dataLength;
-            for (uint8_t i = 0; i < PDO->dataLength; i++) {
-                *PDO->mapPointer[i] = dataRPDO[i];
-            }
 #endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_OD_IO_ACCESS */
+            }
 
             if ((verifyLength > CO_PDO_MAX_SIZE) || (verifyLength != (OD_size_t)PDO->dataLength)) {
                 /* bug in software, should not happen */
@@ -1134,20 +1203,29 @@ CO_TPDOsend(CO_TPDO_t* TPDO) {
                           || (TPDO->transmissionType >= (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_EVENT_LO));
 #endif
 
-#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) != 0
-    for (uint8_t i = 0; i < PDO->mappedObjectsCount; i++) {
-        OD_IO_t* OD_IO = &PDO->OD_IO[i];
-        OD_stream_t* stream = &OD_IO->stream;
-
-        /* get mappedLength from temporary storage */
-        uint8_t mappedLength = (uint8_t)stream->dataOffset;
+    for (uint8_t s = 0; s < PDO->copyPlanCount; s++) {
+        const CO_PDO_copyStep_t* step = &PDO->copyPlan[s];
 
         /* additional safety check */
-        verifyLength += (OD_size_t)mappedLength;
+        verifyLength += (OD_size_t)step->length;
         if (verifyLength > CO_PDO_MAX_SIZE) {
             break;
         }
 
+        /* contiguous OD variables with original IO */
+        if (step->dataOD != NULL) {
+            (void)memcpy(dataTPDO, step->dataOD, step->length);
+            dataTPDO += step->length;
+            continue;
+        }
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) != 0
+        OD_IO_t* OD_IO = &PDO->OD_IO[step->mapIndex];
+        OD_stream_t* stream = &OD_IO->stream;
+
+        /* get mappedLength from temporary storage */
+        uint8_t mappedLength = (uint8_t)stream->dataOffset;
+
         /* length of OD variable may be larger than mappedLength */
         OD_size_t ODdataLength = stream->dataLength;
         if (ODdataLength > CO_PDO_MAX_SIZE) {
@@ -1187,30 +1265,26 @@ CO_TPDOsend(CO_TPDO_t* TPDO) {
             (void)memcpy(dataTPDO, buf, mappedLength);
         }
 
-        /* In event driven TPDO indicate transmission of OD variable */
-#if OD_FLAGS_PDO_SIZE > 0
-        uint8_t* flagPDObyte = PDO->flagPDObyte[i];
-        if ((flagPDObyte != NULL) && eventDriven) {
-            *flagPDObyte |= PDO->flagPDObitmask[i];
-        }
-#endif
-
         dataTPDO += mappedLength;
+#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_OD_IO_ACCESS */
     }
-#else
-    verifyLength = (OD_size_t)PDO->dataLength;
-    for (uint8_t i = 0; i < PDO->dataLength; i++) {
-        dataTPDO[i] = *PDO->mapPointer[i];
 
-        /* In event driven TPDO indicate transmission of OD variable */
+    /* In event driven TPDO indicate transmission of OD variables */
 #if OD_FLAGS_PDO_SIZE > 0
-        uint8_t* flagPDObyte = PDO->flagPDObyte[i];
-        if (flagPDObyte != NULL && eventDriven) {
-            *flagPDObyte |= PDO->flagPDObitmask[i];
-        }
+    if (eventDriven) {
+#if ((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) != 0
+        uint8_t flagCount = PDO->mappedObjectsCount;
+#else
+        uint8_t flagCount = PDO->dataLength;
 #endif
+        for (uint8_t i = 0; i < flagCount; i++) {
+            uint8_t* flagPDObyte = PDO->flagPDObyte[i];
+            if (flagPDObyte != NULL) {
+                *flagPDObyte |= PDO->flagPDObitmask[i];
+            }
+        }
     }
-#endif /* (CO_CONFIG_PDO) & CO_CONFIG_PDO_OD_IO_ACCESS */
+#endif
 
     if ((verifyLength > CO_PDO_MAX_SIZE) || (verifyLength != (OD_size_t)PDO->dataLength)) {
         /* bug in software, should not happen */
@@ -1218,13 +1292,44 @@ CO_TPDOsend(CO_TPDO_t* TPDO) {
         return CO_ERROR_DATA_CORRUPT;
     }
 
-    TPDO->sendRequest = false;
 #if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_TIMERS_ENABLE) != 0
     TPDO->eventTimer = TPDO->eventTime_us;
     TPDO->inhibitTimer = TPDO->inhibitTime_us;
 #endif
-    return CO_CANsend(PDO->CANdev, TPDO->CANtxBuff);
+    CO_ReturnError_t err = CO_CANsend(PDO->CANdev, TPDO->CANtxBuff);
+
+    /* If CAN buffer was not accepted, keep the request and retry. CANtxBuff already holds the new data, so change of
+     * state would not see the change any more and the OD_requestTPDO() flags already indicate transmission. */
+    TPDO->sendRequest = (err == CO_ERROR_TX_OVERFLOW);
+    return err;
+}
+
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_COS_ENABLE) != 0
+/*
+ * Change-of-state detection
+ *
+ * OD variables from memcpy steps of the copy plan are compared with the data of the last TPDO. Variables with OD_IO
+ * read function are not compared, application indicates their change with OD_requestTPDO().
+ *
+ * @param TPDO TPDO object.
+ *
+ * @return true, if any compared OD variable differs from the last TPDO.
+ */
+static bool_t
+CO_TPDO_COSchanged(const CO_TPDO_t* TPDO) {
+    const CO_PDO_common_t* PDO = &TPDO->PDO_common;
+    const uint8_t* dataTPDO = &TPDO->CANtxBuff->data[0];
+
+    for (uint8_t s = 0; s < PDO->copyPlanCount; s++) {
+        const CO_PDO_copyStep_t* step = &PDO->copyPlan[s];
+        if ((step->dataOD != NULL) && (memcmp(step->dataOD, dataTPDO, step->length) != 0)) {
+            return true;
+        }
+        dataTPDO += step->length;
+    }
+    return false;
 }
+#endif
 
 void
 CO_TPDO_process(CO_TPDO_t* TPDO,
@@ -1282,6 +1387,13 @@ CO_TPDO_process(CO_TPDO_t* TPDO,
             TPDO->inhibitTimer = (TPDO->inhibitTimer > timeDifference_us) ? (TPDO->inhibitTimer - timeDifference_us)
                                                                           : 0U;
 
+            /* change of state, checked after inhibit time */
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_COS_ENABLE) != 0
+            if (!TPDO->sendRequest && (TPDO->inhibitTimer == 0U) && CO_TPDO_COSchanged(TPDO)) {
+                TPDO->sendRequest = true;
+            }
+#endif
+
             /* send TPDO */
             if (TPDO->sendRequest && (TPDO->inhibitTimer == 0U)) {
                 (void)CO_TPDOsend(TPDO);
@@ -1294,6 +1406,11 @@ CO_TPDO_process(CO_TPDO_t* TPDO,
             }
 #endif
 #else
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_COS_ENABLE) != 0
+            if (!TPDO->sendRequest && CO_TPDO_COSchanged(TPDO)) {
+                TPDO->sendRequest = true;
+            }
+#endif
             if (TPDO->sendRequest) {
                 (void)CO_TPDOsend(TPDO);
             }
@@ -1305,6 +1422,11 @@ CO_TPDO_process(CO_TPDO_t* TPDO,
         else if ((TPDO->SYNC != NULL) && syncWas) {
             /* send synchronous acyclic TPDO */
             if (TPDO->transmissionType == (uint8_t)CO_PDO_TRANSM_TYPE_SYNC_ACYCLIC) {
+#if ((CO_CONFIG_PDO)&CO_CONFIG_TPDO_COS_ENABLE) != 0
+                if (!TPDO->sendRequest && CO_TPDO_COSchanged(TPDO)) {
+                    TPDO->sendRequest = true;
+                }
+#endif
                 if (TPDO->sendRequest) {
                     (void)CO_TPDOsend(TPDO);
                 }
@@ -65,6 +65,9 @@ extern "C" {
  *    types possible, controlled by: SYNC message, event timer, @ref CO_TPDOsendRequest() by application or @ref
  *    OD_requestTPDO(), where application can request TPDO for OD variable mapped to any of them. In later case
  *    application may, for example, monitor change of state of the OD variable and indicate TPDO request on it.
+ *  - With CO_CONFIG_TPDO_COS_ENABLE in @ref CO_CONFIG_PDO, event driven TPDO is also sent automatically, when any
+ *    of its OD variables, copied directly from memory, differs from the last transmitted TPDO (change of state). It is
+ *    checked in CO_TPDO_process() after inhibit time, so changes inside inhibit time are merged into one TPDO.
  *
  * @anchor CO_PDO_CAN_ID
  * ### CAN identifiers for PDO
@@ -146,6 +149,23 @@ typedef enum {
                                                  specific) */
 } CO_PDO_transmissionTypes_t;
 
+/** Maximum number of steps in the PDO copy plan */
+#if (((CO_CONFIG_PDO)&CO_CONFIG_PDO_OD_IO_ACCESS) != 0) || defined CO_DOXYGEN
+#define CO_PDO_COPY_PLAN_SIZE CO_PDO_MAX_MAPPED_ENTRIES
+#else
+#define CO_PDO_COPY_PLAN_SIZE CO_PDO_MAX_SIZE
+#endif
+
+/**
+ * One step of the PDO copy plan, see @ref CO_PDO_common_t.copyPlan
+ */
+typedef struct {
+    uint8_t* dataOD;  /**< Start of the OD variable(s) in memory, copied with memcpy. NULL if the step is executed with
+                         OD_IO[mapIndex] read/write function. */
+    uint8_t length;   /**< Number of PDO data bytes of the step */
+    uint8_t mapIndex; /**< Index of the first mapped entry (or PDO data byte) of the step */
+} CO_PDO_copyStep_t;
+
 /**
  * PDO object, common properties
  */
@@ -176,6 +196,12 @@ typedef struct {
     uint8_t flagPDObitmask[CO_PDO_MAX_SIZE];
 #endif
 #endif
+    CO_PDO_copyStep_t copyPlan[CO_PDO_COPY_PLAN_SIZE]; /**< Copy plan, compiled from the mapping. Mapped OD variables
+                                                          with original IO functions, which are fully mapped and
+                                                          contiguous in memory, are merged into single memcpy step.
+                                                          Dummy entries, partially mapped variables and variables with
+                                                          custom IO (OD extension) use OD_IO read/write function. */
+    uint8_t copyPlanCount;                             /**< Number of steps in copyPlan */
 #if (((CO_CONFIG_PDO)&CO_CONFIG_FLAG_OD_DYNAMIC) != 0) || defined CO_DOXYGEN
     bool_t isRPDO;                            /**< True for RPDO, false for TPDO */
     OD_t* OD;                                 /**< From CO_xPDO_init() */
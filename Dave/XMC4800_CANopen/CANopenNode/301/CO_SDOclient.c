@@ -87,6 +87,17 @@ CO_SDOclient_receive(void* object, void* msg) {
             SDO_C->timeoutTimer = 0;
             SDO_C->block_timeoutTimer = 0;
 
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+            /* count received segments, also out of sequence, for lost segments in statistics. Before the first segment
+             * remaining segments of the previous sub-block may still arrive, they are not counted. */
+            if ((seqno <= SDO_C->block_blksize) && ((seqno == 1U) || (SDO_C->block_seqno != 0U))) {
+                SDO_C->block_rxCount++;
+                if (seqno > SDO_C->block_rxSeqnoMax) {
+                    SDO_C->block_rxSeqnoMax = seqno;
+                }
+            }
+#endif
+
             /* verify if sequence number is correct */
             if ((seqno <= SDO_C->block_blksize) && (seqno == (SDO_C->block_seqno + 1U))) {
                 SDO_C->block_seqno = seqno;
@@ -237,6 +248,11 @@ CO_SDOclient_init(CO_SDOclient_t* SDO_C, OD_t* OD, OD_entry_t* OD_1280_SDOcliPar
     SDO_C->pFunctSignal = NULL;
     SDO_C->functSignalObject = NULL;
 #endif
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+    SDO_C->blockStat = NULL;
+    SDO_C->blockStatCount = 0;
+    SDO_C->block_stat = NULL;
+#endif
 
     /* prepare circular fifo buffer */
     CO_fifo_init(&SDO_C->bufFifo, SDO_C->buf, CO_CONFIG_SDO_CLI_BUFFER_SIZE + 1U);
@@ -293,6 +309,99 @@ CO_SDOclient_initCallbackPre(CO_SDOclient_t* SDOclient, void* object, void (*pFu
 }
 #endif
 
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+void
+CO_SDOclient_initBlockStat(CO_SDOclient_t* SDO_C, CO_SDOclient_blockStat_t blockStat[], uint8_t count) {
+    if (SDO_C != NULL) {
+        SDO_C->blockStat = blockStat;
+        SDO_C->blockStatCount = (blockStat != NULL) ? count : 0U;
+        SDO_C->block_stat = NULL;
+    }
+}
+
+/* Get statistics entry for the SDO server at start of block transfer */
+static void
+blockStart(CO_SDOclient_t* SDO_C) {
+    CO_SDOclient_blockStat_t* stat = NULL;
+
+    for (uint8_t i = 0; i < SDO_C->blockStatCount; i++) {
+        CO_SDOclient_blockStat_t* entry = &SDO_C->blockStat[i];
+        if (entry->nodeIdServer == SDO_C->nodeIDOfTheSDOServer) {
+            stat = entry;
+            break;
+        }
+        if ((stat == NULL) && (entry->nodeIdServer == 0U)) {
+            stat = entry;
+        }
+    }
+    if ((stat != NULL) && (stat->nodeIdServer != SDO_C->nodeIDOfTheSDOServer)) {
+        (void)memset((void*)stat, 0, sizeof(*stat));
+        stat->nodeIdServer = SDO_C->nodeIDOfTheSDOServer;
+        stat->blksize = 127;
+    }
+    SDO_C->block_stat = stat;
+    SDO_C->block_timeout = false;
+    SDO_C->block_statPending = false;
+}
+
+/* Sub-block acknowledged with ackseq, segments seqnoEnd were sent or expected, lost of them were missing. Update
+ * statistics and blksize (AIMD). */
+static void
+blockStatUpdate(CO_SDOclient_t* SDO_C, uint8_t ackseq, uint8_t seqnoEnd, uint8_t lost) {
+    CO_SDOclient_blockStat_t* stat = SDO_C->block_stat;
+
+    if (stat == NULL) {
+        return;
+    }
+    stat->subBlocks++;
+    stat->segments += seqnoEnd;
+    if (SDO_C->block_timeout) {
+        stat->timeouts++;
+        SDO_C->block_timeout = false;
+    }
+    stat->segmentsLost += lost;
+    if (ackseq < seqnoEnd) {
+        stat->segmentsResent += (uint32_t)seqnoEnd - ackseq;
+        stat->lossEvents++;
+        stat->blksize = (stat->blksize / 2U > CO_CONFIG_SDO_CLI_BLKSIZE_MIN) ? (uint8_t)(stat->blksize / 2U)
+                                                                              : (uint8_t)CO_CONFIG_SDO_CLI_BLKSIZE_MIN;
+    } else {
+        stat->blksize = (stat->blksize < (127U - CO_CONFIG_SDO_CLI_BLKSIZE_INC))
+                            ? (uint8_t)(stat->blksize + CO_CONFIG_SDO_CLI_BLKSIZE_INC)
+                            : 127U;
+    }
+}
+
+/* Missing segments in the sub-block of block upload: segments up to the highest received seqno or, after sub-block
+ * timeout, up to the expected end of the sub-block, which were not received. If the first segment is missing, later
+ * segments can not be told apart from the previous sub-block, only the first one is counted. */
+static uint8_t
+blockUploadLost(const CO_SDOclient_t* SDO_C) {
+    size_t end = SDO_C->block_rxSeqnoMax;
+
+    if (SDO_C->block_rxCount == 0U) {
+        return SDO_C->block_timeout ? 1U : 0U;
+    }
+    if (SDO_C->block_timeout) {
+        end = SDO_C->block_blksize;
+        if ((SDO_C->sizeInd > 0U) && (SDO_C->sizeInd > SDO_C->sizeTran)) {
+            size_t remaining = SDO_C->block_seqno + ((SDO_C->sizeInd - SDO_C->sizeTran + 6U) / 7U);
+            if (remaining < end) {
+                end = remaining;
+            }
+        }
+    }
+    return (end > SDO_C->block_rxCount) ? (uint8_t)(end - SDO_C->block_rxCount) : 0U;
+}
+
+/* Limit number of segments in block upload */
+static size_t
+blockStatLimit(const CO_SDOclient_t* SDO_C, size_t count) {
+    const CO_SDOclient_blockStat_t* stat = SDO_C->block_stat;
+    return ((stat != NULL) && (count > stat->blksize)) ? stat->blksize : count;
+}
+#endif
+
 #if (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_LOCAL) != 0) && defined CO_BIG_ENDIAN
 static inline void
 reverseBytes(void* start, OD_size_t size) {
@@ -388,6 +497,9 @@ CO_SDOclientDownloadInitiate(CO_SDOclient_t* SDO_C, uint16_t index, uint8_t subI
 #if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK) != 0
         if (blockEnable && ((sizeIndicated == 0U) || (sizeIndicated > (size_t)(CO_CONFIG_SDO_CLI_PST)))) {
         SDO_C->state = CO_SDO_ST_DOWNLOAD_BLK_INITIATE_REQ;
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+        blockStart(SDO_C);
+#endif
     } else
 #endif
     {
@@ -695,6 +807,11 @@ CO_SDOclientDownload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t s
                             break;
                         } else { /* MISRA C 2004 14.10 */
                         }
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+                        /* server ignores segments after the first missing one */
+                        blockStatUpdate(SDO_C, SDO_C->CANrxData[1], SDO_C->block_seqno,
+                                        (SDO_C->CANrxData[1] < SDO_C->block_seqno) ? 1U : 0U);
+#endif
 
                         /* confirm successfully transmitted data */
                         CO_fifo_altFinish(&SDO_C->bufFifo, &SDO_C->block_crc);
@@ -1071,6 +1188,9 @@ CO_SDOclientUploadInitiate(CO_SDOclient_t* SDO_C, uint16_t index, uint8_t subInd
 #if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK) != 0
         if (blockEnable) {
         SDO_C->state = CO_SDO_ST_UPLOAD_BLK_INITIATE_REQ;
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+        blockStart(SDO_C);
+#endif
     } else
 #endif
     {
@@ -1507,6 +1627,9 @@ CO_SDOclientUpload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t sen
                 SDO_C->block_timeoutTimer += timeDifference_us;
             }
             if (SDO_C->block_timeoutTimer >= SDO_C->block_SDOtimeoutTime_us) {
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+                SDO_C->block_timeout = true;
+#endif
                 /* SDO_C->state will change, processing will continue in this
                  * thread. Make memory barrier here with CO_FLAG_CLEAR() call. */
                 SDO_C->state = CO_SDO_ST_UPLOAD_BLK_SUBBLOCK_CRSP;
@@ -1577,6 +1700,9 @@ CO_SDOclientUpload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t sen
 
                 /* calculate number of block segments from free buffer space */
                 count = CO_fifo_getSpace(&SDO_C->bufFifo) / 7U;
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+                count = blockStatLimit(SDO_C, count);
+#endif
                 if (count > 127U) {
                     count = 127;
                 } else if (count == 0U) {
@@ -1604,6 +1730,11 @@ CO_SDOclientUpload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t sen
                 SDO_C->block_timeoutTimer = 0;
                 SDO_C->block_seqno = 0;
                 SDO_C->block_crc = 0;
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+                SDO_C->block_statPending = true;
+                SDO_C->block_rxCount = 0;
+                SDO_C->block_rxSeqnoMax = 0;
+#endif
                 /* Block segments will be received in different thread. Make memory
                  * barrier here with CO_FLAG_CLEAR() call. */
                 SDO_C->state = CO_SDO_ST_UPLOAD_BLK_SUBBLOCK_SREQ;
@@ -1619,6 +1750,15 @@ CO_SDOclientUpload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t sen
                 bool_t transferShort = SDO_C->block_seqno != SDO_C->block_blksize;
                 uint8_t seqnoStart = SDO_C->block_seqno;
 #endif
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+                /* once per sub-block, this state is repeated, if data buffer is full */
+                if (SDO_C->block_statPending) {
+                    blockStatUpdate(SDO_C, SDO_C->block_seqno,
+                                    SDO_C->finished ? SDO_C->block_seqno : SDO_C->block_blksize,
+                                    blockUploadLost(SDO_C));
+                    SDO_C->block_statPending = false;
+                }
+#endif
 
                 /* Is last segment? */
                 if (SDO_C->finished) {
@@ -1633,6 +1773,12 @@ CO_SDOclientUpload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t sen
 
                     /* calculate number of block segments from free buffer space */
                     count = CO_fifo_getSpace(&SDO_C->bufFifo) / 7U;
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+                    /* smaller window is not a reason to wait for the application */
+                    if ((SDO_C->block_stat != NULL) && (count >= SDO_C->block_stat->blksize)) {
+                        count = 127;
+                    }
+#endif
                     if (count >= 127U) {
                         count = 127;
                     } else if (CO_fifo_getOccupied(&SDO_C->bufFifo) > 0U) {
@@ -1655,6 +1801,12 @@ CO_SDOclientUpload(CO_SDOclient_t* SDO_C, uint32_t timeDifference_us, bool_t sen
                     } else { /* MISRA C 2004 14.10 */
                     }
 
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0
+                    count = blockStatLimit(SDO_C, count);
+                    SDO_C->block_statPending = true;
+                    SDO_C->block_rxCount = 0;
+                    SDO_C->block_rxSeqnoMax = 0;
+#endif
                     SDO_C->block_blksize = (uint8_t)count;
                     SDO_C->block_seqno = 0;
                     /* Block segments will be received in different thread. Make
@@ -41,6 +41,12 @@
 #endif
 #endif
 #endif
+#ifndef CO_CONFIG_SDO_CLI_BLKSIZE_MIN
+#define CO_CONFIG_SDO_CLI_BLKSIZE_MIN 127U
+#endif
+#ifndef CO_CONFIG_SDO_CLI_BLKSIZE_INC
+#define CO_CONFIG_SDO_CLI_BLKSIZE_INC 8U
+#endif
 
 #if (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ENABLE) != 0) || defined CO_DOXYGEN
 
@@ -145,6 +151,29 @@ write_SDO(CO_SDOclient_t* SDO_C, uint8_t nodeId, uint16_t index, uint8_t subInde
  * @see @ref CO_SDOserver
  */
 
+#if (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0) || defined CO_DOXYGEN
+/**
+ * Block transfer statistics and adaptive block size for one SDO server, see CO_SDOclient_initBlockStat().
+ *
+ * A sub-block with loss is acknowledged with ackseq lower than the number of segments sent, all segments after ackseq
+ * are retransmitted. In block upload the client counts the segments it received, so segmentsLost is the exact number of
+ * missing segments. In block download the server ignores all segments after the first missing one, so only that one is
+ * known and counted. Both directions update the statistics and blksize, but only blksize of block upload is chosen by
+ * the client (blksize of block download is chosen by the server). With default CO_CONFIG_SDO_CLI_BLKSIZE_MIN (127)
+ * blksize is not adapted.
+ */
+typedef struct {
+    uint8_t nodeIdServer;    /**< Node-ID of the SDO server, 0 = unused entry */
+    uint8_t blksize;         /**< Number of segments per block for the next block upload, 1..127 */
+    uint32_t subBlocks;      /**< Acknowledged sub-blocks */
+    uint32_t segments;       /**< Segments sent or expected in acknowledged sub-blocks, including lost segments */
+    uint32_t segmentsLost;   /**< Missing segments (block download: first missing segment of each sub-block) */
+    uint32_t segmentsResent; /**< Segments after ackseq, which were retransmitted */
+    uint32_t lossEvents;     /**< Sub-blocks with lost segments */
+    uint32_t timeouts;       /**< Sub-blocks of block upload, which ended with sub-block timeout */
+} CO_SDOclient_blockStat_t;
+#endif
+
 /**
  * SDO client object
  */
@@ -202,6 +231,15 @@ typedef struct {
     uint8_t block_dataUploadLast[7];  /**< Last 7 bytes of data at block upload */
     uint16_t block_crc;               /**< Calculated CRC checksum */
 #endif
+#if (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0) || defined CO_DOXYGEN
+    CO_SDOclient_blockStat_t* blockStat;   /**< From CO_SDOclient_initBlockStat() or NULL */
+    uint8_t blockStatCount;                /**< From CO_SDOclient_initBlockStat() */
+    CO_SDOclient_blockStat_t* block_stat;  /**< Entry of the current block transfer or NULL */
+    bool_t block_timeout;                  /**< Sub-block of block upload ended with sub-block timeout */
+    bool_t block_statPending;              /**< Sub-block of block upload not yet counted in block_stat */
+    uint8_t block_rxCount;                 /**< Segments received in the sub-block of block upload */
+    uint8_t block_rxSeqnoMax;              /**< Highest seqno received in the sub-block of block upload */
+#endif
 } CO_SDOclient_t;
 
 /**
@@ -244,6 +282,22 @@ CO_ReturnError_t CO_SDOclient_init(CO_SDOclient_t* SDO_C, OD_t* OD, OD_entry_t*
 void CO_SDOclient_initCallbackPre(CO_SDOclient_t* SDOclient, void* object, void (*pFunctSignal)(void* object));
 #endif
 
+#if (((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE) != 0) || defined CO_DOXYGEN
+/**
+ * Initialize block transfer statistics and adaptive block size.
+ *
+ * Each block transfer uses the entry with nodeIDOfTheSDOServer or takes a free entry (nodeIdServer == 0), which starts
+ * with blksize 127. If all entries are used by other servers, block transfer uses fixed blksize and no statistics.
+ * Entries are owned by the application, which may read them at any time and may clear them (set to zero), when there is
+ * no transfer in progress. Without table (default) blksize of block upload is calculated from free buffer space only.
+ *
+ * @param SDO_C This object.
+ * @param blockStat Array of entries or NULL.
+ * @param count Number of entries in blockStat.
+ */
+void CO_SDOclient_initBlockStat(CO_SDOclient_t* SDO_C, CO_SDOclient_blockStat_t blockStat[], uint8_t count);
+#endif
+
 /**
  * Setup SDO client object.
  *
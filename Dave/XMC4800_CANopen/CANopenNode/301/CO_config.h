@@ -391,14 +391,20 @@ extern "C" {
  *   CO_SDOclientUploadInitiate(), CO_SDOclientUpload().
  * - #CO_CONFIG_FLAG_OD_DYNAMIC - Enable dynamic configuration of SDO clients
  *   (Writing to object 0x1280+ re-configures the client).
+ * - CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE - Keep block transfer statistics for each
+ *   SDO server and adapt blksize of block upload to the observed segment loss
+ *   (AIMD), see CO_SDOclient_initBlockStat(). CO_CONFIG_SDO_CLI_BLOCK must also
+ *   be set. Adaptation is disabled by default, see
+ *   CO_CONFIG_SDO_CLI_BLKSIZE_MIN.
  */
 #ifdef CO_DOXYGEN
 #define CO_CONFIG_SDO_CLI (0)
 #endif
-#define CO_CONFIG_SDO_CLI_ENABLE    0x01
-#define CO_CONFIG_SDO_CLI_SEGMENTED 0x02
-#define CO_CONFIG_SDO_CLI_BLOCK     0x04
-#define CO_CONFIG_SDO_CLI_LOCAL     0x08
+#define CO_CONFIG_SDO_CLI_ENABLE         0x01
+#define CO_CONFIG_SDO_CLI_SEGMENTED      0x02
+#define CO_CONFIG_SDO_CLI_BLOCK          0x04
+#define CO_CONFIG_SDO_CLI_LOCAL          0x08
+#define CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE 0x10
 
 /**
  * Size of the internal data buffer for the SDO client.
@@ -414,6 +420,25 @@ extern "C" {
 #ifdef CO_DOXYGEN
 #define CO_CONFIG_SDO_CLI_BUFFER_SIZE 32
 #endif
+
+/**
+ * Adaptive block size of the SDO client, if CO_CONFIG_SDO_CLI_BLOCK_ADAPTIVE is
+ * set.
+ *
+ * After a sub-block with lost segments blksize is halved, but not below
+ * CO_CONFIG_SDO_CLI_BLKSIZE_MIN. After a sub-block without loss blksize is
+ * increased by CO_CONFIG_SDO_CLI_BLKSIZE_INC, up to 127. Smaller sub-blocks
+ * waste less segments after a lost one, but each sub-block costs an acknowledge
+ * and, if its last segment is lost, a sub-block timeout. A lost acknowledge
+ * aborts the transfer with SDO timeout, so where frame loss is random (not in
+ * bursts) smaller sub-blocks lower the goodput. Default minimum is 127, which
+ * keeps blksize fixed and only collects statistics. Lower it only where a link
+ * is measured to benefit.
+ */
+#ifdef CO_DOXYGEN
+#define CO_CONFIG_SDO_CLI_BLKSIZE_MIN 127
+#define CO_CONFIG_SDO_CLI_BLKSIZE_INC 8
+#endif
 /** @} */ /* CO_STACK_CONFIG_SDO */
 
 /**
@@ -482,6 +507,11 @@ extern "C" {
  *   flexibility for application program, but consumes some additional memory
  *   and processor resources. If this option is not enabled, then data from OD
  *   variables are fetched directly from memory allocated by Object dictionary.
+ * - CO_CONFIG_TPDO_COS_ENABLE - Enable change-of-state detection for event
+ *   driven TPDOs. OD variables, which are copied directly from memory (see
+ *   @ref CO_PDO_common_t copyPlan), are compared with the data of the last
+ *   TPDO after inhibit time. If any differs, TPDO is sent. Other variables
+ *   still require @ref OD_requestTPDO(), see also @ref OD_SET_VALUE_REQUEST_TPDO.
  * - #CO_CONFIG_FLAG_CALLBACK_PRE - Enable custom callback after preprocessing
  *   received RPDO CAN message.
  *   Callback is configured by CO_RPDO_initCallbackPre().
@@ -501,6 +531,7 @@ extern "C" {
 #define CO_CONFIG_TPDO_TIMERS_ENABLE 0x08
 #define CO_CONFIG_PDO_SYNC_ENABLE    0x10
 #define CO_CONFIG_PDO_OD_IO_ACCESS   0x20
+#define CO_CONFIG_TPDO_COS_ENABLE    0x40
 /** @} */ /* CO_STACK_CONFIG_SYNC_PDO */
 
 /**
@@ -62,6 +62,19 @@ CO_fifo_init(CO_fifo_t* fifo, uint8_t* buf, size_t bufSize) {
     return;
 }
 
+/* Copy data into fifo buffer and update crc over the copied bytes, which are still in cache. */
+static inline void
+CO_fifo_copyCrc(uint8_t* dest, const uint8_t* src, size_t count, uint16_t* crc) {
+    (void)memcpy(dest, src, count);
+#if ((CO_CONFIG_FIFO)&CO_CONFIG_FIFO_CRC16_CCITT) != 0
+    if (crc != NULL) {
+        *crc = crc16_ccitt(dest, count, *crc);
+    }
+#else
+    (void)crc;
+#endif
+}
+
 /* Circular FIFO buffer example for fifo->bufSize = 7 (usable size = 6): ******
  *                                                                            *
  *   0      *            *             *            *                         *
@@ -74,52 +87,67 @@ CO_fifo_init(CO_fifo_t* fifo, uint8_t* buf, size_t bufSize) {
  *                                                                            *
  *        empty       3 bytes       4 bytes       buffer                      *
  *        buffer      in buff       in buff       full                        *
+ *                                                                            *
+ * Data is copied with memcpy as at most two contiguous spans: from the       *
+ * pointer to the end of the buffer and from the start of the buffer.         *
  ******************************************************************************/
 size_t
 CO_fifo_write(CO_fifo_t* fifo, const uint8_t* buf, size_t count, uint16_t* crc) {
-    size_t i;
-    uint8_t* bufDest;
+    size_t space;
+    size_t span;
 
     if ((fifo == NULL) || (fifo->buf == NULL) || (buf == NULL)) {
         return 0;
     }
 
-    bufDest = &fifo->buf[fifo->writePtr];
-    for (i = count; i > 0U; i--) {
-        size_t writePtrNext = fifo->writePtr + 1U;
+    space = CO_fifo_getSpace(fifo);
+    if (count > space) {
+        count = space;
+    }
 
-        /* is circular buffer full */
-        if ((writePtrNext == fifo->readPtr) || ((writePtrNext == fifo->bufSize) && (fifo->readPtr == 0U))) {
-            break;
+    span = fifo->bufSize - fifo->writePtr;
+    if (span > count) {
+        span = count;
+    }
+    CO_fifo_copyCrc(&fifo->buf[fifo->writePtr], buf, span, crc);
+    if (span < count) {
+        CO_fifo_copyCrc(&fifo->buf[0], &buf[span], count - span, crc);
+        fifo->writePtr = count - span;
+    } else {
+        fifo->writePtr += span;
+        if (fifo->writePtr == fifo->bufSize) {
+            fifo->writePtr = 0;
         }
+    }
 
-        *bufDest = *buf;
+    return count;
+}
 
-#if ((CO_CONFIG_FIFO)&CO_CONFIG_FIFO_CRC16_CCITT) != 0
-        if (crc != NULL) {
-            crc16_ccitt_single(crc, *buf);
-        }
-#endif
+/* Copy count bytes from position *ptr and advance it, count must not exceed occupied data. */
+static size_t
+CO_fifo_copyOut(const CO_fifo_t* fifo, size_t* ptr, uint8_t* buf, size_t count) {
+    size_t span = fifo->bufSize - *ptr;
 
-        /* increment variables */
-        if (writePtrNext == fifo->bufSize) {
-            fifo->writePtr = 0;
-            bufDest = &fifo->buf[0];
-        } else {
-            fifo->writePtr++;
-            bufDest++;
+    if (span > count) {
+        span = count;
+    }
+    (void)memcpy(buf, &fifo->buf[*ptr], span);
+    if (span < count) {
+        (void)memcpy(&buf[span], &fifo->buf[0], count - span);
+        *ptr = count - span;
+    } else {
+        *ptr += span;
+        if (*ptr == fifo->bufSize) {
+            *ptr = 0;
         }
-        buf++;
     }
 
-    return count - i;
+    return count;
 }
 
 size_t
 CO_fifo_read(CO_fifo_t* fifo, uint8_t* buf, size_t count, bool_t* eof) {
-    size_t i;
-    const uint8_t* bufSrc;
-    bool_t alive_cycle = true;
+    size_t occupied;
 
     if (eof != NULL) {
         *eof = false;
@@ -128,62 +156,58 @@ CO_fifo_read(CO_fifo_t* fifo, uint8_t* buf, size_t count, bool_t* eof) {
         return 0;
     }
 
-    bufSrc = &fifo->buf[fifo->readPtr];
-    for (i = count; (i > 0U) && alive_cycle;) {
-        const uint8_t c = *bufSrc;
-
-        /* is circular buffer empty */
-        if (fifo->readPtr == fifo->writePtr) {
-            alive_cycle = false;
-        } else {
-            *buf = c;
-            buf++;
-
-            /* increment variables */
-            if (++fifo->readPtr == fifo->bufSize) {
-                fifo->readPtr = 0;
-                bufSrc = &fifo->buf[0];
-            } else {
-                bufSrc++;
-            }
-            i--;
+    occupied = CO_fifo_getOccupied(fifo);
+    if (count > occupied) {
+        count = occupied;
+    }
 
 #if ((CO_CONFIG_FIFO)&CO_CONFIG_FIFO_ASCII_COMMANDS) != 0
-            /* is delimiter? */
-            if ((eof != NULL) && (c == DELIM_COMMAND)) {
-                *eof = true;
-                alive_cycle = false;
+    /* read up to and including the command delimiter */
+    if (eof != NULL) {
+        size_t span = fifo->bufSize - fifo->readPtr;
+        const uint8_t* delim;
+
+        if (span > count) {
+            span = count;
+        }
+        delim = (const uint8_t*)memchr(&fifo->buf[fifo->readPtr], (int)DELIM_COMMAND, span);
+        if ((delim == NULL) && (span < count)) {
+            delim = (const uint8_t*)memchr(&fifo->buf[0], (int)DELIM_COMMAND, count - span);
+            if (delim != NULL) {
+                count = span + (size_t)(delim - &fifo->buf[0]) + 1U;
             }
-#endif
+        } else if (delim != NULL) {
+            count = (size_t)(delim - &fifo->buf[fifo->readPtr]) + 1U;
+        } else { /* MISRA C 2004 14.10 */
+        }
+        if (delim != NULL) {
+            *eof = true;
         }
     }
+#endif
 
-    return count - i;
+    return CO_fifo_copyOut(fifo, &fifo->readPtr, buf, count);
 }
 
 #if ((CO_CONFIG_FIFO)&CO_CONFIG_FIFO_ALT_READ) != 0
 size_t
 CO_fifo_altBegin(CO_fifo_t* fifo, size_t offset) {
-    size_t i;
+    size_t occupied;
 
     if (fifo == NULL) {
         return 0;
     }
 
-    fifo->altReadPtr = fifo->readPtr;
-    for (i = offset; i > 0U; i--) {
-        /* is circular buffer empty */
-        if (fifo->altReadPtr == fifo->writePtr) {
-            break;
-        }
-
-        /* increment variable */
-        if (++fifo->altReadPtr == fifo->bufSize) {
-            fifo->altReadPtr = 0;
-        }
+    occupied = CO_fifo_getOccupied(fifo);
+    if (offset > occupied) {
+        offset = occupied;
+    }
+    fifo->altReadPtr = fifo->readPtr + offset;
+    if (fifo->altReadPtr >= fifo->bufSize) {
+        fifo->altReadPtr -= fifo->bufSize;
     }
 
-    return offset - i;
+    return offset;
 }
 
 void
@@ -193,52 +217,30 @@ CO_fifo_altFinish(CO_fifo_t* fifo, uint16_t* crc) {
         return;
     }
 
-    if (crc == NULL) {
-        fifo->readPtr = fifo->altReadPtr;
-    } else {
-        const uint8_t* bufSrc = &fifo->buf[fifo->readPtr];
-        while (fifo->readPtr != fifo->altReadPtr) {
 #if ((CO_CONFIG_FIFO)&CO_CONFIG_FIFO_CRC16_CCITT) != 0
-            crc16_ccitt_single(crc, *bufSrc);
-#endif
-            /* increment variable */
-            if (++fifo->readPtr == fifo->bufSize) {
-                fifo->readPtr = 0;
-                bufSrc = &fifo->buf[0];
-            } else {
-                bufSrc++;
-            }
+    if ((crc != NULL) && (fifo->readPtr != fifo->altReadPtr)) {
+        if (fifo->readPtr < fifo->altReadPtr) {
+            *crc = crc16_ccitt(&fifo->buf[fifo->readPtr], fifo->altReadPtr - fifo->readPtr, *crc);
+        } else {
+            *crc = crc16_ccitt(&fifo->buf[fifo->readPtr], fifo->bufSize - fifo->readPtr, *crc);
+            *crc = crc16_ccitt(&fifo->buf[0], fifo->altReadPtr, *crc);
         }
     }
+#else
+    (void)crc;
+#endif
+    fifo->readPtr = fifo->altReadPtr;
 }
 
 size_t
 CO_fifo_altRead(CO_fifo_t* fifo, uint8_t* buf, size_t count) {
-    size_t i;
-    const uint8_t* bufSrc;
-
-    bufSrc = &fifo->buf[fifo->altReadPtr];
-    for (i = count; i > 0U; i--) {
-        const uint8_t c = *bufSrc;
+    size_t occupied = CO_fifo_altGetOccupied(fifo);
 
-        /* is there no more data */
-        if (fifo->altReadPtr == fifo->writePtr) {
-            break;
-        }
-
-        *buf = c;
-        buf++;
-
-        /* increment variables */
-        if (++fifo->altReadPtr == fifo->bufSize) {
-            fifo->altReadPtr = 0;
-            bufSrc = &fifo->buf[0];
-        } else {
-            bufSrc++;
-        }
+    if (count > occupied) {
+        count = occupied;
     }
 
-    return count - i;
+    return CO_fifo_copyOut(fifo, &fifo->altReadPtr, buf, count);
 }
 #endif /* (CO_CONFIG_FIFO) & CO_CONFIG_FIFO_ALT_READ */
 
@@ -20,6 +20,12 @@
 
 #include "CANopen.h"
 
+/* Optional profiling of the process functions, may be defined in CO_driver_target.h */
+#ifndef CO_PROF_BEGIN
+#define CO_PROF_BEGIN(id)
+#define CO_PROF_END(id)
+#endif
+
 /* Get values from CO_config_t or from single default OD.h ********************/
 #ifdef CO_MULTIPLE_OD
 #define CO_GET_CO(obj)       co->obj
@@ -1371,12 +1377,16 @@ CO_process(CO_t* co, bool_t enableGateway, uint32_t timeDifference_us, uint32_t*
 
     /* SDOserver */
     for (uint8_t i = 0; i < CO_GET_CNT(SDO_SRV); i++) {
+        CO_PROF_BEGIN(CO_PROF_SDO_SERVER);
         (void)CO_SDOserver_process(&co->SDOserver[i], NMTisPreOrOperational, timeDifference_us, timerNext_us);
+        CO_PROF_END(CO_PROF_SDO_SERVER);
     }
 
 #if ((CO_CONFIG_HB_CONS)&CO_CONFIG_HB_CONS_ENABLE) != 0
     if (CO_GET_CNT(HB_CONS) == 1U) {
+        CO_PROF_BEGIN(CO_PROF_HB_CONSUMER);
         CO_HBconsumer_process(co->HBcons, NMTisPreOrOperational, timeDifference_us, timerNext_us);
+        CO_PROF_END(CO_PROF_HB_CONSUMER);
     }
 #endif
 
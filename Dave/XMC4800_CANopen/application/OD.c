@@ -1,13 +1,13 @@
 /*******************************************************************************
     CANopen Object Dictionary definition for CANopenNode V4
 
-    This file was automatically generated with
-    libedssharp Object Dictionary Editor v0.8-125-g85dfd8e
+    This file was automatically generated with host/od_gen.c
+    (same names and layout as libedssharp, plus constant OD_find() lookup
+    table and typed getters of fixed-size variables)
 
     https://github.com/CANopenNode/CANopenNode
-    https://github.com/robincornelius/libedssharp
 
-    DON'T EDIT THIS FILE MANUALLY, UNLESS YOU KNOW WHAT YOU ARE DOING !!!!
+    DON'T EDIT THIS FILE MANUALLY, REGENERATE WITH 'make od' IN host/ !!!!
 *******************************************************************************/
 
 #define OD_DEFINITION
@@ -204,6 +204,126 @@ OD_RAM_t OD_RAM = {
         .highestSub_indexSupported = 0x02,
         .COB_IDClientToServerRx = 0x00000600,
         .COB_IDServerToClientTx = 0x00000580
+    },
+    .x2100_profileProcess = {
+        .highestSub_indexSupported = 0x0C,
+        .count = 0x00000000,
+        .minCycles = 0x00000000,
+        .maxCycles = 0x00000000,
+        .averageCycles = 0x00000000,
+        .histogram_0 = 0x00000000,
+        .histogram_1 = 0x00000000,
+        .histogram_2 = 0x00000000,
+        .histogram_3 = 0x00000000,
+        .histogram_4 = 0x00000000,
+        .histogram_5 = 0x00000000,
+        .histogram_6 = 0x00000000,
+        .histogram_7 = 0x00000000
+    },
+    .x2101_profileSYNC = {
+        .highestSub_indexSupported = 0x0C,
+        .count = 0x00000000,
+        .minCycles = 0x00000000,
+        .maxCycles = 0x00000000,
+        .averageCycles = 0x00000000,
+        .histogram_0 = 0x00000000,
+        .histogram_1 = 0x00000000,
+        .histogram_2 = 0x00000000,
+        .histogram_3 = 0x00000000,
+        .histogram_4 = 0x00000000,
+        .histogram_5 = 0x00000000,
+        .histogram_6 = 0x00000000,
+        .histogram_7 = 0x00000000
+    },
+    .x2102_profileRPDO = {
+        .highestSub_indexSupported = 0x0C,
+        .count = 0x00000000,
+        .minCycles = 0x00000000,
+        .maxCycles = 0x00000000,
+        .averageCycles = 0x00000000,
+        .histogram_0 = 0x00000000,
+        .histogram_1 = 0x00000000,
+        .histogram_2 = 0x00000000,
+        .histogram_3 = 0x00000000,
+        .histogram_4 = 0x00000000,
+        .histogram_5 = 0x00000000,
+        .histogram_6 = 0x00000000,
+        .histogram_7 = 0x00000000
+    },
+    .x2103_profileTPDO = {
+        .highestSub_indexSupported = 0x0C,
+        .count = 0x00000000,
+        .minCycles = 0x00000000,
+        .maxCycles = 0x00000000,
+        .averageCycles = 0x00000000,
+        .histogram_0 = 0x00000000,
+        .histogram_1 = 0x00000000,
+        .histogram_2 = 0x00000000,
+        .histogram_3 = 0x00000000,
+        .histogram_4 = 0x00000000,
+        .histogram_5 = 0x00000000,
+        .histogram_6 = 0x00000000,
+        .histogram_7 = 0x00000000
+    },
+    .x2104_profileCAN_RX = {
+        .highestSub_indexSupported = 0x0C,
+        .count = 0x00000000,
+        .minCycles = 0x00000000,
+        .maxCycles = 0x00000000,
+        .averageCycles = 0x00000000,
+        .histogram_0 = 0x00000000,
+        .histogram_1 = 0x00000000,
+        .histogram_2 = 0x00000000,
+        .histogram_3 = 0x00000000,
+        .histogram_4 = 0x00000000,
+        .histogram_5 = 0x00000000,
+        .histogram_6 = 0x00000000,
+        .histogram_7 = 0x00000000
+    },
+    .x2105_profileCAN_TX = {
+        .highestSub_indexSupported = 0x0C,
+        .count = 0x00000000,
+        .minCycles = 0x00000000,
+        .maxCycles = 0x00000000,
+        .averageCycles = 0x00000000,
+        .histogram_0 = 0x00000000,
+        .histogram_1 = 0x00000000,
+        .histogram_2 = 0x00000000,
+        .histogram_3 = 0x00000000,
+        .histogram_4 = 0x00000000,
+        .histogram_5 = 0x00000000,
+        .histogram_6 = 0x00000000,
+        .histogram_7 = 0x00000000
+    },
+    .x2106_profileSDOServer = {
+        .highestSub_indexSupported = 0x0C,
+        .count = 0x00000000,
+        .minCycles = 0x00000000,
+        .maxCycles = 0x00000000,
+        .averageCycles = 0x00000000,
+        .histogram_0 = 0x00000000,
+        .histogram_1 = 0x00000000,
+        .histogram_2 = 0x00000000,
+        .histogram_3 = 0x00000000,
+        .histogram_4 = 0x00000000,
+        .histogram_5 = 0x00000000,
+        .histogram_6 = 0x00000000,
+        .histogram_7 = 0x00000000
+    },
+    .x2107_profileHBConsumer = {
+        .highestSub_indexSupported = 0x0C,
+        .count = 0x00000000,
+        .minCycles = 0x00000000,
+        .maxCycles = 0x00000000,
+        .averageCycles = 0x00000000,
+        .histogram_0 = 0x00000000,
+        .histogram_1 = 0x00000000,
+        .histogram_2 = 0x00000000,
+        .histogram_3 = 0x00000000,
+        .histogram_4 = 0x00000000,
+        .histogram_5 = 0x00000000,
+        .histogram_6 = 0x00000000,
+        .histogram_7 = 0x00000000
     }
 };
 
@@ -246,6 +366,15 @@ typedef struct {
     OD_obj_record_t o_1A01_TPDOMappingParameter[9];
     OD_obj_record_t o_1A02_TPDOMappingParameter[9];
     OD_obj_record_t o_1A03_TPDOMappingParameter[9];
+    OD_obj_record_t o_2100_profileProcess[13];
+    OD_obj_record_t o_2101_profileSYNC[13];
+    OD_obj_record_t o_2102_profileRPDO[13];
+    OD_obj_record_t o_2103_profileTPDO[13];
+    OD_obj_record_t o_2104_profileCAN_RX[13];
+    OD_obj_record_t o_2105_profileCAN_TX[13];
+    OD_obj_record_t o_2106_profileSDOServer[13];
+    OD_obj_record_t o_2107_profileHBConsumer[13];
+    OD_obj_var_t o_2200_parameterFlash;
 } ODObjs_t;
 
 static CO_PROGMEM ODObjs_t ODObjs = {
@@ -1112,53 +1241,762 @@ static CO_PROGMEM ODObjs_t ODObjs = {
             .attribute = ODA_SDO_RW | ODA_MB,
             .dataLength = 4
         }
-    }
-};
-
-
-/*******************************************************************************
-    Object dictionary
-*******************************************************************************/
-static OD_entry_t ODList[] = {
-    {0x1000, 0x01, ODT_VAR, &ODObjs.o_1000_deviceType, NULL},
-    {0x1001, 0x01, ODT_VAR, &ODObjs.o_1001_errorRegister, NULL},
-    {0x1003, 0x11, ODT_ARR, &ODObjs.o_1003_pre_definedErrorField, NULL},
-    {0x1005, 0x01, ODT_VAR, &ODObjs.o_1005_COB_ID_SYNCMessage, NULL},
-    {0x1006, 0x01, ODT_VAR, &ODObjs.o_1006_communicationCyclePeriod, NULL},
-    {0x1007, 0x01, ODT_VAR, &ODObjs.o_1007_synchronousWindowLength, NULL},
-    {0x1010, 0x05, ODT_ARR, &ODObjs.o_1010_storeParameters, NULL},
-    {0x1011, 0x05, ODT_ARR, &ODObjs.o_1011_restoreDefaultParameters, NULL},
-    {0x1012, 0x01, ODT_VAR, &ODObjs.o_1012_COB_IDTimeStampObject, NULL},
-    {0x1014, 0x01, ODT_VAR, &ODObjs.o_1014_COB_ID_EMCY, NULL},
-    {0x1015, 0x01, ODT_VAR, &ODObjs.o_1015_inhibitTimeEMCY, NULL},
-    {0x1016, 0x09, ODT_ARR, &ODObjs.o_1016_consumerHeartbeatTime, NULL},
-    {0x1017, 0x01, ODT_VAR, &ODObjs.o_1017_producerHeartbeatTime, NULL},
-    {0x1018, 0x05, ODT_REC, &ODObjs.o_1018_identity, NULL},
-    {0x1019, 0x01, ODT_VAR, &ODObjs.o_1019_synchronousCounterOverflowValue, NULL},
-    {0x1200, 0x03, ODT_REC, &ODObjs.o_1200_SDOServerParameter, NULL},
-    {0x1280, 0x04, ODT_REC, &ODObjs.o_1280_SDOClientParameter, NULL},
-    {0x1400, 0x04, ODT_REC, &ODObjs.o_1400_RPDOCommunicationParameter, NULL},
-    {0x1401, 0x04, ODT_REC, &ODObjs.o_1401_RPDOCommunicationParameter, NULL},
-    {0x1402, 0x04, ODT_REC, &ODObjs.o_1402_RPDOCommunicationParameter, NULL},
-    {0x1403, 0x04, ODT_REC, &ODObjs.o_1403_RPDOCommunicationParameter, NULL},
-    {0x1600, 0x09, ODT_REC, &ODObjs.o_1600_RPDOMappingParameter, NULL},
-    {0x1601, 0x09, ODT_REC, &ODObjs.o_1601_RPDOMappingParameter, NULL},
-    {0x1602, 0x09, ODT_REC, &ODObjs.o_1602_RPDOMappingParameter, NULL},
-    {0x1603, 0x09, ODT_REC, &ODObjs.o_1603_RPDOMappingParameter, NULL},
-    {0x1800, 0x06, ODT_REC, &ODObjs.o_1800_TPDOCommunicationParameter, NULL},
-    {0x1801, 0x06, ODT_REC, &ODObjs.o_1801_TPDOCommunicationParameter, NULL},
-    {0x1802, 0x06, ODT_REC, &ODObjs.o_1802_TPDOCommunicationParameter, NULL},
-    {0x1803, 0x06, ODT_REC, &ODObjs.o_1803_TPDOCommunicationParameter, NULL},
-    {0x1A00, 0x09, ODT_REC, &ODObjs.o_1A00_TPDOMappingParameter, NULL},
-    {0x1A01, 0x09, ODT_REC, &ODObjs.o_1A01_TPDOMappingParameter, NULL},
-    {0x1A02, 0x09, ODT_REC, &ODObjs.o_1A02_TPDOMappingParameter, NULL},
-    {0x1A03, 0x09, ODT_REC, &ODObjs.o_1A03_TPDOMappingParameter, NULL},
-    {0x0000, 0x00, 0, NULL, NULL}
+    },
+    .o_2100_profileProcess = {
+        {
+            .dataOrig = &OD_RAM.x2100_profileProcess.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_RAM.x2100_profileProcess.count,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2100_profileProcess.minCycles,
+            .subIndex = 2,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2100_profileProcess.maxCycles,
+            .subIndex = 3,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2100_profileProcess.averageCycles,
+            .subIndex = 4,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2100_profileProcess.histogram_0,
+            .subIndex = 5,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2100_profileProcess.histogram_1,
+            .subIndex = 6,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2100_profileProcess.histogram_2,
+            .subIndex = 7,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2100_profileProcess.histogram_3,
+            .subIndex = 8,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2100_profileProcess.histogram_4,
+            .subIndex = 9,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2100_profileProcess.histogram_5,
+            .subIndex = 10,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2100_profileProcess.histogram_6,
+            .subIndex = 11,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2100_profileProcess.histogram_7,
+            .subIndex = 12,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        }
+    },
+    .o_2101_profileSYNC = {
+        {
+            .dataOrig = &OD_RAM.x2101_profileSYNC.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_RAM.x2101_profileSYNC.count,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2101_profileSYNC.minCycles,
+            .subIndex = 2,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2101_profileSYNC.maxCycles,
+            .subIndex = 3,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2101_profileSYNC.averageCycles,
+            .subIndex = 4,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2101_profileSYNC.histogram_0,
+            .subIndex = 5,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2101_profileSYNC.histogram_1,
+            .subIndex = 6,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2101_profileSYNC.histogram_2,
+            .subIndex = 7,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2101_profileSYNC.histogram_3,
+            .subIndex = 8,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2101_profileSYNC.histogram_4,
+            .subIndex = 9,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2101_profileSYNC.histogram_5,
+            .subIndex = 10,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2101_profileSYNC.histogram_6,
+            .subIndex = 11,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2101_profileSYNC.histogram_7,
+            .subIndex = 12,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        }
+    },
+    .o_2102_profileRPDO = {
+        {
+            .dataOrig = &OD_RAM.x2102_profileRPDO.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_RAM.x2102_profileRPDO.count,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2102_profileRPDO.minCycles,
+            .subIndex = 2,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2102_profileRPDO.maxCycles,
+            .subIndex = 3,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2102_profileRPDO.averageCycles,
+            .subIndex = 4,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2102_profileRPDO.histogram_0,
+            .subIndex = 5,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2102_profileRPDO.histogram_1,
+            .subIndex = 6,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2102_profileRPDO.histogram_2,
+            .subIndex = 7,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2102_profileRPDO.histogram_3,
+            .subIndex = 8,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2102_profileRPDO.histogram_4,
+            .subIndex = 9,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2102_profileRPDO.histogram_5,
+            .subIndex = 10,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2102_profileRPDO.histogram_6,
+            .subIndex = 11,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2102_profileRPDO.histogram_7,
+            .subIndex = 12,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        }
+    },
+    .o_2103_profileTPDO = {
+        {
+            .dataOrig = &OD_RAM.x2103_profileTPDO.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_RAM.x2103_profileTPDO.count,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2103_profileTPDO.minCycles,
+            .subIndex = 2,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2103_profileTPDO.maxCycles,
+            .subIndex = 3,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2103_profileTPDO.averageCycles,
+            .subIndex = 4,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2103_profileTPDO.histogram_0,
+            .subIndex = 5,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2103_profileTPDO.histogram_1,
+            .subIndex = 6,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2103_profileTPDO.histogram_2,
+            .subIndex = 7,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2103_profileTPDO.histogram_3,
+            .subIndex = 8,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2103_profileTPDO.histogram_4,
+            .subIndex = 9,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2103_profileTPDO.histogram_5,
+            .subIndex = 10,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2103_profileTPDO.histogram_6,
+            .subIndex = 11,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2103_profileTPDO.histogram_7,
+            .subIndex = 12,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        }
+    },
+    .o_2104_profileCAN_RX = {
+        {
+            .dataOrig = &OD_RAM.x2104_profileCAN_RX.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_RAM.x2104_profileCAN_RX.count,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2104_profileCAN_RX.minCycles,
+            .subIndex = 2,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2104_profileCAN_RX.maxCycles,
+            .subIndex = 3,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2104_profileCAN_RX.averageCycles,
+            .subIndex = 4,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2104_profileCAN_RX.histogram_0,
+            .subIndex = 5,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2104_profileCAN_RX.histogram_1,
+            .subIndex = 6,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2104_profileCAN_RX.histogram_2,
+            .subIndex = 7,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2104_profileCAN_RX.histogram_3,
+            .subIndex = 8,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2104_profileCAN_RX.histogram_4,
+            .subIndex = 9,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2104_profileCAN_RX.histogram_5,
+            .subIndex = 10,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2104_profileCAN_RX.histogram_6,
+            .subIndex = 11,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2104_profileCAN_RX.histogram_7,
+            .subIndex = 12,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        }
+    },
+    .o_2105_profileCAN_TX = {
+        {
+            .dataOrig = &OD_RAM.x2105_profileCAN_TX.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_RAM.x2105_profileCAN_TX.count,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2105_profileCAN_TX.minCycles,
+            .subIndex = 2,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2105_profileCAN_TX.maxCycles,
+            .subIndex = 3,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2105_profileCAN_TX.averageCycles,
+            .subIndex = 4,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2105_profileCAN_TX.histogram_0,
+            .subIndex = 5,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2105_profileCAN_TX.histogram_1,
+            .subIndex = 6,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2105_profileCAN_TX.histogram_2,
+            .subIndex = 7,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2105_profileCAN_TX.histogram_3,
+            .subIndex = 8,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2105_profileCAN_TX.histogram_4,
+            .subIndex = 9,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2105_profileCAN_TX.histogram_5,
+            .subIndex = 10,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2105_profileCAN_TX.histogram_6,
+            .subIndex = 11,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2105_profileCAN_TX.histogram_7,
+            .subIndex = 12,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        }
+    },
+    .o_2106_profileSDOServer = {
+        {
+            .dataOrig = &OD_RAM.x2106_profileSDOServer.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_RAM.x2106_profileSDOServer.count,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2106_profileSDOServer.minCycles,
+            .subIndex = 2,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2106_profileSDOServer.maxCycles,
+            .subIndex = 3,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2106_profileSDOServer.averageCycles,
+            .subIndex = 4,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2106_profileSDOServer.histogram_0,
+            .subIndex = 5,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2106_profileSDOServer.histogram_1,
+            .subIndex = 6,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2106_profileSDOServer.histogram_2,
+            .subIndex = 7,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2106_profileSDOServer.histogram_3,
+            .subIndex = 8,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2106_profileSDOServer.histogram_4,
+            .subIndex = 9,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2106_profileSDOServer.histogram_5,
+            .subIndex = 10,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2106_profileSDOServer.histogram_6,
+            .subIndex = 11,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2106_profileSDOServer.histogram_7,
+            .subIndex = 12,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        }
+    },
+    .o_2107_profileHBConsumer = {
+        {
+            .dataOrig = &OD_RAM.x2107_profileHBConsumer.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_RAM.x2107_profileHBConsumer.count,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2107_profileHBConsumer.minCycles,
+            .subIndex = 2,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2107_profileHBConsumer.maxCycles,
+            .subIndex = 3,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2107_profileHBConsumer.averageCycles,
+            .subIndex = 4,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2107_profileHBConsumer.histogram_0,
+            .subIndex = 5,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2107_profileHBConsumer.histogram_1,
+            .subIndex = 6,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2107_profileHBConsumer.histogram_2,
+            .subIndex = 7,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2107_profileHBConsumer.histogram_3,
+            .subIndex = 8,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2107_profileHBConsumer.histogram_4,
+            .subIndex = 9,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2107_profileHBConsumer.histogram_5,
+            .subIndex = 10,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2107_profileHBConsumer.histogram_6,
+            .subIndex = 11,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x2107_profileHBConsumer.histogram_7,
+            .subIndex = 12,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        }
+    },
+    .o_2200_parameterFlash = {
+        .dataOrig = NULL,
+        .attribute = ODA_SDO_RW,
+        .dataLength = 0
+    }
+};
+
+
+/*******************************************************************************
+    Object dictionary
+*******************************************************************************/
+static OD_entry_t ODList[] = {
+    {0x1000, 0x01, ODT_VAR, &ODObjs.o_1000_deviceType, NULL},
+    {0x1001, 0x01, ODT_VAR, &ODObjs.o_1001_errorRegister, NULL},
+    {0x1003, 0x11, ODT_ARR, &ODObjs.o_1003_pre_definedErrorField, NULL},
+    {0x1005, 0x01, ODT_VAR, &ODObjs.o_1005_COB_ID_SYNCMessage, NULL},
+    {0x1006, 0x01, ODT_VAR, &ODObjs.o_1006_communicationCyclePeriod, NULL},
+    {0x1007, 0x01, ODT_VAR, &ODObjs.o_1007_synchronousWindowLength, NULL},
+    {0x1010, 0x05, ODT_ARR, &ODObjs.o_1010_storeParameters, NULL},
+    {0x1011, 0x05, ODT_ARR, &ODObjs.o_1011_restoreDefaultParameters, NULL},
+    {0x1012, 0x01, ODT_VAR, &ODObjs.o_1012_COB_IDTimeStampObject, NULL},
+    {0x1014, 0x01, ODT_VAR, &ODObjs.o_1014_COB_ID_EMCY, NULL},
+    {0x1015, 0x01, ODT_VAR, &ODObjs.o_1015_inhibitTimeEMCY, NULL},
+    {0x1016, 0x09, ODT_ARR, &ODObjs.o_1016_consumerHeartbeatTime, NULL},
+    {0x1017, 0x01, ODT_VAR, &ODObjs.o_1017_producerHeartbeatTime, NULL},
+    {0x1018, 0x05, ODT_REC, &ODObjs.o_1018_identity, NULL},
+    {0x1019, 0x01, ODT_VAR, &ODObjs.o_1019_synchronousCounterOverflowValue, NULL},
+    {0x1200, 0x03, ODT_REC, &ODObjs.o_1200_SDOServerParameter, NULL},
+    {0x1280, 0x04, ODT_REC, &ODObjs.o_1280_SDOClientParameter, NULL},
+    {0x1400, 0x04, ODT_REC, &ODObjs.o_1400_RPDOCommunicationParameter, NULL},
+    {0x1401, 0x04, ODT_REC, &ODObjs.o_1401_RPDOCommunicationParameter, NULL},
+    {0x1402, 0x04, ODT_REC, &ODObjs.o_1402_RPDOCommunicationParameter, NULL},
+    {0x1403, 0x04, ODT_REC, &ODObjs.o_1403_RPDOCommunicationParameter, NULL},
+    {0x1600, 0x09, ODT_REC, &ODObjs.o_1600_RPDOMappingParameter, NULL},
+    {0x1601, 0x09, ODT_REC, &ODObjs.o_1601_RPDOMappingParameter, NULL},
+    {0x1602, 0x09, ODT_REC, &ODObjs.o_1602_RPDOMappingParameter, NULL},
+    {0x1603, 0x09, ODT_REC, &ODObjs.o_1603_RPDOMappingParameter, NULL},
+    {0x1800, 0x06, ODT_REC, &ODObjs.o_1800_TPDOCommunicationParameter, NULL},
+    {0x1801, 0x06, ODT_REC, &ODObjs.o_1801_TPDOCommunicationParameter, NULL},
+    {0x1802, 0x06, ODT_REC, &ODObjs.o_1802_TPDOCommunicationParameter, NULL},
+    {0x1803, 0x06, ODT_REC, &ODObjs.o_1803_TPDOCommunicationParameter, NULL},
+    {0x1A00, 0x09, ODT_REC, &ODObjs.o_1A00_TPDOMappingParameter, NULL},
+    {0x1A01, 0x09, ODT_REC, &ODObjs.o_1A01_TPDOMappingParameter, NULL},
+    {0x1A02, 0x09, ODT_REC, &ODObjs.o_1A02_TPDOMappingParameter, NULL},
+    {0x1A03, 0x09, ODT_REC, &ODObjs.o_1A03_TPDOMappingParameter, NULL},
+    {0x2100, 0x0D, ODT_REC, &ODObjs.o_2100_profileProcess, NULL},
+    {0x2101, 0x0D, ODT_REC, &ODObjs.o_2101_profileSYNC, NULL},
+    {0x2102, 0x0D, ODT_REC, &ODObjs.o_2102_profileRPDO, NULL},
+    {0x2103, 0x0D, ODT_REC, &ODObjs.o_2103_profileTPDO, NULL},
+    {0x2104, 0x0D, ODT_REC, &ODObjs.o_2104_profileCAN_RX, NULL},
+    {0x2105, 0x0D, ODT_REC, &ODObjs.o_2105_profileCAN_TX, NULL},
+    {0x2106, 0x0D, ODT_REC, &ODObjs.o_2106_profileSDOServer, NULL},
+    {0x2107, 0x0D, ODT_REC, &ODObjs.o_2107_profileHBConsumer, NULL},
+    {0x2200, 0x01, ODT_VAR, &ODObjs.o_2200_parameterFlash, NULL},
+    {0x0000, 0x00, 0, NULL, NULL}
+};
+
+
+/*******************************************************************************
+    OD_find() direct-index lookup table (constant, see OD_lookup_t)
+*******************************************************************************/
+static CO_PROGMEM uint16_t ODLookupSlots[8][256] = {
+    { /* 0x10xx */
+        [0x00] = 1, [0x01] = 2, [0x03] = 3, [0x05] = 4, [0x06] = 5, [0x07] = 6, [0x10] = 7, [0x11] = 8,
+        [0x12] = 9, [0x14] = 10, [0x15] = 11, [0x16] = 12, [0x17] = 13, [0x18] = 14, [0x19] = 15
+    },
+    { /* 0x12xx */
+        [0x00] = 16, [0x80] = 17
+    },
+    { /* 0x14xx */
+        [0x00] = 18, [0x01] = 19, [0x02] = 20, [0x03] = 21
+    },
+    { /* 0x16xx */
+        [0x00] = 22, [0x01] = 23, [0x02] = 24, [0x03] = 25
+    },
+    { /* 0x18xx */
+        [0x00] = 26, [0x01] = 27, [0x02] = 28, [0x03] = 29
+    },
+    { /* 0x1Axx */
+        [0x00] = 30, [0x01] = 31, [0x02] = 32, [0x03] = 33
+    },
+    { /* 0x21xx */
+        [0x00] = 34, [0x01] = 35, [0x02] = 36, [0x03] = 37, [0x04] = 38, [0x05] = 39, [0x06] = 40, [0x07] = 41
+    },
+    { /* 0x22xx */
+        [0x00] = 42
+    }
+};
+
+static CO_PROGMEM OD_lookup_t ODLookup = {
+    .page = {
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x00, 0xFF, 0x01, 0xFF, 0x02, 0xFF, 0x03, 0xFF, 0x04, 0xFF, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x06, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+    },
+    .slots = ODLookupSlots
 };
 
 static OD_t _OD = {
     (sizeof(ODList) / sizeof(ODList[0])) - 1,
-    &ODList[0]
+    &ODList[0],
+    &ODLookup
 };
 
 OD_t *OD = &_OD;
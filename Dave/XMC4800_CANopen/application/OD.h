@@ -1,13 +1,13 @@
 /*******************************************************************************
     CANopen Object Dictionary definition for CANopenNode V4
 
-    This file was automatically generated with
-    libedssharp Object Dictionary Editor v0.8-125-g85dfd8e
+    This file was automatically generated with host/od_gen.c
+    (same names and layout as libedssharp, plus constant OD_find() lookup
+    table and typed getters of fixed-size variables)
 
     https://github.com/CANopenNode/CANopenNode
-    https://github.com/robincornelius/libedssharp
 
-    DON'T EDIT THIS FILE MANUALLY !!!!
+    DON'T EDIT THIS FILE MANUALLY, REGENERATE WITH 'make od' IN host/ !!!!
 ********************************************************************************
 
     File info:
@@ -15,9 +15,9 @@
         Project File: XMC4800_profile.eds
         File Version: 1
 
-        Created:      2020/11/23 下午 01:00:00
+        Created:      11-23-2020 1:00PM
         Created By:   Chieftek Precision Co.
-        Modified:     2021/8/9 下午 06:39:00
+        Modified:     08-09-2021 6:39PM
         Modified By:  
 
     Device Info:
@@ -245,6 +245,126 @@ typedef struct {
         uint32_t COB_IDClientToServerRx;
         uint32_t COB_IDServerToClientTx;
     } x1200_SDOServerParameter;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t count;
+        uint32_t minCycles;
+        uint32_t maxCycles;
+        uint32_t averageCycles;
+        uint32_t histogram_0;
+        uint32_t histogram_1;
+        uint32_t histogram_2;
+        uint32_t histogram_3;
+        uint32_t histogram_4;
+        uint32_t histogram_5;
+        uint32_t histogram_6;
+        uint32_t histogram_7;
+    } x2100_profileProcess;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t count;
+        uint32_t minCycles;
+        uint32_t maxCycles;
+        uint32_t averageCycles;
+        uint32_t histogram_0;
+        uint32_t histogram_1;
+        uint32_t histogram_2;
+        uint32_t histogram_3;
+        uint32_t histogram_4;
+        uint32_t histogram_5;
+        uint32_t histogram_6;
+        uint32_t histogram_7;
+    } x2101_profileSYNC;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t count;
+        uint32_t minCycles;
+        uint32_t maxCycles;
+        uint32_t averageCycles;
+        uint32_t histogram_0;
+        uint32_t histogram_1;
+        uint32_t histogram_2;
+        uint32_t histogram_3;
+        uint32_t histogram_4;
+        uint32_t histogram_5;
+        uint32_t histogram_6;
+        uint32_t histogram_7;
+    } x2102_profileRPDO;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t count;
+        uint32_t minCycles;
+        uint32_t maxCycles;
+        uint32_t averageCycles;
+        uint32_t histogram_0;
+        uint32_t histogram_1;
+        uint32_t histogram_2;
+        uint32_t histogram_3;
+        uint32_t histogram_4;
+        uint32_t histogram_5;
+        uint32_t histogram_6;
+        uint32_t histogram_7;
+    } x2103_profileTPDO;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t count;
+        uint32_t minCycles;
+        uint32_t maxCycles;
+        uint32_t averageCycles;
+        uint32_t histogram_0;
+        uint32_t histogram_1;
+        uint32_t histogram_2;
+        uint32_t histogram_3;
+        uint32_t histogram_4;
+        uint32_t histogram_5;
+        uint32_t histogram_6;
+        uint32_t histogram_7;
+    } x2104_profileCAN_RX;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t count;
+        uint32_t minCycles;
+        uint32_t maxCycles;
+        uint32_t averageCycles;
+        uint32_t histogram_0;
+        uint32_t histogram_1;
+        uint32_t histogram_2;
+        uint32_t histogram_3;
+        uint32_t histogram_4;
+        uint32_t histogram_5;
+        uint32_t histogram_6;
+        uint32_t histogram_7;
+    } x2105_profileCAN_TX;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t count;
+        uint32_t minCycles;
+        uint32_t maxCycles;
+        uint32_t averageCycles;
+        uint32_t histogram_0;
+        uint32_t histogram_1;
+        uint32_t histogram_2;
+        uint32_t histogram_3;
+        uint32_t histogram_4;
+        uint32_t histogram_5;
+        uint32_t histogram_6;
+        uint32_t histogram_7;
+    } x2106_profileSDOServer;
+    struct {
+        uint8_t highestSub_indexSupported;
+        uint32_t count;
+        uint32_t minCycles;
+        uint32_t maxCycles;
+        uint32_t averageCycles;
+        uint32_t histogram_0;
+        uint32_t histogram_1;
+        uint32_t histogram_2;
+        uint32_t histogram_3;
+        uint32_t histogram_4;
+        uint32_t histogram_5;
+        uint32_t histogram_6;
+        uint32_t histogram_7;
+    } x2107_profileHBConsumer;
 } OD_RAM_t;
 
 extern OD_PERSIST_COMM_t OD_PERSIST_COMM;
@@ -288,6 +408,15 @@ extern OD_t *OD;
 #define OD_ENTRY_H1A01 &OD->list[30]
 #define OD_ENTRY_H1A02 &OD->list[31]
 #define OD_ENTRY_H1A03 &OD->list[32]
+#define OD_ENTRY_H2100 &OD->list[33]
+#define OD_ENTRY_H2101 &OD->list[34]
+#define OD_ENTRY_H2102 &OD->list[35]
+#define OD_ENTRY_H2103 &OD->list[36]
+#define OD_ENTRY_H2104 &OD->list[37]
+#define OD_ENTRY_H2105 &OD->list[38]
+#define OD_ENTRY_H2106 &OD->list[39]
+#define OD_ENTRY_H2107 &OD->list[40]
+#define OD_ENTRY_H2200 &OD->list[41]
 
 
 /*******************************************************************************
@@ -326,5 +455,263 @@ extern OD_t *OD;
 #define OD_ENTRY_H1A01_TPDOMappingParameter &OD->list[30]
 #define OD_ENTRY_H1A02_TPDOMappingParameter &OD->list[31]
 #define OD_ENTRY_H1A03_TPDOMappingParameter &OD->list[32]
+#define OD_ENTRY_H2100_profileProcess &OD->list[33]
+#define OD_ENTRY_H2101_profileSYNC &OD->list[34]
+#define OD_ENTRY_H2102_profileRPDO &OD->list[35]
+#define OD_ENTRY_H2103_profileTPDO &OD->list[36]
+#define OD_ENTRY_H2104_profileCAN_RX &OD->list[37]
+#define OD_ENTRY_H2105_profileCAN_TX &OD->list[38]
+#define OD_ENTRY_H2106_profileSDOServer &OD->list[39]
+#define OD_ENTRY_H2107_profileHBConsumer &OD->list[40]
+#define OD_ENTRY_H2200_parameterFlash &OD->list[41]
+
+
+/*******************************************************************************
+    Typed getters of fixed-size variables and record sub-objects
+
+    Direct read of the original data location, same as OD_get_value() with
+    odOrig = true: no OD_find(), no OD_IO_t stream, IO extensions are
+    bypassed. There are no setters: write with OD_set_value() / OD_set_*(),
+    which check ODA_SDO_W, call the IO extension and request the TPDO.
+    Arrays are read directly: OD_<group>.xIIII_name[subIndex - 1].
+*******************************************************************************/
+static inline uint32_t OD_get_x1000_deviceType(void) { return OD_PERSIST_COMM.x1000_deviceType; }
+static inline uint8_t OD_get_x1001_errorRegister(void) { return OD_RAM.x1001_errorRegister; }
+static inline uint32_t OD_get_x1005_COB_ID_SYNCMessage(void) { return OD_PERSIST_COMM.x1005_COB_ID_SYNCMessage; }
+static inline uint32_t OD_get_x1006_communicationCyclePeriod(void) { return OD_PERSIST_COMM.x1006_communicationCyclePeriod; }
+static inline uint32_t OD_get_x1007_synchronousWindowLength(void) { return OD_PERSIST_COMM.x1007_synchronousWindowLength; }
+static inline uint32_t OD_get_x1012_COB_IDTimeStampObject(void) { return OD_PERSIST_COMM.x1012_COB_IDTimeStampObject; }
+static inline uint32_t OD_get_x1014_COB_ID_EMCY(void) { return OD_PERSIST_COMM.x1014_COB_ID_EMCY; }
+static inline uint16_t OD_get_x1015_inhibitTimeEMCY(void) { return OD_PERSIST_COMM.x1015_inhibitTimeEMCY; }
+static inline uint16_t OD_get_x1017_producerHeartbeatTime(void) { return OD_PERSIST_COMM.x1017_producerHeartbeatTime; }
+static inline uint8_t OD_get_x1018_identity_highestSub_indexSupported(void) { return OD_PERSIST_COMM.x1018_identity.highestSub_indexSupported; }
+static inline uint32_t OD_get_x1018_identity_vendor_ID(void) { return OD_PERSIST_COMM.x1018_identity.vendor_ID; }
+static inline uint32_t OD_get_x1018_identity_productCode(void) { return OD_PERSIST_COMM.x1018_identity.productCode; }
+static inline uint32_t OD_get_x1018_identity_revisionNumber(void) { return OD_PERSIST_COMM.x1018_identity.revisionNumber; }
+static inline uint32_t OD_get_x1018_identity_serialNumber(void) { return OD_PERSIST_COMM.x1018_identity.serialNumber; }
+static inline uint8_t OD_get_x1019_synchronousCounterOverflowValue(void) { return OD_PERSIST_COMM.x1019_synchronousCounterOverflowValue; }
+static inline uint8_t OD_get_x1200_SDOServerParameter_highestSub_indexSupported(void) { return OD_RAM.x1200_SDOServerParameter.highestSub_indexSupported; }
+static inline uint32_t OD_get_x1200_SDOServerParameter_COB_IDClientToServerRx(void) { return OD_RAM.x1200_SDOServerParameter.COB_IDClientToServerRx; }
+static inline uint32_t OD_get_x1200_SDOServerParameter_COB_IDServerToClientTx(void) { return OD_RAM.x1200_SDOServerParameter.COB_IDServerToClientTx; }
+static inline uint8_t OD_get_x1280_SDOClientParameter_highestSub_indexSupported(void) { return OD_PERSIST_COMM.x1280_SDOClientParameter.highestSub_indexSupported; }
+static inline uint32_t OD_get_x1280_SDOClientParameter_COB_IDClientToServerTx(void) { return OD_PERSIST_COMM.x1280_SDOClientParameter.COB_IDClientToServerTx; }
+static inline uint32_t OD_get_x1280_SDOClientParameter_COB_IDServerToClientRx(void) { return OD_PERSIST_COMM.x1280_SDOClientParameter.COB_IDServerToClientRx; }
+static inline uint8_t OD_get_x1280_SDOClientParameter_node_IDOfTheSDOServer(void) { return OD_PERSIST_COMM.x1280_SDOClientParameter.node_IDOfTheSDOServer; }
+static inline uint8_t OD_get_x1400_RPDOCommunicationParameter_highestSub_indexSupported(void) { return OD_PERSIST_COMM.x1400_RPDOCommunicationParameter.highestSub_indexSupported; }
+static inline uint32_t OD_get_x1400_RPDOCommunicationParameter_COB_IDUsedByRPDO(void) { return OD_PERSIST_COMM.x1400_RPDOCommunicationParameter.COB_IDUsedByRPDO; }
+static inline uint8_t OD_get_x1400_RPDOCommunicationParameter_transmissionType(void) { return OD_PERSIST_COMM.x1400_RPDOCommunicationParameter.transmissionType; }
+static inline uint16_t OD_get_x1400_RPDOCommunicationParameter_eventTimer(void) { return OD_PERSIST_COMM.x1400_RPDOCommunicationParameter.eventTimer; }
+static inline uint8_t OD_get_x1401_RPDOCommunicationParameter_highestSub_indexSupported(void) { return OD_PERSIST_COMM.x1401_RPDOCommunicationParameter.highestSub_indexSupported; }
+static inline uint32_t OD_get_x1401_RPDOCommunicationParameter_COB_IDUsedByRPDO(void) { return OD_PERSIST_COMM.x1401_RPDOCommunicationParameter.COB_IDUsedByRPDO; }
+static inline uint8_t OD_get_x1401_RPDOCommunicationParameter_transmissionType(void) { return OD_PERSIST_COMM.x1401_RPDOCommunicationParameter.transmissionType; }
+static inline uint16_t OD_get_x1401_RPDOCommunicationParameter_eventTimer(void) { return OD_PERSIST_COMM.x1401_RPDOCommunicationParameter.eventTimer; }
+static inline uint8_t OD_get_x1402_RPDOCommunicationParameter_highestSub_indexSupported(void) { return OD_PERSIST_COMM.x1402_RPDOCommunicationParameter.highestSub_indexSupported; }
+static inline uint32_t OD_get_x1402_RPDOCommunicationParameter_COB_IDUsedByRPDO(void) { return OD_PERSIST_COMM.x1402_RPDOCommunicationParameter.COB_IDUsedByRPDO; }
+static inline uint8_t OD_get_x1402_RPDOCommunicationParameter_transmissionType(void) { return OD_PERSIST_COMM.x1402_RPDOCommunicationParameter.transmissionType; }
+static inline uint16_t OD_get_x1402_RPDOCommunicationParameter_eventTimer(void) { return OD_PERSIST_COMM.x1402_RPDOCommunicationParameter.eventTimer; }
+static inline uint8_t OD_get_x1403_RPDOCommunicationParameter_highestSub_indexSupported(void) { return OD_PERSIST_COMM.x1403_RPDOCommunicationParameter.highestSub_indexSupported; }
+static inline uint32_t OD_get_x1403_RPDOCommunicationParameter_COB_IDUsedByRPDO(void) { return OD_PERSIST_COMM.x1403_RPDOCommunicationParameter.COB_IDUsedByRPDO; }
+static inline uint8_t OD_get_x1403_RPDOCommunicationParameter_transmissionType(void) { return OD_PERSIST_COMM.x1403_RPDOCommunicationParameter.transmissionType; }
+static inline uint16_t OD_get_x1403_RPDOCommunicationParameter_eventTimer(void) { return OD_PERSIST_COMM.x1403_RPDOCommunicationParameter.eventTimer; }
+static inline uint8_t OD_get_x1600_RPDOMappingParameter_numberOfMappedApplicationObjectsInPDO(void) { return OD_PERSIST_COMM.x1600_RPDOMappingParameter.numberOfMappedApplicationObjectsInPDO; }
+static inline uint32_t OD_get_x1600_RPDOMappingParameter_applicationObject_1(void) { return OD_PERSIST_COMM.x1600_RPDOMappingParameter.applicationObject_1; }
+static inline uint32_t OD_get_x1600_RPDOMappingParameter_applicationObject_2(void) { return OD_PERSIST_COMM.x1600_RPDOMappingParameter.applicationObject_2; }
+static inline uint32_t OD_get_x1600_RPDOMappingParameter_applicationObject_3(void) { return OD_PERSIST_COMM.x1600_RPDOMappingParameter.applicationObject_3; }
+static inline uint32_t OD_get_x1600_RPDOMappingParameter_applicationObject_4(void) { return OD_PERSIST_COMM.x1600_RPDOMappingParameter.applicationObject_4; }
+static inline uint32_t OD_get_x1600_RPDOMappingParameter_applicationObject_5(void) { return OD_PERSIST_COMM.x1600_RPDOMappingParameter.applicationObject_5; }
+static inline uint32_t OD_get_x1600_RPDOMappingParameter_applicationObject_6(void) { return OD_PERSIST_COMM.x1600_RPDOMappingParameter.applicationObject_6; }
+static inline uint32_t OD_get_x1600_RPDOMappingParameter_applicationObject_7(void) { return OD_PERSIST_COMM.x1600_RPDOMappingParameter.applicationObject_7; }
+static inline uint32_t OD_get_x1600_RPDOMappingParameter_applicationObject_8(void) { return OD_PERSIST_COMM.x1600_RPDOMappingParameter.applicationObject_8; }
+static inline uint8_t OD_get_x1601_RPDOMappingParameter_numberOfMappedApplicationObjectsInPDO(void) { return OD_PERSIST_COMM.x1601_RPDOMappingParameter.numberOfMappedApplicationObjectsInPDO; }
+static inline uint32_t OD_get_x1601_RPDOMappingParameter_applicationObject_1(void) { return OD_PERSIST_COMM.x1601_RPDOMappingParameter.applicationObject_1; }
+static inline uint32_t OD_get_x1601_RPDOMappingParameter_applicationObject_2(void) { return OD_PERSIST_COMM.x1601_RPDOMappingParameter.applicationObject_2; }
+static inline uint32_t OD_get_x1601_RPDOMappingParameter_applicationObject_3(void) { return OD_PERSIST_COMM.x1601_RPDOMappingParameter.applicationObject_3; }
+static inline uint32_t OD_get_x1601_RPDOMappingParameter_applicationObject_4(void) { return OD_PERSIST_COMM.x1601_RPDOMappingParameter.applicationObject_4; }
+static inline uint32_t OD_get_x1601_RPDOMappingParameter_applicationObject_5(void) { return OD_PERSIST_COMM.x1601_RPDOMappingParameter.applicationObject_5; }
+static inline uint32_t OD_get_x1601_RPDOMappingParameter_applicationObject_6(void) { return OD_PERSIST_COMM.x1601_RPDOMappingParameter.applicationObject_6; }
+static inline uint32_t OD_get_x1601_RPDOMappingParameter_applicationObject_7(void) { return OD_PERSIST_COMM.x1601_RPDOMappingParameter.applicationObject_7; }
+static inline uint32_t OD_get_x1601_RPDOMappingParameter_applicationObject_8(void) { return OD_PERSIST_COMM.x1601_RPDOMappingParameter.applicationObject_8; }
+static inline uint8_t OD_get_x1602_RPDOMappingParameter_numberOfMappedApplicationObjectsInPDO(void) { return OD_PERSIST_COMM.x1602_RPDOMappingParameter.numberOfMappedApplicationObjectsInPDO; }
+static inline uint32_t OD_get_x1602_RPDOMappingParameter_applicationObject_1(void) { return OD_PERSIST_COMM.x1602_RPDOMappingParameter.applicationObject_1; }
+static inline uint32_t OD_get_x1602_RPDOMappingParameter_applicationObject_2(void) { return OD_PERSIST_COMM.x1602_RPDOMappingParameter.applicationObject_2; }
+static inline uint32_t OD_get_x1602_RPDOMappingParameter_applicationObject_3(void) { return OD_PERSIST_COMM.x1602_RPDOMappingParameter.applicationObject_3; }
+static inline uint32_t OD_get_x1602_RPDOMappingParameter_applicationObject_4(void) { return OD_PERSIST_COMM.x1602_RPDOMappingParameter.applicationObject_4; }
+static inline uint32_t OD_get_x1602_RPDOMappingParameter_applicationObject_5(void) { return OD_PERSIST_COMM.x1602_RPDOMappingParameter.applicationObject_5; }
+static inline uint32_t OD_get_x1602_RPDOMappingParameter_applicationObject_6(void) { return OD_PERSIST_COMM.x1602_RPDOMappingParameter.applicationObject_6; }
+static inline uint32_t OD_get_x1602_RPDOMappingParameter_applicationObject_7(void) { return OD_PERSIST_COMM.x1602_RPDOMappingParameter.applicationObject_7; }
+static inline uint32_t OD_get_x1602_RPDOMappingParameter_applicationObject_8(void) { return OD_PERSIST_COMM.x1602_RPDOMappingParameter.applicationObject_8; }
+static inline uint8_t OD_get_x1603_RPDOMappingParameter_numberOfMappedApplicationObjectsInPDO(void) { return OD_PERSIST_COMM.x1603_RPDOMappingParameter.numberOfMappedApplicationObjectsInPDO; }
+static inline uint32_t OD_get_x1603_RPDOMappingParameter_applicationObject_1(void) { return OD_PERSIST_COMM.x1603_RPDOMappingParameter.applicationObject_1; }
+static inline uint32_t OD_get_x1603_RPDOMappingParameter_applicationObject_2(void) { return OD_PERSIST_COMM.x1603_RPDOMappingParameter.applicationObject_2; }
+static inline uint32_t OD_get_x1603_RPDOMappingParameter_applicationObject_3(void) { return OD_PERSIST_COMM.x1603_RPDOMappingParameter.applicationObject_3; }
+static inline uint32_t OD_get_x1603_RPDOMappingParameter_applicationObject_4(void) { return OD_PERSIST_COMM.x1603_RPDOMappingParameter.applicationObject_4; }
+static inline uint32_t OD_get_x1603_RPDOMappingParameter_applicationObject_5(void) { return OD_PERSIST_COMM.x1603_RPDOMappingParameter.applicationObject_5; }
+static inline uint32_t OD_get_x1603_RPDOMappingParameter_applicationObject_6(void) { return OD_PERSIST_COMM.x1603_RPDOMappingParameter.applicationObject_6; }
+static inline uint32_t OD_get_x1603_RPDOMappingParameter_applicationObject_7(void) { return OD_PERSIST_COMM.x1603_RPDOMappingParameter.applicationObject_7; }
+static inline uint32_t OD_get_x1603_RPDOMappingParameter_applicationObject_8(void) { return OD_PERSIST_COMM.x1603_RPDOMappingParameter.applicationObject_8; }
+static inline uint8_t OD_get_x1800_TPDOCommunicationParameter_highestSub_indexSupported(void) { return OD_PERSIST_COMM.x1800_TPDOCommunicationParameter.highestSub_indexSupported; }
+static inline uint32_t OD_get_x1800_TPDOCommunicationParameter_COB_IDUsedByTPDO(void) { return OD_PERSIST_COMM.x1800_TPDOCommunicationParameter.COB_IDUsedByTPDO; }
+static inline uint8_t OD_get_x1800_TPDOCommunicationParameter_transmissionType(void) { return OD_PERSIST_COMM.x1800_TPDOCommunicationParameter.transmissionType; }
+static inline uint16_t OD_get_x1800_TPDOCommunicationParameter_inhibitTime(void) { return OD_PERSIST_COMM.x1800_TPDOCommunicationParameter.inhibitTime; }
+static inline uint16_t OD_get_x1800_TPDOCommunicationParameter_eventTimer(void) { return OD_PERSIST_COMM.x1800_TPDOCommunicationParameter.eventTimer; }
+static inline uint8_t OD_get_x1800_TPDOCommunicationParameter_SYNCStartValue(void) { return OD_PERSIST_COMM.x1800_TPDOCommunicationParameter.SYNCStartValue; }
+static inline uint8_t OD_get_x1801_TPDOCommunicationParameter_highestSub_indexSupported(void) { return OD_PERSIST_COMM.x1801_TPDOCommunicationParameter.highestSub_indexSupported; }
+static inline uint32_t OD_get_x1801_TPDOCommunicationParameter_COB_IDUsedByTPDO(void) { return OD_PERSIST_COMM.x1801_TPDOCommunicationParameter.COB_IDUsedByTPDO; }
+static inline uint8_t OD_get_x1801_TPDOCommunicationParameter_transmissionType(void) { return OD_PERSIST_COMM.x1801_TPDOCommunicationParameter.transmissionType; }
+static inline uint16_t OD_get_x1801_TPDOCommunicationParameter_inhibitTime(void) { return OD_PERSIST_COMM.x1801_TPDOCommunicationParameter.inhibitTime; }
+static inline uint16_t OD_get_x1801_TPDOCommunicationParameter_eventTimer(void) { return OD_PERSIST_COMM.x1801_TPDOCommunicationParameter.eventTimer; }
+static inline uint8_t OD_get_x1801_TPDOCommunicationParameter_SYNCStartValue(void) { return OD_PERSIST_COMM.x1801_TPDOCommunicationParameter.SYNCStartValue; }
+static inline uint8_t OD_get_x1802_TPDOCommunicationParameter_highestSub_indexSupported(void) { return OD_PERSIST_COMM.x1802_TPDOCommunicationParameter.highestSub_indexSupported; }
+static inline uint32_t OD_get_x1802_TPDOCommunicationParameter_COB_IDUsedByTPDO(void) { return OD_PERSIST_COMM.x1802_TPDOCommunicationParameter.COB_IDUsedByTPDO; }
+static inline uint8_t OD_get_x1802_TPDOCommunicationParameter_transmissionType(void) { return OD_PERSIST_COMM.x1802_TPDOCommunicationParameter.transmissionType; }
+static inline uint16_t OD_get_x1802_TPDOCommunicationParameter_inhibitTime(void) { return OD_PERSIST_COMM.x1802_TPDOCommunicationParameter.inhibitTime; }
+static inline uint16_t OD_get_x1802_TPDOCommunicationParameter_eventTimer(void) { return OD_PERSIST_COMM.x1802_TPDOCommunicationParameter.eventTimer; }
+static inline uint8_t OD_get_x1802_TPDOCommunicationParameter_SYNCStartValue(void) { return OD_PERSIST_COMM.x1802_TPDOCommunicationParameter.SYNCStartValue; }
+static inline uint8_t OD_get_x1803_TPDOCommunicationParameter_highestSub_indexSupported(void) { return OD_PERSIST_COMM.x1803_TPDOCommunicationParameter.highestSub_indexSupported; }
+static inline uint32_t OD_get_x1803_TPDOCommunicationParameter_COB_IDUsedByTPDO(void) { return OD_PERSIST_COMM.x1803_TPDOCommunicationParameter.COB_IDUsedByTPDO; }
+static inline uint8_t OD_get_x1803_TPDOCommunicationParameter_transmissionType(void) { return OD_PERSIST_COMM.x1803_TPDOCommunicationParameter.transmissionType; }
+static inline uint16_t OD_get_x1803_TPDOCommunicationParameter_inhibitTime(void) { return OD_PERSIST_COMM.x1803_TPDOCommunicationParameter.inhibitTime; }
+static inline uint16_t OD_get_x1803_TPDOCommunicationParameter_eventTimer(void) { return OD_PERSIST_COMM.x1803_TPDOCommunicationParameter.eventTimer; }
+static inline uint8_t OD_get_x1803_TPDOCommunicationParameter_SYNCStartValue(void) { return OD_PERSIST_COMM.x1803_TPDOCommunicationParameter.SYNCStartValue; }
+static inline uint8_t OD_get_x1A00_TPDOMappingParameter_numberOfMappedApplicationObjectsInPDO(void) { return OD_PERSIST_COMM.x1A00_TPDOMappingParameter.numberOfMappedApplicationObjectsInPDO; }
+static inline uint32_t OD_get_x1A00_TPDOMappingParameter_applicationObject_1(void) { return OD_PERSIST_COMM.x1A00_TPDOMappingParameter.applicationObject_1; }
+static inline uint32_t OD_get_x1A00_TPDOMappingParameter_applicationObject_2(void) { return OD_PERSIST_COMM.x1A00_TPDOMappingParameter.applicationObject_2; }
+static inline uint32_t OD_get_x1A00_TPDOMappingParameter_applicationObject_3(void) { return OD_PERSIST_COMM.x1A00_TPDOMappingParameter.applicationObject_3; }
+static inline uint32_t OD_get_x1A00_TPDOMappingParameter_applicationObject_4(void) { return OD_PERSIST_COMM.x1A00_TPDOMappingParameter.applicationObject_4; }
+static inline uint32_t OD_get_x1A00_TPDOMappingParameter_applicationObject_5(void) { return OD_PERSIST_COMM.x1A00_TPDOMappingParameter.applicationObject_5; }
+static inline uint32_t OD_get_x1A00_TPDOMappingParameter_applicationObject_6(void) { return OD_PERSIST_COMM.x1A00_TPDOMappingParameter.applicationObject_6; }
+static inline uint32_t OD_get_x1A00_TPDOMappingParameter_applicationObject_7(void) { return OD_PERSIST_COMM.x1A00_TPDOMappingParameter.applicationObject_7; }
+static inline uint32_t OD_get_x1A00_TPDOMappingParameter_applicationObject_8(void) { return OD_PERSIST_COMM.x1A00_TPDOMappingParameter.applicationObject_8; }
+static inline uint8_t OD_get_x1A01_TPDOMappingParameter_numberOfMappedApplicationObjectsInPDO(void) { return OD_PERSIST_COMM.x1A01_TPDOMappingParameter.numberOfMappedApplicationObjectsInPDO; }
+static inline uint32_t OD_get_x1A01_TPDOMappingParameter_applicationObject_1(void) { return OD_PERSIST_COMM.x1A01_TPDOMappingParameter.applicationObject_1; }
+static inline uint32_t OD_get_x1A01_TPDOMappingParameter_applicationObject_2(void) { return OD_PERSIST_COMM.x1A01_TPDOMappingParameter.applicationObject_2; }
+static inline uint32_t OD_get_x1A01_TPDOMappingParameter_applicationObject_3(void) { return OD_PERSIST_COMM.x1A01_TPDOMappingParameter.applicationObject_3; }
+static inline uint32_t OD_get_x1A01_TPDOMappingParameter_applicationObject_4(void) { return OD_PERSIST_COMM.x1A01_TPDOMappingParameter.applicationObject_4; }
+static inline uint32_t OD_get_x1A01_TPDOMappingParameter_applicationObject_5(void) { return OD_PERSIST_COMM.x1A01_TPDOMappingParameter.applicationObject_5; }
+static inline uint32_t OD_get_x1A01_TPDOMappingParameter_applicationObject_6(void) { return OD_PERSIST_COMM.x1A01_TPDOMappingParameter.applicationObject_6; }
+static inline uint32_t OD_get_x1A01_TPDOMappingParameter_applicationObject_7(void) { return OD_PERSIST_COMM.x1A01_TPDOMappingParameter.applicationObject_7; }
+static inline uint32_t OD_get_x1A01_TPDOMappingParameter_applicationObject_8(void) { return OD_PERSIST_COMM.x1A01_TPDOMappingParameter.applicationObject_8; }
+static inline uint8_t OD_get_x1A02_TPDOMappingParameter_numberOfMappedApplicationObjectsInPDO(void) { return OD_PERSIST_COMM.x1A02_TPDOMappingParameter.numberOfMappedApplicationObjectsInPDO; }
+static inline uint32_t OD_get_x1A02_TPDOMappingParameter_applicationObject_1(void) { return OD_PERSIST_COMM.x1A02_TPDOMappingParameter.applicationObject_1; }
+static inline uint32_t OD_get_x1A02_TPDOMappingParameter_applicationObject_2(void) { return OD_PERSIST_COMM.x1A02_TPDOMappingParameter.applicationObject_2; }
+static inline uint32_t OD_get_x1A02_TPDOMappingParameter_applicationObject_3(void) { return OD_PERSIST_COMM.x1A02_TPDOMappingParameter.applicationObject_3; }
+static inline uint32_t OD_get_x1A02_TPDOMappingParameter_applicationObject_4(void) { return OD_PERSIST_COMM.x1A02_TPDOMappingParameter.applicationObject_4; }
+static inline uint32_t OD_get_x1A02_TPDOMappingParameter_applicationObject_5(void) { return OD_PERSIST_COMM.x1A02_TPDOMappingParameter.applicationObject_5; }
+static inline uint32_t OD_get_x1A02_TPDOMappingParameter_applicationObject_6(void) { return OD_PERSIST_COMM.x1A02_TPDOMappingParameter.applicationObject_6; }
+static inline uint32_t OD_get_x1A02_TPDOMappingParameter_applicationObject_7(void) { return OD_PERSIST_COMM.x1A02_TPDOMappingParameter.applicationObject_7; }
+static inline uint32_t OD_get_x1A02_TPDOMappingParameter_applicationObject_8(void) { return OD_PERSIST_COMM.x1A02_TPDOMappingParameter.applicationObject_8; }
+static inline uint8_t OD_get_x1A03_TPDOMappingParameter_numberOfMappedApplicationObjectsInPDO(void) { return OD_PERSIST_COMM.x1A03_TPDOMappingParameter.numberOfMappedApplicationObjectsInPDO; }
+static inline uint32_t OD_get_x1A03_TPDOMappingParameter_applicationObject_1(void) { return OD_PERSIST_COMM.x1A03_TPDOMappingParameter.applicationObject_1; }
+static inline uint32_t OD_get_x1A03_TPDOMappingParameter_applicationObject_2(void) { return OD_PERSIST_COMM.x1A03_TPDOMappingParameter.applicationObject_2; }
+static inline uint32_t OD_get_x1A03_TPDOMappingParameter_applicationObject_3(void) { return OD_PERSIST_COMM.x1A03_TPDOMappingParameter.applicationObject_3; }
+static inline uint32_t OD_get_x1A03_TPDOMappingParameter_applicationObject_4(void) { return OD_PERSIST_COMM.x1A03_TPDOMappingParameter.applicationObject_4; }
+static inline uint32_t OD_get_x1A03_TPDOMappingParameter_applicationObject_5(void) { return OD_PERSIST_COMM.x1A03_TPDOMappingParameter.applicationObject_5; }
+static inline uint32_t OD_get_x1A03_TPDOMappingParameter_applicationObject_6(void) { return OD_PERSIST_COMM.x1A03_TPDOMappingParameter.applicationObject_6; }
+static inline uint32_t OD_get_x1A03_TPDOMappingParameter_applicationObject_7(void) { return OD_PERSIST_COMM.x1A03_TPDOMappingParameter.applicationObject_7; }
+static inline uint32_t OD_get_x1A03_TPDOMappingParameter_applicationObject_8(void) { return OD_PERSIST_COMM.x1A03_TPDOMappingParameter.applicationObject_8; }
+static inline uint8_t OD_get_x2100_profileProcess_highestSub_indexSupported(void) { return OD_RAM.x2100_profileProcess.highestSub_indexSupported; }
+static inline uint32_t OD_get_x2100_profileProcess_count(void) { return OD_RAM.x2100_profileProcess.count; }
+static inline uint32_t OD_get_x2100_profileProcess_minCycles(void) { return OD_RAM.x2100_profileProcess.minCycles; }
+static inline uint32_t OD_get_x2100_profileProcess_maxCycles(void) { return OD_RAM.x2100_profileProcess.maxCycles; }
+static inline uint32_t OD_get_x2100_profileProcess_averageCycles(void) { return OD_RAM.x2100_profileProcess.averageCycles; }
+static inline uint32_t OD_get_x2100_profileProcess_histogram_0(void) { return OD_RAM.x2100_profileProcess.histogram_0; }
+static inline uint32_t OD_get_x2100_profileProcess_histogram_1(void) { return OD_RAM.x2100_profileProcess.histogram_1; }
+static inline uint32_t OD_get_x2100_profileProcess_histogram_2(void) { return OD_RAM.x2100_profileProcess.histogram_2; }
+static inline uint32_t OD_get_x2100_profileProcess_histogram_3(void) { return OD_RAM.x2100_profileProcess.histogram_3; }
+static inline uint32_t OD_get_x2100_profileProcess_histogram_4(void) { return OD_RAM.x2100_profileProcess.histogram_4; }
+static inline uint32_t OD_get_x2100_profileProcess_histogram_5(void) { return OD_RAM.x2100_profileProcess.histogram_5; }
+static inline uint32_t OD_get_x2100_profileProcess_histogram_6(void) { return OD_RAM.x2100_profileProcess.histogram_6; }
+static inline uint32_t OD_get_x2100_profileProcess_histogram_7(void) { return OD_RAM.x2100_profileProcess.histogram_7; }
+static inline uint8_t OD_get_x2101_profileSYNC_highestSub_indexSupported(void) { return OD_RAM.x2101_profileSYNC.highestSub_indexSupported; }
+static inline uint32_t OD_get_x2101_profileSYNC_count(void) { return OD_RAM.x2101_profileSYNC.count; }
+static inline uint32_t OD_get_x2101_profileSYNC_minCycles(void) { return OD_RAM.x2101_profileSYNC.minCycles; }
+static inline uint32_t OD_get_x2101_profileSYNC_maxCycles(void) { return OD_RAM.x2101_profileSYNC.maxCycles; }
+static inline uint32_t OD_get_x2101_profileSYNC_averageCycles(void) { return OD_RAM.x2101_profileSYNC.averageCycles; }
+static inline uint32_t OD_get_x2101_profileSYNC_histogram_0(void) { return OD_RAM.x2101_profileSYNC.histogram_0; }
+static inline uint32_t OD_get_x2101_profileSYNC_histogram_1(void) { return OD_RAM.x2101_profileSYNC.histogram_1; }
+static inline uint32_t OD_get_x2101_profileSYNC_histogram_2(void) { return OD_RAM.x2101_profileSYNC.histogram_2; }
+static inline uint32_t OD_get_x2101_profileSYNC_histogram_3(void) { return OD_RAM.x2101_profileSYNC.histogram_3; }
+static inline uint32_t OD_get_x2101_profileSYNC_histogram_4(void) { return OD_RAM.x2101_profileSYNC.histogram_4; }
+static inline uint32_t OD_get_x2101_profileSYNC_histogram_5(void) { return OD_RAM.x2101_profileSYNC.histogram_5; }
+static inline uint32_t OD_get_x2101_profileSYNC_histogram_6(void) { return OD_RAM.x2101_profileSYNC.histogram_6; }
+static inline uint32_t OD_get_x2101_profileSYNC_histogram_7(void) { return OD_RAM.x2101_profileSYNC.histogram_7; }
+static inline uint8_t OD_get_x2102_profileRPDO_highestSub_indexSupported(void) { return OD_RAM.x2102_profileRPDO.highestSub_indexSupported; }
+static inline uint32_t OD_get_x2102_profileRPDO_count(void) { return OD_RAM.x2102_profileRPDO.count; }
+static inline uint32_t OD_get_x2102_profileRPDO_minCycles(void) { return OD_RAM.x2102_profileRPDO.minCycles; }
+static inline uint32_t OD_get_x2102_profileRPDO_maxCycles(void) { return OD_RAM.x2102_profileRPDO.maxCycles; }
+static inline uint32_t OD_get_x2102_profileRPDO_averageCycles(void) { return OD_RAM.x2102_profileRPDO.averageCycles; }
+static inline uint32_t OD_get_x2102_profileRPDO_histogram_0(void) { return OD_RAM.x2102_profileRPDO.histogram_0; }
+static inline uint32_t OD_get_x2102_profileRPDO_histogram_1(void) { return OD_RAM.x2102_profileRPDO.histogram_1; }
+static inline uint32_t OD_get_x2102_profileRPDO_histogram_2(void) { return OD_RAM.x2102_profileRPDO.histogram_2; }
+static inline uint32_t OD_get_x2102_profileRPDO_histogram_3(void) { return OD_RAM.x2102_profileRPDO.histogram_3; }
+static inline uint32_t OD_get_x2102_profileRPDO_histogram_4(void) { return OD_RAM.x2102_profileRPDO.histogram_4; }
+static inline uint32_t OD_get_x2102_profileRPDO_histogram_5(void) { return OD_RAM.x2102_profileRPDO.histogram_5; }
+static inline uint32_t OD_get_x2102_profileRPDO_histogram_6(void) { return OD_RAM.x2102_profileRPDO.histogram_6; }
+static inline uint32_t OD_get_x2102_profileRPDO_histogram_7(void) { return OD_RAM.x2102_profileRPDO.histogram_7; }
+static inline uint8_t OD_get_x2103_profileTPDO_highestSub_indexSupported(void) { return OD_RAM.x2103_profileTPDO.highestSub_indexSupported; }
+static inline uint32_t OD_get_x2103_profileTPDO_count(void) { return OD_RAM.x2103_profileTPDO.count; }
+static inline uint32_t OD_get_x2103_profileTPDO_minCycles(void) { return OD_RAM.x2103_profileTPDO.minCycles; }
+static inline uint32_t OD_get_x2103_profileTPDO_maxCycles(void) { return OD_RAM.x2103_profileTPDO.maxCycles; }
+static inline uint32_t OD_get_x2103_profileTPDO_averageCycles(void) { return OD_RAM.x2103_profileTPDO.averageCycles; }
+static inline uint32_t OD_get_x2103_profileTPDO_histogram_0(void) { return OD_RAM.x2103_profileTPDO.histogram_0; }
+static inline uint32_t OD_get_x2103_profileTPDO_histogram_1(void) { return OD_RAM.x2103_profileTPDO.histogram_1; }
+static inline uint32_t OD_get_x2103_profileTPDO_histogram_2(void) { return OD_RAM.x2103_profileTPDO.histogram_2; }
+static inline uint32_t OD_get_x2103_profileTPDO_histogram_3(void) { return OD_RAM.x2103_profileTPDO.histogram_3; }
+static inline uint32_t OD_get_x2103_profileTPDO_histogram_4(void) { return OD_RAM.x2103_profileTPDO.histogram_4; }
+static inline uint32_t OD_get_x2103_profileTPDO_histogram_5(void) { return OD_RAM.x2103_profileTPDO.histogram_5; }
+static inline uint32_t OD_get_x2103_profileTPDO_histogram_6(void) { return OD_RAM.x2103_profileTPDO.histogram_6; }
+static inline uint32_t OD_get_x2103_profileTPDO_histogram_7(void) { return OD_RAM.x2103_profileTPDO.histogram_7; }
+static inline uint8_t OD_get_x2104_profileCAN_RX_highestSub_indexSupported(void) { return OD_RAM.x2104_profileCAN_RX.highestSub_indexSupported; }
+static inline uint32_t OD_get_x2104_profileCAN_RX_count(void) { return OD_RAM.x2104_profileCAN_RX.count; }
+static inline uint32_t OD_get_x2104_profileCAN_RX_minCycles(void) { return OD_RAM.x2104_profileCAN_RX.minCycles; }
+static inline uint32_t OD_get_x2104_profileCAN_RX_maxCycles(void) { return OD_RAM.x2104_profileCAN_RX.maxCycles; }
+static inline uint32_t OD_get_x2104_profileCAN_RX_averageCycles(void) { return OD_RAM.x2104_profileCAN_RX.averageCycles; }
+static inline uint32_t OD_get_x2104_profileCAN_RX_histogram_0(void) { return OD_RAM.x2104_profileCAN_RX.histogram_0; }
+static inline uint32_t OD_get_x2104_profileCAN_RX_histogram_1(void) { return OD_RAM.x2104_profileCAN_RX.histogram_1; }
+static inline uint32_t OD_get_x2104_profileCAN_RX_histogram_2(void) { return OD_RAM.x2104_profileCAN_RX.histogram_2; }
+static inline uint32_t OD_get_x2104_profileCAN_RX_histogram_3(void) { return OD_RAM.x2104_profileCAN_RX.histogram_3; }
+static inline uint32_t OD_get_x2104_profileCAN_RX_histogram_4(void) { return OD_RAM.x2104_profileCAN_RX.histogram_4; }
+static inline uint32_t OD_get_x2104_profileCAN_RX_histogram_5(void) { return OD_RAM.x2104_profileCAN_RX.histogram_5; }
+static inline uint32_t OD_get_x2104_profileCAN_RX_histogram_6(void) { return OD_RAM.x2104_profileCAN_RX.histogram_6; }
+static inline uint32_t OD_get_x2104_profileCAN_RX_histogram_7(void) { return OD_RAM.x2104_profileCAN_RX.histogram_7; }
+static inline uint8_t OD_get_x2105_profileCAN_TX_highestSub_indexSupported(void) { return OD_RAM.x2105_profileCAN_TX.highestSub_indexSupported; }
+static inline uint32_t OD_get_x2105_profileCAN_TX_count(void) { return OD_RAM.x2105_profileCAN_TX.count; }
+static inline uint32_t OD_get_x2105_profileCAN_TX_minCycles(void) { return OD_RAM.x2105_profileCAN_TX.minCycles; }
+static inline uint32_t OD_get_x2105_profileCAN_TX_maxCycles(void) { return OD_RAM.x2105_profileCAN_TX.maxCycles; }
+static inline uint32_t OD_get_x2105_profileCAN_TX_averageCycles(void) { return OD_RAM.x2105_profileCAN_TX.averageCycles; }
+static inline uint32_t OD_get_x2105_profileCAN_TX_histogram_0(void) { return OD_RAM.x2105_profileCAN_TX.histogram_0; }
+static inline uint32_t OD_get_x2105_profileCAN_TX_histogram_1(void) { return OD_RAM.x2105_profileCAN_TX.histogram_1; }
+static inline uint32_t OD_get_x2105_profileCAN_TX_histogram_2(void) { return OD_RAM.x2105_profileCAN_TX.histogram_2; }
+static inline uint32_t OD_get_x2105_profileCAN_TX_histogram_3(void) { return OD_RAM.x2105_profileCAN_TX.histogram_3; }
+static inline uint32_t OD_get_x2105_profileCAN_TX_histogram_4(void) { return OD_RAM.x2105_profileCAN_TX.histogram_4; }
+static inline uint32_t OD_get_x2105_profileCAN_TX_histogram_5(void) { return OD_RAM.x2105_profileCAN_TX.histogram_5; }
+static inline uint32_t OD_get_x2105_profileCAN_TX_histogram_6(void) { return OD_RAM.x2105_profileCAN_TX.histogram_6; }
+static inline uint32_t OD_get_x2105_profileCAN_TX_histogram_7(void) { return OD_RAM.x2105_profileCAN_TX.histogram_7; }
+static inline uint8_t OD_get_x2106_profileSDOServer_highestSub_indexSupported(void) { return OD_RAM.x2106_profileSDOServer.highestSub_indexSupported; }
+static inline uint32_t OD_get_x2106_profileSDOServer_count(void) { return OD_RAM.x2106_profileSDOServer.count; }
+static inline uint32_t OD_get_x2106_profileSDOServer_minCycles(void) { return OD_RAM.x2106_profileSDOServer.minCycles; }
+static inline uint32_t OD_get_x2106_profileSDOServer_maxCycles(void) { return OD_RAM.x2106_profileSDOServer.maxCycles; }
+static inline uint32_t OD_get_x2106_profileSDOServer_averageCycles(void) { return OD_RAM.x2106_profileSDOServer.averageCycles; }
+static inline uint32_t OD_get_x2106_profileSDOServer_histogram_0(void) { return OD_RAM.x2106_profileSDOServer.histogram_0; }
+static inline uint32_t OD_get_x2106_profileSDOServer_histogram_1(void) { return OD_RAM.x2106_profileSDOServer.histogram_1; }
+static inline uint32_t OD_get_x2106_profileSDOServer_histogram_2(void) { return OD_RAM.x2106_profileSDOServer.histogram_2; }
+static inline uint32_t OD_get_x2106_profileSDOServer_histogram_3(void) { return OD_RAM.x2106_profileSDOServer.histogram_3; }
+static inline uint32_t OD_get_x2106_profileSDOServer_histogram_4(void) { return OD_RAM.x2106_profileSDOServer.histogram_4; }
+static inline uint32_t OD_get_x2106_profileSDOServer_histogram_5(void) { return OD_RAM.x2106_profileSDOServer.histogram_5; }
+static inline uint32_t OD_get_x2106_profileSDOServer_histogram_6(void) { return OD_RAM.x2106_profileSDOServer.histogram_6; }
+static inline uint32_t OD_get_x2106_profileSDOServer_histogram_7(void) { return OD_RAM.x2106_profileSDOServer.histogram_7; }
+static inline uint8_t OD_get_x2107_profileHBConsumer_highestSub_indexSupported(void) { return OD_RAM.x2107_profileHBConsumer.highestSub_indexSupported; }
+static inline uint32_t OD_get_x2107_profileHBConsumer_count(void) { return OD_RAM.x2107_profileHBConsumer.count; }
+static inline uint32_t OD_get_x2107_profileHBConsumer_minCycles(void) { return OD_RAM.x2107_profileHBConsumer.minCycles; }
+static inline uint32_t OD_get_x2107_profileHBConsumer_maxCycles(void) { return OD_RAM.x2107_profileHBConsumer.maxCycles; }
+static inline uint32_t OD_get_x2107_profileHBConsumer_averageCycles(void) { return OD_RAM.x2107_profileHBConsumer.averageCycles; }
+static inline uint32_t OD_get_x2107_profileHBConsumer_histogram_0(void) { return OD_RAM.x2107_profileHBConsumer.histogram_0; }
+static inline uint32_t OD_get_x2107_profileHBConsumer_histogram_1(void) { return OD_RAM.x2107_profileHBConsumer.histogram_1; }
+static inline uint32_t OD_get_x2107_profileHBConsumer_histogram_2(void) { return OD_RAM.x2107_profileHBConsumer.histogram_2; }
+static inline uint32_t OD_get_x2107_profileHBConsumer_histogram_3(void) { return OD_RAM.x2107_profileHBConsumer.histogram_3; }
+static inline uint32_t OD_get_x2107_profileHBConsumer_histogram_4(void) { return OD_RAM.x2107_profileHBConsumer.histogram_4; }
+static inline uint32_t OD_get_x2107_profileHBConsumer_histogram_5(void) { return OD_RAM.x2107_profileHBConsumer.histogram_5; }
+static inline uint32_t OD_get_x2107_profileHBConsumer_histogram_6(void) { return OD_RAM.x2107_profileHBConsumer.histogram_6; }
+static inline uint32_t OD_get_x2107_profileHBConsumer_histogram_7(void) { return OD_RAM.x2107_profileHBConsumer.histogram_7; }
 
 #endif /* OD_H */
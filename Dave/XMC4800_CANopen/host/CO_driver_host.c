@@ -0,0 +1,517 @@
+/**
+ * CANopen driver over an in-process virtual CAN bus (Linux host build)
+ *
+ * @file CO_driver_host.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 與 port/CO_driver_XMC4800.c 實作相同的 CO_driver.h 介面，CANptr 為 CO_vbus_t。
+ * 不在韌體中編譯 (.cproject 排除 host/)。
+ */
+#include <string.h>
+
+#include "301/CO_driver.h"
+#include "CO_driver_host.h"
+#include "CO_rx_dispatch.h"
+#include "CO_can_err.h"
+
+/******************************************************************************/
+void CO_vbus_init(CO_vbus_t *bus)
+{
+    memset(bus, 0, sizeof(*bus));
+}
+
+/******************************************************************************/
+void CO_vbus_setMonitor(CO_vbus_t *bus, CO_vbusMonitor_t monitor, void *object)
+{
+    bus->monitor = monitor;
+    bus->monitorObject = object;
+}
+
+/******************************************************************************/
+void CO_vbus_setDrop(CO_vbus_t *bus, CO_vbusDrop_t drop, void *object)
+{
+    bus->drop = drop;
+    bus->dropObject = object;
+}
+
+/* 放入匯流排佇列 */
+static bool_t vbus_push(CO_vbus_t *bus, CO_CANmodule_t *sender, uint16_t ident,
+                        uint8_t DLC, const uint8_t *data, bool_t syncFlag)
+{
+    if (bus->head - bus->tail >= CO_VBUS_QUEUE_SIZE) {
+        return false;
+    }
+
+    CO_vbusFrame_t *frame = &bus->queue[bus->head & (CO_VBUS_QUEUE_SIZE - 1U)];
+    frame->msg.ident = ident;
+    frame->msg.DLC = DLC;
+    memset(frame->msg.data, 0, sizeof(frame->msg.data));
+    if (data != NULL) {
+        memcpy(frame->msg.data, data, DLC);
+    }
+    frame->sender = sender;
+    frame->syncFlag = syncFlag;
+    frame->cancelled = false;
+    frame->queuedNs = bus->nowNs;
+    frame->startNs = bus->nowNs;
+    frame->endNs = bus->nowNs;
+    bus->head++;
+    return true;
+}
+
+/******************************************************************************/
+bool_t CO_vbus_inject(CO_vbus_t *bus, uint16_t ident, uint8_t DLC, const uint8_t *data)
+{
+    if (bus == NULL || ident > 0x7FFU || DLC > 8U) {
+        return false;
+    }
+    return vbus_push(bus, NULL, ident, DLC, data, false);
+}
+
+/* 傳送完成：依 txArray 順序接續送出等待中的緩衝區 */
+static void vbus_tx_complete(CO_vbus_t *bus, CO_CANmodule_t *CANmodule)
+{
+    for (uint16_t i = 0; i < CANmodule->txSize && CANmodule->CANtxCount != 0U; i++) {
+        CO_CANtx_t *buffer = &CANmodule->txArray[i];
+        if (!buffer->bufferFull) {
+            continue;
+        }
+        if (!vbus_push(bus, CANmodule, (uint16_t)buffer->ident, buffer->DLC, buffer->data, buffer->syncFlag)) {
+            return;
+        }
+        if (buffer->syncFlag) {
+            CANmodule->bufferInhibitFlag = true;
+        }
+        buffer->bufferFull = false;
+        CANmodule->CANtxCount--;
+    }
+}
+
+/* 傳遞給其他節點與監看回呼，之後視為發送者的傳送完成 */
+static void vbus_deliver(CO_vbus_t *bus, CO_vbusFrame_t *frame)
+{
+    uint16_t ident = (uint16_t)frame->msg.ident;
+    uint16_t nodeCount = bus->nodeCount;
+
+    if (bus->drop != NULL && bus->drop(bus->dropObject, frame)) {
+        bus->dropCount++;
+        nodeCount = 0;
+    }
+    for (uint16_t n = 0; n < nodeCount; n++) {
+        CO_CANmodule_t *CANmodule = bus->node[n];
+        if (CANmodule == frame->sender || !CANmodule->CANnormal) {
+            continue;
+        }
+        CO_CANrx_t *buffer = CO_CANrxDispatch_find(CANmodule, ident);
+        if (buffer != NULL && buffer->CANrx_callback != NULL) {
+            buffer->CANrx_callback(buffer->object, &frame->msg);
+            bus->rxCount++;
+        }
+    }
+    if (bus->monitor != NULL) {
+        bus->monitor(bus->monitorObject, frame);
+    }
+    bus->frameCount++;
+
+    if (frame->sender != NULL) {
+        frame->sender->firstCANtxMessage = false;
+        if (frame->syncFlag) {
+            frame->sender->bufferInhibitFlag = false;
+        }
+        vbus_tx_complete(bus, frame->sender);
+    }
+}
+
+/******************************************************************************/
+uint32_t CO_vbus_process(CO_vbus_t *bus)
+{
+    uint32_t delivered = 0;
+
+    while (bus->tail != bus->head) {
+        CO_vbusFrame_t frame = bus->queue[bus->tail & (CO_VBUS_QUEUE_SIZE - 1U)];
+        bus->tail++;
+        if (!frame.cancelled) {
+            vbus_deliver(bus, &frame);
+            delivered++;
+        }
+    }
+    return delivered;
+}
+
+/******************************************************************************/
+void CO_vbus_setBitrate(CO_vbus_t *bus, uint16_t kbps)
+{
+    bus->bitNs = (kbps > 0U) ? 1000000U / kbps : 0U;
+}
+
+/******************************************************************************/
+uint32_t CO_vbus_frameBits(const CO_CANrxMsg_t *msg)
+{
+    /* SOF、11-bit ID、RTR、IDE、r0、DLC、資料：最多 19 + 64 位元，再加 15 位元 CRC */
+    uint8_t bits[19U + 64U + 15U];
+    uint32_t n = 0;
+    uint8_t DLC = (msg->DLC > 8U) ? 8U : msg->DLC;
+
+    bits[n++] = 0U;
+    for (int i = 10; i >= 0; i--) {
+        bits[n++] = (uint8_t)((msg->ident >> i) & 1U);
+    }
+    bits[n++] = 0U;
+    bits[n++] = 0U;
+    bits[n++] = 0U;
+    for (int i = 3; i >= 0; i--) {
+        bits[n++] = (uint8_t)((DLC >> i) & 1U);
+    }
+    for (uint32_t b = 0; b < DLC; b++) {
+        for (int i = 7; i >= 0; i--) {
+            bits[n++] = (uint8_t)((msg->data[b] >> i) & 1U);
+        }
+    }
+
+    /* CRC-15 (x^15 + x^14 + x^10 + x^8 + x^7 + x^4 + x^3 + 1) */
+    uint16_t crc = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        uint16_t crcNext = (uint16_t)(bits[i] ^ ((crc >> 14) & 1U));
+        crc = (uint16_t)((crc << 1) & 0x7FFFU);
+        if (crcNext != 0U) {
+            crc ^= 0x4599U;
+        }
+    }
+    for (int i = 14; i >= 0; i--) {
+        bits[n++] = (uint8_t)((crc >> i) & 1U);
+    }
+
+    /* 位元填充：連續 5 個相同位元後插入反相位元，填充位元計入下一段 */
+    uint32_t stuff = 0;
+    uint32_t run = 1;
+    uint8_t last = bits[0];
+    for (uint32_t i = 1; i < n; i++) {
+        if (bits[i] == last) {
+            if (++run == 5U) {
+                stuff++;
+                last = (uint8_t)!last;
+                run = 1;
+            }
+        } else {
+            last = bits[i];
+            run = 1;
+        }
+    }
+
+    /* CRC 分隔 1、ACK 2、EOF 7、訊框間隔 3 */
+    return n + stuff + 13U;
+}
+
+/******************************************************************************/
+uint64_t CO_vbus_nextEvent(const CO_vbus_t *bus)
+{
+    if (bus->txActive) {
+        return bus->txFrame.endNs;
+    }
+    for (uint32_t i = bus->tail; i != bus->head; i++) {
+        if (!bus->queue[i & (CO_VBUS_QUEUE_SIZE - 1U)].cancelled) {
+            return bus->nowNs;
+        }
+    }
+    return UINT64_MAX;
+}
+
+/* 匯流排閒置：待送訊框中 COB-ID 最小者贏得仲裁 (相同 COB-ID 先放入者優先) */
+static bool_t vbus_arbitrate(CO_vbus_t *bus)
+{
+    uint32_t winner = bus->head;
+
+    for (uint32_t i = bus->tail; i != bus->head; i++) {
+        const CO_vbusFrame_t *frame = &bus->queue[i & (CO_VBUS_QUEUE_SIZE - 1U)];
+        if (!frame->cancelled && (winner == bus->head
+            || frame->msg.ident < bus->queue[winner & (CO_VBUS_QUEUE_SIZE - 1U)].msg.ident)) {
+            winner = i;
+        }
+    }
+    if (winner == bus->head) {
+        return false;
+    }
+
+    bus->txFrame = bus->queue[winner & (CO_VBUS_QUEUE_SIZE - 1U)];
+    bus->txFrame.startNs = bus->nowNs;
+    bus->txFrame.endNs = bus->nowNs + (uint64_t)CO_vbus_frameBits(&bus->txFrame.msg) * bus->bitNs;
+    bus->txActive = true;
+
+    /* 移出佇列，其餘訊框保持放入順序；低優先權訊框長期等待時佇列不會被已送出的位置佔滿 */
+    for (uint32_t i = winner; i + 1U != bus->head; i++) {
+        bus->queue[i & (CO_VBUS_QUEUE_SIZE - 1U)] = bus->queue[(i + 1U) & (CO_VBUS_QUEUE_SIZE - 1U)];
+    }
+    bus->head--;
+    while (bus->tail != bus->head && bus->queue[bus->tail & (CO_VBUS_QUEUE_SIZE - 1U)].cancelled) {
+        bus->tail++;
+    }
+
+    /* 佇列曾滿而等待的節點 */
+    if (bus->txPendCount != 0U) {
+        for (uint16_t n = 0; n < bus->nodeCount; n++) {
+            if (bus->node[n]->CANtxCount != 0U) {
+                vbus_tx_complete(bus, bus->node[n]);
+            }
+        }
+    }
+    return true;
+}
+
+/******************************************************************************/
+uint32_t CO_vbus_advance(CO_vbus_t *bus, uint64_t untilNs)
+{
+    uint32_t delivered = 0;
+
+    for (;;) {
+        if (!bus->txActive && !vbus_arbitrate(bus)) {
+            break;
+        }
+        if (bus->txFrame.endNs > untilNs) {
+            break;
+        }
+        bus->nowNs = bus->txFrame.endNs;
+        bus->busyNs += bus->txFrame.endNs - bus->txFrame.startNs;
+        bus->txActive = false;
+        CO_vbusFrame_t frame = bus->txFrame;
+        vbus_deliver(bus, &frame);
+        delivered++;
+    }
+    if (untilNs > bus->nowNs) {
+        bus->nowNs = untilNs;
+    }
+    return delivered;
+}
+
+/******************************************************************************/
+void CO_CANsetConfigurationMode(void *CANptr)
+{
+    (void)CANptr;
+}
+
+/******************************************************************************/
+void CO_CANsetNormalMode(CO_CANmodule_t *CANmodule)
+{
+    if (CANmodule != NULL) {
+        CANmodule->CANnormal = true;
+    }
+}
+
+/******************************************************************************/
+CO_ReturnError_t CO_CANmodule_init(
+    CO_CANmodule_t *CANmodule,
+    void *CANptr,
+    CO_CANrx_t rxArray[],
+    uint16_t rxSize,
+    CO_CANtx_t txArray[],
+    uint16_t txSize,
+    uint16_t CANbitRate)
+{
+    CO_vbus_t *bus = (CO_vbus_t *)CANptr;
+    uint16_t i;
+
+    (void)CANbitRate;
+    if (CANmodule == NULL || bus == NULL || rxArray == NULL || txArray == NULL) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    CANmodule->CANptr = CANptr;
+    CANmodule->rxArray = rxArray;
+    CANmodule->rxSize = rxSize;
+    CANmodule->txArray = txArray;
+    CANmodule->txSize = txSize;
+    CANmodule->CANerrorStatus = 0;
+    CANmodule->CANerrorEvents = 0;
+    CANmodule->CANnormal = false;
+    CANmodule->useCANrxFilters = true;
+    CANmodule->bufferInhibitFlag = false;
+    CANmodule->firstCANtxMessage = true;
+    CANmodule->CANtxCount = 0U;
+    CANmodule->errOld = 0U;
+
+    for (i = 0U; i < rxSize; i++) {
+        rxArray[i].ident = 0U;
+        rxArray[i].mask = 0xFFFFU;
+        rxArray[i].object = NULL;
+        rxArray[i].CANrx_callback = NULL;
+        rxArray[i].dave_lmo = NULL;
+        rxArray[i].lmo_index = (uint8_t)i;
+    }
+    for (i = 0U; i < txSize; i++) {
+        txArray[i].bufferFull = false;
+        txArray[i].queued = false;
+        txArray[i].txState = CO_CAN_TX_IDLE;
+        txArray[i].dave_lmo = NULL;
+        txArray[i].lmo_index = (uint8_t)i;
+    }
+    CO_CANrxDispatch_init(CANmodule);
+
+    /* 加入匯流排 (通訊重置時再次調用，不重複加入) */
+    for (i = 0U; i < bus->nodeCount; i++) {
+        if (bus->node[i] == CANmodule) {
+            return CO_ERROR_NO;
+        }
+    }
+    if (bus->nodeCount >= CO_VBUS_NODES_MAX) {
+        return CO_ERROR_OUT_OF_MEMORY;
+    }
+    bus->node[bus->nodeCount++] = CANmodule;
+    return CO_ERROR_NO;
+}
+
+/******************************************************************************/
+void CO_CANmodule_disable(CO_CANmodule_t *CANmodule)
+{
+    if (CANmodule == NULL) {
+        return;
+    }
+    CANmodule->CANnormal = false;
+
+    /* 離開匯流排 */
+    CO_vbus_t *bus = (CO_vbus_t *)CANmodule->CANptr;
+    if (bus != NULL) {
+        for (uint16_t i = 0; i < bus->nodeCount; i++) {
+            if (bus->node[i] == CANmodule) {
+                bus->node[i] = bus->node[--bus->nodeCount];
+                break;
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+CO_ReturnError_t CO_CANrxBufferInit(
+    CO_CANmodule_t *CANmodule,
+    uint16_t index,
+    uint16_t ident,
+    uint16_t mask,
+    bool_t rtr,
+    void *object,
+    void (*CANrx_callback)(void *object, void *message))
+{
+    (void)rtr;
+    if (CANmodule == NULL || object == NULL || CANrx_callback == NULL || index >= CANmodule->rxSize) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    CO_CANrx_t *buffer = &CANmodule->rxArray[index];
+    /* 與韌體相同：執行中重新設定時 RX 分派不可看到一半的設定 */
+    CO_LOCK_CAN_SEND(CANmodule);
+    uint16_t oldIdent = (uint16_t)buffer->ident;
+    buffer->object = object;
+    buffer->CANrx_callback = CANrx_callback;
+    buffer->ident = ident & 0x07FFU;
+    buffer->mask = (mask & 0x07FFU) | 0x0800U;
+    CO_CANrxDispatch_update(CANmodule, index, oldIdent);
+    CO_UNLOCK_CAN_SEND(CANmodule);
+
+    return CO_ERROR_NO;
+}
+
+/******************************************************************************/
+CO_CANtx_t *CO_CANtxBufferInit(
+    CO_CANmodule_t *CANmodule,
+    uint16_t index,
+    uint16_t ident,
+    bool_t rtr,
+    uint8_t noOfBytes,
+    bool_t syncFlag)
+{
+    (void)rtr;
+    if (CANmodule == NULL || index >= CANmodule->txSize) {
+        return NULL;
+    }
+
+    CO_CANtx_t *buffer = &CANmodule->txArray[index];
+    /* 匯流排運作中重新設定時，丟棄仍在等待的訊框 (與 XMC4800 驅動相同) */
+    CO_LOCK_CAN_SEND(CANmodule);
+    if (buffer->bufferFull) {
+        buffer->bufferFull = false;
+        CANmodule->CANtxCount--;
+    }
+    buffer->ident = ident & 0x07FFU;
+    buffer->DLC = noOfBytes;
+    buffer->syncFlag = syncFlag;
+    CO_UNLOCK_CAN_SEND(CANmodule);
+    return buffer;
+}
+
+/******************************************************************************/
+CO_ReturnError_t CO_CANsend(CO_CANmodule_t *CANmodule, CO_CANtx_t *buffer)
+{
+    CO_vbus_t *bus = (CO_vbus_t *)CANmodule->CANptr;
+    CO_ReturnError_t err = CO_ERROR_NO;
+
+    if (buffer->ident > 0x7FFU || buffer->DLC > 8U) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    CO_LOCK_CAN_SEND(CANmodule);
+    if (buffer->bufferFull) {
+        if (!CANmodule->firstCANtxMessage) {
+            /* Don't set error, if bootup message is still on buffers */
+            CO_CANerr_event(CANmodule, CO_CAN_ERRTX_OVERFLOW);
+        }
+        err = CO_ERROR_TX_OVERFLOW;
+    } else if (CANmodule->CANtxCount == 0U
+               && vbus_push(bus, CANmodule, (uint16_t)buffer->ident, buffer->DLC, buffer->data, buffer->syncFlag)) {
+        /* 佇列有空間且沒有更早等待的緩衝區 - 直接放上匯流排 */
+        if (buffer->syncFlag) {
+            CANmodule->bufferInhibitFlag = true;
+        }
+    } else {
+        /* 等待傳送完成 (CO_vbus_process()) */
+        buffer->bufferFull = true;
+        CANmodule->CANtxCount++;
+        bus->txPendCount++;
+    }
+    CO_UNLOCK_CAN_SEND(CANmodule);
+
+    return err;
+}
+
+/******************************************************************************/
+void CO_CANclearPendingSyncPDOs(CO_CANmodule_t *CANmodule)
+{
+    CO_vbus_t *bus = (CO_vbus_t *)CANmodule->CANptr;
+    uint32_t tpdoDeleted = 0U;
+
+    CO_LOCK_CAN_SEND(CANmodule);
+    /* 已在匯流排佇列中、尚未傳遞的同步 TPDO */
+    if (CANmodule->bufferInhibitFlag) {
+        for (uint32_t i = bus->tail; i != bus->head; i++) {
+            CO_vbusFrame_t *frame = &bus->queue[i & (CO_VBUS_QUEUE_SIZE - 1U)];
+            if (frame->sender == CANmodule && frame->syncFlag && !frame->cancelled) {
+                frame->cancelled = true;
+                tpdoDeleted = 1U;
+            }
+        }
+        CANmodule->bufferInhibitFlag = false;
+    }
+    /* 等待中的同步 TPDO */
+    if (CANmodule->CANtxCount != 0U) {
+        for (uint16_t i = 0; i < CANmodule->txSize; i++) {
+            CO_CANtx_t *buffer = &CANmodule->txArray[i];
+            if (buffer->bufferFull && buffer->syncFlag) {
+                buffer->bufferFull = false;
+                CANmodule->CANtxCount--;
+                tpdoDeleted = 2U;
+            }
+        }
+    }
+    if (tpdoDeleted != 0U) {
+        CO_CANerr_event(CANmodule, CO_CAN_ERRTX_PDO_LATE);
+    }
+    CO_UNLOCK_CAN_SEND(CANmodule);
+}
+
+/******************************************************************************/
+void CO_CANmodule_process(CO_CANmodule_t *CANmodule)
+{
+    /* 虛擬匯流排沒有匯流排錯誤；溢位與 TPDO 逾時事件與韌體相同 (CO_can_err.h) */
+    if (CANmodule != NULL) {
+        CO_LOCK_CAN_SEND(CANmodule);
+        CO_CANerr_process(CANmodule);
+        CO_UNLOCK_CAN_SEND(CANmodule);
+    }
+}
@@ -0,0 +1,163 @@
+/**
+ * Virtual CAN bus for the Linux host build of the CANopen stack
+ *
+ * @file CO_driver_host.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * CO_driver_host.c 以行程內的共享記憶體匯流排實作 CO_driver.h：
+ * CO_CANinit() 的 CANptr 傳入 CO_vbus_t，同一個匯流排可掛多個節點 (CO_t)。
+ * CO_CANsend() 只把訊框放入匯流排佇列，傳遞給其他所有節點的接收回呼
+ * (發送者不收到自己的訊框，與 CAN 控制器相同) 後視為傳送完成，接續送出等待中的傳送緩衝區。
+ * 兩種傳遞方式：
+ *  - CO_vbus_process()：立即依送出順序傳遞 (功能測試)
+ *  - CO_vbus_advance()：虛擬時間 (ns)，匯流排閒置時以 COB-ID 仲裁，最小者先送，
+ *    訊框長度依位元填充計算 (CO_vbus_frameBits())，傳遞時間為訊框結束
+ * CO_vbus_setDrop() 注入訊框遺失 (所有接收者都收不到)，用於協定的重送測試。
+ * 全部在呼叫者的執行緒中執行，沒有計時器或執行緒，模擬結果完全可重現。
+ * CO_CANmodule_t 與韌體相同 (port/CO_driver_target.h)，接收分派使用 CO_rx_dispatch.c。
+ */
+
+#ifndef CO_DRIVER_HOST_H
+#define CO_DRIVER_HOST_H
+
+#include "CO_driver_target.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 匯流排上的節點數上限 */
+#ifndef CO_VBUS_NODES_MAX
+#define CO_VBUS_NODES_MAX               32U
+#endif
+
+/* 匯流排佇列容量 (訊框數) - 必須是 2 的次方 */
+#ifndef CO_VBUS_QUEUE_SIZE
+#define CO_VBUS_QUEUE_SIZE              256U
+#endif
+
+/* 佇列中的訊框 */
+typedef struct {
+    CO_CANrxMsg_t           msg;
+    CO_CANmodule_t         *sender;         /* NULL = CO_vbus_inject() */
+    bool_t                  syncFlag;       /* 同步 TPDO - CO_CANclearPendingSyncPDOs() 可取消 */
+    bool_t                  cancelled;      /* 已取消或已開始傳送 */
+    uint64_t                queuedNs;       /* 放入佇列的虛擬時間 */
+    uint64_t                startNs;        /* 贏得仲裁 (CO_vbus_advance()) */
+    uint64_t                endNs;          /* 訊框結束 = 傳遞時間 */
+} CO_vbusFrame_t;
+
+/* 每個傳遞的訊框呼叫一次 (匯流排監看，例如測試或記錄) */
+typedef void (*CO_vbusMonitor_t)(void *object, const CO_vbusFrame_t *frame);
+
+/* 故障注入：回傳 true 時接收者都收不到該訊框 (接收溢位 / 雜訊)，發送者仍視為傳送完成 */
+typedef bool_t (*CO_vbusDrop_t)(void *object, const CO_vbusFrame_t *frame);
+
+/* 虛擬匯流排 - head / tail 為自由遞增的訊框數 */
+typedef struct {
+    CO_vbusFrame_t          queue[CO_VBUS_QUEUE_SIZE];
+    uint32_t                head;
+    uint32_t                tail;
+    CO_CANmodule_t         *node[CO_VBUS_NODES_MAX];
+    uint16_t                nodeCount;
+    CO_vbusMonitor_t        monitor;
+    void                   *monitorObject;
+    CO_vbusDrop_t           drop;
+    void                   *dropObject;
+    uint32_t                dropCount;      /* 故障注入丟棄的訊框數 */
+    uint32_t                frameCount;     /* 已傳遞的訊框數 */
+    uint32_t                rxCount;        /* 呼叫的接收回呼數 */
+    uint32_t                txPendCount;    /* 佇列滿而等待的 CO_CANsend() 次數 */
+
+    /* 虛擬時間 - CO_vbus_advance() */
+    uint32_t                bitNs;          /* 位元時間，0 = 未設定位元率 */
+    uint64_t                nowNs;
+    bool_t                  txActive;       /* 匯流排上正在傳送 txFrame */
+    CO_vbusFrame_t          txFrame;
+    uint64_t                busyNs;         /* 累計匯流排佔用時間 */
+} CO_vbus_t;
+
+/**
+ * @brief 初始化 (清空) 匯流排 - 節點在 CO_CANmodule_init() 時加入
+ * @param bus 匯流排
+ */
+void CO_vbus_init(CO_vbus_t *bus);
+
+/**
+ * @brief 設定匯流排監看回呼
+ * @param bus 匯流排
+ * @param monitor 回呼，NULL 取消
+ * @param object 回呼的第一個參數
+ */
+void CO_vbus_setMonitor(CO_vbus_t *bus, CO_vbusMonitor_t monitor, void *object);
+
+/**
+ * @brief 設定故障注入回呼 - 在傳遞前對每個訊框呼叫，監看回呼仍收到被丟棄的訊框
+ * @param bus 匯流排
+ * @param drop 回呼，NULL 取消
+ * @param object 回呼的第一個參數
+ */
+void CO_vbus_setDrop(CO_vbus_t *bus, CO_vbusDrop_t drop, void *object);
+
+/**
+ * @brief 從匯流排外部送出訊框 (測試工具、主站模擬)
+ * @param bus 匯流排
+ * @param ident 11-bit COB-ID
+ * @param DLC 資料長度
+ * @param data 資料，可為 NULL (DLC = 0)
+ * @return false: 佇列已滿
+ */
+bool_t CO_vbus_inject(CO_vbus_t *bus, uint16_t ident, uint8_t DLC, const uint8_t *data);
+
+/**
+ * @brief 設定位元率 - CO_vbus_advance() 的訊框時間
+ * @param bus 匯流排
+ * @param kbps 10 ~ 1000 kbit/s
+ */
+void CO_vbus_setBitrate(CO_vbus_t *bus, uint16_t kbps);
+
+/**
+ * @brief 標準訊框 (11-bit) 在匯流排上的位元數
+ *
+ * SOF 到 CRC 依實際內容計算位元填充，加上 CRC/ACK 分隔、EOF 與 3 位元訊框間隔。
+ * @param msg 訊框
+ * @return 位元數 (資料 0 byte: 47 ~ 55，8 byte: 111 ~ 135)
+ */
+uint32_t CO_vbus_frameBits(const CO_CANrxMsg_t *msg);
+
+/**
+ * @brief 下一個匯流排事件的虛擬時間
+ * @param bus 匯流排
+ * @return 傳送中訊框的結束時間；閒置且有待送訊框時為 nowNs；否則 UINT64_MAX
+ */
+uint64_t CO_vbus_nextEvent(const CO_vbus_t *bus);
+
+/**
+ * @brief 虛擬時間前進到 untilNs - 仲裁、傳送並傳遞在此之前結束的訊框
+ * @param bus 匯流排 (須先 CO_vbus_setBitrate())
+ * @param untilNs 目標時間，不可早於 nowNs
+ * @return 傳遞的訊框數
+ */
+uint32_t CO_vbus_advance(CO_vbus_t *bus, uint64_t untilNs);
+
+/**
+ * @brief 傳遞佇列中的所有訊框，包括傳遞過程中新送出的訊框
+ * @param bus 匯流排
+ * @return 傳遞的訊框數
+ */
+uint32_t CO_vbus_process(CO_vbus_t *bus);
+
+/**
+ * @brief 佇列中尚未傳遞的訊框數
+ */
+static inline uint32_t CO_vbus_pending(const CO_vbus_t *bus)
+{
+    return bus->head - bus->tail;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_DRIVER_HOST_H */
@@ -0,0 +1,69 @@
+/**
+ * CANopen node bring-up for host simulations on the virtual CAN bus
+ *
+ * @file CO_host_node.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+#include "CO_host_node.h"
+#include "OD.h"
+
+/******************************************************************************/
+CO_t *CO_hostNode_new(CO_vbus_t *bus, uint8_t nodeId, uint32_t *errInfo)
+{
+    uint32_t heapMemoryUsed, info = 0;
+    uint16_t bitRate = 500;
+    uint8_t pendingNodeId = nodeId;
+    CO_t *co = CO_new(NULL, &heapMemoryUsed);
+
+    if (co == NULL) {
+        return NULL;
+    }
+
+    CO_LSS_address_t lssAddress = {.identity = {
+        .vendorID = OD_PERSIST_COMM.x1018_identity.vendor_ID,
+        .productCode = OD_PERSIST_COMM.x1018_identity.productCode,
+        .revisionNumber = OD_PERSIST_COMM.x1018_identity.revisionNumber,
+        .serialNumber = nodeId}};
+    if (CO_CANinit(co, bus, bitRate) != CO_ERROR_NO
+        || CO_LSSinit(co, &lssAddress, &pendingNodeId, &bitRate) != CO_ERROR_NO
+        || CO_CANopenInit(co, NULL, NULL, OD, NULL, CO_HOST_NMT_CONTROL, CO_HOST_FIRST_HB_TIME,
+                          CO_HOST_SDO_SRV_TIMEOUT_TIME, CO_HOST_SDO_CLI_TIMEOUT_TIME,
+                          CO_HOST_SDO_CLI_BLOCK, pendingNodeId, &info) != CO_ERROR_NO
+        || CO_CANopenInitPDO(co, co->em, OD, pendingNodeId, &info) != CO_ERROR_NO) {
+        if (errInfo != NULL) {
+            *errInfo = info;
+        }
+        CO_delete(co);
+        return NULL;
+    }
+
+    CO_CANsetNormalMode(co->CANmodule);
+    return co;
+}
+
+/******************************************************************************/
+bool_t CO_hostNode_rt(CO_t *co, uint32_t timeDifference_us)
+{
+    bool_t syncWas = false;
+
+    if (co->nodeIdUnconfigured || !co->CANmodule->CANnormal) {
+        return false;
+    }
+#if (CO_CONFIG_SYNC) & CO_CONFIG_SYNC_ENABLE
+    CO_PROF_BEGIN(CO_PROF_SYNC);
+    syncWas = CO_process_SYNC(co, timeDifference_us, NULL);
+    CO_PROF_END(CO_PROF_SYNC);
+#endif
+#if (CO_CONFIG_PDO) & CO_CONFIG_RPDO_ENABLE
+    CO_PROF_BEGIN(CO_PROF_RPDO);
+    CO_process_RPDO(co, syncWas, timeDifference_us, NULL);
+    CO_PROF_END(CO_PROF_RPDO);
+#endif
+#if (CO_CONFIG_PDO) & CO_CONFIG_TPDO_ENABLE
+    CO_PROF_BEGIN(CO_PROF_TPDO);
+    CO_process_TPDO(co, syncWas, timeDifference_us, NULL);
+    CO_PROF_END(CO_PROF_TPDO);
+#endif
+    return syncWas;
+}
@@ -0,0 +1,52 @@
+/**
+ * CANopen node bring-up for host simulations on the virtual CAN bus
+ *
+ * @file CO_host_node.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 與 main.c canopen_app_init() 相同的初始化順序與參數 (CO_new、CO_CANinit、
+ * CO_LSSinit、CO_CANopenInit、CO_CANopenInitPDO)，CANptr 為 CO_vbus_t。
+ * 節點共用 application/OD.c (韌體未啟用 CO_MULTIPLE_OD)：OD 變數相同，
+ * OD 擴充 (例如寫入 0x1017 時更新心跳週期) 屬於最後初始化的節點。
+ */
+
+#ifndef CO_HOST_NODE_H
+#define CO_HOST_NODE_H
+
+#include "CANopen.h"
+#include "CO_driver_host.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 與 main.c 相同的 CO_CANopenInit() 參數 */
+#define CO_HOST_NMT_CONTROL             (CO_NMT_STARTUP_TO_OPERATIONAL | CO_NMT_ERR_ON_ERR_REG | CO_ERR_REG_GENERIC_ERR | CO_ERR_REG_COMMUNICATION)
+#define CO_HOST_FIRST_HB_TIME           500
+#define CO_HOST_SDO_SRV_TIMEOUT_TIME    1000
+#define CO_HOST_SDO_CLI_TIMEOUT_TIME    500
+#define CO_HOST_SDO_CLI_BLOCK           false
+
+/**
+ * @brief 建立節點並掛上匯流排，進入 CAN 正常模式
+ * @param bus 匯流排
+ * @param nodeId 1 ~ 127，同時作為 LSS 序號
+ * @param errInfo [out] CO_CANopenInit() 的錯誤資訊，可為 NULL
+ * @return 節點，失敗為 NULL
+ */
+CO_t *CO_hostNode_new(CO_vbus_t *bus, uint8_t nodeId, uint32_t *errInfo);
+
+/**
+ * @brief RT slot 處理 - SYNC/RPDO/TPDO (與 canopen_rt_process() 相同)
+ * @param co 節點
+ * @param timeDifference_us 距上次處理的時間
+ * @return 本次處理了 SYNC
+ */
+bool_t CO_hostNode_rt(CO_t *co, uint32_t timeDifference_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_HOST_NODE_H */
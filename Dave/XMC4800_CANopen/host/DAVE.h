@@ -0,0 +1,67 @@
+/**
+ * Host stub of DAVE.h for building port/ modules on Linux
+ *
+ * @file DAVE.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * host/ 目錄放在 include 路徑最前面，取代 DAVE 產生的 DAVE.h。
+ * 只提供 port/CO_driver_target.h 需要的 CMSIS 內建函數，主機端為單執行緒，
+ * PRIMASK 操作為空實作；BASEPRI 以一般變數模擬 (host_basepri())，供 CO_lock.h 測試。
+ * CO_CAN_CYCLES() 以 CLOCK_MONOTONIC 奈秒取代 DWT CYCCNT (可由編譯選項替換為模擬時鐘)；
+ * SCB->ICSR (PendSV 觸發) 由使用的程式定義 host_scb。
+ */
+
+#ifndef DAVE_H
+#define DAVE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+static inline void __disable_irq(void) {}
+static inline void __enable_irq(void) {}
+static inline uint32_t __get_PRIMASK(void) { return 0U; }
+static inline void __set_PRIMASK(uint32_t priMask) { (void)priMask; }
+
+#define __NVIC_PRIO_BITS    6U
+
+/* 模擬的 BASEPRI 暫存器 (每個編譯單元一份) */
+static inline uint32_t *host_basepri(void)
+{
+    static uint32_t basepri;
+    return &basepri;
+}
+static inline uint32_t __get_BASEPRI(void) { return *host_basepri(); }
+static inline void __set_BASEPRI(uint32_t basePri) { *host_basepri() = basePri & 0xFFU; }
+static inline void __set_BASEPRI_MAX(uint32_t basePri)
+{
+    /* 只能提高遮罩 (數值變小)，0 表示不遮罩 */
+    basePri &= 0xFFU;
+    if (basePri != 0U && (*host_basepri() == 0U || basePri < *host_basepri())) {
+        *host_basepri() = basePri;
+    }
+}
+
+/* 模擬的 SCB - 只有 ICSR，供 CO_RT_TRIGGER() 使用 */
+typedef struct {
+    volatile uint32_t       ICSR;
+} host_SCB_t;
+extern host_SCB_t host_scb;
+#define SCB                         (&host_scb)
+#define SCB_ICSR_PENDSVSET_Msk      (1UL << 28)
+
+/* 模擬時鐘 - 以 -DCO_CAN_CYCLES()=host_sim_cycles 編譯的程式定義 */
+extern volatile uint32_t host_sim_cycles;
+
+static inline uint32_t host_cycles(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+}
+#ifndef CO_CAN_CYCLES
+#define CO_CAN_CYCLES()     host_cycles()
+#endif
+
+#endif /* DAVE_H */
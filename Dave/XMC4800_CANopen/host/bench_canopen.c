@@ -0,0 +1,748 @@
+/**
+ * Throughput and latency benchmark of the CANopen protocol engines
+ *
+ * @file bench_canopen.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 直接以 CANopenNode 的 SDO/PDO/EMCY/HB 物件 (不經過 CO_t) 在 CO_vbus_t 上量測：
+ *  - SDO 伺服器 (節點 1) / 客戶端 (節點 2)：快速、分段、區塊上傳與下載
+ *  - TPDO (節點 1) -> RPDO (節點 2)：8 x 8 bit、2 x 32 bit 與混合映射 (自訂 IO、部分映射、dummy)
+ *  - 狀態變化 TPDO：無改變時的比較成本、改變時傳送、禁止時間、OD_set_value() 要求
+ *  - EMCY：CO_errorReport() / CO_errorReset() 與 CO_EM_process()
+ *  - 心跳消費者：1 ~ 127 個監看節點，每輪接收每個節點一個心跳並執行 CO_HBconsumer_process()
+ * 每個操作的執行時間 (ns，含匯流排傳遞) 取 p50/p99；匯流排效率 = 資料位元 / 訊框位元
+ * (含位元填充，CO_vbus_frameBits())。
+ * 結果以 JSON 輸出到 stdout 或 -o 檔案，用於比較不同版本的效能；檢查結果輸出到 stderr。
+ * 使用獨立的物件字典 (本檔案)，SDO 區塊傳輸與客戶端以 Makefile 的 BENCH_CONFIG 啟用。
+ *
+ * 使用方式: bench_canopen [-o file.json] [-s iteration scale]
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define OD_DEFINITION
+#include "301/CO_ODinterface.h"
+#include "301/CO_Emergency.h"
+#include "301/CO_HBconsumer.h"
+#include "301/CO_SDOserver.h"
+#include "301/CO_SDOclient.h"
+#include "301/CO_PDO.h"
+#include "CO_driver_host.h"
+
+#define NODE_SRV                1U          /* SDO 伺服器、TPDO、EMCY 生產者 */
+#define NODE_CLI                2U          /* SDO 客戶端、RPDO、心跳消費者 */
+#define BLOB_SIZE               1024U       /* 分段 / 區塊傳輸的物件大小 */
+#define HB_NODES_MAX            127U
+#define SDO_TIMEOUT_MS          1000U
+#define RESULTS_MAX             32U
+
+/* CO_CANmodule_t 緩衝區索引 (兩個節點相同) */
+#define RX_SDO_SRV              0U
+#define RX_SDO_CLI              1U
+#define RX_RPDO                 2U
+#define RX_HB_CONS              3U
+#define RX_SIZE                 (RX_HB_CONS + HB_NODES_MAX)
+#define TX_SDO_SRV              0U
+#define TX_SDO_CLI              1U
+#define TX_TPDO                 2U
+#define TX_EMCY                 3U
+#define TX_SIZE                 4U
+
+#define CHECK(cond, ...) do { if (!(cond)) { fprintf(stderr, "FAIL: " __VA_ARGS__); fprintf(stderr, "\n"); failures++; } } while (0)
+
+/******************************************************************************/
+/* 物件字典 */
+typedef struct {
+    uint8_t                 highestSub;
+    uint32_t                COB_ID;
+    uint8_t                 transmissionType;
+    uint16_t                inhibitTime;
+    uint16_t                eventTimer;
+    uint8_t                 SYNCStartValue;
+} benchPdoComm_t;
+
+typedef struct {
+    uint8_t                 count;
+    uint32_t                object[8];
+} benchPdoMap_t;
+
+static struct {
+    uint8_t                 x1001_errorRegister;
+    uint8_t                 x1003_count;
+    uint32_t                x1003_preDefinedErrorField[16];
+    uint32_t                x1014_COB_ID_EMCY;
+    uint8_t                 x1016_count;
+    uint32_t                x1016_consumerHeartbeatTime[HB_NODES_MAX];
+    struct {
+        uint8_t             highestSub;
+        uint32_t            COB_IDClientToServer;
+        uint32_t            COB_IDServerToClient;
+        uint8_t             nodeIdOfServer;
+    } x1280;
+    benchPdoComm_t          x1400;
+    benchPdoMap_t           x1600;
+    benchPdoComm_t          x1800;
+    benchPdoMap_t           x1A00;
+    uint32_t                x2000_u32;
+    uint8_t                 x2001_blob[BLOB_SIZE];
+    uint8_t                 x2100_count;
+    uint8_t                 x2100_txU8[8];
+    uint8_t                 x2101_count;
+    uint8_t                 x2101_rxU8[8];
+    uint8_t                 x2102_count;
+    uint32_t                x2102_txU32[2];
+    uint8_t                 x2103_count;
+    uint32_t                x2103_rxU32[2];
+} bod;
+
+static CO_PROGMEM OD_obj_var_t o_1001 = { &bod.x1001_errorRegister, ODA_SDO_R | ODA_TPDO, 1 };
+static CO_PROGMEM OD_obj_array_t o_1003 = {
+    &bod.x1003_count, &bod.x1003_preDefinedErrorField[0], ODA_SDO_RW, ODA_SDO_R | ODA_MB, 4, sizeof(uint32_t) };
+static CO_PROGMEM OD_obj_var_t o_1014 = { &bod.x1014_COB_ID_EMCY, ODA_SDO_RW | ODA_MB, 4 };
+static CO_PROGMEM OD_obj_array_t o_1016 = {
+    &bod.x1016_count, &bod.x1016_consumerHeartbeatTime[0], ODA_SDO_R, ODA_SDO_RW | ODA_MB, 4, sizeof(uint32_t) };
+static CO_PROGMEM OD_obj_record_t o_1280[4] = {
+    { &bod.x1280.highestSub, 0, ODA_SDO_R, 1 },
+    { &bod.x1280.COB_IDClientToServer, 1, ODA_SDO_RW | ODA_MB, 4 },
+    { &bod.x1280.COB_IDServerToClient, 2, ODA_SDO_RW | ODA_MB, 4 },
+    { &bod.x1280.nodeIdOfServer, 3, ODA_SDO_RW, 1 } };
+static CO_PROGMEM OD_obj_record_t o_1400[4] = {
+    { &bod.x1400.highestSub, 0, ODA_SDO_R, 1 },
+    { &bod.x1400.COB_ID, 1, ODA_SDO_RW | ODA_MB, 4 },
+    { &bod.x1400.transmissionType, 2, ODA_SDO_RW, 1 },
+    { &bod.x1400.eventTimer, 5, ODA_SDO_RW | ODA_MB, 2 } };
+static CO_PROGMEM OD_obj_array_t o_1600 = {
+    &bod.x1600.count, &bod.x1600.object[0], ODA_SDO_RW, ODA_SDO_RW | ODA_MB, 4, sizeof(uint32_t) };
+static CO_PROGMEM OD_obj_record_t o_1800[6] = {
+    { &bod.x1800.highestSub, 0, ODA_SDO_R, 1 },
+    { &bod.x1800.COB_ID, 1, ODA_SDO_RW | ODA_MB, 4 },
+    { &bod.x1800.transmissionType, 2, ODA_SDO_RW, 1 },
+    { &bod.x1800.inhibitTime, 3, ODA_SDO_RW | ODA_MB, 2 },
+    { &bod.x1800.eventTimer, 5, ODA_SDO_RW | ODA_MB, 2 },
+    { &bod.x1800.SYNCStartValue, 6, ODA_SDO_RW, 1 } };
+static CO_PROGMEM OD_obj_array_t o_1A00 = {
+    &bod.x1A00.count, &bod.x1A00.object[0], ODA_SDO_RW, ODA_SDO_RW | ODA_MB, 4, sizeof(uint32_t) };
+static CO_PROGMEM OD_obj_var_t o_2000 = { &bod.x2000_u32, ODA_SDO_RW | ODA_MB, 4 };
+static CO_PROGMEM OD_obj_var_t o_2001 = { &bod.x2001_blob[0], ODA_SDO_RW, BLOB_SIZE };
+static CO_PROGMEM OD_obj_array_t o_2100 = {
+    &bod.x2100_count, &bod.x2100_txU8[0], ODA_SDO_R, ODA_SDO_RW | ODA_TPDO, 1, sizeof(uint8_t) };
+static CO_PROGMEM OD_obj_array_t o_2101 = {
+    &bod.x2101_count, &bod.x2101_rxU8[0], ODA_SDO_R, ODA_SDO_RW | ODA_RPDO, 1, sizeof(uint8_t) };
+static CO_PROGMEM OD_obj_array_t o_2102 = {
+    &bod.x2102_count, &bod.x2102_txU32[0], ODA_SDO_R, ODA_SDO_RW | ODA_TPDO | ODA_MB, 4, sizeof(uint32_t) };
+static CO_PROGMEM OD_obj_array_t o_2103 = {
+    &bod.x2103_count, &bod.x2103_rxU32[0], ODA_SDO_R, ODA_SDO_RW | ODA_RPDO | ODA_MB, 4, sizeof(uint32_t) };
+
+static OD_entry_t benchODList[] = {
+    {0x1001, 0x01, ODT_VAR, (void *)&o_1001, NULL},
+    {0x1003, 0x11, ODT_ARR, (void *)&o_1003, NULL},
+    {0x1014, 0x01, ODT_VAR, (void *)&o_1014, NULL},
+    {0x1016, HB_NODES_MAX + 1U, ODT_ARR, (void *)&o_1016, NULL},
+    {0x1280, 0x04, ODT_REC, (void *)&o_1280, NULL},
+    {0x1400, 0x04, ODT_REC, (void *)&o_1400, NULL},
+    {0x1600, 0x09, ODT_ARR, (void *)&o_1600, NULL},
+    {0x1800, 0x06, ODT_REC, (void *)&o_1800, NULL},
+    {0x1A00, 0x09, ODT_ARR, (void *)&o_1A00, NULL},
+    {0x2000, 0x01, ODT_VAR, (void *)&o_2000, NULL},
+    {0x2001, 0x01, ODT_VAR, (void *)&o_2001, NULL},
+    {0x2100, 0x09, ODT_ARR, (void *)&o_2100, NULL},
+    {0x2101, 0x09, ODT_ARR, (void *)&o_2101, NULL},
+    {0x2102, 0x03, ODT_ARR, (void *)&o_2102, NULL},
+    {0x2103, 0x03, ODT_ARR, (void *)&o_2103, NULL},
+    {0x0000, 0x00, 0, NULL, NULL}
+};
+
+static OD_t benchOD = { (sizeof(benchODList) / sizeof(benchODList[0])) - 1U, &benchODList[0] };
+
+static void bod_defaults(void)
+{
+    memset(&bod, 0, sizeof(bod));
+    bod.x1003_count = 0;
+    bod.x1014_COB_ID_EMCY = 0x80U;
+    bod.x1016_count = HB_NODES_MAX;
+    bod.x1280.highestSub = 3;
+    bod.x1280.COB_IDClientToServer = 0x600U + NODE_SRV;
+    bod.x1280.COB_IDServerToClient = 0x580U + NODE_SRV;
+    bod.x1280.nodeIdOfServer = NODE_SRV;
+    bod.x1400.highestSub = 5;
+    bod.x1400.COB_ID = 0x180U + NODE_SRV;     /* 節點 1 的 TPDO */
+    bod.x1400.transmissionType = 254;
+    bod.x1800.highestSub = 6;
+    bod.x1800.COB_ID = 0x180U + NODE_SRV;
+    bod.x1800.transmissionType = 254;
+    bod.x2100_count = 8;
+    bod.x2101_count = 8;
+    bod.x2102_count = 2;
+    bod.x2103_count = 2;
+}
+
+/******************************************************************************/
+/* 節點與匯流排 */
+typedef struct {
+    CO_CANmodule_t          CANmodule;
+    CO_CANrx_t              rxArray[RX_SIZE];
+    CO_CANtx_t              txArray[TX_SIZE];
+} benchNode_t;
+
+static CO_vbus_t bus;
+static benchNode_t nodeSrv, nodeCli;
+static CO_EM_t em;
+static CO_EM_fifo_t emFifo[16];
+static CO_SDOserver_t sdoSrv;
+static CO_SDOclient_t sdoCli;
+static CO_TPDO_t tpdo;
+static CO_RPDO_t rpdo;
+static CO_HBconsumer_t hbCons;
+static CO_HBconsNode_t hbNodes[HB_NODES_MAX];
+
+/* 匯流排監看：訊框數與位元數 */
+static struct {
+    uint64_t                frames;
+    uint64_t                bits;
+} busStat;
+
+static void bus_monitor(void *object, const CO_vbusFrame_t *frame)
+{
+    (void)object;
+    busStat.frames++;
+    busStat.bits += CO_vbus_frameBits(&frame->msg);
+}
+
+static int bench_setup(void)
+{
+    uint32_t errInfo = 0;
+    CO_ReturnError_t err;
+
+    bod_defaults();
+    CO_vbus_init(&bus);
+    CO_vbus_setMonitor(&bus, bus_monitor, NULL);
+    err = CO_CANmodule_init(&nodeSrv.CANmodule, &bus, nodeSrv.rxArray, RX_SIZE, nodeSrv.txArray, TX_SIZE, 500);
+    if (err == CO_ERROR_NO) {
+        err = CO_CANmodule_init(&nodeCli.CANmodule, &bus, nodeCli.rxArray, RX_SIZE, nodeCli.txArray, TX_SIZE, 500);
+    }
+    if (err == CO_ERROR_NO) {
+        err = CO_EM_init(&em, &nodeSrv.CANmodule, OD_find(&benchOD, 0x1001), emFifo, 16,
+                         OD_find(&benchOD, 0x1014), TX_EMCY, OD_find(&benchOD, 0x1003), NODE_SRV, &errInfo);
+    }
+    if (err == CO_ERROR_NO) {
+        err = CO_SDOserver_init(&sdoSrv, &benchOD, NULL, NODE_SRV, SDO_TIMEOUT_MS, &nodeSrv.CANmodule,
+                                RX_SDO_SRV, &nodeSrv.CANmodule, TX_SDO_SRV, &errInfo);
+    }
+    if (err == CO_ERROR_NO) {
+        err = CO_SDOclient_init(&sdoCli, &benchOD, OD_find(&benchOD, 0x1280), NODE_CLI, &nodeCli.CANmodule,
+                                RX_SDO_CLI, &nodeCli.CANmodule, TX_SDO_CLI, &errInfo);
+    }
+    if (err != CO_ERROR_NO) {
+        fprintf(stderr, "setup failed: %d (errInfo 0x%X)\n", err, errInfo);
+        return 1;
+    }
+    CO_CANsetNormalMode(&nodeSrv.CANmodule);
+    CO_CANsetNormalMode(&nodeCli.CANmodule);
+    return 0;
+}
+
+/******************************************************************************/
+/* 結果 */
+typedef struct {
+    char                    name[40];
+    uint32_t                ops;
+    uint32_t                payloadBytes;   /* 每個操作的應用資料 */
+    double                  opsPerSec;
+    uint32_t                p50Ns;
+    uint32_t                p99Ns;
+    double                  framesPerOp;
+    double                  bytesPerFrame;
+    double                  busEfficiency;
+} benchResult_t;
+
+static benchResult_t results[RESULTS_MAX];
+static uint32_t resultCount;
+static uint32_t *latency;
+static double iterScale = 1.0;
+
+static int cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static uint32_t iterations(uint32_t n)
+{
+    uint32_t scaled = (uint32_t)(n * iterScale);
+    return scaled > 10U ? scaled : 10U;
+}
+
+/* 量測 ops 次 op(i)，記錄每次的執行時間與匯流排訊框 */
+static benchResult_t *measure(const char *name, uint32_t ops, uint32_t payloadBytes, bool_t (*op)(uint32_t i))
+{
+    benchResult_t *r = &results[resultCount++];
+    uint64_t totalNs = 0;
+
+    memset(&busStat, 0, sizeof(busStat));
+    for (uint32_t i = 0; i < ops; i++) {
+        uint32_t t0 = host_cycles();
+        if (!op(i)) {
+            fprintf(stderr, "FAIL: %s operation %u\n", name, i);
+            resultCount--;
+            return NULL;
+        }
+        latency[i] = host_cycles() - t0;
+        totalNs += latency[i];
+    }
+    qsort(latency, ops, sizeof(latency[0]), cmp_u32);
+
+    snprintf(r->name, sizeof(r->name), "%s", name);
+    r->ops = ops;
+    r->payloadBytes = payloadBytes;
+    r->opsPerSec = totalNs ? (double)ops * 1e9 / (double)totalNs : 0.0;
+    r->p50Ns = latency[ops / 2U];
+    r->p99Ns = latency[(uint64_t)ops * 99U / 100U];
+    r->framesPerOp = (double)busStat.frames / ops;
+    r->bytesPerFrame = busStat.frames ? (double)payloadBytes * ops / (double)busStat.frames : 0.0;
+    r->busEfficiency = busStat.bits ? (double)payloadBytes * 8.0 * ops / (double)busStat.bits : 0.0;
+    fprintf(stderr, "  %-28s %10.0f ops/s  p50 %7u ns  p99 %7u ns  %6.2f frames/op\n",
+            r->name, r->opsPerSec, r->p50Ns, r->p99Ns, r->framesPerOp);
+    return r;
+}
+
+/******************************************************************************/
+/* SDO */
+static uint8_t sdoBuf[BLOB_SIZE];
+static size_t sdoLen;
+static bool_t sdoBlock;
+
+/* 客戶端處理後傳遞訊框給伺服器，伺服器處理後傳遞回應 */
+static void sdo_exchange(void)
+{
+    CO_vbus_process(&bus);
+    CO_SDOserver_process(&sdoSrv, true, 0, NULL);
+    CO_vbus_process(&bus);
+}
+
+static bool_t sdo_download(uint16_t index, uint8_t subIndex, const uint8_t *data, size_t len, bool_t block)
+{
+    CO_SDO_abortCode_t abortCode = CO_SDO_AB_NONE;
+    CO_SDO_return_t ret;
+    size_t sizeTransferred = 0;
+
+    if (CO_SDOclientDownloadInitiate(&sdoCli, index, subIndex, len, SDO_TIMEOUT_MS, block) != CO_SDO_RT_ok_communicationEnd) {
+        return false;
+    }
+    size_t written = CO_SDOclientDownloadBufWrite(&sdoCli, data, len);
+    do {
+        ret = CO_SDOclientDownload(&sdoCli, 0, false, written < len, &abortCode, &sizeTransferred, NULL);
+        if (written < len) {
+            written += CO_SDOclientDownloadBufWrite(&sdoCli, data + written, len - written);
+        }
+        sdo_exchange();
+    } while (ret > 0);
+    return ret == CO_SDO_RT_ok_communicationEnd && sizeTransferred == len;
+}
+
+static bool_t sdo_upload(uint16_t index, uint8_t subIndex, uint8_t *data, size_t size, size_t *len, bool_t block)
+{
+    CO_SDO_abortCode_t abortCode = CO_SDO_AB_NONE;
+    CO_SDO_return_t ret;
+    size_t sizeIndicated = 0, sizeTransferred = 0, read = 0;
+
+    if (CO_SDOclientUploadInitiate(&sdoCli, index, subIndex, SDO_TIMEOUT_MS, block) != CO_SDO_RT_ok_communicationEnd) {
+        return false;
+    }
+    do {
+        ret = CO_SDOclientUpload(&sdoCli, 0, false, &abortCode, &sizeIndicated, &sizeTransferred, NULL);
+        if (ret == CO_SDO_RT_uploadDataBufferFull || ret == CO_SDO_RT_ok_communicationEnd) {
+            read += CO_SDOclientUploadBufRead(&sdoCli, data + read, size - read);
+        }
+        if (ret > 0) {
+            sdo_exchange();
+        }
+    } while (ret > 0);
+    *len = read;
+    return ret == CO_SDO_RT_ok_communicationEnd;
+}
+
+static bool_t op_sdo_exp_download(uint32_t i)
+{
+    uint32_t value = i * 2654435761U;
+    uint8_t data[4] = { (uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24) };
+    return sdo_download(0x2000, 0, data, 4, false) && bod.x2000_u32 == value;
+}
+
+static bool_t op_sdo_exp_upload(uint32_t i)
+{
+    uint8_t data[4];
+    size_t len = 0;
+    bod.x2000_u32 = i;
+    return sdo_upload(0x2000, 0, data, sizeof(data), &len, false) && len == 4U && data[0] == (uint8_t)i;
+}
+
+static bool_t op_sdo_blob_download(uint32_t i)
+{
+    sdoBuf[0] = (uint8_t)i;
+    return sdo_download(0x2001, 0, sdoBuf, sdoLen, sdoBlock) && bod.x2001_blob[0] == (uint8_t)i;
+}
+
+static bool_t op_sdo_blob_upload(uint32_t i)
+{
+    static uint8_t data[BLOB_SIZE];
+    size_t len = 0;
+    bod.x2001_blob[BLOB_SIZE - 1U] = (uint8_t)i;
+    return sdo_upload(0x2001, 0, data, sizeof(data), &len, sdoBlock) && len == BLOB_SIZE
+           && memcmp(data, bod.x2001_blob, BLOB_SIZE) == 0;
+}
+
+static int bench_sdo(void)
+{
+    int failures = 0;
+
+    for (uint32_t i = 0; i < BLOB_SIZE; i++) {
+        sdoBuf[i] = (uint8_t)(i * 7U + 3U);
+    }
+    sdoLen = BLOB_SIZE;
+
+    CHECK(measure("sdo_expedited_download", iterations(20000), 4, op_sdo_exp_download) != NULL, "SDO expedited download");
+    CHECK(measure("sdo_expedited_upload", iterations(20000), 4, op_sdo_exp_upload) != NULL, "SDO expedited upload");
+    sdoBlock = false;
+    CHECK(measure("sdo_segmented_download", iterations(1000), BLOB_SIZE, op_sdo_blob_download) != NULL,
+          "SDO segmented download");
+    CHECK(memcmp(bod.x2001_blob + 1, sdoBuf + 1, BLOB_SIZE - 1U) == 0, "segmented download data");
+    CHECK(measure("sdo_segmented_upload", iterations(1000), BLOB_SIZE, op_sdo_blob_upload) != NULL,
+          "SDO segmented upload");
+#if ((CO_CONFIG_SDO_SRV) & CO_CONFIG_SDO_SRV_BLOCK) != 0 && ((CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_BLOCK) != 0
+    sdoBlock = true;
+    memset(bod.x2001_blob, 0, sizeof(bod.x2001_blob));
+    CHECK(measure("sdo_block_download", iterations(1000), BLOB_SIZE, op_sdo_blob_download) != NULL,
+          "SDO block download");
+    CHECK(memcmp(bod.x2001_blob + 1, sdoBuf + 1, BLOB_SIZE - 1U) == 0, "block download data");
+    CHECK(measure("sdo_block_upload", iterations(1000), BLOB_SIZE, op_sdo_blob_upload) != NULL, "SDO block upload");
+#else
+    fprintf(stderr, "  SDO block transfer not enabled (BENCH_CONFIG)\n");
+#endif
+    return failures;
+}
+
+/******************************************************************************/
+/* PDO */
+static bool_t op_pdo_u8(uint32_t i)
+{
+    for (uint32_t b = 0; b < 8U; b++) {
+        bod.x2100_txU8[b] = (uint8_t)(i + b);
+    }
+    CO_TPDOsendRequest(&tpdo);
+    CO_TPDO_process(&tpdo, 0, NULL, true, false);
+    CO_vbus_process(&bus);
+    CO_RPDO_process(&rpdo, 0, NULL, true, false);
+    return bod.x2101_rxU8[7] == (uint8_t)(i + 7U);
+}
+
+static bool_t op_pdo_u32(uint32_t i)
+{
+    bod.x2102_txU32[0] = i;
+    bod.x2102_txU32[1] = ~i;
+    CO_TPDOsendRequest(&tpdo);
+    CO_TPDO_process(&tpdo, 0, NULL, true, false);
+    CO_vbus_process(&bus);
+    CO_RPDO_process(&rpdo, 0, NULL, true, false);
+    return bod.x2103_rxU32[0] == i && bod.x2103_rxU32[1] == ~i;
+}
+
+/* TPDO 映射 tx 物件的 count 個子索引 (bits 位元)，RPDO 映射 rx 物件 */
+static bool_t pdo_map(uint16_t txIndex, uint16_t rxIndex, uint8_t count, uint8_t bits)
+{
+    uint32_t errInfo = 0;
+
+    bod.x1A00.count = count;
+    bod.x1600.count = count;
+    for (uint8_t i = 0; i < 8U; i++) {
+        bod.x1A00.object[i] = (i < count) ? ((uint32_t)txIndex << 16) | ((uint32_t)(i + 1U) << 8) | bits : 0U;
+        bod.x1600.object[i] = (i < count) ? ((uint32_t)rxIndex << 16) | ((uint32_t)(i + 1U) << 8) | bits : 0U;
+    }
+    return CO_TPDO_init(&tpdo, &benchOD, &em, NULL, 0, OD_find(&benchOD, 0x1800), OD_find(&benchOD, 0x1A00),
+                        &nodeSrv.CANmodule, TX_TPDO, &errInfo) == CO_ERROR_NO
+           && CO_RPDO_init(&rpdo, &benchOD, &em, NULL, 0, OD_find(&benchOD, 0x1400), OD_find(&benchOD, 0x1600),
+                           &nodeCli.CANmodule, RX_RPDO, &errInfo) == CO_ERROR_NO
+           && tpdo.PDO_common.valid && rpdo.PDO_common.valid;
+}
+
+/* 混合映射：自訂 IO (OD 擴充)、部分映射與 dummy 物件走 OD_IO，其餘合併為 memcpy */
+static uint32_t pdoExtReads;
+
+static ODR_t pdo_ext_read(OD_stream_t *stream, void *buf, OD_size_t count, OD_size_t *countRead)
+{
+    pdoExtReads++;
+    return OD_readOriginal(stream, buf, count, countRead);
+}
+
+static OD_extension_t ext2102 = { .object = NULL, .read = pdo_ext_read, .write = OD_writeOriginal };
+
+static bool_t op_pdo_mixed(uint32_t i)
+{
+    bod.x2100_txU8[0] = (uint8_t)i;
+    bod.x2100_txU8[1] = (uint8_t)(i + 1U);
+    bod.x2100_txU8[2] = (uint8_t)(i + 2U);
+    bod.x2100_txU8[3] = (uint8_t)(i + 3U);
+    bod.x2102_txU32[0] = i * 0x10001U;
+    CO_TPDOsendRequest(&tpdo);
+    CO_TPDO_process(&tpdo, 0, NULL, true, false);
+    CO_vbus_process(&bus);
+    CO_RPDO_process(&rpdo, 0, NULL, true, false);
+    return bod.x2101_rxU8[0] == (uint8_t)i && bod.x2101_rxU8[1] == (uint8_t)(i + 1U)
+           && bod.x2101_rxU8[2] == (uint8_t)(i + 2U) && bod.x2101_rxU8[3] == (uint8_t)(i + 3U)
+           && bod.x2103_rxU32[0] == ((i * 0x10001U) & 0xFFFFU) && pdoExtReads == i + 1U;
+}
+
+static bool_t pdo_map_mixed(OD_extension_t *ext)
+{
+    /* TPDO: 2100:01..02 | 2102:01 (32 bit, 擴充) | 2100:03..04 */
+    static const uint32_t txMap[5] = { 0x21000108, 0x21000208, 0x21020120, 0x21000308, 0x21000408 };
+    /* RPDO: 2101:01..02 | 2103:01 (16 of 32 bit) | dummy u16 | 2101:03..04 */
+    static const uint32_t rxMap[6] = { 0x21010108, 0x21010208, 0x21030110, 0x00060010, 0x21010308, 0x21010408 };
+    uint32_t errInfo = 0;
+
+    OD_extension_init(OD_find(&benchOD, 0x2102), ext);
+    memset(&bod.x1A00, 0, sizeof(bod.x1A00));
+    memset(&bod.x1600, 0, sizeof(bod.x1600));
+    bod.x1A00.count = 5;
+    memcpy(bod.x1A00.object, txMap, sizeof(txMap));
+    bod.x1600.count = 6;
+    memcpy(bod.x1600.object, rxMap, sizeof(rxMap));
+    return CO_TPDO_init(&tpdo, &benchOD, &em, NULL, 0, OD_find(&benchOD, 0x1800), OD_find(&benchOD, 0x1A00),
+                        &nodeSrv.CANmodule, TX_TPDO, &errInfo) == CO_ERROR_NO
+           && CO_RPDO_init(&rpdo, &benchOD, &em, NULL, 0, OD_find(&benchOD, 0x1400), OD_find(&benchOD, 0x1600),
+                           &nodeCli.CANmodule, RX_RPDO, &errInfo) == CO_ERROR_NO
+           && tpdo.PDO_common.valid && rpdo.PDO_common.valid;
+}
+
+static int bench_pdo(void)
+{
+    int failures = 0;
+
+    CHECK(pdo_map(0x2100, 0x2101, 8, 8), "PDO mapping 8 x 8 bit");
+    CHECK(measure("pdo_8x8bit", iterations(100000), 8, op_pdo_u8) != NULL, "TPDO -> RPDO 8 x 8 bit");
+    CHECK(pdo_map(0x2102, 0x2103, 2, 32), "PDO mapping 2 x 32 bit");
+    CHECK(measure("pdo_2x32bit", iterations(100000), 8, op_pdo_u32) != NULL, "TPDO -> RPDO 2 x 32 bit");
+
+    /* 複製計畫：8 x 8 bit 為單一 memcpy；混合映射 TPDO 3 步、RPDO 4 步 */
+    CHECK(pdo_map(0x2100, 0x2101, 8, 8) && tpdo.PDO_common.copyPlanCount == 1U
+          && rpdo.PDO_common.copyPlanCount == 1U, "copy plan 8 x 8 bit: %u / %u steps",
+          tpdo.PDO_common.copyPlanCount, rpdo.PDO_common.copyPlanCount);
+    CHECK(pdo_map_mixed(&ext2102) && tpdo.PDO_common.copyPlanCount == 3U && rpdo.PDO_common.copyPlanCount == 4U,
+          "copy plan mixed mapping: %u / %u steps", tpdo.PDO_common.copyPlanCount, rpdo.PDO_common.copyPlanCount);
+    pdoExtReads = 0;
+    CHECK(measure("pdo_mixed", iterations(100000), 8, op_pdo_mixed) != NULL, "TPDO -> RPDO mixed mapping");
+    OD_extension_init(OD_find(&benchOD, 0x2102), NULL);
+    return failures;
+}
+
+/******************************************************************************/
+/* 狀態變化 TPDO (CO_CONFIG_TPDO_COS_ENABLE) */
+#if ((CO_CONFIG_PDO) & CO_CONFIG_TPDO_COS_ENABLE) != 0
+#define COS_INHIBIT_100US       10U         /* 1 ms */
+
+/* CO_TPDO_process() 經過 dt_us，傳遞到 RPDO；回傳 TPDO 訊框數 */
+static uint64_t cos_step(uint32_t dt_us)
+{
+    uint64_t frames = busStat.frames;
+
+    CO_TPDO_process(&tpdo, dt_us, NULL, true, false);
+    CO_vbus_process(&bus);
+    CO_RPDO_process(&rpdo, 0, NULL, true, false);
+    return busStat.frames - frames;
+}
+
+static bool_t op_cos_unchanged(uint32_t i)
+{
+    (void)i;
+    return cos_step(1000U) == 0U;
+}
+
+static bool_t op_cos_changed(uint32_t i)
+{
+    bod.x2100_txU8[i & 7U] ^= 0x5AU;
+    return cos_step(COS_INHIBIT_100US * 100U) == 1U && bod.x2101_rxU8[i & 7U] == bod.x2100_txU8[i & 7U];
+}
+
+static int bench_pdo_cos(void)
+{
+    int failures = 0;
+    OD_entry_t *e2102 = OD_find(&benchOD, 0x2102);
+
+    /* 8 x 8 bit，事件驅動 (254)，禁止時間 1 ms */
+    bod.x1800.inhibitTime = COS_INHIBIT_100US;
+    CHECK(pdo_map(0x2100, 0x2101, 8, 8), "PDO mapping 8 x 8 bit");
+    CHECK(cos_step(0) == 1U, "no TPDO after init");
+    CHECK(cos_step(1000U) == 0U, "TPDO without change");
+    bod.x2100_txU8[3] = 0x11;
+    CHECK(cos_step(1000U) == 1U && bod.x2101_rxU8[3] == 0x11, "change of state not sent");
+
+    /* 禁止時間內的兩次改變合併為一個 TPDO (最新值) */
+    bod.x2100_txU8[3] = 0x22;
+    CHECK(cos_step(400U) == 0U, "TPDO inside inhibit time");
+    bod.x2100_txU8[3] = 0x33;
+    CHECK(cos_step(400U) == 0U, "TPDO inside inhibit time");
+    CHECK(cos_step(400U) == 1U && bod.x2101_rxU8[3] == 0x33, "changes inside inhibit time: rx 0x%02X",
+          bod.x2101_rxU8[3]);
+
+    /* 傳送緩衝區仍被佔用 (CO_ERROR_TX_OVERFLOW)：CANtxBuff 已有新值，要求保留到緩衝區釋放後送出 */
+    tpdo.CANtxBuff->bufferFull = true;
+    bod.x2100_txU8[3] = 0x44;
+    CHECK(cos_step(1000U) == 0U, "TPDO sent while TX buffer full");
+    tpdo.CANtxBuff->bufferFull = false;
+    CHECK(cos_step(1000U) == 1U && bod.x2101_rxU8[3] == 0x44, "change lost after TX overflow: rx 0x%02X",
+          bod.x2101_rxU8[3]);
+
+    CHECK(measure("pdo_cos_scan", iterations(100000), 0, op_cos_unchanged) != NULL, "COS scan without change");
+    CHECK(measure("pdo_cos_change", iterations(100000), 8, op_cos_changed) != NULL, "COS TPDO -> RPDO");
+
+    /* 自訂 IO 的變數不比較，由 OD_set_value() 寫入改變時要求 TPDO */
+    CHECK(pdo_map_mixed(&ext2102), "PDO mixed mapping");
+    CHECK(cos_step(1000U) == 1U && cos_step(1000U) == 0U, "mixed mapping first TPDO");
+    uint32_t v = bod.x2102_txU32[0];
+    CHECK(OD_set_u32(e2102, 1, v, false) == ODR_OK && cos_step(1000U) == 0U, "OD_set_u32() same value sent TPDO");
+#if OD_SET_VALUE_REQUEST_TPDO
+    CHECK(OD_set_u32(e2102, 1, v + 1U, false) == ODR_OK && cos_step(1000U) == 1U
+          && bod.x2103_rxU32[0] == ((v + 1U) & 0xFFFFU), "OD_set_u32() change not sent");
+#endif
+    bod.x2102_txU32[0] = v + 2U;
+    CHECK(cos_step(1000U) == 0U, "custom IO variable compared");
+
+    OD_extension_init(e2102, NULL);
+    bod.x1800.inhibitTime = 0;
+    return failures;
+}
+#else
+static int bench_pdo_cos(void)
+{
+    fprintf(stderr, "  TPDO change of state not enabled (CO_CONFIG_PDO)\n");
+    return 0;
+}
+#endif
+
+/******************************************************************************/
+/* EMCY */
+static bool_t op_emcy(uint32_t i)
+{
+    uint64_t frames = busStat.frames;
+    CO_errorReport(&em, CO_EM_GENERIC_ERROR, CO_EMC_GENERIC, i);
+    CO_EM_process(&em, true, 0, NULL);
+    CO_vbus_process(&bus);
+    CO_errorReset(&em, CO_EM_GENERIC_ERROR, i);
+    CO_EM_process(&em, true, 0, NULL);
+    CO_vbus_process(&bus);
+    return busStat.frames == frames + 2U;
+}
+
+static int bench_emcy(void)
+{
+    int failures = 0;
+    CHECK(measure("emcy_report_reset", iterations(50000), 8, op_emcy) != NULL, "EMCY report/reset");
+    return failures;
+}
+
+/******************************************************************************/
+/* 心跳消費者 */
+static uint32_t hbCount;
+
+static bool_t op_hb(uint32_t i)
+{
+    static const uint8_t operational[1] = { CO_NMT_OPERATIONAL };
+    (void)i;
+    for (uint32_t n = 1; n <= hbCount; n++) {
+        CO_vbus_inject(&bus, (uint16_t)(0x700U + n), 1, operational);
+    }
+    CO_vbus_process(&bus);
+    CO_HBconsumer_process(&hbCons, true, 1000, NULL);
+    return hbCons.allMonitoredOperational || i == 0U;
+}
+
+static int bench_hb(void)
+{
+    static const uint32_t counts[] = { 1, 8, 32, HB_NODES_MAX };
+    int failures = 0;
+
+    for (uint32_t n = 0; n < HB_NODES_MAX; n++) {
+        bod.x1016_consumerHeartbeatTime[n] = ((n + 1U) << 16) | 1000U;
+    }
+    for (uint32_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+        char name[40];
+        uint32_t errInfo = 0;
+
+        hbCount = counts[c];
+        CO_ReturnError_t err = CO_HBconsumer_init(&hbCons, &em, hbNodes, (uint8_t)hbCount,
+                                                  OD_find(&benchOD, 0x1016), &nodeCli.CANmodule, RX_HB_CONS, &errInfo);
+        CHECK(err == CO_ERROR_NO, "HB consumer init %u nodes: %d", hbCount, err);
+        snprintf(name, sizeof(name), "hb_consumer_%unodes", hbCount);
+        benchResult_t *r = measure(name, iterations(200000) / hbCount + 10U, hbCount, op_hb);
+        CHECK(r != NULL, "HB consumer %u nodes", hbCount);
+        CHECK(hbCons.allMonitoredOperational, "HB consumer %u nodes not all operational", hbCount);
+    }
+    return failures;
+}
+
+/******************************************************************************/
+static void write_json(FILE *f)
+{
+    fprintf(f, "{\n  \"suite\": \"bench_canopen\",\n  \"schema\": 1,\n");
+    fprintf(f, "  \"config\": {\"sdo_srv_buffer\": %u, \"sdo_cli_buffer\": %u, \"blob_bytes\": %u, \"iteration_scale\": %g},\n",
+            (unsigned)CO_CONFIG_SDO_SRV_BUFFER_SIZE, (unsigned)CO_CONFIG_SDO_CLI_BUFFER_SIZE, BLOB_SIZE, iterScale);
+    fprintf(f, "  \"results\": [\n");
+    for (uint32_t i = 0; i < resultCount; i++) {
+        const benchResult_t *r = &results[i];
+        fprintf(f, "    {\"name\": \"%s\", \"ops\": %u, \"payload_bytes\": %u, \"ops_per_s\": %.1f, "
+                "\"p50_ns\": %u, \"p99_ns\": %u, \"frames_per_op\": %.3f, \"bytes_per_frame\": %.3f, "
+                "\"bus_efficiency\": %.4f}%s\n",
+                r->name, r->ops, r->payloadBytes, r->opsPerSec, r->p50Ns, r->p99Ns, r->framesPerOp,
+                r->bytesPerFrame, r->busEfficiency, (i + 1U < resultCount) ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+}
+
+int main(int argc, char *argv[])
+{
+    const char *outPath = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "o:s:")) != -1) {
+        switch (opt) {
+            case 'o': outPath = optarg; break;
+            case 's': iterScale = atof(optarg); break;
+            default:
+                fprintf(stderr, "usage: %s [-o file.json] [-s iteration scale]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (iterScale <= 0.0) {
+        iterScale = 1.0;
+    }
+
+    latency = malloc(sizeof(latency[0]) * iterations(200000) + sizeof(latency[0]) * 16U);
+    if (latency == NULL || bench_setup() != 0) {
+        return 1;
+    }
+
+    fprintf(stderr, "CANopen protocol engines on the virtual bus\n");
+    int failures = bench_sdo();
+    failures += bench_pdo();
+    failures += bench_pdo_cos();
+    failures += bench_emcy();
+    failures += bench_hb();
+
+    FILE *f = stdout;
+    if (outPath != NULL && (f = fopen(outPath, "w")) == NULL) {
+        perror(outPath);
+        return 1;
+    }
+    write_json(f);
+    if (f != stdout) {
+        fclose(f);
+        fprintf(stderr, "results written to %s\n", outPath);
+    }
+
+    fprintf(stderr, "\n%s\n", failures == 0 ? "PASS" : "FAIL");
+    free(latency);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,154 @@
+/**
+ * Host benchmark for CRC-16 CCITT: byte table vs slice-by-4 / slice-by-8 / FCE model
+ *
+ * @file bench_crc16.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * crc16-ccitt.c (逐 byte 查表) 為參考，比較 port/CO_crc16.c：
+ *  1. 標準測試向量 "123456789" = 0x31C3 (XMODEM)
+ *  2. 隨機長度 (0 ~ 1024)、起始位址偏移 (0 ~ 7) 與初值，以及分段計算，結果必須與參考逐位元相同
+ *  3. 7 byte (SDO 分段)、889 byte (127 個分段的區塊) 與 64 KB 的 MB/s (取 3 次中最快)
+ * FCE 以 host/xmc_fce.h 的逐位元模型驗證 CO_crc16_fce() 的位址對齊、奇數長度與初值處理；
+ * 模型的速度沒有意義，硬體上的時間以 CO_CAN_CYCLES() 量測。
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "DAVE.h"
+#include "CO_crc16.h"
+#include "xmc_fce.h"
+
+#define DATA_SIZE       65536U
+#define BYTES_PER_RUN   (64U << 20)     /* 每個變體每次量測處理的資料量 */
+#define RANDOM_CASES    20000U
+
+typedef uint16_t (*crc_fn_t)(const uint8_t block[], size_t blockLength, uint16_t crc);
+
+typedef struct {
+    const char             *name;
+    crc_fn_t                fn;
+    bool                    timed;
+} variant_t;
+
+static const variant_t variants[] = {
+    { "byte table", crc16_ccitt, true },
+    { "slice-by-4", CO_crc16_slice4, true },
+    { "slice-by-8", CO_crc16_slice8, true },
+    { "FCE (model)", CO_crc16_fce, false },
+};
+#define VARIANTS        (sizeof(variants) / sizeof(variants[0]))
+
+XMC_FCE_Kernel_t host_fce_ke2 = { .CFG = 0x700U };    /* 重置值：REFIN | REFOUT | XSEL */
+static uint8_t data[DATA_SIZE + 8U];
+static volatile uint16_t sink;
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static int test_exact(void)
+{
+    int errors = 0;
+    static const uint8_t vector[] = "123456789";
+
+    for (uint32_t v = 0; v < VARIANTS; v++) {
+        uint16_t crc = variants[v].fn(vector, 9, 0);
+        if (crc != 0x31C3U) {
+            printf("FAIL: %s \"123456789\" = 0x%04X\n", variants[v].name, crc);
+            errors++;
+        }
+    }
+
+    for (uint32_t n = 0; n < RANDOM_CASES; n++) {
+        size_t offset = (size_t)(rand() % 8);
+        size_t length = (size_t)(rand() % 1025);
+        size_t split = length == 0U ? 0U : (size_t)rand() % length;
+        uint16_t seed = (uint16_t)rand();
+        const uint8_t *block = &data[offset];
+        uint16_t ref = crc16_ccitt(block, length, seed);
+
+        for (uint32_t v = 1; v < VARIANTS; v++) {
+            uint16_t crc = variants[v].fn(block, length, seed);
+            uint16_t chained = variants[v].fn(&block[split], length - split, variants[v].fn(block, split, seed));
+            if (crc != ref || chained != ref) {
+                printf("FAIL: %s offset %zu length %zu seed 0x%04X: 0x%04X / 0x%04X, reference 0x%04X\n",
+                       variants[v].name, offset, length, seed, crc, chained, ref);
+                if (++errors > 10) {
+                    return errors;
+                }
+            }
+        }
+    }
+
+    /* FCE：偶數長度的對齊區塊全部以 16 bit 寫入 IR */
+    uint32_t writes = host_fce_ke2.irWrites;
+    (void)CO_crc16_fce(data, 1024, 0);
+    if (host_fce_ke2.irWrites - writes != 512U) {
+        printf("FAIL: FCE %u IR writes for 1024 bytes\n", host_fce_ke2.irWrites - writes);
+        errors++;
+    }
+    return errors;
+}
+
+static double bench(crc_fn_t fn, size_t length)
+{
+    uint32_t count = (uint32_t)(BYTES_PER_RUN / length);
+    double best = 0.0;
+
+    for (int run = 0; run < 3; run++) {
+        uint16_t crc = 0;
+        double t0 = now_ns();
+        for (uint32_t i = 0; i < count; i++) {
+            crc = fn(data, length, crc);
+        }
+        double mbps = (double)count * (double)length / ((now_ns() - t0) / 1e9) / 1e6;
+        sink = crc;
+        if (mbps > best) {
+            best = mbps;
+        }
+    }
+    return best;
+}
+
+int main(void)
+{
+    static const size_t lengths[] = {7, 889, DATA_SIZE};
+    double mbps[VARIANTS][3];
+    int errors;
+
+    srand(1);
+    for (uint32_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)rand();
+    }
+    CO_crc16_init();
+
+    printf("=== CRC-16 CCITT: crc16-ccitt.c byte table vs CO_crc16.c ===\n");
+    errors = test_exact();
+    printf("bit-exact against byte table: %u random blocks (offset 0-7, length 0-1024, chained), %s\n",
+           RANDOM_CASES, errors == 0 ? "ok" : "MISMATCH");
+
+    printf("%-12s %10s %10s %10s  (MB/s)\n", "", "7 B", "889 B", "64 KB");
+    for (uint32_t v = 0; v < VARIANTS; v++) {
+        if (!variants[v].timed) {
+            printf("%-12s %10s %10s %10s  bit-exact only (host model)\n", variants[v].name, "-", "-", "-");
+            continue;
+        }
+        for (uint32_t l = 0; l < 3U; l++) {
+            mbps[v][l] = bench(variants[v].fn, lengths[l]);
+        }
+        printf("%-12s %10.1f %10.1f %10.1f  x%.2f\n", variants[v].name, mbps[v][0], mbps[v][1], mbps[v][2],
+               mbps[v][2] / mbps[0][2]);
+    }
+    if (mbps[2][2] <= mbps[0][2]) {
+        printf("FAIL: slice-by-8 not faster than byte table (%.1f vs %.1f MB/s)\n", mbps[2][2], mbps[0][2]);
+        errors++;
+    }
+
+    printf("%s\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
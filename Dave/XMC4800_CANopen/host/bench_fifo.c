@@ -0,0 +1,298 @@
+/**
+ * Host micro-benchmark for CO_fifo bulk copies vs the original byte loops
+ *
+ * @file bench_fifo.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * CO_fifo_write / read / altRead 以最多兩段 memcpy 複製，altFinish 的 CRC 以區塊計算 (CO_crc16.c)。
+ * ref_* 是原本每個 byte 檢查回繞的迴圈 (寫入時逐 byte crc16_ccitt_single())：
+ *  1. 隨機的 write / read / altBegin / altRead / altFinish 序列 (含 CRC、命令分隔字元 '\n')，
+ *     回傳值、讀出的資料、CRC 與讀寫指標必須與原本的迴圈相同
+ *  2. 7 byte (SDO 分段)、889 byte (127 x 7 區塊) 與 4 KB 的傳輸經過 FIFO 的 MB/s：
+ *     write + read、write + CRC (區塊上傳)、altRead + altFinish CRC (區塊下載)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "DAVE.h"
+#include "301/CO_fifo.h"
+#include "301/crc16-ccitt.h"
+
+#define FIFO_SIZE_MAX   (4096U + 1U)
+#define RANDOM_OPS      200000U
+#define BYTES_PER_RUN   (32U << 20)
+
+static uint8_t bufA[FIFO_SIZE_MAX];
+static uint8_t bufB[FIFO_SIZE_MAX];
+static uint8_t data[FIFO_SIZE_MAX + 16U];
+static uint8_t outA[FIFO_SIZE_MAX];
+static uint8_t outB[FIFO_SIZE_MAX];
+static volatile uint16_t sink;
+
+/******************************************************************************/
+/* 原本的實作 (CO_fifo.c 基準版本) */
+static size_t ref_write(CO_fifo_t *fifo, const uint8_t *buf, size_t count, uint16_t *crc)
+{
+    size_t i;
+    uint8_t *bufDest = &fifo->buf[fifo->writePtr];
+
+    for (i = count; i > 0U; i--) {
+        size_t writePtrNext = fifo->writePtr + 1U;
+        if ((writePtrNext == fifo->readPtr) || ((writePtrNext == fifo->bufSize) && (fifo->readPtr == 0U))) {
+            break;
+        }
+        *bufDest = *buf;
+        if (crc != NULL) {
+            crc16_ccitt_single(crc, *buf);
+        }
+        if (writePtrNext == fifo->bufSize) {
+            fifo->writePtr = 0;
+            bufDest = &fifo->buf[0];
+        } else {
+            fifo->writePtr++;
+            bufDest++;
+        }
+        buf++;
+    }
+    return count - i;
+}
+
+static size_t ref_read(CO_fifo_t *fifo, uint8_t *buf, size_t count, bool_t *eof)
+{
+    size_t i;
+    bool_t alive = true;
+
+    if (eof != NULL) {
+        *eof = false;
+    }
+    if (fifo->readPtr == fifo->writePtr) {
+        return 0;
+    }
+    const uint8_t *bufSrc = &fifo->buf[fifo->readPtr];
+    for (i = count; (i > 0U) && alive;) {
+        const uint8_t c = *bufSrc;
+        if (fifo->readPtr == fifo->writePtr) {
+            alive = false;
+        } else {
+            *buf++ = c;
+            if (++fifo->readPtr == fifo->bufSize) {
+                fifo->readPtr = 0;
+                bufSrc = &fifo->buf[0];
+            } else {
+                bufSrc++;
+            }
+            i--;
+            if ((eof != NULL) && (c == '\n')) {
+                *eof = true;
+                alive = false;
+            }
+        }
+    }
+    return count - i;
+}
+
+static size_t ref_altBegin(CO_fifo_t *fifo, size_t offset)
+{
+    size_t i;
+
+    fifo->altReadPtr = fifo->readPtr;
+    for (i = offset; i > 0U; i--) {
+        if (fifo->altReadPtr == fifo->writePtr) {
+            break;
+        }
+        if (++fifo->altReadPtr == fifo->bufSize) {
+            fifo->altReadPtr = 0;
+        }
+    }
+    return offset - i;
+}
+
+static void ref_altFinish(CO_fifo_t *fifo, uint16_t *crc)
+{
+    if (crc == NULL) {
+        fifo->readPtr = fifo->altReadPtr;
+        return;
+    }
+    const uint8_t *bufSrc = &fifo->buf[fifo->readPtr];
+    while (fifo->readPtr != fifo->altReadPtr) {
+        crc16_ccitt_single(crc, *bufSrc);
+        if (++fifo->readPtr == fifo->bufSize) {
+            fifo->readPtr = 0;
+            bufSrc = &fifo->buf[0];
+        } else {
+            bufSrc++;
+        }
+    }
+}
+
+static size_t ref_altRead(CO_fifo_t *fifo, uint8_t *buf, size_t count)
+{
+    size_t i;
+    const uint8_t *bufSrc = &fifo->buf[fifo->altReadPtr];
+
+    for (i = count; i > 0U; i--) {
+        const uint8_t c = *bufSrc;
+        if (fifo->altReadPtr == fifo->writePtr) {
+            break;
+        }
+        *buf++ = c;
+        if (++fifo->altReadPtr == fifo->bufSize) {
+            fifo->altReadPtr = 0;
+            bufSrc = &fifo->buf[0];
+        } else {
+            bufSrc++;
+        }
+    }
+    return count - i;
+}
+
+/******************************************************************************/
+static int test_exact(void)
+{
+    static const size_t sizes[] = {2, 3, 8, 64, 901, FIFO_SIZE_MAX};
+    int errors = 0;
+
+    for (uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        CO_fifo_t a = {0}, b = {0};
+        uint16_t crcA = 0, crcB = 0;
+        size_t size = sizes[s];
+
+        CO_fifo_init(&a, bufA, size);
+        CO_fifo_init(&b, bufB, size);
+        for (uint32_t n = 0; n < RANDOM_OPS / 8U; n++) {
+            size_t count = (size_t)rand() % (size + 2U);
+            size_t offset = (size_t)rand() % (size + 2U);
+            uint16_t *cA = (rand() & 1) ? &crcA : NULL;
+            uint16_t *cB = cA != NULL ? &crcB : NULL;
+            bool_t eofA = false, eofB = false, useEof = (rand() & 1) != 0;
+            size_t rA = 0, rB = 0;
+
+            switch (rand() % 5) {
+                case 0:
+                    rA = CO_fifo_write(&a, &data[offset % 16U], count, cA);
+                    rB = ref_write(&b, &data[offset % 16U], count, cB);
+                    break;
+                case 1:
+                    rA = CO_fifo_read(&a, outA, count, useEof ? &eofA : NULL);
+                    rB = ref_read(&b, outB, count, useEof ? &eofB : NULL);
+                    break;
+                case 2:
+                    rA = CO_fifo_altBegin(&a, offset);
+                    rB = ref_altBegin(&b, offset);
+                    break;
+                case 3:
+                    rA = CO_fifo_altRead(&a, outA, count);
+                    rB = ref_altRead(&b, outB, count);
+                    break;
+                default:
+                    /* altReadPtr 必須先由 altBegin 設定 */
+                    (void)CO_fifo_altBegin(&a, offset);
+                    (void)ref_altBegin(&b, offset);
+                    CO_fifo_altFinish(&a, cA);
+                    ref_altFinish(&b, cB);
+                    break;
+            }
+            if (rA != rB || eofA != eofB || crcA != crcB || memcmp(outA, outB, rA) != 0 || a.readPtr != b.readPtr
+                || a.writePtr != b.writePtr || memcmp(bufA, bufB, size) != 0) {
+                printf("FAIL: size %zu op %u: %zu / %zu bytes, crc 0x%04X / 0x%04X, rp %zu / %zu, wp %zu / %zu\n",
+                       size, n, rA, rB, crcA, crcB, a.readPtr, b.readPtr, a.writePtr, b.writePtr);
+                if (++errors > 10) {
+                    return errors;
+                }
+                break;
+            }
+        }
+    }
+    return errors;
+}
+
+/******************************************************************************/
+typedef enum { PATH_COPY, PATH_CRC, PATH_ALT } path_t;
+
+/* 資料分成 length 大小的傳輸經過 FIFO (容量 length + 1，每次從不同的位置開始以產生回繞)，回傳 MB/s */
+static double bench(bool_t bulk, path_t path, size_t length)
+{
+    uint32_t count = (uint32_t)(BYTES_PER_RUN / length);
+    double best = 0.0;
+
+    for (int run = 0; run < 3; run++) {
+        CO_fifo_t fifo;
+        uint16_t crc = 0;
+        struct timespec t0, t1;
+
+        CO_fifo_init(&fifo, bufA, length + 1U);
+        fifo.readPtr = fifo.writePtr = length / 2U;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (uint32_t i = 0; i < count; i++) {
+            if (bulk) {
+                (void)CO_fifo_write(&fifo, data, length, path == PATH_CRC ? &crc : NULL);
+                if (path == PATH_ALT) {
+                    (void)CO_fifo_altBegin(&fifo, 0);
+                    (void)CO_fifo_altRead(&fifo, outA, length);
+                    CO_fifo_altFinish(&fifo, &crc);
+                } else {
+                    (void)CO_fifo_read(&fifo, outA, length, NULL);
+                }
+            } else {
+                (void)ref_write(&fifo, data, length, path == PATH_CRC ? &crc : NULL);
+                if (path == PATH_ALT) {
+                    (void)ref_altBegin(&fifo, 0);
+                    (void)ref_altRead(&fifo, outA, length);
+                    ref_altFinish(&fifo, &crc);
+                } else {
+                    (void)ref_read(&fifo, outA, length, NULL);
+                }
+            }
+            /* 下一次從不同的位置開始 */
+            fifo.readPtr = fifo.writePtr = (fifo.writePtr + 3U) % fifo.bufSize;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        double ns = (double)(t1.tv_sec - t0.tv_sec) * 1e9 + (double)(t1.tv_nsec - t0.tv_nsec);
+        double mbps = (double)count * (double)length / ns * 1e3;
+        sink = (uint16_t)(crc ^ outA[0]);
+        if (mbps > best) {
+            best = mbps;
+        }
+    }
+    return best;
+}
+
+int main(void)
+{
+    static const size_t lengths[] = {7, 889, 4096};
+    static const char *const names[] = {"write + read", "write + CRC + read", "altRead + altFinish CRC"};
+    int errors;
+
+    srand(1);
+    for (uint32_t i = 0; i < sizeof(data); i++) {
+        /* 約 1/32 為命令分隔字元 */
+        data[i] = (rand() % 32 == 0) ? (uint8_t)'\n' : (uint8_t)rand();
+    }
+
+    printf("=== CO_fifo: byte loop vs memcpy spans ===\n");
+    errors = test_exact();
+    printf("identical to byte loop: %u random operations, %s\n", RANDOM_OPS - RANDOM_OPS % 8U,
+           errors == 0 ? "ok" : "MISMATCH");
+
+    printf("%-24s %6s %12s %12s %8s\n", "", "bytes", "loop MB/s", "memcpy MB/s", "speedup");
+    double speedup4k = 0.0;
+    for (uint32_t p = 0; p < 3U; p++) {
+        for (uint32_t l = 0; l < 3U; l++) {
+            double loop = bench(false, (path_t)p, lengths[l]);
+            double bulk = bench(true, (path_t)p, lengths[l]);
+            printf("%-24s %6zu %12.1f %12.1f %7.2fx\n", l == 0U ? names[p] : "", lengths[l], loop, bulk, bulk / loop);
+            if (p == PATH_COPY && lengths[l] == 4096U) {
+                speedup4k = bulk / loop;
+            }
+        }
+    }
+    if (speedup4k <= 1.0) {
+        printf("FAIL: memcpy spans not faster for 4 KB (x%.2f)\n", speedup4k);
+        errors++;
+    }
+
+    printf("%s\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
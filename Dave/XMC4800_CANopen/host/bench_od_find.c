@@ -0,0 +1,141 @@
+/**
+ * Host micro-benchmark for the OD_find() direct-index lookup table
+ *
+ * @file bench_od_find.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 以合成物件字典 (50 / 500 / 5000 個 OD 項目，分佈於通訊區、製造商區與裝置規範區)
+ * 比較 OD_find() 的二分搜尋與 OD_initLookup() 建立的兩層直接索引查表：
+ *  1. 所有 65536 個 index 的查找結果必須一致
+ *  2. 頁數不足時 OD_initLookup() 失敗並退回二分搜尋
+ *  3. 輸出每次查找的平均時間 (ns/lookup) 與查表記憶體
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "DAVE.h"
+#include "301/CO_ODinterface.h"
+
+#define OD_SIZE_MAX     5000U
+#define QUERY_COUNT     (1U << 16)
+#define REPEAT          64U
+
+static OD_entry_t list[OD_SIZE_MAX + 1U];
+static OD_t od;
+static OD_lookup_t lookup;
+static uint16_t slots[256][256];
+static uint16_t queries[QUERY_COUNT];
+static volatile uintptr_t sink;
+
+static int cmp_entry(const void *a, const void *b)
+{
+    return (int)((const OD_entry_t *)a)->index - (int)((const OD_entry_t *)b)->index;
+}
+
+/* size 個不重複的 index：1/8 在通訊區 (0x1000-0x1FFF)，其餘一半在製造商區 (0x2000 起)、
+ * 一半在裝置規範區 (0x6000 起)，兩區各約 50% 密度 */
+static void make_od(uint16_t size)
+{
+    static uint8_t used[0x10000];
+    unsigned span = (size * 7U / 16U) * 2U + 16U;
+
+    memset(used, 0, sizeof(used));
+    memset(list, 0, sizeof(list));
+    for (uint16_t i = 0; i < size; i++) {
+        uint16_t index;
+        do {
+            int area = rand() % 16;
+            if (area < 2) {
+                index = (uint16_t)(0x1000U + (unsigned)rand() % 0x1000U);
+            } else if (area < 9) {
+                index = (uint16_t)(0x2000U + (unsigned)rand() % span);
+            } else {
+                index = (uint16_t)(0x6000U + (unsigned)rand() % span);
+            }
+        } while (used[index]);
+        used[index] = 1;
+        list[i].index = index;
+        list[i].subEntriesCount = 1;
+    }
+    qsort(list, size, sizeof(list[0]), cmp_entry);
+
+    od.size = size;
+    od.list = list;
+    od.lookup = NULL;
+
+    /* 90% 存在的 index (SDO/PDO 存取)，10% 任意 index */
+    for (uint32_t q = 0; q < QUERY_COUNT; q++) {
+        queries[q] = (rand() % 10 != 0) ? list[(unsigned)rand() % size].index
+                                        : (uint16_t)((unsigned)rand() & 0xFFFFU);
+    }
+}
+
+static double run_bench(void)
+{
+    uintptr_t acc = 0;
+    uint32_t t0 = host_cycles();
+    for (uint32_t r = 0; r < REPEAT; r++) {
+        for (uint32_t q = 0; q < QUERY_COUNT; q++) {
+            acc += (uintptr_t)OD_find(&od, queries[q]);
+        }
+    }
+    uint32_t ns = host_cycles() - t0;
+    sink = acc;
+    return (double)ns / ((double)REPEAT * QUERY_COUNT);
+}
+
+static int bench_size(uint16_t size)
+{
+    static OD_entry_t *expected[0x10000];
+    int errors = 0;
+
+    make_od(size);
+    for (uint32_t index = 0; index < 0x10000U; index++) {
+        expected[index] = OD_find(&od, (uint16_t)index);
+    }
+    double nsBinary = run_bench();
+
+    uint16_t pages = OD_lookupPages(&od);
+    if (pages > 1U && (OD_initLookup(&od, &lookup, slots, pages - 1U) != ODR_OUT_OF_MEM || od.lookup != NULL)) {
+        printf("FAIL: OD_initLookup() with %u of %u pages\n", pages - 1U, pages);
+        errors++;
+    }
+    if (OD_initLookup(&od, &lookup, slots, pages) != ODR_OK || od.lookup != &lookup) {
+        printf("FAIL: OD_initLookup() with %u pages\n", pages);
+        return errors + 1;
+    }
+
+    uint32_t mismatch = 0;
+    for (uint32_t index = 0; index < 0x10000U; index++) {
+        if (OD_find(&od, (uint16_t)index) != expected[index]) {
+            if (mismatch++ == 0U) {
+                printf("FAIL: index 0x%04X lookup %p, binary search %p\n", index,
+                       (void *)OD_find(&od, (uint16_t)index), (void *)expected[index]);
+            }
+        }
+    }
+    errors += (mismatch != 0U) ? 1 : 0;
+    double nsLookup = run_bench();
+
+    printf("%5u entries: binary search %6.2f ns, lookup %5.2f ns (x%.1f), %3u pages = %6u bytes%s\n",
+           size, nsBinary, nsLookup, nsBinary / nsLookup, pages,
+           (unsigned)(sizeof(OD_lookup_t) + pages * sizeof(slots[0])), mismatch != 0U ? "  MISMATCH" : "");
+    return errors;
+}
+
+int main(void)
+{
+    int errors = 0;
+
+    srand(1);
+    printf("=== OD_find() binary search / direct-index lookup (%u queries x %u) ===\n",
+           (unsigned)QUERY_COUNT, (unsigned)REPEAT);
+    errors += bench_size(50);
+    errors += bench_size(500);
+    errors += bench_size(OD_SIZE_MAX);
+
+    printf("%s\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,167 @@
+/**
+ * Host micro-benchmark for the RX dispatch index
+ *
+ * @file bench_rx_dispatch.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 以合成 CAN 訊框測試 CO_CANrxDispatch_find()，並與原本 CO_CANinterrupt_Rx()
+ * 的線性掃描比較：
+ *  1. 所有 2048 個 COB-ID 的匹配結果必須一致
+ *  2. 輸出每個訊框的平均查找時間 (ns/frame)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "CO_driver_target.h"
+#include "CO_rx_dispatch.h"
+
+#define NODE_ID         10U
+#define RX_SIZE         32U
+#define FRAME_COUNT     (1U << 20)
+#define REPEAT          16U
+
+static CO_CANmodule_t CANmodule;
+static CO_CANrx_t rxArray[RX_SIZE];
+static uint16_t frames[FRAME_COUNT];
+static volatile uintptr_t sink;
+
+static void dummy_callback(void *object, void *message)
+{
+    (void)object;
+    (void)message;
+}
+
+/* 與 CO_driver_XMC4800.c 相同的緩衝區登記流程 (不含 LMO 配置) */
+static void rx_register(uint16_t index, uint16_t ident, uint16_t mask)
+{
+    CO_CANrx_t *buffer = &rxArray[index];
+    uint16_t oldIdent = (uint16_t)buffer->ident;
+    buffer->ident = ident;
+    buffer->mask = mask;
+    buffer->object = NULL;
+    buffer->CANrx_callback = dummy_callback;
+    CO_CANrxDispatch_update(&CANmodule, index, oldIdent);
+}
+
+/* 原本 CO_CANinterrupt_Rx() 的線性掃描 */
+static CO_CANrx_t *linear_find(uint16_t ident)
+{
+    for (uint16_t i = 0; i < CANmodule.rxSize; i++) {
+        CO_CANrx_t *buffer = &CANmodule.rxArray[i];
+        if (buffer->CANrx_callback != NULL && ((ident ^ buffer->ident) & buffer->mask) == 0U) {
+            return buffer;
+        }
+    }
+    return NULL;
+}
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* 典型 CANopen slave 配置：NMT/SYNC/TIME/RPDO1-4/SDO/8 個 HB consumer/LSS */
+static void setup_node(void)
+{
+    uint16_t idx = 0;
+
+    memset(&CANmodule, 0, sizeof(CANmodule));
+    memset(rxArray, 0, sizeof(rxArray));
+    CANmodule.rxArray = rxArray;
+    CANmodule.rxSize = RX_SIZE;
+    CO_CANrxDispatch_init(&CANmodule);
+
+    rx_register(idx++, 0x000U, 0x7FFU);                 /* NMT */
+    rx_register(idx++, 0x080U, 0x7FFU);                 /* SYNC */
+    rx_register(idx++, 0x100U, 0x7FFU);                 /* TIME */
+    for (uint16_t p = 0; p < 4U; p++) {
+        rx_register(idx++, (uint16_t)(0x200U + p * 0x100U + NODE_ID), 0x7FFU);  /* RPDO1-4 */
+    }
+    rx_register(idx++, (uint16_t)(0x600U + NODE_ID), 0x7FFU);                   /* SDO server */
+    for (uint16_t n = 1; n <= 8U; n++) {
+        rx_register(idx++, (uint16_t)(0x700U + n), 0x7FFU);                     /* HB consumer */
+    }
+    rx_register(idx++, 0x000U, 0x7FFU);                 /* 未使用的 HB consumer (ID=0) */
+    rx_register(idx++, 0x7E5U, 0x7FFU);                 /* LSS slave */
+}
+
+static int verify_all_idents(const char *label)
+{
+    int mismatches = 0;
+    for (uint16_t ident = 0; ident < CO_CAN_RX_DISPATCH_SIZE; ident++) {
+        if (CO_CANrxDispatch_find(&CANmodule, ident) != linear_find(ident)) {
+            printf("  [%s] MISMATCH ident=0x%03X\n", label, ident);
+            mismatches++;
+        }
+    }
+    printf("  [%s] 2048 COB-ID 比對: %s\n", label, mismatches == 0 ? "一致" : "不一致");
+    return mismatches;
+}
+
+static void run_bench(const char *label)
+{
+    double t0, t1, t2;
+    uintptr_t acc = 0;
+
+    t0 = now_ns();
+    for (uint32_t r = 0; r < REPEAT; r++) {
+        for (uint32_t i = 0; i < FRAME_COUNT; i++) {
+            acc += (uintptr_t)linear_find(frames[i]);
+        }
+    }
+    t1 = now_ns();
+    for (uint32_t r = 0; r < REPEAT; r++) {
+        for (uint32_t i = 0; i < FRAME_COUNT; i++) {
+            acc += (uintptr_t)CO_CANrxDispatch_find(&CANmodule, frames[i]);
+        }
+    }
+    t2 = now_ns();
+    sink = acc;
+
+    double n = (double)FRAME_COUNT * REPEAT;
+    printf("  [%s] linear scan: %6.2f ns/frame, dispatch: %6.2f ns/frame (x%.1f)\n",
+           label, (t1 - t0) / n, (t2 - t1) / n, (t1 - t0) / (t2 - t1));
+}
+
+int main(void)
+{
+    int errors = 0;
+
+    /* 合成匯流排流量：本節點 RPDO/SDO/SYNC 與其他節點的 TPDO/HB 混合 */
+    srand(1);
+    for (uint32_t i = 0; i < FRAME_COUNT; i++) {
+        uint16_t node = (uint16_t)(1U + (unsigned)rand() % 64U);
+        switch ((unsigned)rand() % 6U) {
+            case 0:  frames[i] = 0x080U; break;
+            case 1:  frames[i] = (uint16_t)(0x200U + NODE_ID); break;
+            case 2:  frames[i] = (uint16_t)(0x180U + node); break;
+            case 3:  frames[i] = (uint16_t)(0x280U + node); break;
+            case 4:  frames[i] = (uint16_t)(0x700U + node); break;
+            default: frames[i] = (uint16_t)(0x600U + NODE_ID); break;
+        }
+    }
+
+    printf("=== RX 分派索引 micro-benchmark (rxSize=%u, %u frames x %u) ===\n",
+           (unsigned)RX_SIZE, (unsigned)FRAME_COUNT, (unsigned)REPEAT);
+
+    setup_node();
+    errors += verify_all_idents("exact");
+    run_bench("exact");
+
+    /* 加入一個遮罩項 (0x180-0x1FF 所有 TPDO1)，驗證備用掃描路徑 */
+    rx_register(RX_SIZE - 1U, 0x180U, 0x780U);
+    errors += verify_all_idents("masked");
+    run_bench("masked");
+
+    /* 重新設定 RPDO1 COB-ID，舊登記必須被移除 */
+    rx_register(3, 0x222U, 0x7FFU);
+    errors += verify_all_idents("remap");
+
+    printf("%s\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
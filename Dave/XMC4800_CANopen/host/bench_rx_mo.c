@@ -0,0 +1,176 @@
+/**
+ * Host micro-benchmark for the direct MO receive path
+ *
+ * @file bench_rx_mo.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 以 xmc_can_mock.h 的 MO 暫存器比較 CO_CANinterrupt_Rx() 的兩種讀取方式：
+ *  1. 原本的做法：GetStatus + ResetStatus(RXPND) + CAN_NODE_MO_Receive() 複製到 XMC_CAN_MO_t，
+ *     再由 can_data[] 組成 uint64_t 逐位元組拆到 rcvMsg.data[]
+ *  2. CO_CANrxMo_read()：一次 MOCTR 寫入，暫存器直接寫入對齊的 CO_CANrxMsg_t
+ * 檢查兩者讀出的訊框相同、NEWDAT/RXPND 已清除、DLC 9~15 視為 8，
+ * 輸出每個訊框的平均時間 (不含 mock 寫入訊框的時間)。
+ * 在 XMC4800 上以 g_rx_frame_cycles_max (DWT) 量測實際週期。
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "DAVE.h"
+#include "CO_rx_mo.h"
+
+CAN_GLOBAL_TypeDef mock_can_global;
+CAN_MO_TypeDef mock_can_mo[256];
+
+#define MO_COUNT        16U
+#define FRAME_COUNT     (1U << 20)
+#define REPEAT          8U
+
+typedef struct {
+    uint16_t                ident;
+    uint8_t                 dlc;
+    uint32_t                dataLow;
+    uint32_t                dataHigh;
+} frame_t;
+
+static XMC_CAN_MO_t mo[MO_COUNT];
+static frame_t frames[FRAME_COUNT];
+static volatile uint32_t sink;
+
+/* 原本 CO_CANinterrupt_Rx() 的讀取流程 (CAN_NODE_MO_Receive() = XMC_CAN_MO_Receive()) */
+static bool legacy_read(XMC_CAN_MO_t *rx_mo, CO_CANrxMsg_t *rcvMsg)
+{
+    uint32_t mo_status = XMC_CAN_MO_GetStatus(rx_mo);
+    if ((mo_status & XMC_CAN_MO_STATUS_RX_PENDING) == 0U) {
+        return false;
+    }
+    XMC_CAN_MO_ResetStatus(rx_mo, XMC_CAN_MO_RESET_STATUS_RX_PENDING);
+    if (XMC_CAN_MO_Receive(rx_mo) != XMC_CAN_STATUS_SUCCESS) {
+        return false;
+    }
+    rcvMsg->ident = rx_mo->can_identifier & 0x07FFU;
+    rcvMsg->DLC = rx_mo->can_data_length & 0x0FU;
+    uint64_t received_data = ((uint64_t)rx_mo->can_data[1] << 32) | rx_mo->can_data[0];
+    for (int i = 0; i < rcvMsg->DLC && i < 8; i++) {
+        rcvMsg->data[i] = (uint8_t)((received_data >> (i * 8)) & 0xFF);
+    }
+    return true;
+}
+
+static bool direct_read(XMC_CAN_MO_t *rx_mo, CO_CANrxMsg_t *rcvMsg)
+{
+    if ((XMC_CAN_MO_GetStatus(rx_mo) & XMC_CAN_MO_STATUS_NEW_DATA) == 0U) {
+        return false;
+    }
+    CO_CANrxMo_read(rx_mo, rcvMsg);
+    return true;
+}
+
+static void make_frames(void)
+{
+    for (uint32_t i = 0; i < FRAME_COUNT; i++) {
+        frames[i].ident = (uint16_t)(rand() & 0x7FF);
+        frames[i].dlc = (uint8_t)(rand() % 9);
+        frames[i].dataLow = (uint32_t)rand() ^ ((uint32_t)rand() << 16);
+        frames[i].dataHigh = (uint32_t)rand() ^ ((uint32_t)rand() << 16);
+    }
+}
+
+static inline void store(uint32_t i)
+{
+    const frame_t *f = &frames[i];
+    mock_can_mo_store((uint8_t)(i % MO_COUNT), f->ident, f->dlc, f->dataLow, f->dataHigh);
+}
+
+/* 寫入 + 讀取 的時間減去只寫入 (並清除 NEWDAT) 的時間 */
+static double run_bench(bool (*read)(XMC_CAN_MO_t *, CO_CANrxMsg_t *))
+{
+    CO_CANrxMsg_t msg;
+    uint32_t acc = 0;
+
+    uint32_t t0 = host_cycles();
+    for (uint32_t r = 0; r < REPEAT; r++) {
+        for (uint32_t i = 0; i < FRAME_COUNT; i++) {
+            store(i);
+            mock_can_mo[i % MO_COUNT].MOSTAT &= ~(CAN_MO_MOSTAT_NEWDAT_Msk | CAN_MO_MOSTAT_RXPND_Msk);
+            acc += mock_can_mo[i % MO_COUNT].MOAR;
+        }
+    }
+    uint32_t nsStore = host_cycles() - t0;
+
+    t0 = host_cycles();
+    for (uint32_t r = 0; r < REPEAT; r++) {
+        for (uint32_t i = 0; i < FRAME_COUNT; i++) {
+            store(i);
+            (void)read(&mo[i % MO_COUNT], &msg);
+            acc += msg.data[0] + msg.DLC;
+        }
+    }
+    uint32_t ns = host_cycles() - t0;
+    sink = acc;
+    return ((double)ns - (double)nsStore) / ((double)REPEAT * FRAME_COUNT);
+}
+
+static int test_read(void)
+{
+    int errors = 0;
+
+    for (uint32_t i = 0; i < FRAME_COUNT; i++) {
+        CO_CANrxMsg_t legacy, direct;
+        uint8_t n = (uint8_t)(i % MO_COUNT);
+
+        memset(&legacy, 0, sizeof(legacy));
+        memset(&direct, 0, sizeof(direct));
+        store(i);
+        bool okLegacy = legacy_read(&mo[n], &legacy);
+        store(i);
+        bool okDirect = direct_read(&mo[n], &direct);
+
+        if (!okLegacy || !okDirect || legacy.ident != direct.ident || legacy.DLC != direct.DLC
+            || memcmp(legacy.data, direct.data, direct.DLC) != 0) {
+            if (errors++ == 0) {
+                printf("FAIL: frame %u: legacy 0x%03X/%u, direct 0x%03X/%u\n", i, legacy.ident, legacy.DLC,
+                       direct.ident, direct.DLC);
+            }
+        }
+        if ((mock_can_mo[n].MOSTAT & (CAN_MO_MOSTAT_NEWDAT_Msk | CAN_MO_MOSTAT_RXPND_Msk)) != 0U
+            || direct_read(&mo[n], &direct)) {
+            if (errors++ == 0) {
+                printf("FAIL: frame %u: NEWDAT/RXPND not cleared\n", i);
+            }
+        }
+    }
+
+    /* DLC 9~15：CAN 資料仍為 8 bytes */
+    CO_CANrxMsg_t msg;
+    mock_can_mo_store(0, 0x181, 12, 0x04030201U, 0x08070605U);
+    if (!direct_read(&mo[0], &msg) || msg.DLC != 8U || msg.ident != 0x181U || msg.data[7] != 0x08U) {
+        printf("FAIL: DLC 12 -> %u\n", msg.DLC);
+        errors++;
+    }
+    return errors;
+}
+
+int main(void)
+{
+    int errors = 0;
+
+    srand(1);
+    mock_can_reset();
+    for (uint8_t n = 0; n < MO_COUNT; n++) {
+        mock_can_mo_init(&mo[n], n, XMC_CAN_MO_TYPE_RECMSGOBJ);
+    }
+    make_frames();
+
+    printf("=== RX MO read: CAN_NODE_MO_Receive + byte unpack / CO_CANrxMo_read (%u frames x %u) ===\n",
+           (unsigned)FRAME_COUNT, (unsigned)REPEAT);
+    errors += test_read();
+
+    double nsLegacy = run_bench(legacy_read);
+    double nsDirect = run_bench(direct_read);
+    printf("legacy %.2f ns/frame, direct %.2f ns/frame (x%.1f)\n", nsLegacy, nsDirect, nsLegacy / nsDirect);
+
+    printf("%s\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,86 @@
+/**
+ * Host decoder for the deferred ISR log
+ *
+ * @file log_decode.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 解碼 CO_logRing_t 的記憶體傾印 (例如 GDB:
+ *   dump binary memory isr_log.bin &g_isr_log (&g_isr_log)+1)
+ * 依序號輸出緩衝區中保留的紀錄，格式來自與韌體共用的 port/CO_log_fmt.h。
+ * 用法: log_decode <dump.bin> [cpu_hz]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CO_log.h"
+
+#define RING_TAIL_BYTES     (3U * sizeof(uint32_t))     /* head, tail, dropped */
+
+static uint32_t read_u32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void read_entry(const uint8_t *p, CO_logEntry_t *entry)
+{
+    entry->id = (uint16_t)(p[0] | (p[1] << 8));
+    entry->seq = (uint16_t)(p[2] | (p[3] << 8));
+    entry->timestamp = read_u32(p + 4);
+    for (int i = 0; i < 4; i++) {
+        entry->arg[i] = read_u32(p + 8 + 4 * i);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <CO_logRing_t dump> [cpu_hz]\n", argv[0]);
+        return 2;
+    }
+    double cpu_hz = (argc > 2) ? atof(argv[2]) : 144e6;
+
+    FILE *f = fopen(argv[1], "rb");
+    if (f == NULL) {
+        perror(argv[1]);
+        return 2;
+    }
+    static uint8_t data[1U << 20];
+    size_t len = fread(data, 1, sizeof(data), f);
+    fclose(f);
+
+    if (len < RING_TAIL_BYTES + sizeof(CO_logEntry_t) ||
+        (len - RING_TAIL_BYTES) % sizeof(CO_logEntry_t) != 0U) {
+        fprintf(stderr, "%s: %zu bytes is not a CO_logRing_t dump\n", argv[1], len);
+        return 2;
+    }
+
+    /* 紀錄數由檔案大小推得，支援不同的 CO_LOG_RING_SIZE */
+    uint32_t size = (uint32_t)((len - RING_TAIL_BYTES) / sizeof(CO_logEntry_t));
+    const uint8_t *tailp = data + (size_t)size * sizeof(CO_logEntry_t);
+    uint32_t head = read_u32(tailp);
+    uint32_t tail = read_u32(tailp + 4);
+    uint32_t dropped = read_u32(tailp + 8);
+    uint32_t first = (head > size) ? head - size : 0U;
+
+    printf("ring: %u entries, head %u, tail %u, dropped %u\n", size, head, tail, dropped);
+
+    uint32_t last_ts = 0;
+    for (uint32_t n = first; n < head; n++) {
+        CO_logEntry_t entry;
+        char line[160];
+
+        read_entry(data + (size_t)(n % size) * sizeof(CO_logEntry_t), &entry);
+        if (entry.seq != (uint16_t)n) {
+            printf("%6u  <overwritten>\n", n);
+            continue;
+        }
+        CO_log_format(&entry, line, sizeof(line));
+        printf("%6u %c %10u  +%9.3f us  %s\n", n, n < tail ? ' ' : '*', entry.timestamp,
+               n == first ? 0.0 : (double)(uint32_t)(entry.timestamp - last_ts) * 1e6 / cpu_hz, line);
+        last_ts = entry.timestamp;
+    }
+
+    return 0;
+}
@@ -0,0 +1,813 @@
+/**
+ * Object Dictionary generator for CANopenNode V4 (application/OD.c, OD.h)
+ *
+ * @file od_gen.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 讀取 EDS (XMC4800_profile.eds，libedssharp 匯出的 ";StorageLocation=" 註解決定資料群組)，
+ * 產生與 libedssharp 相同名稱與佈局的 OD.c / OD.h，另外加上：
+ *  1. 常數 (CO_PROGMEM) 的 OD_find() 直接索引查表 - 不必在啟動時以 OD_initLookup() 建立於 RAM
+ *  2. 固定長度變數與 record 子項目的 static inline 讀取函式 (OD_get_xIIII_name())；不產生寫入函式，
+ *     寫入必須經過 OD_set_value() 才會檢查屬性、呼叫 OD 擴充並要求 TPDO / COS
+ *  3. 物件屬性 (ODA_*) 在產生時決定，ODObjs 與查表都是 flash 中的常數
+ *
+ * 用法: od_gen <file.eds> <輸出目錄>
+ * 支援 VAR / ARRAY / RECORD 與 BOOLEAN、INTEGER8~64、UNSIGNED8~64、REAL32/64，
+ * DOMAIN 只支援 VAR：與 libedssharp 相同沒有資料 (dataOrig = NULL)，由應用程式以 OD 擴充存取；
+ * 字串物件會回報錯誤 (目前的 profile 沒有使用)。
+ */
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define OBJ_MAX         1024U
+#define TEXT_MAX        128U
+#define GROUP_MAX       8U
+
+#define OT_VAR          0x7U
+#define OT_ARR          0x8U
+#define OT_REC          0x9U
+
+#define DT_DOMAIN       0x0FU
+
+typedef struct {
+    bool                    present;
+    char                    name[TEXT_MAX];
+    char                    storage[TEXT_MAX];
+    uint16_t                dataType;
+    char                    access[16];
+    char                    defaultValue[TEXT_MAX];
+    bool                    pdoMapping;
+} edsSub_t;
+
+typedef struct {
+    uint16_t                index;
+    uint8_t                 objectType;
+    uint16_t                subNumber;
+    char                    name[TEXT_MAX];
+    char                    cname[TEXT_MAX];
+    char                    storage[TEXT_MAX];
+    edsSub_t                var;            /* VAR: 本身的參數 */
+    edsSub_t               *subs;           /* ARRAY / RECORD: 256 個子項目 */
+} edsObj_t;
+
+typedef struct {
+    const char             *ctype;
+    uint8_t                 length;
+    bool                    isSigned;
+    bool                    isFloat;
+} dataType_t;
+
+static edsObj_t objs[OBJ_MAX];
+static edsObj_t *sorted[OBJ_MAX];
+static uint32_t objCount;
+static char groups[GROUP_MAX][TEXT_MAX];
+static uint32_t groupCount;
+
+/* [FileInfo] / [DeviceInfo] 的欄位 - 檔頭註解 */
+static char fileInfo[16][2][TEXT_MAX];
+static uint32_t fileInfoCount;
+
+static void fail(const char *fmt, ...)
+{
+    va_list ap;
+    va_start(ap, fmt);
+    fprintf(stderr, "od_gen: ");
+    vfprintf(stderr, fmt, ap);
+    fprintf(stderr, "\n");
+    va_end(ap);
+    exit(1);
+}
+
+static const dataType_t *data_type(uint16_t dataType, uint16_t index)
+{
+    static const dataType_t types[] = {
+        [0x01] = {"bool_t", 1, false, false},   [0x02] = {"int8_t", 1, true, false},
+        [0x03] = {"int16_t", 2, true, false},   [0x04] = {"int32_t", 4, true, false},
+        [0x05] = {"uint8_t", 1, false, false},  [0x06] = {"uint16_t", 2, false, false},
+        [0x07] = {"uint32_t", 4, false, false}, [0x08] = {"float32_t", 4, true, true},
+        [0x11] = {"float64_t", 8, true, true},  [0x15] = {"int64_t", 8, true, false},
+        [0x1B] = {"uint64_t", 8, false, false},
+    };
+    if (dataType >= sizeof(types) / sizeof(types[0]) || types[dataType].ctype == NULL) {
+        fail("0x%04X: unsupported DataType 0x%04X", index, dataType);
+    }
+    return &types[dataType];
+}
+
+static bool is_domain(const edsObj_t *obj)
+{
+    return obj->objectType == OT_VAR && obj->var.dataType == DT_DOMAIN;
+}
+
+static void trim(char *s)
+{
+    size_t len = strlen(s);
+    while (len > 0U && isspace((unsigned char)s[len - 1U])) {
+        s[--len] = '\0';
+    }
+    size_t start = 0;
+    while (isspace((unsigned char)s[start])) {
+        start++;
+    }
+    memmove(s, s + start, len - start + 1U);
+}
+
+static void copy_text(char *dst, const char *src)
+{
+    snprintf(dst, TEXT_MAX, "%s", src);
+}
+
+/*
+ * libedssharp 的 C 名稱規則：'-' 換成 '_'，以其他非文字字元分詞，每個詞首字大寫後串接；
+ * 前一字元是大寫且本詞是縮寫 (前兩個字元大寫，例如 "COB-ID SYNC") 或詞首是數字時插入 '_'；
+ * 第二個字元是小寫時第一個字元改為小寫。
+ */
+static void make_cname(char *out, const char *name)
+{
+    size_t len = 0;
+    const char *p = name;
+
+    while (*p != '\0') {
+        while (*p != '\0' && !(isalnum((unsigned char)*p) || *p == '_' || *p == '-')) {
+            p++;
+        }
+        if (*p == '\0') {
+            break;
+        }
+        char first = (char)toupper((unsigned char)*p);
+        bool acronym = isupper((unsigned char)p[0]) && !islower((unsigned char)p[1]);
+        if (len > 0U && ((isupper((unsigned char)out[len - 1U]) && acronym) || isdigit((unsigned char)first))) {
+            out[len++] = '_';
+        }
+        out[len++] = first;
+        p++;
+        while (isalnum((unsigned char)*p) || *p == '_' || *p == '-') {
+            out[len++] = (*p == '-') ? '_' : *p;
+            p++;
+        }
+        if (len > TEXT_MAX - 8U) {
+            fail("name too long: %s", name);
+        }
+    }
+    out[len] = '\0';
+    if (len > 1U && islower((unsigned char)out[1])) {
+        out[0] = (char)tolower((unsigned char)out[0]);
+    } else if (len == 1U) {
+        out[0] = (char)tolower((unsigned char)out[0]);
+    }
+}
+
+static edsObj_t *find_obj(uint16_t index, bool create)
+{
+    for (uint32_t i = 0; i < objCount; i++) {
+        if (objs[i].index == index) {
+            return &objs[i];
+        }
+    }
+    if (!create) {
+        return NULL;
+    }
+    if (objCount >= OBJ_MAX) {
+        fail("too many objects");
+    }
+    edsObj_t *obj = &objs[objCount++];
+    obj->index = index;
+    return obj;
+}
+
+/******************************************************************************/
+/* EDS 讀取 */
+static void set_param(edsObj_t *obj, edsSub_t *sub, const char *key, const char *value)
+{
+    if (strcmp(key, "ParameterName") == 0) {
+        copy_text(sub != NULL ? sub->name : obj->name, value);
+        if (sub == NULL) {
+            copy_text(obj->var.name, value);
+        }
+    } else if (strcmp(key, ";StorageLocation") == 0) {
+        copy_text(sub != NULL ? sub->storage : obj->storage, value);
+    } else if (strcmp(key, "ObjectType") == 0 && sub == NULL) {
+        obj->objectType = (uint8_t)strtoul(value, NULL, 0);
+    } else if (strcmp(key, "SubNumber") == 0 && sub == NULL) {
+        obj->subNumber = (uint16_t)strtoul(value, NULL, 0);
+    } else {
+        edsSub_t *s = (sub != NULL) ? sub : &obj->var;
+        if (strcmp(key, "DataType") == 0) {
+            s->dataType = (uint16_t)strtoul(value, NULL, 0);
+        } else if (strcmp(key, "AccessType") == 0) {
+            snprintf(s->access, sizeof(s->access), "%s", value);
+        } else if (strcmp(key, "DefaultValue") == 0) {
+            copy_text(s->defaultValue, value);
+        } else if (strcmp(key, "PDOMapping") == 0) {
+            s->pdoMapping = strtoul(value, NULL, 0) != 0U;
+        }
+    }
+}
+
+static void read_eds(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[TEXT_MAX];
+    char section[TEXT_MAX] = "";
+    edsObj_t *obj = NULL;
+    edsSub_t *sub = NULL;
+
+    if (f == NULL) {
+        fail("cannot open %s", path);
+    }
+    while (fgets(line, sizeof(line), f) != NULL) {
+        trim(line);
+        if (line[0] == '[') {
+            char *end = strchr(line, ']');
+            if (end == NULL) {
+                fail("bad section: %s", line);
+            }
+            *end = '\0';
+            copy_text(section, line + 1);
+            obj = NULL;
+            sub = NULL;
+
+            /* [IIII] 或 [IIIIsubS] (十六進位) */
+            char *endIndex;
+            unsigned long index = strtoul(section, &endIndex, 16);
+            if (endIndex == section + 4) {
+                if (*endIndex == '\0') {
+                    obj = find_obj((uint16_t)index, true);
+                } else if (strncmp(endIndex, "sub", 3) == 0) {
+                    char *endSub;
+                    unsigned long subIndex = strtoul(endIndex + 3, &endSub, 16);
+                    if (*endSub != '\0' || subIndex > 0xFFU) {
+                        fail("bad section: %s", section);
+                    }
+                    obj = find_obj((uint16_t)index, true);
+                    if (obj->subs == NULL) {
+                        obj->subs = calloc(256, sizeof(edsSub_t));
+                    }
+                    sub = &obj->subs[subIndex];
+                    sub->present = true;
+                }
+            }
+            continue;
+        }
+
+        char *eq = strchr(line, '=');
+        if (eq == NULL) {
+            continue;
+        }
+        *eq = '\0';
+        char *key = line, *value = eq + 1;
+        trim(key);
+        trim(value);
+        if (obj != NULL) {
+            set_param(obj, sub, key, value);
+        } else if ((strcmp(section, "FileInfo") == 0 || strcmp(section, "DeviceInfo") == 0)
+                   && fileInfoCount < sizeof(fileInfo) / sizeof(fileInfo[0])) {
+            copy_text(fileInfo[fileInfoCount][0], key);
+            copy_text(fileInfo[fileInfoCount][1], value);
+            fileInfoCount++;
+        }
+    }
+    fclose(f);
+}
+
+static const char *file_info(const char *key)
+{
+    for (uint32_t i = 0; i < fileInfoCount; i++) {
+        if (strcmp(fileInfo[i][0], key) == 0) {
+            return fileInfo[i][1];
+        }
+    }
+    return "";
+}
+
+static int cmp_obj(const void *a, const void *b)
+{
+    return (int)(*(edsObj_t *const *)a)->index - (int)(*(edsObj_t *const *)b)->index;
+}
+
+/* 排序、檢查並整理資料群組 (依第一次出現的順序) */
+static void prepare(void)
+{
+    for (uint32_t i = 0; i < objCount; i++) {
+        edsObj_t *obj = &objs[i];
+        sorted[i] = obj;
+        if (obj->objectType == 0U) {
+            obj->objectType = OT_VAR;
+        }
+        if (obj->objectType != OT_VAR && obj->objectType != OT_ARR && obj->objectType != OT_REC) {
+            fail("0x%04X: unsupported ObjectType 0x%X", obj->index, obj->objectType);
+        }
+        if (obj->objectType != OT_VAR) {
+            uint16_t count = 0;
+            if (obj->subs == NULL || !obj->subs[0].present) {
+                fail("0x%04X: missing sub0", obj->index);
+            }
+            for (uint16_t s = 0; s < 256U; s++) {
+                if (obj->subs[s].present) {
+                    (void)data_type(obj->subs[s].dataType, obj->index);
+                    count++;
+                }
+            }
+            if (count != obj->subNumber) {
+                fail("0x%04X: SubNumber 0x%X, %u sub-objects", obj->index, obj->subNumber, count);
+            }
+            if (obj->objectType == OT_ARR && !obj->subs[count - 1U].present) {
+                fail("0x%04X: array sub-objects are not contiguous", obj->index);
+            }
+        } else if (obj->var.dataType != DT_DOMAIN) {
+            (void)data_type(obj->var.dataType, obj->index);
+        }
+        make_cname(obj->cname, obj->name);
+        if (obj->storage[0] == '\0') {
+            copy_text(obj->storage, "RAM");
+        }
+    }
+    qsort(sorted, objCount, sizeof(sorted[0]), cmp_obj);
+
+    for (uint32_t i = 0; i < objCount; i++) {
+        uint32_t g;
+        if (is_domain(sorted[i])) {
+            continue;
+        }
+        for (g = 0; g < groupCount; g++) {
+            if (strcmp(groups[g], sorted[i]->storage) == 0) {
+                break;
+            }
+        }
+        if (g == groupCount) {
+            if (groupCount >= GROUP_MAX) {
+                fail("too many storage groups");
+            }
+            copy_text(groups[groupCount++], sorted[i]->storage);
+        }
+    }
+}
+
+/******************************************************************************/
+/* 輸出輔助 */
+static const char *sdo_access(const edsSub_t *sub)
+{
+    if (strcmp(sub->access, "ro") == 0 || strcmp(sub->access, "const") == 0) {
+        return "ODA_SDO_R";
+    }
+    if (strcmp(sub->access, "wo") == 0) {
+        return "ODA_SDO_W";
+    }
+    return "ODA_SDO_RW";
+}
+
+static const char *attribute(const edsSub_t *sub, uint16_t index)
+{
+    static char buf[64];
+    const dataType_t *type = data_type(sub->dataType, index);
+
+    snprintf(buf, sizeof(buf), "%s%s%s", sdo_access(sub), sub->pdoMapping ? " | ODA_TRPDO" : "",
+             type->length > 1U ? " | ODA_MB" : "");
+    return buf;
+}
+
+/* 預設值 - 去除 "$NODEID" (節點 ID 由 CANopenNode 在執行時加上) */
+static const char *default_value(const edsSub_t *sub, uint16_t index)
+{
+    static char buf[TEXT_MAX];
+    const dataType_t *type = data_type(sub->dataType, index);
+    char value[TEXT_MAX];
+    char *p;
+
+    copy_text(value, sub->defaultValue);
+    while ((p = strstr(value, "$NODEID")) != NULL) {
+        memmove(p, p + 7, strlen(p + 7) + 1U);
+    }
+    for (p = value; *p != '\0'; p++) {
+        if (*p == '+') {
+            *p = ' ';
+        }
+    }
+    trim(value);
+
+    if (type->isFloat) {
+        snprintf(buf, sizeof(buf), "%s", value[0] != '\0' ? value : "0");
+        return buf;
+    }
+    int base = (value[0] == '0' && (value[1] == 'x' || value[1] == 'X')) ? 16 : 10;
+    char *end;
+    if (type->isSigned) {
+        long long v = strtoll(value, &end, base);
+        trim(end);
+        if (*end != '\0') {
+            fail("0x%04X: bad DefaultValue '%s'", index, sub->defaultValue);
+        }
+        snprintf(buf, sizeof(buf), "%lld", v);
+    } else {
+        unsigned long long v = strtoull(value, &end, base);
+        trim(end);
+        if (*end != '\0') {
+            fail("0x%04X: bad DefaultValue '%s'", index, sub->defaultValue);
+        }
+        snprintf(buf, sizeof(buf), "0x%0*llX", type->length * 2, v);
+    }
+    return buf;
+}
+
+static const char *sub_cname(const edsSub_t *sub)
+{
+    static char buf[TEXT_MAX];
+    make_cname(buf, sub->name);
+    return buf;
+}
+
+static uint32_t count_index(uint16_t from, uint16_t to)
+{
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < objCount; i++) {
+        if (sorted[i]->index >= from && sorted[i]->index <= to) {
+            count++;
+        }
+    }
+    return count;
+}
+
+static void file_header(FILE *f, bool withInfo)
+{
+    fprintf(f, "/*******************************************************************************\n"
+               "    CANopen Object Dictionary definition for CANopenNode V4\n"
+               "\n"
+               "    This file was automatically generated with host/od_gen.c\n"
+               "    (same names and layout as libedssharp, plus constant OD_find() lookup\n"
+               "    table and typed getters of fixed-size variables)\n"
+               "\n"
+               "    https://github.com/CANopenNode/CANopenNode\n"
+               "\n"
+               "    DON'T EDIT THIS FILE MANUALLY, REGENERATE WITH 'make od' IN host/ !!!!\n");
+    if (!withInfo) {
+        fprintf(f, "*******************************************************************************/\n\n");
+        return;
+    }
+    fprintf(f, "********************************************************************************\n"
+               "\n"
+               "    File info:\n"
+               "        File Names:   OD.h; OD.c\n"
+               "        Project File: %s\n"
+               "        File Version: %s\n"
+               "\n"
+               "        Created:      %s %s\n"
+               "        Created By:   %s\n"
+               "        Modified:     %s %s\n"
+               "        Modified By:  %s\n"
+               "\n"
+               "    Device Info:\n"
+               "        Vendor Name:  %s\n"
+               "        Vendor ID:    %s\n"
+               "        Product Name: %s\n"
+               "        Product ID:   %s\n"
+               "\n"
+               "        Description:  %s\n"
+               "*******************************************************************************/\n\n",
+            file_info("FileName"), file_info("FileVersion"), file_info("CreationDate"),
+            file_info("CreationTime"), file_info("CreatedBy"), file_info("ModificationDate"),
+            file_info("ModificationTime"), file_info("ModifiedBy"), file_info("VendorName"),
+            file_info("VendorNumber"), file_info("ProductName"), file_info("ProductNumber"),
+            file_info("Description"));
+}
+
+/******************************************************************************/
+/* OD.h */
+static void write_header(FILE *f)
+{
+    static const struct {
+        const char *name;
+        uint16_t from, to;
+    } counters[] = {
+        {"NMT", 0x1000, 0x1000},      {"EM", 0x1001, 0x1001},       {"SYNC", 0x1005, 0x1005},
+        {"SYNC_PROD", 0x1006, 0x1006}, {"STORAGE", 0x1010, 0x1010},  {"TIME", 0x1012, 0x1012},
+        {"EM_PROD", 0x1014, 0x1014},   {"HB_CONS", 0x1016, 0x1016},  {"HB_PROD", 0x1017, 0x1017},
+        {"SDO_SRV", 0x1200, 0x127F},   {"SDO_CLI", 0x1280, 0x12FF},  {"GFC", 0x1300, 0x1300},
+        {"SRDO", 0x1301, 0x1340},      {"RPDO", 0x1400, 0x15FF},     {"TPDO", 0x1800, 0x19FF},
+    };
+
+    file_header(f, true);
+    fprintf(f, "#ifndef OD_H\n#define OD_H\n");
+    fprintf(f, "/*******************************************************************************\n"
+               "    Counters of OD objects\n"
+               "*******************************************************************************/\n");
+    for (uint32_t i = 0; i < sizeof(counters) / sizeof(counters[0]); i++) {
+        uint32_t count = count_index(counters[i].from, counters[i].to);
+        if (count > 0U) {
+            fprintf(f, "#define OD_CNT_%s %u\n", counters[i].name, count);
+        }
+    }
+
+    fprintf(f, "\n\n/*******************************************************************************\n"
+               "    Sizes of OD arrays\n"
+               "*******************************************************************************/\n");
+    for (uint32_t i = 0; i < objCount; i++) {
+        if (sorted[i]->objectType == OT_ARR) {
+            fprintf(f, "#define OD_CNT_ARR_%04X %u\n", sorted[i]->index, sorted[i]->subNumber - 1U);
+        }
+    }
+
+    fprintf(f, "\n\n/*******************************************************************************\n"
+               "    OD data declaration of all groups\n"
+               "*******************************************************************************/\n");
+    for (uint32_t g = 0; g < groupCount; g++) {
+        fprintf(f, "typedef struct {\n");
+        for (uint32_t i = 0; i < objCount; i++) {
+            const edsObj_t *obj = sorted[i];
+            if (strcmp(obj->storage, groups[g]) != 0 || is_domain(obj)) {
+                continue;
+            }
+            if (obj->objectType == OT_VAR) {
+                fprintf(f, "    %s x%04X_%s;\n", data_type(obj->var.dataType, obj->index)->ctype, obj->index,
+                        obj->cname);
+            } else if (obj->objectType == OT_ARR) {
+                fprintf(f, "    %s x%04X_%s_sub0;\n", data_type(obj->subs[0].dataType, obj->index)->ctype,
+                        obj->index, obj->cname);
+                fprintf(f, "    %s x%04X_%s[%u];\n", data_type(obj->subs[1].dataType, obj->index)->ctype,
+                        obj->index, obj->cname, obj->subNumber - 1U);
+            } else {
+                fprintf(f, "    struct {\n");
+                for (uint16_t s = 0; s < 256U; s++) {
+                    if (obj->subs[s].present) {
+                        fprintf(f, "        %s %s;\n", data_type(obj->subs[s].dataType, obj->index)->ctype,
+                                sub_cname(&obj->subs[s]));
+                    }
+                }
+                fprintf(f, "    } x%04X_%s;\n", obj->index, obj->cname);
+            }
+        }
+        fprintf(f, "} OD_%s_t;\n\n", groups[g]);
+    }
+    for (uint32_t g = 0; g < groupCount; g++) {
+        fprintf(f, "extern OD_%s_t OD_%s;\n", groups[g], groups[g]);
+    }
+    fprintf(f, "extern OD_t *OD;\n");
+
+    fprintf(f, "\n\n/*******************************************************************************\n"
+               "    Object dictionary entries - shortcuts\n"
+               "*******************************************************************************/\n");
+    for (uint32_t i = 0; i < objCount; i++) {
+        fprintf(f, "#define OD_ENTRY_H%04X &OD->list[%u]\n", sorted[i]->index, i);
+    }
+
+    fprintf(f, "\n\n/*******************************************************************************\n"
+               "    Object dictionary entries - shortcuts with names\n"
+               "*******************************************************************************/\n");
+    for (uint32_t i = 0; i < objCount; i++) {
+        fprintf(f, "#define OD_ENTRY_H%04X_%s &OD->list[%u]\n", sorted[i]->index, sorted[i]->cname, i);
+    }
+
+    fprintf(f, "\n\n/*******************************************************************************\n"
+               "    Typed getters of fixed-size variables and record sub-objects\n"
+               "\n"
+               "    Direct read of the original data location, same as OD_get_value() with\n"
+               "    odOrig = true: no OD_find(), no OD_IO_t stream, IO extensions are\n"
+               "    bypassed. There are no setters: write with OD_set_value() / OD_set_*(),\n"
+               "    which check ODA_SDO_W, call the IO extension and request the TPDO.\n"
+               "    Arrays are read directly: OD_<group>.xIIII_name[subIndex - 1].\n"
+               "*******************************************************************************/\n");
+    for (uint32_t i = 0; i < objCount; i++) {
+        const edsObj_t *obj = sorted[i];
+        if (is_domain(obj)) {
+            continue;
+        }
+        if (obj->objectType == OT_VAR) {
+            const char *ctype = data_type(obj->var.dataType, obj->index)->ctype;
+            fprintf(f, "static inline %s OD_get_x%04X_%s(void) { return OD_%s.x%04X_%s; }\n", ctype, obj->index,
+                    obj->cname, obj->storage, obj->index, obj->cname);
+        } else if (obj->objectType == OT_REC) {
+            for (uint16_t s = 0; s < 256U; s++) {
+                if (!obj->subs[s].present) {
+                    continue;
+                }
+                const char *ctype = data_type(obj->subs[s].dataType, obj->index)->ctype;
+                char sub[TEXT_MAX];
+                copy_text(sub, sub_cname(&obj->subs[s]));
+                fprintf(f, "static inline %s OD_get_x%04X_%s_%s(void) { return OD_%s.x%04X_%s.%s; }\n", ctype,
+                        obj->index, obj->cname, sub, obj->storage, obj->index, obj->cname, sub);
+            }
+        }
+    }
+    fprintf(f, "\n#endif /* OD_H */\n");
+}
+
+/******************************************************************************/
+/* OD.c */
+static void write_data(FILE *f)
+{
+    fprintf(f, "/*******************************************************************************\n"
+               "    OD data initialization of all groups\n"
+               "*******************************************************************************/\n");
+    for (uint32_t g = 0; g < groupCount; g++) {
+        bool first = true;
+        fprintf(f, "OD_%s_t OD_%s = {", groups[g], groups[g]);
+        for (uint32_t i = 0; i < objCount; i++) {
+            const edsObj_t *obj = sorted[i];
+            if (strcmp(obj->storage, groups[g]) != 0 || is_domain(obj)) {
+                continue;
+            }
+            fprintf(f, "%s\n", first ? "" : ",");
+            first = false;
+            if (obj->objectType == OT_VAR) {
+                fprintf(f, "    .x%04X_%s = %s", obj->index, obj->cname, default_value(&obj->var, obj->index));
+            } else if (obj->objectType == OT_ARR) {
+                fprintf(f, "    .x%04X_%s_sub0 = %s,\n", obj->index, obj->cname, default_value(&obj->subs[0], obj->index));
+                fprintf(f, "    .x%04X_%s = {", obj->index, obj->cname);
+                for (uint16_t s = 1; s < obj->subNumber; s++) {
+                    fprintf(f, "%s%s", s > 1U ? ", " : "", default_value(&obj->subs[s], obj->index));
+                }
+                fprintf(f, "}");
+            } else {
+                bool firstSub = true;
+                fprintf(f, "    .x%04X_%s = {", obj->index, obj->cname);
+                for (uint16_t s = 0; s < 256U; s++) {
+                    if (obj->subs[s].present) {
+                        fprintf(f, "%s\n        .%s = %s", firstSub ? "" : ",", sub_cname(&obj->subs[s]),
+                                default_value(&obj->subs[s], obj->index));
+                        firstSub = false;
+                    }
+                }
+                fprintf(f, "\n    }");
+            }
+        }
+        fprintf(f, "\n};\n\n");
+    }
+}
+
+static void write_objs(FILE *f)
+{
+    fprintf(f, "\n\n/*******************************************************************************\n"
+               "    All OD objects (constant definitions)\n"
+               "*******************************************************************************/\n"
+               "typedef struct {\n");
+    for (uint32_t i = 0; i < objCount; i++) {
+        const edsObj_t *obj = sorted[i];
+        if (obj->objectType == OT_VAR) {
+            fprintf(f, "    OD_obj_var_t o_%04X_%s;\n", obj->index, obj->cname);
+        } else if (obj->objectType == OT_ARR) {
+            fprintf(f, "    OD_obj_array_t o_%04X_%s;\n", obj->index, obj->cname);
+        } else {
+            fprintf(f, "    OD_obj_record_t o_%04X_%s[%u];\n", obj->index, obj->cname, obj->subNumber);
+        }
+    }
+    fprintf(f, "} ODObjs_t;\n\nstatic CO_PROGMEM ODObjs_t ODObjs = {");
+
+    for (uint32_t i = 0; i < objCount; i++) {
+        const edsObj_t *obj = sorted[i];
+        fprintf(f, "%s\n    .o_%04X_%s = {\n", i > 0U ? "," : "", obj->index, obj->cname);
+        if (is_domain(obj)) {
+            fprintf(f, "        .dataOrig = NULL,\n");
+            fprintf(f, "        .attribute = %s,\n", sdo_access(&obj->var));
+            fprintf(f, "        .dataLength = 0\n");
+        } else if (obj->objectType == OT_VAR) {
+            fprintf(f, "        .dataOrig = &OD_%s.x%04X_%s,\n", obj->storage, obj->index, obj->cname);
+            fprintf(f, "        .attribute = %s,\n", attribute(&obj->var, obj->index));
+            fprintf(f, "        .dataLength = %u\n", data_type(obj->var.dataType, obj->index)->length);
+        } else if (obj->objectType == OT_ARR) {
+            const dataType_t *type = data_type(obj->subs[1].dataType, obj->index);
+            fprintf(f, "        .dataOrig0 = &OD_%s.x%04X_%s_sub0,\n", obj->storage, obj->index, obj->cname);
+            fprintf(f, "        .dataOrig = &OD_%s.x%04X_%s[0],\n", obj->storage, obj->index, obj->cname);
+            fprintf(f, "        .attribute0 = %s,\n", attribute(&obj->subs[0], obj->index));
+            fprintf(f, "        .attribute = %s,\n", attribute(&obj->subs[1], obj->index));
+            fprintf(f, "        .dataElementLength = %u,\n", type->length);
+            fprintf(f, "        .dataElementSizeof = sizeof(%s)\n", type->ctype);
+        } else {
+            bool firstSub = true;
+            for (uint16_t s = 0; s < 256U; s++) {
+                const edsSub_t *sub = &obj->subs[s];
+                if (!sub->present) {
+                    continue;
+                }
+                fprintf(f, "%s        {\n", firstSub ? "" : ",\n");
+                firstSub = false;
+                fprintf(f, "            .dataOrig = &OD_%s.x%04X_%s.%s,\n", obj->storage, obj->index, obj->cname,
+                        sub_cname(sub));
+                fprintf(f, "            .subIndex = %u,\n", s);
+                fprintf(f, "            .attribute = %s,\n", attribute(sub, obj->index));
+                fprintf(f, "            .dataLength = %u\n", data_type(sub->dataType, obj->index)->length);
+                fprintf(f, "        }");
+            }
+            fprintf(f, "\n");
+        }
+        fprintf(f, "    }");
+    }
+    fprintf(f, "\n};\n");
+}
+
+static void write_list(FILE *f)
+{
+    static const char *const odt[] = {[OT_VAR] = "ODT_VAR", [OT_ARR] = "ODT_ARR", [OT_REC] = "ODT_REC"};
+    uint16_t pageSlot[256];
+    uint16_t pages = 0;
+
+    fprintf(f, "\n\n/*******************************************************************************\n"
+               "    Object dictionary\n"
+               "*******************************************************************************/\n"
+               "static OD_entry_t ODList[] = {\n");
+    for (uint32_t i = 0; i < objCount; i++) {
+        const edsObj_t *obj = sorted[i];
+        fprintf(f, "    {0x%04X, 0x%02X, %s, &ODObjs.o_%04X_%s, NULL},\n", obj->index,
+                obj->objectType == OT_VAR ? 1U : obj->subNumber, odt[obj->objectType], obj->index, obj->cname);
+    }
+    fprintf(f, "    {0x0000, 0x00, 0, NULL, NULL}\n};\n");
+
+    /* OD_find() 查表：頁 = index 高位元組，槽 = 低位元組，內容 = ODList 位置 + 1 (0 = 不存在) */
+    for (uint16_t p = 0; p < 256U; p++) {
+        pageSlot[p] = 0xFFU;
+    }
+    for (uint32_t i = 0; i < objCount; i++) {
+        uint8_t page = (uint8_t)(sorted[i]->index >> 8);
+        if (pageSlot[page] == 0xFFU) {
+            if (pages >= 0xFFU) {
+                fail("too many lookup pages");
+            }
+            pageSlot[page] = pages++;
+        }
+    }
+
+    fprintf(f, "\n\n/*******************************************************************************\n"
+               "    OD_find() direct-index lookup table (constant, see OD_lookup_t)\n"
+               "*******************************************************************************/\n"
+               "static CO_PROGMEM uint16_t ODLookupSlots[%u][256] = {", pages);
+    for (uint16_t p = 0; p < 256U; p++) {
+        if (pageSlot[p] == 0xFFU) {
+            continue;
+        }
+        uint32_t n = 0;
+        fprintf(f, "%s\n    { /* 0x%02Xxx */", pageSlot[p] > 0U ? "," : "", p);
+        for (uint32_t i = 0; i < objCount; i++) {
+            if ((sorted[i]->index >> 8) == p) {
+                fprintf(f, "%s[0x%02X] = %u", (n % 8U) == 0U ? (n > 0U ? ",\n        " : "\n        ") : ", ",
+                        sorted[i]->index & 0xFFU, i + 1U);
+                n++;
+            }
+        }
+        fprintf(f, "\n    }");
+    }
+    fprintf(f, "\n};\n\nstatic CO_PROGMEM OD_lookup_t ODLookup = {\n    .page = {");
+    for (uint16_t p = 0; p < 256U; p++) {
+        fprintf(f, "%s0x%02X", (p % 16U) == 0U ? (p > 0U ? ",\n        " : "\n        ") : ", ", pageSlot[p]);
+    }
+    fprintf(f, "\n    },\n    .slots = ODLookupSlots\n};\n");
+
+    fprintf(f, "\nstatic OD_t _OD = {\n"
+               "    (sizeof(ODList) / sizeof(ODList[0])) - 1,\n"
+               "    &ODList[0],\n"
+               "    &ODLookup\n"
+               "};\n\n"
+               "OD_t *OD = &_OD;\n");
+}
+
+static void write_source(FILE *f)
+{
+    file_header(f, false);
+    fprintf(f, "#define OD_DEFINITION\n"
+               "#include \"301/CO_ODinterface.h\"\n"
+               "#include \"OD.h\"\n"
+               "\n"
+               "#if CO_VERSION_MAJOR < 4\n"
+               "#error This Object dictionary is compatible with CANopenNode V4.0 and above!\n"
+               "#endif\n"
+               "\n");
+    write_data(f);
+    write_objs(f);
+    write_list(f);
+}
+
+static FILE *open_out(const char *dir, const char *name)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", dir, name);
+    FILE *f = fopen(path, "w");
+    if (f == NULL) {
+        fail("cannot write %s", path);
+    }
+    return f;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 3) {
+        fprintf(stderr, "usage: od_gen <file.eds> <output directory>\n");
+        return 2;
+    }
+    read_eds(argv[1]);
+    if (objCount == 0U) {
+        fail("%s: no objects", argv[1]);
+    }
+    prepare();
+
+    FILE *f = open_out(argv[2], "OD.h");
+    write_header(f);
+    fclose(f);
+    f = open_out(argv[2], "OD.c");
+    write_source(f);
+    fclose(f);
+    printf("od_gen: %u objects, %u groups -> %s/OD.c, OD.h\n", objCount, groupCount, argv[2]);
+    return 0;
+}
@@ -0,0 +1,400 @@
+/**
+ * Discrete-event CAN bus simulator: N CANopen nodes on virtual time
+ *
+ * @file sim_can_bus.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * N 個完整的 CANopen 節點 (CO_hostNode_new()) 掛在 CO_vbus_t 上，以虛擬時間 (ns) 執行：
+ *  - 匯流排：COB-ID 仲裁，訊框長度含位元填充 (CO_vbus_frameBits())
+ *  - 節點：每 1 ms 執行 CO_process() 與 RT slot，各節點的 1 ms 相位錯開；
+ *    -r 1 (預設) 時 SYNC 接收回呼立即執行 RT slot (與韌體 CO_rt 相同)
+ *  - 外部主站每 -s us 送出 SYNC
+ * 報告匯流排負載、TPDO 延遲百分位數 (CO_CANsend() 到訊框結束、SYNC 到 TPDO 結束)
+ * 與心跳間隔 (消費者逾時 = -c 倍生產者週期)。
+ * 節點共用 application/OD.c，TPDO 設定寫入共用的 0x1800/0x1A00 (映射 0x1001 以得到 -l bytes)。
+ *
+ * 使用方式: sim_can_bus [-n nodes] [-b kbit/s] [-s SYNC us] [-p TPDOs] [-l bytes]
+ *                       [-t transmission type] [-e event timer ms] [-h HB ms]
+ *                       [-c HB consumer factor] [-d seconds] [-r 0|1]
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "CANopen.h"
+#include "OD.h"
+#include "CO_host_node.h"
+
+#define NODES_MAX               127U
+#define WARMUP_NS               200000000ULL    /* 開機訊息後才開始統計 */
+#define TICK_NS                 1000000ULL
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+typedef struct {
+    uint32_t                nodes;
+    uint16_t                kbps;
+    uint32_t                syncUs;         /* 0 = 不送 SYNC */
+    uint32_t                tpdos;          /* 每個節點啟用的 TPDO 數 (0 ~ 4) */
+    uint32_t                bytes;
+    uint32_t                transType;
+    uint32_t                eventTimerMs;
+    uint32_t                hbMs;
+    double                  hbFactor;
+    uint32_t                seconds;
+    bool_t                  rtOnSync;
+} simConfig_t;
+
+typedef struct {
+    CO_t                   *co;
+    uint64_t                nextTickNs;
+    uint64_t                rtLastNs;
+    bool_t                  rtPending;
+    uint64_t                hbLastNs;
+    uint64_t                hbMaxGapNs;
+    uint32_t                hbTimeouts;
+} simNode_t;
+
+/* 延遲樣本 (ns) */
+typedef struct {
+    uint32_t               *v;
+    uint32_t                n, cap;
+} samples_t;
+
+typedef struct {
+    const simConfig_t      *cfg;
+    simNode_t              *node;
+    uint64_t                syncEndNs;
+    samples_t               tpdoQueue;      /* CO_CANsend() -> 訊框結束 */
+    samples_t               syncTpdo;       /* SYNC 結束 -> TPDO 結束 */
+    uint32_t                tpdoFrames;
+    uint32_t                syncFrames;
+    uint64_t                busyNsWarm;
+} simState_t;
+
+static CO_vbus_t bus;
+
+static void samples_add(samples_t *s, uint64_t v)
+{
+    if (s->n == s->cap) {
+        s->cap = s->cap ? s->cap * 2U : 4096U;
+        s->v = realloc(s->v, s->cap * sizeof(s->v[0]));
+    }
+    s->v[s->n++] = (uint32_t)(v > UINT32_MAX ? UINT32_MAX : v);
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void samples_report(const char *name, samples_t *s)
+{
+    if (s->n == 0U) {
+        printf("  %-22s no samples\n", name);
+        return;
+    }
+    qsort(s->v, s->n, sizeof(s->v[0]), cmp_u32);
+    printf("  %-22s p50 %8.1f  p90 %8.1f  p99 %8.1f  p99.9 %8.1f  max %8.1f us  (%u)\n", name,
+           s->v[s->n / 2U] / 1000.0, s->v[(uint64_t)s->n * 90U / 100U] / 1000.0,
+           s->v[(uint64_t)s->n * 99U / 100U] / 1000.0, s->v[(uint64_t)s->n * 999U / 1000U] / 1000.0,
+           s->v[s->n - 1U] / 1000.0, s->n);
+}
+
+static void on_sync(void *object)
+{
+    ((simNode_t *)object)->rtPending = true;
+}
+
+static void monitor(void *object, const CO_vbusFrame_t *frame)
+{
+    simState_t *st = (simState_t *)object;
+    uint16_t ident = (uint16_t)frame->msg.ident;
+    bool_t warm = frame->endNs >= WARMUP_NS;
+
+    if (ident == 0x080U) {
+        st->syncEndNs = frame->endNs;
+        st->syncFrames += warm ? 1U : 0U;
+    } else if (ident >= 0x181U && ident <= 0x57FU && (ident & 0x7FU) != 0U) {
+        if (warm) {
+            st->tpdoFrames++;
+            samples_add(&st->tpdoQueue, frame->endNs - frame->queuedNs);
+            if (st->cfg->transType <= 240U && st->syncEndNs != 0U) {
+                samples_add(&st->syncTpdo, frame->endNs - st->syncEndNs);
+            }
+        }
+    } else if (ident >= 0x701U && ident <= 0x77FU) {
+        uint32_t id = ident - 0x700U;
+        if (id <= st->cfg->nodes) {
+            simNode_t *node = &st->node[id - 1U];
+            if (node->hbLastNs != 0U && frame->endNs >= WARMUP_NS) {
+                uint64_t gap = frame->endNs - node->hbLastNs;
+                if (gap > node->hbMaxGapNs) {
+                    node->hbMaxGapNs = gap;
+                }
+                if ((double)gap > st->cfg->hbMs * 1e6 * st->cfg->hbFactor) {
+                    node->hbTimeouts++;
+                }
+            }
+            node->hbLastNs = frame->endNs;
+        }
+    }
+}
+
+/* 共用 OD 的 TPDO 與心跳設定 (節點建立前寫入) */
+static void configure_od(const simConfig_t *cfg)
+{
+    OD_PERSIST_COMM.x1017_producerHeartbeatTime = (uint16_t)cfg->hbMs;
+    for (uint16_t k = 0; k < 4U; k++) {
+        const OD_entry_t *comm = OD_find(OD, (uint16_t)(0x1800U + k));
+        const OD_entry_t *map = OD_find(OD, (uint16_t)(0x1A00U + k));
+        bool_t on = k < cfg->tpdos;
+
+        OD_set_u32(comm, 1, (on ? 0x40000000U : 0xC0000000U) | (0x180U + 0x100U * k), true);
+        OD_set_u8(comm, 2, (uint8_t)cfg->transType, true);
+        OD_set_u16(comm, 5, (uint16_t)cfg->eventTimerMs, true);
+        OD_set_u8(map, 0, on ? (uint8_t)cfg->bytes : 0U, true);
+        for (uint8_t i = 1; i <= 8U; i++) {
+            OD_set_u32(map, i, (on && i <= cfg->bytes) ? 0x10010008U : 0U, true);    /* 0x1001:00, 8 bit */
+        }
+    }
+}
+
+static double wall_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static int simulate(const simConfig_t *cfg, simState_t *st, double *wall)
+{
+    static simNode_t nodes[NODES_MAX];
+    const uint64_t endNs = (uint64_t)cfg->seconds * 1000000000ULL;
+    uint64_t nextSyncNs = cfg->syncUs ? WARMUP_NS / 2U : UINT64_MAX;
+
+    memset(nodes, 0, sizeof(nodes));
+    memset(st, 0, sizeof(*st));
+    st->cfg = cfg;
+    st->node = nodes;
+    configure_od(cfg);
+    CO_vbus_init(&bus);
+    CO_vbus_setBitrate(&bus, cfg->kbps);
+    CO_vbus_setMonitor(&bus, monitor, st);
+
+    for (uint32_t n = 0; n < cfg->nodes; n++) {
+        uint32_t errInfo = 0;
+        nodes[n].co = CO_hostNode_new(&bus, (uint8_t)(n + 1U), &errInfo);
+        if (nodes[n].co == NULL) {
+            printf("node %u init failed (errInfo 0x%X)\n", n + 1U, errInfo);
+            return 1;
+        }
+        if (cfg->rtOnSync) {
+            CO_SYNC_initCallbackPre(nodes[n].co->SYNC, &nodes[n], on_sync);
+        }
+        /* 各節點的 1 ms 計時器相位不同 */
+        nodes[n].nextTickNs = (uint64_t)n * TICK_NS / cfg->nodes;
+        nodes[n].rtLastNs = nodes[n].nextTickNs;
+    }
+
+    double t0 = wall_sec();
+    for (;;) {
+        uint64_t t = CO_vbus_nextEvent(&bus);
+        if (nextSyncNs < t) {
+            t = nextSyncNs;
+        }
+        for (uint32_t n = 0; n < cfg->nodes; n++) {
+            if (nodes[n].nextTickNs < t) {
+                t = nodes[n].nextTickNs;
+            }
+        }
+        if (t >= endNs) {
+            break;
+        }
+        if (t == WARMUP_NS || (bus.nowNs < WARMUP_NS && t > WARMUP_NS)) {
+            st->busyNsWarm = bus.busyNs;
+        }
+
+        /* 訊框在 t 結束並傳遞；SYNC 接收回呼立即執行 RT slot */
+        CO_vbus_advance(&bus, t);
+        for (uint32_t n = 0; n < cfg->nodes; n++) {
+            simNode_t *node = &nodes[n];
+            if (node->rtPending) {
+                node->rtPending = false;
+                uint32_t dt = (uint32_t)((t - node->rtLastNs) / 1000U);
+                node->rtLastNs += (uint64_t)dt * 1000U;
+                CO_hostNode_rt(node->co, dt);
+            }
+        }
+        if (t == nextSyncNs) {
+            CO_vbus_inject(&bus, 0x080, 0, NULL);
+            nextSyncNs += (uint64_t)cfg->syncUs * 1000U;
+        }
+        for (uint32_t n = 0; n < cfg->nodes; n++) {
+            simNode_t *node = &nodes[n];
+            if (node->nextTickNs == t) {
+                uint32_t dt = (uint32_t)((t - node->rtLastNs) / 1000U);
+                node->rtLastNs += (uint64_t)dt * 1000U;
+                CO_process(node->co, false, 1000U, NULL);
+                CO_hostNode_rt(node->co, dt);
+                node->nextTickNs += TICK_NS;
+            }
+        }
+    }
+    CO_vbus_advance(&bus, endNs);
+    *wall = wall_sec() - t0;
+
+    for (uint32_t n = 0; n < cfg->nodes; n++) {
+        CO_delete(nodes[n].co);
+    }
+    return 0;
+}
+
+typedef struct {
+    uint32_t                ident[3];
+    uint64_t                endNs[3];
+    uint32_t                count;
+} arbLog_t;
+
+static void arb_monitor(void *object, const CO_vbusFrame_t *frame)
+{
+    arbLog_t *log = (arbLog_t *)object;
+    if (log->count < 3U) {
+        log->ident[log->count] = frame->msg.ident;
+        log->endNs[log->count] = frame->endNs;
+    }
+    log->count++;
+}
+
+static int test_bus(void)
+{
+    int failures = 0;
+    CO_CANrxMsg_t msg;
+
+    /* 全 0 訊框：34 個 0 位元 (SOF 到 CRC) 插入 6 個填充位元 */
+    memset(&msg, 0, sizeof(msg));
+    CHECK(CO_vbus_frameBits(&msg) == 53U, "zero frame %u bits, expected 53", CO_vbus_frameBits(&msg));
+    for (uint32_t i = 0; i < 2000U; i++) {
+        msg.ident = (i * 2654435761U) & 0x7FFU;
+        msg.DLC = 8;
+        for (uint32_t b = 0; b < 8U; b++) {
+            msg.data[b] = (uint8_t)((i * 31U + b * 17U) ^ (i >> 3));
+        }
+        uint32_t bits = CO_vbus_frameBits(&msg);
+        if (bits < 111U || bits > 135U) {
+            CHECK(false, "8-byte frame %u bits", bits);
+            break;
+        }
+    }
+
+    /* 仲裁：同時待送的訊框依 COB-ID 送出，訊框首尾相接 */
+    arbLog_t log;
+    memset(&log, 0, sizeof(log));
+    CO_vbus_init(&bus);
+    CO_vbus_setBitrate(&bus, 500);
+    CO_vbus_setMonitor(&bus, arb_monitor, &log);
+    CO_vbus_inject(&bus, 0x300, 0, NULL);
+    CO_vbus_inject(&bus, 0x100, 0, NULL);
+    CO_vbus_inject(&bus, 0x200, 0, NULL);
+    CHECK(CO_vbus_nextEvent(&bus) == 0U, "idle bus with pending frames not due now");
+    CO_vbus_advance(&bus, 1000000U);
+    CHECK(log.count == 3U && log.ident[0] == 0x100U && log.ident[1] == 0x200U && log.ident[2] == 0x300U,
+          "arbitration order %03X %03X %03X", log.ident[0], log.ident[1], log.ident[2]);
+    memset(&msg, 0, sizeof(msg));
+    msg.ident = 0x100;
+    uint64_t first = (uint64_t)CO_vbus_frameBits(&msg) * 2000U;
+    msg.ident = 0x200;
+    CHECK(log.endNs[0] == first && log.endNs[1] == first + (uint64_t)CO_vbus_frameBits(&msg) * 2000U,
+          "frame timing");
+    CHECK(CO_vbus_nextEvent(&bus) == UINT64_MAX, "empty bus has an event");
+
+    printf("bus: bit stuffing, arbitration and frame timing %s\n", failures == 0 ? "OK" : "WRONG");
+    return failures;
+}
+
+int main(int argc, char *argv[])
+{
+    simConfig_t cfg = {
+        .nodes = 60, .kbps = 500, .syncUs = 20000, .tpdos = 1, .bytes = 8,
+        .transType = 1, .eventTimerMs = 0, .hbMs = 100, .hbFactor = 1.5, .seconds = 10, .rtOnSync = true
+    };
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:b:s:p:l:t:e:h:c:d:r:")) != -1) {
+        switch (opt) {
+            case 'n': cfg.nodes = (uint32_t)atoi(optarg); break;
+            case 'b': cfg.kbps = (uint16_t)atoi(optarg); break;
+            case 's': cfg.syncUs = (uint32_t)atoi(optarg); break;
+            case 'p': cfg.tpdos = (uint32_t)atoi(optarg); break;
+            case 'l': cfg.bytes = (uint32_t)atoi(optarg); break;
+            case 't': cfg.transType = (uint32_t)atoi(optarg); break;
+            case 'e': cfg.eventTimerMs = (uint32_t)atoi(optarg); break;
+            case 'h': cfg.hbMs = (uint32_t)atoi(optarg); break;
+            case 'c': cfg.hbFactor = atof(optarg); break;
+            case 'd': cfg.seconds = (uint32_t)atoi(optarg); break;
+            case 'r': cfg.rtOnSync = atoi(optarg) != 0; break;
+            default:
+                fprintf(stderr, "usage: %s [-n nodes] [-b kbit/s] [-s SYNC us] [-p TPDOs] [-l bytes] [-t type]"
+                        " [-e event ms] [-h HB ms] [-c HB factor] [-d seconds] [-r 0|1]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (cfg.nodes < 1U || cfg.nodes > NODES_MAX || cfg.nodes > CO_VBUS_NODES_MAX || cfg.kbps < 10U
+        || cfg.kbps > 1000U || cfg.tpdos > 4U || cfg.bytes < 1U || cfg.bytes > 8U || cfg.seconds < 1U) {
+        fprintf(stderr, "invalid configuration\n");
+        return 2;
+    }
+
+    int failures = test_bus();
+    simState_t st;
+    double wall;
+
+    printf("\n%u nodes, %u kbit/s, SYNC %u us, %u TPDO x %u bytes (type %u, event %u ms), HB %u ms, %u s, RT on SYNC %s\n",
+           cfg.nodes, cfg.kbps, cfg.syncUs, cfg.tpdos, cfg.bytes, cfg.transType, cfg.eventTimerMs,
+           cfg.hbMs, cfg.seconds, cfg.rtOnSync ? "yes" : "no");
+    if (simulate(&cfg, &st, &wall) != 0) {
+        return 1;
+    }
+
+    double simSec = cfg.seconds - WARMUP_NS / 1e9;
+    double load = (double)(bus.busyNs - st.busyNsWarm) / (simSec * 1e9);
+    uint32_t hbTimeouts = 0, hbNodes = 0;
+    uint64_t hbMaxGap = 0;
+    for (uint32_t n = 0; n < cfg.nodes; n++) {
+        hbTimeouts += st.node[n].hbTimeouts;
+        hbNodes += st.node[n].hbTimeouts ? 1U : 0U;
+        if (st.node[n].hbMaxGapNs > hbMaxGap) {
+            hbMaxGap = st.node[n].hbMaxGapNs;
+        }
+    }
+
+    printf("  bus load               %.1f %%  (%u frames, %.0f frames/s)\n", load * 100.0, bus.frameCount,
+           bus.frameCount / (double)cfg.seconds);
+    samples_report("TPDO send -> bus end", &st.tpdoQueue);
+    if (cfg.transType <= 240U && cfg.syncUs != 0U) {
+        samples_report("SYNC -> TPDO end", &st.syncTpdo);
+    }
+    if (cfg.hbMs != 0U) {
+        printf("  heartbeat              max gap %.2f ms (%.2fx), consumer timeout %.1fx: %u timeouts on %u nodes\n",
+               hbMaxGap / 1e6, hbMaxGap / (cfg.hbMs * 1e6), cfg.hbFactor, hbTimeouts, hbNodes);
+    }
+    printf("  simulated %.1f s in %.2f s wall clock (%.0fx real time)\n", (double)cfg.seconds, wall,
+           cfg.seconds / wall);
+
+    /* 負載未滿時，每個 SYNC 觸發每個節點的每個同步 TPDO */
+    if (cfg.transType == 1U && cfg.syncUs != 0U && load < 0.95) {
+        CHECK(st.tpdoFrames >= (st.syncFrames - 1U) * cfg.nodes * cfg.tpdos
+              && st.tpdoFrames <= (st.syncFrames + 1U) * cfg.nodes * cfg.tpdos,
+              "%u TPDOs for %u SYNCs", st.tpdoFrames, st.syncFrames);
+    }
+    CHECK(load > 0.0 && load <= 1.001, "bus load %.3f", load);
+    CHECK(cfg.seconds / wall > 1.0, "slower than real time");
+
+    printf("\n%s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,255 @@
+/**
+ * Host simulation of SYNC -> TPDO jitter: timer ISR processing vs CO_rt slot
+ *
+ * @file sim_rt_jitter.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ *  1. CO_rt_begin()/CO_rt_end()/CO_rt_syncSignal() 的時間差、觸發與延遲統計
+ *  2. 以 1 us 解析度比較兩種 SYNC/RPDO/TPDO 處理方式：
+ *     - 原本：1 ms 計時器中斷 (優先權與 CAN 相同) 中處理，SYNC 等到下一個 tick，
+ *       處理期間與 CO_LOCK_OD 期間 CAN 接收中斷都被擋住
+ *     - CO_rt：SYNC 接收回呼立即觸發 PendSV，CAN 中斷優先權較高可搶占 RT slot，
+ *       CO_LOCK_OD 只遮罩 RT slot
+ *     兩者都以 CO_rt_t 記錄 SYNC 接收到 TPDO 送出的延遲。
+ *  CAN ISR 搶占 RT slot 的時間未加到 RT slot 的處理時間。
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CO_rt.h"
+
+#define CPU_MHZ             144U        /* CO_CAN_CYCLES() = DWT CYCCNT @ 144 MHz */
+#define SYNC_PERIOD_US      10000U
+#define SYNC_PERIODS        2000U
+#define CAN_ISR_US          3U          /* SYNC 接收中斷 */
+#define TICK_PASS_US        15U         /* 沒有 SYNC 的 RPDO/TPDO 處理 */
+#define SYNC_PASS_US        40U         /* SYNC + RPDO + TPDO 處理 */
+#define MAIN_LOCK_US        25U         /* 主循環 CO_LOCK_OD (例如 SDO 寫入 OD) */
+#define CAN_SEND_US         2U          /* CO_LOCK_CAN_SEND */
+#define RX_PER_PERIOD       20U         /* 每個 SYNC 週期的其他接收訊框 */
+#define SIM_MS              (SYNC_PERIODS * SYNC_PERIOD_US / 1000U + 2U)
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+host_SCB_t host_scb;
+volatile uint32_t host_sim_cycles;
+
+typedef enum { RT_TIMER_ISR, RT_PENDSV } rtMode_t;
+
+static uint32_t rng_state = 12345U;
+static uint32_t rng(void)
+{
+    rng_state = rng_state * 1103515245U + 12345U;
+    return rng_state >> 8;
+}
+
+/* 主循環的 CO_LOCK_OD：每 ms 有 1/4 機率，位置隨機 */
+static uint32_t lockStart[SIM_MS];      /* UINT32_MAX = 無 */
+/* 原本模式下處理 SYNC 的 tick */
+static bool syncTick[SIM_MS];
+static uint32_t syncRx[SYNC_PERIODS];
+
+static void sim_at(uint64_t us)
+{
+    host_sim_cycles = (uint32_t)(us * CPU_MHZ);
+}
+
+/* t 落在主循環 CO_LOCK_OD 內時回傳鎖的結束時間 */
+static uint64_t lock_end(uint64_t t)
+{
+    uint64_t ms = t / 1000U;
+    for (uint64_t m = (ms > 0U ? ms - 1U : 0U); m <= ms && m < SIM_MS; m++) {
+        if (lockStart[m] != UINT32_MAX && t >= lockStart[m] && t < lockStart[m] + MAIN_LOCK_US) {
+            return lockStart[m] + MAIN_LOCK_US;
+        }
+    }
+    return t;
+}
+
+/* tick m 的 RT 處理時段 [start, end) - 計時器中斷在 CO_LOCK_OD 結束後才執行 */
+static void tick_pass(rtMode_t mode, uint64_t m, uint64_t *start, uint64_t *end)
+{
+    *start = lock_end(m * 1000U);
+    *end = *start + ((mode == RT_TIMER_ISR && syncTick[m]) ? SYNC_PASS_US : TICK_PASS_US);
+}
+
+/* 原本：SYNC 在下一個 tick 的計時器中斷中處理 */
+static uint64_t tpdo_timer_isr(uint64_t t)
+{
+    uint64_t start, end;
+    tick_pass(RT_TIMER_ISR, t / 1000U + 1U, &start, &end);
+    return end;
+}
+
+/* CO_rt：CAN ISR 結束後執行 PendSV，等待進行中的 tick 處理與 CO_LOCK_OD */
+static uint64_t tpdo_pendsv(uint64_t t)
+{
+    uint64_t start = t + CAN_ISR_US;
+    uint64_t prev;
+    do {
+        prev = start;
+        uint64_t ts, te;
+        tick_pass(RT_PENDSV, start / 1000U, &ts, &te);
+        if (start >= ts && start < te) {
+            start = te;
+        }
+        start = lock_end(start);
+    } while (start != prev);
+    return start + SYNC_PASS_US;
+}
+
+/* 接收訊框在 t 到達，回傳 CAN ISR 開始執行的時間 */
+static uint64_t rx_start(rtMode_t mode, uint64_t t, const uint64_t *tpdoDone)
+{
+    uint64_t start = t;
+    uint64_t prev;
+    do {
+        prev = start;
+        if (mode == RT_TIMER_ISR) {
+            /* 同優先權的計時器中斷與 CO_LOCK_OD 都擋住 CAN 中斷 */
+            uint64_t ts, te;
+            tick_pass(mode, start / 1000U, &ts, &te);
+            if (start >= ts && start < te) {
+                start = te;
+            }
+            start = lock_end(start);
+        } else {
+            /* 只有 TPDO 送出時的 CO_LOCK_CAN_SEND 擋住 CAN 中斷 */
+            uint64_t done = tpdoDone[start / SYNC_PERIOD_US];
+            if (start + CAN_SEND_US >= done && start < done) {
+                start = done;
+            }
+        }
+    } while (start != prev);
+    return start;
+}
+
+static void run(rtMode_t mode, CO_rt_t *rt, uint64_t *rxMax, double *rxAvg, uint32_t *triggers)
+{
+    static uint64_t tpdoDone[SYNC_PERIODS + 1U];
+    uint64_t rxSum = 0, rxN = 0;
+
+    CO_rt_init(rt, 0);
+    *rxMax = 0;
+    *triggers = 0;
+    memset(tpdoDone, 0, sizeof(tpdoDone));
+
+    for (uint32_t j = 0; j < SYNC_PERIODS; j++) {
+        uint64_t t = syncRx[j];
+
+        /* CAN ISR：CO_SYNC 接收回呼 */
+        host_scb.ICSR = 0U;
+        sim_at(t);
+        CO_rt_syncSignal(rt);
+        if (host_scb.ICSR & SCB_ICSR_PENDSVSET_Msk) {
+            (*triggers)++;
+        }
+
+        uint64_t done = (mode == RT_TIMER_ISR) ? tpdo_timer_isr(t) : tpdo_pendsv(t);
+        tpdoDone[j] = done;
+        CO_rt_begin(rt, (uint32_t)(done / 1000U));
+        sim_at(done);
+        CO_rt_end(rt, true);
+    }
+
+    rng_state = 777U;
+    for (uint32_t j = 0; j < SYNC_PERIODS; j++) {
+        for (uint32_t i = 0; i < RX_PER_PERIOD; i++) {
+            uint64_t t = (uint64_t)j * SYNC_PERIOD_US + (rng() % SYNC_PERIOD_US);
+            uint64_t lat = rx_start(mode, t, tpdoDone) - t;
+            rxSum += lat;
+            rxN++;
+            if (lat > *rxMax) {
+                *rxMax = lat;
+            }
+        }
+    }
+    *rxAvg = (double)rxSum / (double)rxN;
+}
+
+static int test_rt(void)
+{
+    int failures = 0;
+    CO_rt_t rt;
+
+    CO_rt_init(&rt, 100U);
+    CHECK(CO_rt_begin(&rt, 103U) == 3000U, "dt after 3 ms");
+    CHECK(CO_rt_begin(&rt, 103U) == 0U, "dt of SYNC-triggered run");
+    CHECK(rt.runCount == 2U, "runCount=%u", rt.runCount);
+
+    /* 沒有 SYNC 或 SYNC 未被這次處理：不計入 */
+    sim_at(1000U);
+    CO_rt_end(&rt, true);
+    CHECK(rt.syncCount == 0U, "counted without SYNC stamp");
+    host_scb.ICSR = 0U;
+    CO_rt_syncSignal(&rt);
+    CHECK(host_scb.ICSR & SCB_ICSR_PENDSVSET_Msk, "SYNC did not pend the RT slot");
+    CO_rt_end(&rt, false);
+    CHECK(rt.syncCount == 0U, "counted without syncWas");
+
+    sim_at(1050U);
+    CO_rt_end(&rt, true);
+    CHECK(rt.syncCount == 1U && rt.latencyLast == 50U * CPU_MHZ, "latency %u", rt.latencyLast);
+    CO_rt_end(&rt, true);
+    CHECK(rt.syncCount == 1U, "same SYNC counted twice");
+
+    sim_at(2000U);
+    CO_rt_syncSignal(&rt);
+    sim_at(2080U);
+    CO_rt_end(&rt, true);
+    CHECK(CO_rt_jitter(&rt) == 30U * CPU_MHZ, "jitter %u", CO_rt_jitter(&rt));
+
+    /* CO_timer1ms 與 CYCCNT 溢位 */
+    CO_rt_init(&rt, 0xFFFFFFFFU);
+    CHECK(CO_rt_begin(&rt, 1U) == 2000U, "CO_timer1ms wrap");
+    host_sim_cycles = 0xFFFFFF00U;
+    CO_rt_syncSignal(&rt);
+    host_sim_cycles = 0x100U;
+    CO_rt_end(&rt, true);
+    CHECK(rt.latencyLast == 0x200U, "CYCCNT wrap latency %u", rt.latencyLast);
+
+    printf("CO_rt: dt, trigger, latency and wrap %s\n", failures == 0 ? "OK" : "WRONG");
+    return failures;
+}
+
+int main(void)
+{
+    int failures = test_rt();
+    static const char *const names[] = { "1 ms timer ISR (old)", "CO_rt PendSV slot" };
+    CO_rt_t rt[2];
+    uint64_t rxMax[2];
+    double rxAvg[2];
+    uint32_t triggers[2];
+
+    /* SYNC 生產者與本節點時鐘不同步：接收時間在 1 ms tick 之間隨機分布 */
+    for (uint32_t m = 0; m < SIM_MS; m++) {
+        lockStart[m] = (rng() % 4U == 0U) ? m * 1000U + (rng() % 1000U) : UINT32_MAX;
+    }
+    for (uint32_t j = 0; j < SYNC_PERIODS; j++) {
+        syncRx[j] = j * SYNC_PERIOD_US + 100U + (rng() % (SYNC_PERIOD_US - 1200U));
+        syncTick[syncRx[j] / 1000U + 1U] = true;
+    }
+
+    printf("\nSYNC -> TPDO, SYNC every %u us, %u periods, %u other RX frames per period\n",
+           SYNC_PERIOD_US, SYNC_PERIODS, RX_PER_PERIOD);
+    for (int m = 0; m < 2; m++) {
+        run((rtMode_t)m, &rt[m], &rxMax[m], &rxAvg[m], &triggers[m]);
+        printf("  %s\n", names[m]);
+        printf("    SYNC->TPDO  min %7.1f us  max %7.1f us  avg %7.1f us  jitter %7.1f us\n",
+               (double)rt[m].latencyMin / CPU_MHZ, (double)rt[m].latencyMax / CPU_MHZ,
+               (double)rt[m].latencySum / rt[m].syncCount / CPU_MHZ, (double)CO_rt_jitter(&rt[m]) / CPU_MHZ);
+        printf("    CAN RX ISR delay  avg %6.2f us  max %4llu us\n", rxAvg[m], (unsigned long long)rxMax[m]);
+    }
+
+    CHECK(rt[1].syncCount == SYNC_PERIODS, "SYNC count %u", rt[1].syncCount);
+    CHECK(triggers[1] == SYNC_PERIODS, "PendSV triggered %u times", triggers[1]);
+    CHECK(CO_rt_jitter(&rt[1]) < 100U * CPU_MHZ, "CO_rt jitter above 100 us");
+    CHECK(CO_rt_jitter(&rt[1]) * 5U < CO_rt_jitter(&rt[0]), "CO_rt jitter not clearly lower");
+    CHECK(rxMax[1] < rxMax[0], "CAN RX delay not reduced");
+
+    printf("\n%s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}
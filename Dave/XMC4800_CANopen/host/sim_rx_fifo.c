@@ -0,0 +1,210 @@
+/**
+ * Host bus-load simulation for the MultiCAN RX FIFO mode
+ *
+ * @file sim_rx_fifo.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 以 xmc_can_mock.h 模擬 500 kbit/s 滿載匯流排 (訊框背對背、不含填充位元)，比較：
+ *  1. 原本的做法：每個 COB-ID 一個 RX LMO，ISR 讀取前再次收到同 ID 即覆寫
+ *  2. RX FIFO 模式：CO_CANrxFifo_drain() 依序讀出基底 MO 之後的 slave
+ * 主程式週期性關閉中斷 (CO_LOCK_xxx / Flash 寫入等)，掃描關閉時間，
+ * 統計遺失訊框數、FIFO overrun 計數與單次中斷處理的最大批次。
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CO_rx_fifo.h"
+
+CAN_GLOBAL_TypeDef mock_can_global;
+CAN_MO_TypeDef mock_can_mo[256];
+
+#define BIT_NS              2000U       /* 500 kbit/s */
+#define FRAME_COUNT         200000U
+#define ISR_LATENCY_NS      1000U       /* 進入中斷 */
+#define ISR_FRAME_NS        8000U       /* 每個訊框的分派 + CANopen 處理 */
+#define MASK_PERIOD_NS      2000000U    /* 主程式每 2 ms 關閉一次中斷 */
+
+#define FIFO_BASE_MO        64U
+#define FIFO_DEPTH          32U
+
+/* DAVE RX LMO 與其接收的 COB-ID (NMT, SYNC, RPDO1, RPDO2, SDO RX) */
+static const uint8_t legacy_mo[] = {60, 9, 33, 34, 35};
+static const uint16_t traffic_id[] = {0x000, 0x080, 0x20A, 0x30A, 0x60A};
+static const uint8_t traffic_dlc[] = {2, 0, 8, 8, 8};
+#define ID_COUNT    (sizeof(traffic_id) / sizeof(traffic_id[0]))
+
+static XMC_CAN_MO_t legacy_obj[ID_COUNT];
+static XMC_CAN_MO_t fifo_slaves[FIFO_DEPTH];
+static CO_CANrxFifo_t fifo;
+
+/* 模擬狀態 */
+static uint64_t mask_ns;            /* 每個週期關閉中斷的時間 */
+static uint64_t busy_until;         /* CPU 在 ISR 中直到此時間 */
+static uint64_t isr_time;
+static bool isr_scheduled;
+static uint32_t received;
+static uint32_t last_seq;
+static uint32_t out_of_order;
+
+static void frame_handler(void *object, const CO_CANrxMsg_t *msg)
+{
+    uint32_t seq;
+    (void)object;
+    memcpy(&seq, msg->data, sizeof(seq));
+    if (msg->DLC >= 4U) {
+        if (received > 0U && seq <= last_seq) {
+            out_of_order++;
+        }
+        last_seq = seq;
+    }
+    received++;
+}
+
+/* 中斷被遮罩時延後到遮罩結束 */
+static uint64_t unmasked_time(uint64_t t)
+{
+    uint64_t phase = t % MASK_PERIOD_NS;
+    return (phase < mask_ns) ? (t - phase + mask_ns) : t;
+}
+
+static void schedule_isr(uint64_t t)
+{
+    if (!isr_scheduled) {
+        uint64_t entry = t + ISR_LATENCY_NS;
+        if (entry < busy_until) {
+            entry = busy_until;
+        }
+        isr_time = unmasked_time(entry);
+        isr_scheduled = true;
+    }
+}
+
+/* 原本的做法：輪詢每個 RX LMO */
+static uint16_t legacy_isr(void)
+{
+    uint16_t count = 0;
+    for (uint32_t i = 0; i < ID_COUNT; i++) {
+        XMC_CAN_MO_t *mo = &legacy_obj[i];
+        if (XMC_CAN_MO_GetStatus(mo) & XMC_CAN_MO_STATUS_NEW_DATA) {
+            XMC_CAN_MO_Receive(mo);
+            XMC_CAN_MO_ResetStatus(mo, XMC_CAN_MO_RESET_STATUS_RX_PENDING | XMC_CAN_MO_RESET_STATUS_MESSAGE_LOST);
+            CO_CANrxMsg_t msg;
+            msg.ident = mo->can_identifier;
+            msg.DLC = mo->can_data_length;
+            memcpy(msg.data, mo->can_data_byte, sizeof(msg.data));
+            frame_handler(NULL, &msg);
+            count++;
+        }
+    }
+    return count;
+}
+
+static void run_isrs_until(uint64_t t, bool useFifo)
+{
+    while (isr_scheduled && isr_time <= t) {
+        uint16_t n = useFifo ? CO_CANrxFifo_drain(&fifo, FIFO_DEPTH, frame_handler, NULL)
+                             : legacy_isr();
+        busy_until = isr_time + ISR_LATENCY_NS + (uint64_t)n * ISR_FRAME_NS;
+        isr_scheduled = false;
+    }
+}
+
+typedef struct {
+    uint32_t sent;
+    uint32_t lost;
+    uint32_t overrun;
+    uint32_t maxBatch;
+    uint32_t outOfOrder;
+} sim_result_t;
+
+static sim_result_t simulate(bool useFifo, uint16_t depth, uint64_t maskNs)
+{
+    sim_result_t r;
+    uint64_t t = 0;
+    uint32_t seed = 1U;
+
+    mock_can_reset();
+    mask_ns = maskNs;
+    busy_until = 0;
+    isr_scheduled = false;
+    received = 0;
+    last_seq = 0;
+    out_of_order = 0;
+
+    if (useFifo) {
+        XMC_CAN_MO_t base;
+        mock_can_mo_init(&base, FIFO_BASE_MO, XMC_CAN_MO_TYPE_RECMSGOBJ);
+        for (uint16_t i = 0; i < depth; i++) {
+            mock_can_mo_init(&fifo_slaves[i], (uint8_t)(FIFO_BASE_MO + 1U + i), XMC_CAN_MO_TYPE_RECMSGOBJ);
+        }
+        base.can_mo_ptr->MOFGPR = ((FIFO_BASE_MO + 1U) << CAN_MO_MOFGPR_BOT_Pos) |
+                                  ((FIFO_BASE_MO + depth) << CAN_MO_MOFGPR_TOP_Pos) |
+                                  ((FIFO_BASE_MO + 1U) << CAN_MO_MOFGPR_CUR_Pos);
+        CO_CANrxFifo_init(&fifo, fifo_slaves, depth);
+    } else {
+        for (uint32_t i = 0; i < ID_COUNT; i++) {
+            mock_can_mo_init(&legacy_obj[i], legacy_mo[i], XMC_CAN_MO_TYPE_RECMSGOBJ);
+        }
+    }
+
+    for (uint32_t seq = 1; seq <= FRAME_COUNT; seq++) {
+        seed = seed * 1103515245U + 12345U;
+        uint32_t k = (seed >> 16) % ID_COUNT;
+        uint8_t dlc = traffic_dlc[k];
+
+        /* 訊框在最後一個位元結束時寫入 MO */
+        t += (uint64_t)(47U + 8U * dlc) * BIT_NS;
+        run_isrs_until(t, useFifo);
+
+        if (useFifo) {
+            mock_can_rxfifo_store(FIFO_BASE_MO, traffic_id[k], dlc, seq, 0);
+        } else {
+            mock_can_mo_store(legacy_mo[k], traffic_id[k], dlc, seq, 0);
+        }
+        schedule_isr(t);
+    }
+    run_isrs_until(UINT64_MAX, useFifo);
+
+    r.sent = FRAME_COUNT;
+    r.lost = FRAME_COUNT - received;
+    r.overrun = useFifo ? fifo.overrunCount : 0U;
+    r.maxBatch = useFifo ? fifo.maxBatch : 0U;
+    r.outOfOrder = out_of_order;
+    return r;
+}
+
+int main(void)
+{
+    static const uint32_t mask_us[] = {0, 100, 300, 600, 1200, 1800};
+    int errors = 0;
+
+    printf("RX FIFO bus-load simulation (500 kbit/s, %u frames, FIFO depth %u)\n",
+           FRAME_COUNT, FIFO_DEPTH);
+    printf("  IRQ masked    per-ID LMO lost    FIFO lost  overrun  max batch\n");
+
+    for (uint32_t i = 0; i < sizeof(mask_us) / sizeof(mask_us[0]); i++) {
+        sim_result_t legacy = simulate(false, 0, (uint64_t)mask_us[i] * 1000U);
+        sim_result_t fifoResult = simulate(true, FIFO_DEPTH, (uint64_t)mask_us[i] * 1000U);
+
+        printf("  %5u us/2ms  %10u (%4.1f%%)  %9u  %7u  %9u\n", mask_us[i],
+               legacy.lost, 100.0 * legacy.lost / legacy.sent,
+               fifoResult.lost, fifoResult.overrun, fifoResult.maxBatch);
+
+        if (fifoResult.lost != 0U || fifoResult.overrun != 0U || fifoResult.outOfOrder != 0U) {
+            errors++;
+        }
+    }
+
+    /* FIFO 太淺時必須回報 overrun */
+    sim_result_t shallow = simulate(true, 4, 1800U * 1000U);
+    printf("  depth 4 @ 1800 us: lost %u, overrun %u\n", shallow.lost, shallow.overrun);
+    if (shallow.lost == 0U || shallow.overrun == 0U || shallow.overrun > shallow.lost) {
+        printf("  overrun not reported\n");
+        errors++;
+    }
+
+    printf("%s\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,368 @@
+/**
+ * Host simulation of the RX frame ring and the bounded RX softirq
+ *
+ * @file sim_rx_ring.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 1. 兩個執行緒 (ISR 生產者 / 軟體中斷消費者) 同時操作 CO_CANrxRing_t：
+ *    訊框依序、內容完整，分派數 + 丟棄數 = 寫入數
+ * 2. 輪詢與 ISR 使用相同的讀取路徑 (驅動中輪詢時遮罩 CAN 中斷)：同一訊框只進入緩衝區一次
+ * 3. 以 1 us 為單位模擬 CPU (CAN ISR > PendSV > 主循環) 與 1 Mbit/s 滿載匯流排，比較：
+ *     - 原本的做法：ISR 中直接執行 CANopen 回呼
+ *     - RX 環形緩衝區：ISR 只讀出訊框，PendSV 每個 1 ms 週期最多分派 budget 個、最多
+ *       CO_CAN_RX_SOFTIRQ_CYCLES 的時間 (與驅動相同)，用完時 ISR 不再觸發 PendSV，等下一個週期；
+ *       SYNC/RPDO/TPDO 只在 1 ms 週期執行 (CO_rt_due())
+ *    統計主循環的 CPU 比例與最長停頓、遺失 (MO 覆寫) / 丟棄 (緩衝區滿) 訊框、最高使用量；
+ *    所有環形緩衝區的設定 (包含預設的 budget 16 與 150 us 回呼) 主循環停頓都必須少於 2 個週期
+ * 以 -DCO_CAN_CYCLES()=host_sim_cycles 編譯，回呼推進模擬時鐘，dispatch 的時間預算與韌體相同。
+ */
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CO_rx_mo.h"
+#include "CO_rx_ring.h"
+
+CAN_GLOBAL_TypeDef mock_can_global;
+CAN_MO_TypeDef mock_can_mo[256];
+volatile uint32_t host_sim_cycles;
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+#define RX_MO               33U
+#define IRQ_BUDGET          4U          /* CO_CAN_RX_IRQ_BUDGET */
+#define CPU_MHZ             144U
+
+/* 執行緒測試 */
+#define THREAD_FRAMES       200000U
+#define THREAD_BUDGET       16U
+
+/* CPU 模擬 (單位 us) */
+#define SIM_US              200000U     /* 200 ms 的連續訊框 */
+#define FRAME_US            111U        /* 1 Mbit/s 背對背 8 byte 訊框 (不含填充位元) */
+#define TICK_US             1000U       /* 1 ms 計時器觸發 PendSV */
+#define ISR_ENTRY_US        1U
+#define READ_US             1U          /* ISR 讀出一個訊框 */
+#define PENDSV_ENTRY_US     1U
+#define RT_US               20U         /* SYNC/RPDO/TPDO 處理 */
+
+static CO_CANrxRing_t ring;
+static XMC_CAN_MO_t rx_mo;
+static uint32_t callbackUs;         /* check_frame() 推進模擬時鐘的時間 */
+
+/* 分派端的檢查 */
+typedef struct {
+    uint32_t                handled;
+    uint32_t                lastSeq;
+    uint32_t                outOfOrder;
+    uint32_t                corrupted;
+} checker_t;
+
+static void check_frame(void *object, const CO_CANrxMsg_t *msg)
+{
+    checker_t *c = object;
+    uint32_t seq, inv;
+
+    memcpy(&seq, &msg->data[0], sizeof(seq));
+    memcpy(&inv, &msg->data[4], sizeof(inv));
+    if (inv != ~seq || msg->DLC != 8U || msg->ident != (0x180U + (seq & 0x7FU))) {
+        c->corrupted++;
+    }
+    if (c->handled > 0U && seq <= c->lastSeq) {
+        c->outOfOrder++;
+    }
+    c->lastSeq = seq;
+    c->handled++;
+    host_sim_cycles += callbackUs * CPU_MHZ;
+}
+
+static inline void make_frame(CO_CANrxMsg_t *msg, uint32_t seq)
+{
+    uint32_t inv = ~seq;
+
+    msg->ident = 0x180U + (seq & 0x7FU);
+    msg->DLC = 8U;
+    memcpy(&msg->data[0], &seq, sizeof(seq));
+    memcpy(&msg->data[4], &inv, sizeof(inv));
+}
+
+/* ---------------------------------------------------------------------------
+ * 1. 生產者 / 消費者執行緒
+ */
+static volatile bool producerDone;
+
+static void *producer(void *arg)
+{
+    (void)arg;
+    for (uint32_t seq = 1; seq <= THREAD_FRAMES; seq++) {
+        /* 大部分訊框等待空格，每 64 個中有一個不等待 (緩衝區滿時丟棄) */
+        while ((seq % 64U) != 0U && CO_CANrxRing_pending(&ring) >= CO_CAN_RX_RING_SIZE) {
+            sched_yield();
+        }
+        CO_CANrxMsg_t *slot = CO_CANrxRing_reserve(&ring);
+        if (slot != NULL) {
+            make_frame(slot, seq);
+            CO_CANrxRing_commit(&ring);
+        }
+    }
+    __atomic_store_n(&producerDone, true, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+static int test_threads(void)
+{
+    int failures = 0;
+    checker_t c;
+    pthread_t thread;
+
+    memset(&c, 0, sizeof(c));
+    CO_CANrxRing_init(&ring);
+    producerDone = false;
+    pthread_create(&thread, NULL, producer, NULL);
+    for (;;) {
+        bool done = __atomic_load_n(&producerDone, __ATOMIC_ACQUIRE);
+        uint32_t n = CO_CANrxRing_dispatch(&ring, THREAD_BUDGET, UINT32_MAX, check_frame, &c);
+        CHECK(n <= THREAD_BUDGET, "dispatch %u > budget", n);
+        if (n == 0U) {
+            sched_yield();
+        }
+        if (done && CO_CANrxRing_pending(&ring) == 0U) {
+            break;
+        }
+    }
+    pthread_join(thread, NULL);
+
+    CHECK(c.corrupted == 0U && c.outOfOrder == 0U, "%u corrupted, %u out of order", c.corrupted, c.outOfOrder);
+    CHECK(c.handled + ring.dropCount == THREAD_FRAMES, "handled %u + dropped %u != %u", c.handled,
+          ring.dropCount, THREAD_FRAMES);
+    CHECK(ring.maxFill <= CO_CAN_RX_RING_SIZE && ring.batchFramesMax <= THREAD_BUDGET, "max fill %u, batch %u",
+          ring.maxFill, ring.batchFramesMax);
+    printf("threads: %u frames, handled %u, dropped %u, max fill %u/%u, max batch %u - %s\n", THREAD_FRAMES,
+           c.handled, ring.dropCount, ring.maxFill, CO_CAN_RX_RING_SIZE, ring.batchFramesMax,
+           failures == 0 ? "ok" : "FAIL");
+    return failures;
+}
+
+/* ---------------------------------------------------------------------------
+ * 2. RX LMO 讀出 - 與 CO_driver_XMC4800.c 的 CO_CANinterrupt_Rx() 相同
+ */
+static uint32_t lost;               /* 讀出前被覆寫 (MSGLST) */
+
+static uint32_t drain_lmo(void)
+{
+    uint32_t count = 0U;
+
+    while (count < IRQ_BUDGET) {
+        uint32_t status = XMC_CAN_MO_GetStatus(&rx_mo);
+        if ((status & XMC_CAN_MO_STATUS_NEW_DATA) == 0U) {
+            break;
+        }
+        if (status & XMC_CAN_MO_STATUS_MESSAGE_LOST) {
+            XMC_CAN_MO_ResetStatus(&rx_mo, XMC_CAN_MO_RESET_STATUS_MESSAGE_LOST);
+            lost++;
+        }
+
+        CO_CANrxMsg_t *slot = CO_CANrxRing_reserve(&ring);
+        if (slot != NULL) {
+            CO_CANrxMo_read(&rx_mo, slot);
+            CO_CANrxRing_commit(&ring);
+        } else {
+            CO_CANrxMsg_t dropped;
+            CO_CANrxMo_read(&rx_mo, &dropped);
+        }
+        count++;
+    }
+    return count;
+}
+
+static void store_frame(uint32_t seq)
+{
+    mock_can_mo_store(RX_MO, (uint16_t)(0x180U + (seq & 0x7FU)), 8U, seq, ~seq);
+}
+
+static int test_poll_once(void)
+{
+    int failures = 0;
+    checker_t c;
+
+    memset(&c, 0, sizeof(c));
+    mock_can_reset();
+    mock_can_mo_init(&rx_mo, RX_MO, XMC_CAN_MO_TYPE_RECMSGOBJ);
+    CO_CANrxRing_init(&ring);
+    lost = 0;
+
+    /* ISR 先讀出，主循環輪詢看不到；輪詢先讀出，之後的 ISR (MSPND 仍設定) 看不到 */
+    for (uint32_t seq = 1; seq <= 1000U; seq++) {
+        store_frame(seq);
+        uint32_t first = drain_lmo();
+        uint32_t second = drain_lmo();
+        CHECK(first == 1U && second == 0U, "frame %u read %u + %u times", seq, first, second);
+        if (first != 1U || second != 0U) {
+            break;
+        }
+        (void)CO_CANrxRing_dispatch(&ring, UINT32_MAX, UINT32_MAX, check_frame, &c);
+    }
+    CHECK(c.handled == 1000U && c.outOfOrder == 0U && c.corrupted == 0U, "poll + ISR: handled %u", c.handled);
+    printf("poll + ISR: 1000 frames, each handled once - %s\n", failures == 0 ? "ok" : "FAIL");
+    return failures;
+}
+
+/* ---------------------------------------------------------------------------
+ * 3. CPU 模擬
+ */
+typedef struct {
+    const char              *name;
+    bool                    ring;           /* false: 回呼在 ISR 中執行 */
+    uint32_t                budget;         /* 每個 1 ms 週期最多分派的訊框數 */
+    uint32_t                callbackUs;     /* 每個訊框的 CANopen 回呼 */
+} sim_config_t;
+
+typedef struct {
+    uint32_t                sent;
+    uint32_t                handled;
+    uint32_t                lost;
+    uint32_t                dropped;
+    uint32_t                mainUs;
+    uint32_t                mainGapMax;     /* 主循環最長停頓 */
+    uint32_t                maxFill;
+    uint32_t                batchMax;
+    uint32_t                corrupted;
+    uint32_t                outOfOrder;
+} sim_result_t;
+
+static sim_result_t simulate(const sim_config_t *cfg)
+{
+    sim_result_t r;
+    checker_t c;
+    uint32_t isrBusy = 0, pendsvBusy = 0, gap = 0, credit = 0, creditCycles = 0;
+    bool isrPending = false, pendsvPending = false, rtDue = false;
+
+    memset(&r, 0, sizeof(r));
+    memset(&c, 0, sizeof(c));
+    mock_can_reset();
+    mock_can_mo_init(&rx_mo, RX_MO, XMC_CAN_MO_TYPE_RECMSGOBJ);
+    CO_CANrxRing_init(&ring);
+    lost = 0;
+    callbackUs = cfg->callbackUs;
+
+    /* 訊框停止後再模擬 100 ms，讓積壓的訊框分派完 */
+    for (uint32_t t = 0; t < SIM_US + 100000U; t++) {
+        host_sim_cycles = t * CPU_MHZ;
+        if (t < SIM_US && (t % FRAME_US) == 0U) {
+            store_frame(++r.sent);
+            isrPending = true;
+        }
+        if ((t % TICK_US) == 0U) {
+            pendsvPending = true;
+            rtDue = true;
+            credit = cfg->budget;
+            creditCycles = CO_CAN_RX_SOFTIRQ_CYCLES;
+        }
+
+        if (isrBusy > 0U) {
+            isrBusy--;
+        } else if (isrPending) {
+            isrPending = false;
+            uint32_t n = drain_lmo();
+            isrBusy = ISR_ENTRY_US + n * READ_US;
+            if (cfg->ring) {
+                if (CO_CANrxRing_signalNeeded(&ring)) {
+                    pendsvPending = true;
+                }
+            } else {
+                /* 原本的做法：回呼在 ISR 中執行 */
+                isrBusy += CO_CANrxRing_dispatch(&ring, UINT32_MAX, UINT32_MAX, check_frame, &c) * cfg->callbackUs;
+            }
+        } else if (pendsvBusy > 0U) {
+            /* 模擬中回呼時間在 dispatch 之後才經過 - 與韌體相同，以 PendSV 結束時的 head 判斷積壓 */
+            if (--pendsvBusy == 0U && cfg->ring) {
+                ring.backlog = (CO_CANrxRing_pending(&ring) != 0U);
+            }
+        } else if (pendsvPending) {
+            pendsvPending = false;
+            uint32_t n = cfg->ring ? CO_CANrxRing_dispatch(&ring, credit, creditCycles, check_frame, &c) : 0U;
+            credit -= n;
+            creditCycles = (ring.batchCycles < creditCycles) ? (creditCycles - ring.batchCycles) : 0U;
+            pendsvBusy = PENDSV_ENTRY_US + n * cfg->callbackUs + (rtDue ? RT_US : 0U);
+            rtDue = false;
+        } else {
+            r.mainUs++;
+            gap = 0;
+            continue;
+        }
+        if (t < SIM_US && ++gap > r.mainGapMax) {
+            r.mainGapMax = gap;
+        }
+    }
+
+    r.handled = c.handled;
+    r.corrupted = c.corrupted;
+    r.outOfOrder = c.outOfOrder;
+    r.lost = lost;
+    r.dropped = ring.dropCount;
+    r.maxFill = ring.maxFill;
+    r.batchMax = ring.batchFramesMax;
+    return r;
+}
+
+static int test_flood(void)
+{
+    static const sim_config_t configs[] = {
+        {"ISR callbacks",       false,  0,  20},
+        {"ring, budget 16",     true,   16, 20},
+        {"ISR callbacks",       false,  0,  150},
+        {"ring, budget 2",      true,   2,  150},
+        {"ring, budget 4",      true,   4,  150},
+        {"ring, budget 16",     true,   16, 150},
+    };
+    int failures = 0;
+    sim_result_t r[sizeof(configs) / sizeof(configs[0])];
+
+    printf("\n1 Mbit/s flood for %u ms (frame every %u us), RT slot %u us every %u us\n", SIM_US / 1000U, FRAME_US,
+           RT_US, TICK_US);
+    printf("%-16s %8s %7s %7s %7s %7s %9s %9s %7s %6s\n", "mode", "callback", "sent", "handled", "lost", "dropped",
+           "main CPU", "main gap", "maxFill", "batch");
+    for (size_t i = 0; i < sizeof(configs) / sizeof(configs[0]); i++) {
+        const sim_config_t *cfg = &configs[i];
+        r[i] = simulate(cfg);
+        printf("%-16s %6u us %7u %7u %7u %7u %8.1f%% %6u us %7u %6u\n", cfg->name, cfg->callbackUs, r[i].sent,
+               r[i].handled, r[i].lost, r[i].dropped, 100.0 * r[i].mainUs / (SIM_US + 100000U), r[i].mainGapMax,
+               r[i].maxFill, r[i].batchMax);
+
+        CHECK(r[i].corrupted == 0U && r[i].outOfOrder == 0U, "%s: %u corrupted, %u out of order", cfg->name,
+              r[i].corrupted, r[i].outOfOrder);
+        CHECK(r[i].handled + r[i].lost + r[i].dropped == r[i].sent, "%s: handled + lost + dropped != sent",
+              cfg->name);
+        CHECK(!cfg->ring || r[i].batchMax <= cfg->budget, "%s: batch %u > budget", cfg->name, r[i].batchMax);
+    }
+
+    /* 一般負載：兩者都不遺失訊框 */
+    CHECK(r[0].lost == 0U && r[1].lost == 0U && r[1].dropped == 0U, "normal load lost frames");
+    /* 過載：回呼在 ISR 中執行時主循環停頓整段期間 */
+    CHECK(r[2].mainGapMax > SIM_US / 2U, "ISR callbacks: main gap %u us", r[2].mainGapMax);
+    /* 環形緩衝區：任何 budget 下主循環停頓少於 2 個週期，並保有 30% 以上的 CPU */
+    for (size_t i = 0; i < sizeof(configs) / sizeof(configs[0]); i++) {
+        if (configs[i].ring) {
+            CHECK(r[i].mainGapMax < 2U * TICK_US && r[i].mainUs > (SIM_US + 100000U) * 3U / 10U,
+                  "%s, %u us callback: main CPU %u us, gap %u us", configs[i].name, configs[i].callbackUs,
+                  r[i].mainUs, r[i].mainGapMax);
+        }
+    }
+    return failures;
+}
+
+int main(void)
+{
+    int failures = 0;
+
+    printf("=== RX frame ring: ISR drain + bounded softirq dispatch ===\n");
+    failures += test_threads();
+    failures += test_poll_once();
+    failures += test_flood();
+
+    printf("%s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}
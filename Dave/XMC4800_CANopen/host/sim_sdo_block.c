@@ -0,0 +1,509 @@
+/**
+ * SDO block vs segmented download into the streaming flash backend on virtual time
+ *
+ * @file sim_sdo_block.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * SDO 伺服器 (節點 1，韌體設定 port/CO_driver_target.h) 與客戶端 (節點 2) 在 CO_vbus_t 上以虛擬時間執行，
+ * 下載 100 KB 到 DOMAIN 0x2200 (port/CO_flash_stream.c)，比較分段與區塊 (127 段) 傳輸的 bytes/s：
+ *  - 匯流排：500 kbit/s 與 1 Mbit/s，訊框長度含位元填充
+ *  - 節點：收到訊框後 (callbackPre) 經過 WAKE_NS 執行 process()，timerNext 0 時 IDLE_NS 後再次執行
+ *  - flash：以 RAM 模擬，寫入一頁時主循環停止 -p us (XMC4800 t_PRP 約 5.5 ms)、擦除一個 sector 停止
+ *    -e us (預設 0 = 只量測匯流排)；flash 命令在 RAM 中等待，停止期間中斷照常執行：CAN 控制器繼續收發，
+ *    SDO 接收回呼繼續收下子區塊的分段 (模擬時間前進)
+ *  - 伺服器主循環在 SDO 處理後調用 CO_flashStream_process()，還有 flash 命令時 IDLE_NS 後再次執行
+ * 檢查：flash 內容、區塊上傳讀回、超過容量中止 (DATA_LONG)、中止的下載沒有有效資料、區塊比分段快；
+ * flash 停止時間：sector 擦除不在 CO_LOCK_OD (遮罩 RT slot) 內執行、鎖內寫頁的時間、擦除時間超過
+ * SDO 客戶端逾時時下載中止。
+ * SDO 客戶端與其 CO_fifo 以 Makefile 的 SIM_CONFIG 啟用。
+ *
+ * 使用方式: sim_sdo_block [-k KB] [-p page program us] [-e sector erase us]
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define OD_DEFINITION
+#include "301/CO_ODinterface.h"
+#include "301/CO_SDOserver.h"
+#include "301/CO_SDOclient.h"
+#include "CO_driver_host.h"
+#include "CO_flash_stream.h"
+
+#define NODE_SRV                1U
+#define NODE_CLI                2U
+#define SDO_TIMEOUT_MS          2000U
+#define STALL_PROGRAM_US        5500U           /* flash 停止測試：XMC4800 t_PRP */
+#define STALL_ERASE_US          1500000U        /* flash 停止測試：假設的 sector 擦除時間 (< SDO_TIMEOUT_MS) */
+#define WAKE_NS                 10000ULL        /* 收到訊框到主循環處理 */
+#define IDLE_NS                 1000ULL         /* timerNext 0：立即再次處理 */
+#define FLASH_SIZE              0x20000U        /* 與 CO_FLASH_XMC4_PARAM_SIZE 相同的一個 sector */
+#define FLASH_SECTOR            0x20000U
+
+#define RX_SDO_SRV              0U
+#define RX_SDO_CLI              1U
+#define RX_SIZE                 2U
+#define TX_SDO_SRV              0U
+#define TX_SDO_CLI              1U
+#define TX_SIZE                 2U
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+/******************************************************************************/
+/* 物件字典：客戶端參數與參數 flash DOMAIN */
+static struct {
+    uint8_t                 highestSub;
+    uint32_t                COB_IDClientToServer;
+    uint32_t                COB_IDServerToClient;
+    uint8_t                 nodeIdOfServer;
+} x1280 = { 3, 0x600U + NODE_SRV, 0x580U + NODE_SRV, NODE_SRV };
+
+static CO_PROGMEM OD_obj_record_t o_1280[4] = {
+    { &x1280.highestSub, 0, ODA_SDO_R, 1 },
+    { &x1280.COB_IDClientToServer, 1, ODA_SDO_RW | ODA_MB, 4 },
+    { &x1280.COB_IDServerToClient, 2, ODA_SDO_RW | ODA_MB, 4 },
+    { &x1280.nodeIdOfServer, 3, ODA_SDO_RW, 1 } };
+static CO_PROGMEM OD_obj_var_t o_2200 = { NULL, ODA_SDO_RW, 0 };
+
+static OD_entry_t simODList[] = {
+    {0x1280, 0x04, ODT_REC, (void *)&o_1280, NULL},
+    {0x2200, 0x01, ODT_VAR, (void *)&o_2200, NULL},
+    {0x0000, 0x00, 0, NULL, NULL}
+};
+
+static OD_t simOD = { (sizeof(simODList) / sizeof(simODList[0])) - 1U, &simODList[0] };
+
+/******************************************************************************/
+/* 節點、匯流排與模擬 flash */
+typedef struct {
+    CO_CANmodule_t          CANmodule;
+    CO_CANrx_t              rxArray[RX_SIZE];
+    CO_CANtx_t              txArray[TX_SIZE];
+    uint64_t                wakeNs;         /* 下一次 process()，UINT64_MAX = 等待訊框 */
+    uint64_t                lastNs;         /* 上一次 process() */
+    uint64_t                busyUntilNs;    /* 主循環停止 (flash 命令) 到此時間 */
+} simNode_t;
+
+static CO_vbus_t bus;
+static simNode_t nodeSrv, nodeCli;
+static CO_SDOserver_t sdoSrv;
+static CO_SDOclient_t sdoCli;
+static CO_flashStream_t flashStream;
+static uint32_t flashMem[FLASH_SIZE / 4U];
+static uint64_t pageProgramNs;
+static uint64_t sectorEraseNs;
+static uint32_t sdoTimeoutMs = SDO_TIMEOUT_MS;
+static uint32_t busFrames;
+
+/* flash 停止時間統計 - CO_LOCK_OD 內 (SDO 伺服器的 OD 寫入) 的停止會遮罩 RT slot */
+static struct {
+    uint64_t                totalNs;
+    uint64_t                lockedNs;
+    uint64_t                lockedMaxNs;    /* 一次 CO_LOCK_OD 持有期間 */
+    uint64_t                holdNs;
+    uint32_t                holdCount;
+    uint32_t                lockedErases;
+} stall;
+
+/* 伺服器主循環停止 ns：下一次 process() 延後，中斷 (SDO 接收回呼) 與其他節點繼續 */
+static void sim_flash_stall(uint64_t ns, bool_t erase)
+{
+    const CO_lockClass_t *od = &CO_lockClass[CO_LOCK_CLASS_OD];
+
+    stall.totalNs += ns;
+    if (od->depth != 0U) {
+        if (od->count != stall.holdCount) {
+            stall.holdCount = od->count;
+            stall.holdNs = 0;
+        }
+        stall.holdNs += ns;
+        stall.lockedNs += ns;
+        if (stall.holdNs > stall.lockedMaxNs) {
+            stall.lockedMaxNs = stall.holdNs;
+        }
+        if (erase) {
+            stall.lockedErases++;
+        }
+    }
+    if (nodeSrv.busyUntilNs < bus.nowNs) {
+        nodeSrv.busyUntilNs = bus.nowNs;
+    }
+    nodeSrv.busyUntilNs += ns;
+}
+
+static bool_t sim_flash_erase(void *object, uintptr_t address)
+{
+    (void)object;
+    memset((void *)address, 0xFF, FLASH_SECTOR);
+    sim_flash_stall(sectorEraseNs, true);
+    return true;
+}
+
+static bool_t sim_flash_program(void *object, uintptr_t address, const uint32_t *page)
+{
+    (void)object;
+    memcpy((void *)address, page, CO_FLASH_PAGE_SIZE);
+    sim_flash_stall(pageProgramNs, false);
+    return true;
+}
+
+static const CO_flashOps_t simFlashOps = { sim_flash_erase, sim_flash_program, NULL };
+
+/* 主循環停止期間不執行 process() */
+static void node_wakeAt(simNode_t *node, uint64_t t)
+{
+    if (t < node->busyUntilNs) {
+        t = node->busyUntilNs;
+    }
+    if (t < node->wakeNs) {
+        node->wakeNs = t;
+    }
+}
+
+static void node_wake(void *object)
+{
+    node_wakeAt((simNode_t *)object, bus.nowNs + WAKE_NS);
+}
+
+static void bus_monitor(void *object, const CO_vbusFrame_t *frame)
+{
+    (void)object;
+    (void)frame;
+    busFrames++;
+}
+
+static int sim_setup(uint16_t kbps)
+{
+    uint32_t errInfo = 0;
+    CO_ReturnError_t err;
+
+    CO_vbus_init(&bus);
+    CO_vbus_setBitrate(&bus, kbps);
+    CO_vbus_setMonitor(&bus, bus_monitor, NULL);
+    err = CO_CANmodule_init(&nodeSrv.CANmodule, &bus, nodeSrv.rxArray, RX_SIZE, nodeSrv.txArray, TX_SIZE, kbps);
+    if (err == CO_ERROR_NO) {
+        err = CO_CANmodule_init(&nodeCli.CANmodule, &bus, nodeCli.rxArray, RX_SIZE, nodeCli.txArray, TX_SIZE, kbps);
+    }
+    if (err == CO_ERROR_NO) {
+        err = CO_SDOserver_init(&sdoSrv, &simOD, NULL, NODE_SRV, SDO_TIMEOUT_MS, &nodeSrv.CANmodule, RX_SDO_SRV,
+                                &nodeSrv.CANmodule, TX_SDO_SRV, &errInfo);
+    }
+    if (err == CO_ERROR_NO) {
+        err = CO_SDOclient_init(&sdoCli, &simOD, OD_find(&simOD, 0x1280), NODE_CLI, &nodeCli.CANmodule, RX_SDO_CLI,
+                                &nodeCli.CANmodule, TX_SDO_CLI, &errInfo);
+    }
+    if (err == CO_ERROR_NO && CO_flashStream_initOD(&flashStream, OD_find(&simOD, 0x2200)) != ODR_OK) {
+        err = CO_ERROR_OD_PARAMETERS;
+    }
+    if (err != CO_ERROR_NO) {
+        printf("FAIL: setup %d (errInfo 0x%X)\n", err, errInfo);
+        return 1;
+    }
+    CO_SDOserver_initCallbackPre(&sdoSrv, &nodeSrv, node_wake);
+    CO_SDOclient_initCallbackPre(&sdoCli, &nodeCli, node_wake);
+    CO_CANsetNormalMode(&nodeSrv.CANmodule);
+    CO_CANsetNormalMode(&nodeCli.CANmodule);
+    nodeSrv.wakeNs = nodeCli.wakeNs = UINT64_MAX;
+    nodeSrv.lastNs = nodeCli.lastNs = 0;
+    nodeSrv.busyUntilNs = nodeCli.busyUntilNs = 0;
+    memset(&stall, 0, sizeof(stall));
+    return 0;
+}
+
+/* 經過的時間 (us) 並依 timerNext 排定下一次 process() */
+static uint32_t node_elapsed_us(simNode_t *node)
+{
+    uint32_t dt = (uint32_t)((bus.nowNs - node->lastNs) / 1000U);
+    node->lastNs += (uint64_t)dt * 1000U;
+    node->wakeNs = UINT64_MAX;
+    return dt;
+}
+
+static void node_schedule(simNode_t *node, uint32_t timerNext_us)
+{
+    uint64_t t = timerNext_us == 0U ? bus.nowNs + IDLE_NS : bus.nowNs + (uint64_t)timerNext_us * 1000U;
+    if (timerNext_us != UINT32_MAX) {
+        node_wakeAt(node, t);
+    }
+}
+
+/* 執行到下一個事件 (匯流排或節點)，回傳 false：沒有事件 */
+static bool_t sim_step(void)
+{
+    uint64_t t = CO_vbus_nextEvent(&bus);
+
+    if (nodeSrv.wakeNs < t) {
+        t = nodeSrv.wakeNs;
+    }
+    if (nodeCli.wakeNs < t) {
+        t = nodeCli.wakeNs;
+    }
+    if (t == UINT64_MAX) {
+        return false;
+    }
+    CO_vbus_advance(&bus, t);
+    if (bus.nowNs >= nodeSrv.wakeNs) {
+        uint32_t timerNext = UINT32_MAX;
+        CO_SDOserver_process(&sdoSrv, true, node_elapsed_us(&nodeSrv), &timerNext);
+        /* 與 main.c 相同：SDO 之後執行一個 flash 命令 (鎖外) */
+        if (CO_flashStream_process(&flashStream)) {
+            timerNext = 0;
+        }
+        node_schedule(&nodeSrv, timerNext);
+    }
+    return true;
+}
+
+/* 客戶端傳輸結束後執行伺服器到閒置，客戶端不再處理 */
+static void sim_drain(void)
+{
+    do {
+        nodeCli.wakeNs = UINT64_MAX;
+    } while (sim_step());
+}
+
+/******************************************************************************/
+/* SDO 傳輸，回傳中止碼 (CO_SDO_AB_NONE = 成功)，*ns 為虛擬時間 */
+static CO_SDO_abortCode_t sdo_download(const uint8_t *data, size_t len, bool_t block, size_t abortAt, uint64_t *ns)
+{
+    CO_SDO_abortCode_t abortCode = CO_SDO_AB_NONE;
+    CO_SDO_return_t ret;
+    size_t sizeTransferred = 0;
+    uint64_t t0 = bus.nowNs;
+
+    if (CO_SDOclientDownloadInitiate(&sdoCli, 0x2200, 0, len, sdoTimeoutMs, block) != CO_SDO_RT_ok_communicationEnd) {
+        return CO_SDO_AB_GENERAL;
+    }
+    size_t written = CO_SDOclientDownloadBufWrite(&sdoCli, data, len);
+    nodeCli.lastNs = bus.nowNs;
+    nodeCli.wakeNs = bus.nowNs;
+    do {
+        if (!sim_step()) {
+            return CO_SDO_AB_GENERAL;
+        }
+        if (bus.nowNs < nodeCli.wakeNs) {
+            continue;
+        }
+        uint32_t timerNext = UINT32_MAX;
+        bool_t abort = abortAt != 0U && sizeTransferred >= abortAt;
+        if (abort) {
+            abortCode = CO_SDO_AB_GENERAL;      /* 客戶端送出的中止碼 */
+        }
+        ret = CO_SDOclientDownload(&sdoCli, node_elapsed_us(&nodeCli), abort, written < len, &abortCode,
+                                   &sizeTransferred, &timerNext);
+        if (written < len) {
+            written += CO_SDOclientDownloadBufWrite(&sdoCli, data + written, len - written);
+            timerNext = 0;
+        }
+        node_schedule(&nodeCli, timerNext);
+    } while (ret > 0);
+    *ns = bus.nowNs - t0;
+
+    sim_drain();
+    if (ret == CO_SDO_RT_ok_communicationEnd && sizeTransferred != len) {
+        return CO_SDO_AB_DATA_SHORT;
+    }
+    return ret == CO_SDO_RT_ok_communicationEnd ? CO_SDO_AB_NONE : abortCode;
+}
+
+static CO_SDO_abortCode_t sdo_upload(uint8_t *data, size_t size, size_t *len, bool_t block)
+{
+    CO_SDO_abortCode_t abortCode = CO_SDO_AB_NONE;
+    CO_SDO_return_t ret;
+    size_t sizeIndicated = 0, sizeTransferred = 0, read = 0;
+
+    if (CO_SDOclientUploadInitiate(&sdoCli, 0x2200, 0, sdoTimeoutMs, block) != CO_SDO_RT_ok_communicationEnd) {
+        return CO_SDO_AB_GENERAL;
+    }
+    nodeCli.lastNs = bus.nowNs;
+    nodeCli.wakeNs = bus.nowNs;
+    do {
+        if (!sim_step()) {
+            return CO_SDO_AB_GENERAL;
+        }
+        if (bus.nowNs < nodeCli.wakeNs) {
+            continue;
+        }
+        uint32_t timerNext = UINT32_MAX;
+        ret = CO_SDOclientUpload(&sdoCli, node_elapsed_us(&nodeCli), false, &abortCode, &sizeIndicated,
+                                 &sizeTransferred, &timerNext);
+        if (ret == CO_SDO_RT_uploadDataBufferFull || ret == CO_SDO_RT_ok_communicationEnd) {
+            read += CO_SDOclientUploadBufRead(&sdoCli, data + read, size - read);
+            timerNext = 0;
+        }
+        node_schedule(&nodeCli, timerNext);
+    } while (ret > 0);
+    sim_drain();
+    *len = read;
+    return ret == CO_SDO_RT_ok_communicationEnd ? CO_SDO_AB_NONE : abortCode;
+}
+
+/******************************************************************************/
+static int run(uint16_t kbps, const uint8_t *src, size_t len, uint32_t programUs, uint32_t eraseUs, double *bps)
+{
+    int failures = 0;
+    uint64_t ns[2] = {0, 0};
+    static const char *const names[2] = {"segmented", "block"};
+
+    for (int block = 0; block < 2; block++) {
+        CO_flashStream_init(&flashStream, &simFlashOps, (uintptr_t)flashMem, FLASH_SIZE, FLASH_SECTOR);
+        if (sim_setup(kbps) != 0) {
+            return 1;
+        }
+        pageProgramNs = (uint64_t)programUs * 1000U;
+        sectorEraseNs = (uint64_t)eraseUs * 1000U;
+        busFrames = 0;
+
+        CO_SDO_abortCode_t abortCode = sdo_download(src, len, block != 0, 0, &ns[block]);
+        uint32_t length = 0;
+        const uint8_t *stored = CO_flashStream_data(&flashStream, &length);
+        CHECK(abortCode == CO_SDO_AB_NONE, "%u kbit/s %s download: abort 0x%08X", kbps, names[block],
+              (unsigned)abortCode);
+        CHECK(stored != NULL && length == len && memcmp(stored, src, len) == 0, "%u kbit/s %s: flash content",
+              kbps, names[block]);
+        CHECK(flashStream.pageCount == (len + CO_FLASH_PAGE_SIZE - 1U) / CO_FLASH_PAGE_SIZE + 1U,
+              "%u kbit/s %s: %u pages programmed", kbps, names[block], flashStream.pageCount);
+
+        bps[block] = ns[block] != 0U ? (double)len * 1e9 / (double)ns[block] : 0.0;
+        printf("  %4u kbit/s  %-9s  page %5u us  %8.3f ms  %6u frames  %8.0f bytes/s\n", kbps, names[block],
+               programUs, (double)ns[block] / 1e6, busFrames, bps[block]);
+    }
+    CHECK(bps[1] > bps[0], "%u kbit/s: block %.0f <= segmented %.0f bytes/s", kbps, bps[1], bps[0]);
+    return failures;
+}
+
+/* 區塊上傳讀回、超過容量、中止的下載 */
+static int test_edges(const uint8_t *src, size_t len)
+{
+    int failures = 0;
+    static uint8_t readBack[FLASH_SIZE];
+    size_t readLen = 0;
+    uint64_t ns = 0;
+
+    CO_flashStream_init(&flashStream, &simFlashOps, (uintptr_t)flashMem, FLASH_SIZE, FLASH_SECTOR);
+    if (sim_setup(1000) != 0) {
+        return 1;
+    }
+    pageProgramNs = 0;
+    sectorEraseNs = 0;
+
+    CHECK(sdo_download(src, len, true, 0, &ns) == CO_SDO_AB_NONE, "block download");
+    CHECK(sdo_upload(readBack, sizeof(readBack), &readLen, true) == CO_SDO_AB_NONE && readLen == len
+              && memcmp(readBack, src, len) == 0,
+          "block upload: %u bytes", (unsigned)readLen);
+    CHECK(sdo_upload(readBack, sizeof(readBack), &readLen, false) == CO_SDO_AB_NONE && readLen == len
+              && memcmp(readBack, src, len) == 0,
+          "segmented upload: %u bytes", (unsigned)readLen);
+
+    /* 超過容量：伺服器以 DATA_LONG 中止 (大小指示)，之前的資料已失效 */
+    static uint8_t big[FLASH_SIZE];
+    size_t capacity = CO_flashStream_capacity(&flashStream);
+    uint32_t length = 0;
+    memcpy(big, src, len);
+    CHECK(sdo_download(big, capacity + 1U, true, 0, &ns) == CO_SDO_AB_DATA_LONG, "capacity + 1 not aborted");
+    CHECK(CO_flashStream_data(&flashStream, &length) == NULL, "data valid after aborted download");
+
+    /* 容量剛好 */
+    CHECK(sdo_download(big, capacity, true, 0, &ns) == CO_SDO_AB_NONE
+              && CO_flashStream_data(&flashStream, &length) != NULL && length == capacity,
+          "download of capacity: %u bytes", length);
+
+    /* 客戶端在資料寫入 flash 後中止：沒有標頭，上傳回應 No data */
+    CO_SDO_abortCode_t abortCode = sdo_download(big, capacity, true, capacity / 2U, &ns);
+    CHECK(abortCode != CO_SDO_AB_NONE && CO_flashStream_data(&flashStream, &length) == NULL,
+          "client abort: 0x%08X", (unsigned)abortCode);
+    abortCode = sdo_upload(readBack, sizeof(readBack), &readLen, false);
+    CHECK(abortCode == CO_SDO_AB_NO_DATA, "upload after abort: 0x%08X", (unsigned)abortCode);
+    return failures;
+}
+
+/*
+ * flash 停止：XMC4800 的頁寫入與 sector 擦除時間。sector 擦除與大部分寫頁在 CO_flashStream_process()
+ * (鎖外) 執行；只有佇列已滿時 OD 寫入在 CO_LOCK_OD 內寫頁
+ */
+static int test_flash_stall(const uint8_t *src, size_t len)
+{
+    int failures = 0;
+    uint64_t ns = 0;
+    uint32_t length = 0;
+
+    printf("flash stall: page %u us, sector erase %u us\n", STALL_PROGRAM_US, STALL_ERASE_US);
+    static const uint16_t rates[2] = {500, 1000};
+    for (int r = 0; r < 2; r++) {
+        CO_flashStream_init(&flashStream, &simFlashOps, (uintptr_t)flashMem, FLASH_SIZE, FLASH_SECTOR);
+        if (sim_setup(rates[r]) != 0) {
+            return 1;
+        }
+        pageProgramNs = (uint64_t)STALL_PROGRAM_US * 1000U;
+        sectorEraseNs = (uint64_t)STALL_ERASE_US * 1000U;
+
+        CO_SDO_abortCode_t abortCode = sdo_download(src, len, true, 0, &ns);
+        const uint8_t *stored = CO_flashStream_data(&flashStream, &length);
+        CHECK(abortCode == CO_SDO_AB_NONE && stored != NULL && length == len && memcmp(stored, src, len) == 0,
+              "%u kbit/s: download with flash stall: abort 0x%08X", rates[r], (unsigned)abortCode);
+        CHECK(stall.lockedErases == 0U, "%u kbit/s: %u sector erases inside CO_LOCK_OD", rates[r],
+              stall.lockedErases);
+        CHECK(stall.lockedMaxNs <= CO_FLASH_STREAM_QUEUE_PAGES * pageProgramNs,
+              "%u kbit/s: %.1f ms flash stall in one CO_LOCK_OD hold", rates[r], (double)stall.lockedMaxNs / 1e6);
+        printf("  %4u kbit/s  block  %8.0f bytes/s  stall %7.1f ms, in CO_LOCK_OD %6.1f ms (max %5.1f ms per OD "
+               "write, %u of %u pages)\n",
+               rates[r], (double)len * 1e9 / (double)ns, (double)stall.totalNs / 1e6, (double)stall.lockedNs / 1e6,
+               (double)stall.lockedMaxNs / 1e6, flashStream.lockedPages, flashStream.pageCount);
+    }
+
+    /* 擦除時間超過客戶端逾時：第一個子區塊的確認太晚，客戶端中止，沒有有效資料 */
+    sdoTimeoutMs = STALL_ERASE_US / 2000U;
+    CO_SDO_abortCode_t abortCode = sdo_download(src, len, true, 0, &ns);
+    sdoTimeoutMs = SDO_TIMEOUT_MS;
+    CHECK(abortCode == CO_SDO_AB_TIMEOUT && CO_flashStream_data(&flashStream, &length) == NULL,
+          "client timeout %u ms < erase: abort 0x%08X", STALL_ERASE_US / 2000U, (unsigned)abortCode);
+    printf("  client timeout %u ms < sector erase: abort 0x%08X\n", STALL_ERASE_US / 2000U, (unsigned)abortCode);
+    return failures;
+}
+
+int main(int argc, char *argv[])
+{
+    int failures = 0;
+    uint32_t kb = 100;
+    uint32_t programUs = 0;
+    uint32_t eraseUs = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "k:p:e:")) != -1) {
+        switch (opt) {
+            case 'k': kb = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'p': programUs = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'e': eraseUs = (uint32_t)strtoul(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "usage: %s [-k KB] [-p page program us] [-e sector erase us]\n", argv[0]);
+                return 2;
+        }
+    }
+    size_t len = (size_t)kb * 1024U;
+    if (len == 0U || len > FLASH_SIZE - CO_FLASH_PAGE_SIZE) {
+        fprintf(stderr, "-k: 1 ~ %u KB\n", (FLASH_SIZE - CO_FLASH_PAGE_SIZE) / 1024U);
+        return 2;
+    }
+    static uint8_t src[FLASH_SIZE];
+    for (size_t i = 0; i < sizeof(src); i++) {
+        src[i] = (uint8_t)(i * 7U + (i >> 8) + 3U);
+    }
+
+    unsigned blksize = (unsigned)((CO_CONFIG_SDO_SRV_BUFFER_SIZE - 2U) / 7U);
+    printf("=== SDO download of %u KB to 0x2200 (flash stream, server buffer %u, block size %u) ===\n", kb,
+           (unsigned)CO_CONFIG_SDO_SRV_BUFFER_SIZE, blksize > 127U ? 127U : blksize);
+    static const uint16_t rates[2] = {500, 1000};
+    for (int r = 0; r < 2; r++) {
+        double bps[2];
+        failures += run(rates[r], src, len, programUs, eraseUs, bps);
+        printf("  %4u kbit/s  block / segmented %.2fx\n", rates[r], bps[0] != 0.0 ? bps[1] / bps[0] : 0.0);
+    }
+    failures += test_edges(src, len);
+    failures += test_flash_stall(src, len);
+
+    printf("%s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}
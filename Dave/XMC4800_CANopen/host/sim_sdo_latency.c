@@ -0,0 +1,204 @@
+/**
+ * Host simulation of SDO/EMCY latency: fixed 10 ms CO_process() vs CO_sched
+ *
+ * @file sim_sdo_latency.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 以 1 us 解析度的事件模擬比較兩種主循環：
+ *  - 原本：CO_timer1ms 前進 10 ms 才呼叫 CO_process()，timerNext_us = NULL
+ *  - CO_sched：接收回呼 (CALLBACK_PRE) 或 timerNext_us 到期時呼叫，其餘時間 WFI
+ * SDO 伺服器在 CO_process() 中回應，回應後客戶端隔一段時間送出下一個請求；
+ * EMCY 由應用程式在隨機時間觸發，在下一次 CO_process() 送出。
+ * 同時檢查 CO_sched 的 timerNext_us 到期判斷與 1 ms 解析度。
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CO_sched.h"
+
+#define CAN_FRAME_US        222U        /* 500 kbit/s，8 byte 標準訊框含填充位元 */
+#define ISR_WAKE_US         5U          /* CAN ISR + WFI 喚醒 + CO_process() 的處理時間 */
+#define CLIENT_TURN_US      300U        /* 客戶端收到回應到送出下一個請求 */
+#define SEGMENTS            10U         /* 分段上傳：起始 + 9 個分段，每段一次往返 */
+#define TRANSFERS           2000U
+#define EMCY_EVENTS         2000U
+#define OLD_INTERVAL_MS     10U
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+typedef enum { LOOP_FIXED_10MS, LOOP_SCHED } loop_t;
+
+typedef struct {
+    uint64_t                sum, max, n;
+} stat_t;
+
+static void stat_add(stat_t *s, uint64_t v)
+{
+    s->sum += v;
+    s->n++;
+    if (v > s->max) {
+        s->max = v;
+    }
+}
+
+static uint32_t rng_state = 12345U;
+static uint32_t rng(void)
+{
+    rng_state = rng_state * 1103515245U + 12345U;
+    return rng_state >> 8;
+}
+
+/*
+ * 事件發生在 t (us)：回傳主循環處理該事件的時間。
+ *  - 原本：lastRun 起每 10 ms 一次，事件之後的第一個執行點
+ *  - CO_sched：接收中斷呼叫 CO_sched_signal()，主循環被中斷喚醒後立即處理
+ * 兩者的 CO_process() 都由主循環執行，所以 10 ms 週期內的事件在週期點一起處理。
+ */
+static uint64_t process_time(loop_t loop, CO_sched_t *sched, uint64_t *lastRunMs, uint64_t t)
+{
+    if (loop == LOOP_FIXED_10MS) {
+        uint64_t ms = t / 1000U + 1U;
+        uint64_t next = *lastRunMs;
+        while (next < ms) {
+            next += OLD_INTERVAL_MS;
+        }
+        *lastRunMs = next;
+        return next * 1000U + ISR_WAKE_US;
+    }
+
+    uint32_t dt;
+    CO_sched_signal(sched);
+    if (!CO_sched_due(sched, (uint32_t)(t / 1000U), &dt)) {
+        return UINT64_MAX;
+    }
+    return t + ISR_WAKE_US;
+}
+
+static void run(loop_t loop, stat_t *rtt, stat_t *xfer, stat_t *emcy, uint32_t *runsPerSec)
+{
+    CO_sched_t sched;
+    uint64_t lastRunMs = 0;
+    uint64_t t = 1000U;
+
+    CO_sched_init(&sched, 0);
+    rng_state = 12345U;
+
+    /* SDO 分段上傳：每段一次請求/回應 */
+    for (uint32_t x = 0; x < TRANSFERS; x++) {
+        uint64_t start = t;
+        for (uint32_t seg = 0; seg < SEGMENTS; seg++) {
+            uint64_t rxDone = t + CAN_FRAME_US;                     /* 請求訊框收完 */
+            uint64_t resp = process_time(loop, &sched, &lastRunMs, rxDone);
+            uint64_t respDone = resp + CAN_FRAME_US;                /* 回應訊框送完 */
+            stat_add(rtt, respDone - t);
+            t = respDone + CLIENT_TURN_US;
+        }
+        stat_add(xfer, t - start);
+        t += (rng() % 20000U) + 1000U;                              /* 下一次傳輸 */
+    }
+
+    /* EMCY：應用程式在隨機時間呼叫 CO_errorReport() */
+    for (uint32_t e = 0; e < EMCY_EVENTS; e++) {
+        t += (rng() % 20000U) + 1000U;
+        uint64_t sent = process_time(loop, &sched, &lastRunMs, t) + CAN_FRAME_US;
+        stat_add(emcy, sent - t);
+    }
+
+    /* 閒置時的 CO_process() 次數：原本固定 100 次/s；CO_sched 依 timerNext_us (此處 HB 100 ms) */
+    if (loop == LOOP_FIXED_10MS) {
+        *runsPerSec = 1000U / OLD_INTERVAL_MS;
+    } else {
+        uint32_t before = sched.runCount;
+        uint32_t dt;
+        uint32_t base = (uint32_t)(t / 1000U) + 1U;
+        sched.signal = false;
+        sched.lastMs = base;
+        sched.timerNext_us = 100000U;
+        for (uint32_t ms = base; ms < base + 1000U; ms++) {
+            if (CO_sched_due(&sched, ms, &dt)) {
+                sched.timerNext_us = 100000U;   /* CO_process() 回報下一次心跳 */
+            }
+        }
+        *runsPerSec = sched.runCount - before;
+    }
+}
+
+static int test_sched(void)
+{
+    int failures = 0;
+    CO_sched_t sched;
+    uint32_t dt = 0;
+
+    CO_sched_init(&sched, 100U);
+    CHECK(CO_sched_due(&sched, 100U, &dt) && dt == 0U, "first call not due");
+    CHECK(sched.timerNext_us == CO_SCHED_MAX_INTERVAL_US, "timerNext_us not reset");
+    CHECK(CO_sched_idle(&sched), "not idle after run");
+
+    /* timerNext_us 到期判斷：1 ms 解析度 */
+    sched.timerNext_us = 2500U;
+    CHECK(!CO_sched_due(&sched, 102U, &dt), "due before 2.5 ms");
+    CHECK(CO_sched_due(&sched, 103U, &dt) && dt == 3000U, "not due at 3 ms (dt=%u)", dt);
+
+    /* 回呼立即觸發，dt 可以是 0 */
+    sched.timerNext_us = 50000U;
+    CHECK(!CO_sched_due(&sched, 103U, &dt), "due without signal");
+    CO_sched_signal(&sched);
+    CHECK(!CO_sched_idle(&sched), "idle with signal");
+    CHECK(CO_sched_due(&sched, 103U, &dt) && dt == 0U, "signal not due");
+    CHECK(sched.signalCount == 1U, "signalCount=%u", sched.signalCount);
+
+    /* timerNext_us = 0：CO_process() 要求立即再處理，主循環不能睡眠 */
+    sched.timerNext_us = 0U;
+    CHECK(!CO_sched_idle(&sched), "idle with timerNext_us = 0");
+    CHECK(CO_sched_due(&sched, 103U, &dt), "timerNext_us = 0 not due");
+
+    /* CO_timer1ms 溢位 */
+    CO_sched_init(&sched, 0xFFFFFFFEU);
+    CO_sched_due(&sched, 0xFFFFFFFEU, &dt);
+    sched.timerNext_us = 3000U;
+    CHECK(CO_sched_due(&sched, 1U, &dt) && dt == 3000U, "wrap dt=%u", dt);
+
+    printf("sched: timerNext_us, signal and wrap %s\n", failures == 0 ? "OK" : "WRONG");
+    return failures;
+}
+
+static void report(const char *name, const stat_t *s)
+{
+    printf("    %-26s avg %8.2f ms   max %8.2f ms\n", name,
+           (double)s->sum / (double)s->n / 1000.0, (double)s->max / 1000.0);
+}
+
+int main(void)
+{
+    int failures = test_sched();
+    static const char *const names[] = { "fixed 10 ms CO_process()", "CO_sched + WFI" };
+    stat_t rtt[2], xfer[2], emcy[2];
+    uint32_t runs[2];
+
+    memset(rtt, 0, sizeof(rtt));
+    memset(xfer, 0, sizeof(xfer));
+    memset(emcy, 0, sizeof(emcy));
+
+    printf("\nSDO/EMCY latency, 500 kbit/s (%u us/frame), %u transfers x %u segments, %u EMCY\n",
+           CAN_FRAME_US, TRANSFERS, SEGMENTS, EMCY_EVENTS);
+    for (int l = 0; l < 2; l++) {
+        run((loop_t)l, &rtt[l], &xfer[l], &emcy[l], &runs[l]);
+        printf("  %s\n", names[l]);
+        report("SDO request -> response", &rtt[l]);
+        report("SDO 10-segment upload", &xfer[l]);
+        report("CO_errorReport -> EMCY", &emcy[l]);
+        printf("    %-26s %u /s\n", "idle CO_process() calls", runs[l]);
+    }
+
+    double gain = (double)rtt[0].sum / (double)rtt[1].sum;
+    printf("\n  SDO round trip %.0fx faster\n", gain);
+    CHECK(rtt[1].max < 1000U, "CO_sched SDO round trip above 1 ms (%llu us)", (unsigned long long)rtt[1].max);
+    CHECK(gain > 5.0, "CO_sched not clearly faster (%.1fx)", gain);
+    CHECK(runs[1] < runs[0], "CO_sched runs more often when idle");
+
+    printf("\n%s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,384 @@
+/**
+ * SDO block transfer goodput under frame loss, without and with block transfer statistics
+ *
+ * @file sim_sdo_loss.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * SDO 伺服器 (節點 1，韌體設定) 與客戶端 (節點 2) 在 CO_vbus_t 上以虛擬時間執行，CO_vbus_setDrop() 以固定種子的
+ * 亂數丟棄 0 / 0.1% / 1% / 5% 的訊框。每種遺失率下載與上傳 TRANSFERS 次 4 KB 到 RAM DOMAIN 0x2000：
+ *  - fixed：客戶端沒有統計表，上傳 blksize 由緩衝區空間決定 (127)
+ *  - stat：CO_SDOclient_initBlockStat()，記錄每個 sub-block 的遺失段 (實際缺少的段) 與重送段
+ * 中止 (遺失的起始 / 確認訊框造成 SDO 逾時) 後應用程式重試，goodput = 資料 bytes / 包含重試的總虛擬時間。
+ * 下載的 blksize 由伺服器決定 (CiA 301)，伺服器忽略第一個缺少的段之後的段，每個 sub-block 只知道一個遺失段。
+ * 預設 CO_CONFIG_SDO_CLI_BLKSIZE_MIN (127) 不調整 blksize：較小的 sub-block 雖然重送較少的段，
+ * 但每個 sub-block 多一個確認訊框，確認遺失時傳輸以 SDO 逾時中止。以 -DCO_CONFIG_SDO_CLI_BLKSIZE_MIN=16 ~ 96 編譯
+ * (AIMD，-n 64) 時 1% 遺失的上傳 goodput 都低於 fixed，5% 遺失時最多相同。
+ * 檢查：資料正確、全部傳輸在 ATTEMPTS_MAX 次內完成、遺失段數不超過丟棄的訊框且不超過重送段數、
+ * 不調整 blksize 時統計不改變傳輸 (goodput 與訊框數與 fixed 相同)。
+ *
+ * 使用方式: sim_sdo_loss [-n transfers] [-s seed]
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define OD_DEFINITION
+#include "301/CO_ODinterface.h"
+#include "301/CO_SDOserver.h"
+#include "301/CO_SDOclient.h"
+#include "CO_driver_host.h"
+
+#define NODE_SRV                1U
+#define NODE_CLI                2U
+#define SDO_TIMEOUT_MS          500U
+#define WAKE_NS                 10000ULL        /* 收到訊框到主循環處理 */
+#define IDLE_NS                 1000ULL         /* timerNext 0：立即再次處理 */
+#define KBPS                    1000U
+#define DATA_SIZE               4096U
+#define TRANSFERS               16U
+#define ATTEMPTS_MAX            1000U
+#define STAT_COUNT              4U
+
+#define RX_SDO_SRV              0U
+#define RX_SDO_CLI              1U
+#define RX_SIZE                 2U
+#define TX_SDO_SRV              0U
+#define TX_SDO_CLI              1U
+#define TX_SIZE                 2U
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+/******************************************************************************/
+/* 物件字典：客戶端參數與 RAM DOMAIN */
+static struct {
+    uint8_t                 highestSub;
+    uint32_t                COB_IDClientToServer;
+    uint32_t                COB_IDServerToClient;
+    uint8_t                 nodeIdOfServer;
+} x1280 = { 3, 0x600U + NODE_SRV, 0x580U + NODE_SRV, NODE_SRV };
+
+static uint8_t x2000[DATA_SIZE];
+
+static CO_PROGMEM OD_obj_record_t o_1280[4] = {
+    { &x1280.highestSub, 0, ODA_SDO_R, 1 },
+    { &x1280.COB_IDClientToServer, 1, ODA_SDO_RW | ODA_MB, 4 },
+    { &x1280.COB_IDServerToClient, 2, ODA_SDO_RW | ODA_MB, 4 },
+    { &x1280.nodeIdOfServer, 3, ODA_SDO_RW, 1 } };
+static CO_PROGMEM OD_obj_var_t o_2000 = { &x2000[0], ODA_SDO_RW, sizeof(x2000) };
+
+static OD_entry_t simODList[] = {
+    {0x1280, 0x04, ODT_REC, (void *)&o_1280, NULL},
+    {0x2000, 0x01, ODT_VAR, (void *)&o_2000, NULL},
+    {0x0000, 0x00, 0, NULL, NULL}
+};
+
+static OD_t simOD = { (sizeof(simODList) / sizeof(simODList[0])) - 1U, &simODList[0] };
+
+/******************************************************************************/
+/* 節點、匯流排與故障注入 */
+typedef struct {
+    CO_CANmodule_t          CANmodule;
+    CO_CANrx_t              rxArray[RX_SIZE];
+    CO_CANtx_t              txArray[TX_SIZE];
+    uint64_t                wakeNs;         /* 下一次 process()，UINT64_MAX = 等待訊框 */
+    uint64_t                lastNs;         /* 上一次 process() */
+} simNode_t;
+
+typedef struct {
+    uint32_t                state;          /* xorshift32 */
+    uint32_t                threshold;      /* 丟棄機率 * 2^32 */
+} simLoss_t;
+
+static CO_vbus_t bus;
+static simNode_t nodeSrv, nodeCli;
+static CO_SDOserver_t sdoSrv;
+static CO_SDOclient_t sdoCli;
+static CO_SDOclient_blockStat_t blockStat[STAT_COUNT];
+static simLoss_t loss;
+
+static bool_t sim_drop(void *object, const CO_vbusFrame_t *frame)
+{
+    simLoss_t *l = (simLoss_t *)object;
+    (void)frame;
+    l->state ^= l->state << 13;
+    l->state ^= l->state >> 17;
+    l->state ^= l->state << 5;
+    return l->state < l->threshold;
+}
+
+static void node_wake(void *object)
+{
+    simNode_t *node = (simNode_t *)object;
+    if (node->wakeNs > bus.nowNs + WAKE_NS) {
+        node->wakeNs = bus.nowNs + WAKE_NS;
+    }
+}
+
+static int sim_setup(double lossRate, uint32_t seed, bool_t adaptive)
+{
+    uint32_t errInfo = 0;
+    CO_ReturnError_t err;
+
+    CO_vbus_init(&bus);
+    CO_vbus_setBitrate(&bus, KBPS);
+    loss.state = seed != 0U ? seed : 1U;
+    loss.threshold = (uint32_t)(lossRate * 4294967296.0);
+    CO_vbus_setDrop(&bus, sim_drop, &loss);
+    err = CO_CANmodule_init(&nodeSrv.CANmodule, &bus, nodeSrv.rxArray, RX_SIZE, nodeSrv.txArray, TX_SIZE, KBPS);
+    if (err == CO_ERROR_NO) {
+        err = CO_CANmodule_init(&nodeCli.CANmodule, &bus, nodeCli.rxArray, RX_SIZE, nodeCli.txArray, TX_SIZE, KBPS);
+    }
+    if (err == CO_ERROR_NO) {
+        err = CO_SDOserver_init(&sdoSrv, &simOD, NULL, NODE_SRV, SDO_TIMEOUT_MS, &nodeSrv.CANmodule, RX_SDO_SRV,
+                                &nodeSrv.CANmodule, TX_SDO_SRV, &errInfo);
+    }
+    if (err == CO_ERROR_NO) {
+        err = CO_SDOclient_init(&sdoCli, &simOD, OD_find(&simOD, 0x1280), NODE_CLI, &nodeCli.CANmodule, RX_SDO_CLI,
+                                &nodeCli.CANmodule, TX_SDO_CLI, &errInfo);
+    }
+    if (err != CO_ERROR_NO) {
+        printf("FAIL: setup %d (errInfo 0x%X)\n", err, errInfo);
+        return 1;
+    }
+    memset(blockStat, 0, sizeof(blockStat));
+    CO_SDOclient_initBlockStat(&sdoCli, adaptive ? blockStat : NULL, STAT_COUNT);
+    CO_SDOserver_initCallbackPre(&sdoSrv, &nodeSrv, node_wake);
+    CO_SDOclient_initCallbackPre(&sdoCli, &nodeCli, node_wake);
+    CO_CANsetNormalMode(&nodeSrv.CANmodule);
+    CO_CANsetNormalMode(&nodeCli.CANmodule);
+    nodeSrv.wakeNs = nodeCli.wakeNs = UINT64_MAX;
+    nodeSrv.lastNs = nodeCli.lastNs = 0;
+    return 0;
+}
+
+/* 經過的時間 (us) 並依 timerNext 排定下一次 process() */
+static uint32_t node_elapsed_us(simNode_t *node)
+{
+    uint32_t dt = (uint32_t)((bus.nowNs - node->lastNs) / 1000U);
+    node->lastNs += (uint64_t)dt * 1000U;
+    node->wakeNs = UINT64_MAX;
+    return dt;
+}
+
+static void node_schedule(simNode_t *node, uint32_t timerNext_us)
+{
+    uint64_t t = timerNext_us == 0U ? bus.nowNs + IDLE_NS : bus.nowNs + (uint64_t)timerNext_us * 1000U;
+    if (timerNext_us != UINT32_MAX && t < node->wakeNs) {
+        node->wakeNs = t;
+    }
+}
+
+/* 執行到下一個事件 (匯流排或節點)，回傳 false：沒有事件 */
+static bool_t sim_step(void)
+{
+    uint64_t t = CO_vbus_nextEvent(&bus);
+
+    if (nodeSrv.wakeNs < t) {
+        t = nodeSrv.wakeNs;
+    }
+    if (nodeCli.wakeNs < t) {
+        t = nodeCli.wakeNs;
+    }
+    if (t == UINT64_MAX) {
+        return false;
+    }
+    CO_vbus_advance(&bus, t);
+    if (bus.nowNs >= nodeSrv.wakeNs) {
+        uint32_t timerNext = UINT32_MAX;
+        CO_SDOserver_process(&sdoSrv, true, node_elapsed_us(&nodeSrv), &timerNext);
+        node_schedule(&nodeSrv, timerNext);
+    }
+    return true;
+}
+
+/* 客戶端傳輸結束後執行伺服器到閒置 (遺失的中止訊框：伺服器逾時)，客戶端不再處理 */
+static void sim_drain(void)
+{
+    do {
+        nodeCli.wakeNs = UINT64_MAX;
+    } while (sim_step());
+}
+
+/******************************************************************************/
+/* 一次區塊傳輸，回傳中止碼 (CO_SDO_AB_NONE = 成功) */
+static CO_SDO_abortCode_t sdo_download(const uint8_t *data, size_t len)
+{
+    CO_SDO_abortCode_t abortCode = CO_SDO_AB_NONE;
+    CO_SDO_return_t ret;
+    size_t sizeTransferred = 0;
+
+    if (CO_SDOclientDownloadInitiate(&sdoCli, 0x2000, 0, len, SDO_TIMEOUT_MS, true) != CO_SDO_RT_ok_communicationEnd) {
+        return CO_SDO_AB_GENERAL;
+    }
+    size_t written = CO_SDOclientDownloadBufWrite(&sdoCli, data, len);
+    nodeCli.lastNs = bus.nowNs;
+    nodeCli.wakeNs = bus.nowNs;
+    do {
+        if (!sim_step()) {
+            return CO_SDO_AB_GENERAL;
+        }
+        if (bus.nowNs < nodeCli.wakeNs) {
+            continue;
+        }
+        uint32_t timerNext = UINT32_MAX;
+        ret = CO_SDOclientDownload(&sdoCli, node_elapsed_us(&nodeCli), false, written < len, &abortCode,
+                                   &sizeTransferred, &timerNext);
+        if (written < len) {
+            written += CO_SDOclientDownloadBufWrite(&sdoCli, data + written, len - written);
+            timerNext = 0;
+        }
+        node_schedule(&nodeCli, timerNext);
+    } while (ret > 0);
+    sim_drain();
+    return ret == CO_SDO_RT_ok_communicationEnd ? CO_SDO_AB_NONE : abortCode;
+}
+
+static CO_SDO_abortCode_t sdo_upload(uint8_t *data, size_t size, size_t *len)
+{
+    CO_SDO_abortCode_t abortCode = CO_SDO_AB_NONE;
+    CO_SDO_return_t ret;
+    size_t sizeIndicated = 0, sizeTransferred = 0, read = 0;
+
+    if (CO_SDOclientUploadInitiate(&sdoCli, 0x2000, 0, SDO_TIMEOUT_MS, true) != CO_SDO_RT_ok_communicationEnd) {
+        return CO_SDO_AB_GENERAL;
+    }
+    nodeCli.lastNs = bus.nowNs;
+    nodeCli.wakeNs = bus.nowNs;
+    do {
+        if (!sim_step()) {
+            return CO_SDO_AB_GENERAL;
+        }
+        if (bus.nowNs < nodeCli.wakeNs) {
+            continue;
+        }
+        uint32_t timerNext = UINT32_MAX;
+        ret = CO_SDOclientUpload(&sdoCli, node_elapsed_us(&nodeCli), false, &abortCode, &sizeIndicated,
+                                 &sizeTransferred, &timerNext);
+        if (ret == CO_SDO_RT_uploadDataBufferFull || ret == CO_SDO_RT_ok_communicationEnd) {
+            read += CO_SDOclientUploadBufRead(&sdoCli, data + read, size - read);
+            timerNext = 0;
+        }
+        node_schedule(&nodeCli, timerNext);
+    } while (ret > 0);
+    sim_drain();
+    *len = read;
+    return ret == CO_SDO_RT_ok_communicationEnd ? CO_SDO_AB_NONE : abortCode;
+}
+
+/******************************************************************************/
+typedef struct {
+    double                  bps;            /* goodput */
+    uint32_t                frames;         /* 匯流排上的訊框，包含遺失的 */
+    uint32_t                aborts;         /* 重試的傳輸 */
+    CO_SDOclient_blockStat_t stat;          /* stat：伺服器的統計 */
+} simResult_t;
+
+/* TRANSFERS 次下載 (upload = false) 或上傳，中止時重試 */
+static int run(double lossRate, uint32_t seed, bool_t withStat, bool_t upload, uint32_t transfers,
+               simResult_t *result)
+{
+    int failures = 0;
+    static uint8_t src[DATA_SIZE], readBack[DATA_SIZE];
+    const char *name = upload ? "upload" : "download";
+
+    if (sim_setup(lossRate, seed, withStat) != 0) {
+        return 1;
+    }
+    memset(result, 0, sizeof(*result));
+    uint64_t t0 = bus.nowNs;
+    for (uint32_t n = 0; n < transfers; n++) {
+        for (size_t i = 0; i < sizeof(src); i++) {
+            src[i] = (uint8_t)((i * 13U) ^ (i >> 7) ^ (n * 29U));
+        }
+        if (upload) {
+            memcpy(x2000, src, sizeof(x2000));
+        }
+        uint32_t attempt = 0;
+        CO_SDO_abortCode_t abortCode;
+        size_t len = 0;
+        do {
+            abortCode = upload ? sdo_upload(readBack, sizeof(readBack), &len) : sdo_download(src, sizeof(src));
+            if (abortCode != CO_SDO_AB_NONE) {
+                result->aborts++;
+            }
+        } while (abortCode != CO_SDO_AB_NONE && ++attempt < ATTEMPTS_MAX);
+        CHECK(abortCode == CO_SDO_AB_NONE, "%.1f%% %s %u: abort 0x%08X after %u attempts", lossRate * 100.0, name, n,
+              (unsigned)abortCode, attempt);
+        if (upload) {
+            CHECK(len == sizeof(src) && memcmp(readBack, src, sizeof(src)) == 0, "%.1f%% upload %u: data",
+                  lossRate * 100.0, n);
+        } else {
+            CHECK(memcmp(x2000, src, sizeof(src)) == 0, "%.1f%% download %u: data", lossRate * 100.0, n);
+        }
+    }
+    uint64_t ns = bus.nowNs - t0;
+    result->bps = ns != 0U ? (double)transfers * DATA_SIZE * 1e9 / (double)ns : 0.0;
+    result->frames = bus.frameCount;
+
+    if (withStat) {
+        result->stat = blockStat[0];
+        CHECK(blockStat[0].nodeIdServer == NODE_SRV && blockStat[1].nodeIdServer == 0U, "%s: statistics entry",
+              name);
+        CHECK(blockStat[0].subBlocks > 0U && blockStat[0].segments >= transfers * (DATA_SIZE / 7U),
+              "%s: %u sub-blocks, %u segments", name, blockStat[0].subBlocks, blockStat[0].segments);
+        CHECK(lossRate != 0.0 || (blockStat[0].segmentsResent == 0U && blockStat[0].blksize == 127U),
+              "%s without loss: %u segments resent, blksize %u", name, blockStat[0].segmentsResent,
+              blockStat[0].blksize);
+        /* 遺失段是丟棄的訊框，中止的傳輸中的 sub-block 沒有確認而不計入 */
+        CHECK(blockStat[0].segmentsLost <= bus.dropCount && blockStat[0].segmentsLost <= blockStat[0].segmentsResent,
+              "%s: %u segments lost, %u resent, %u frames dropped", name, blockStat[0].segmentsLost,
+              blockStat[0].segmentsResent, bus.dropCount);
+        CHECK(lossRate == 0.0 || blockStat[0].segmentsLost > 0U, "%s: no lost segments", name);
+    }
+    printf("  %5.1f%%  %-8s  %-5s  %8.0f bytes/s  %3u aborts", lossRate * 100.0, name, withStat ? "stat" : "fixed",
+           result->bps, result->aborts);
+    if (withStat) {
+        printf("  %5u sub-blocks  %5u lost  %6u/%6u resent  blksize %3u", result->stat.subBlocks,
+               result->stat.segmentsLost, result->stat.segmentsResent, result->stat.segments, result->stat.blksize);
+    }
+    printf("  %6u frames  %5u dropped\n", bus.frameCount, bus.dropCount);
+    return failures;
+}
+
+int main(int argc, char *argv[])
+{
+    int failures = 0;
+    uint32_t transfers = TRANSFERS;
+    uint32_t seed = 0x2468ACE1U;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+        switch (opt) {
+            case 'n': transfers = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 's': seed = (uint32_t)strtoul(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "usage: %s [-n transfers] [-s seed]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (transfers == 0U) {
+        transfers = 1;
+    }
+
+    printf("=== SDO block transfer of %u x %u bytes at %u kbit/s under frame loss (blksize min %u, +%u) ===\n",
+           transfers, DATA_SIZE, KBPS, (unsigned)CO_CONFIG_SDO_CLI_BLKSIZE_MIN, (unsigned)CO_CONFIG_SDO_CLI_BLKSIZE_INC);
+    static const double rates[4] = {0.0, 0.001, 0.01, 0.05};
+    for (int r = 0; r < 4; r++) {
+        for (int upload = 0; upload < 2; upload++) {
+            simResult_t fixed, stat;
+            failures += run(rates[r], seed, false, upload != 0, transfers, &fixed);
+            failures += run(rates[r], seed, true, upload != 0, transfers, &stat);
+            if (CO_CONFIG_SDO_CLI_BLKSIZE_MIN >= 127U) {
+                CHECK(stat.frames == fixed.frames && stat.bps == fixed.bps,
+                      "%.1f%% %s: statistics changed the transfer (%u / %u frames)", rates[r] * 100.0,
+                      upload != 0 ? "upload" : "download", stat.frames, fixed.frames);
+            }
+        }
+    }
+
+    printf("%s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}
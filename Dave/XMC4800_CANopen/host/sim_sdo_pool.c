@@ -0,0 +1,381 @@
+/**
+ * Batch SDO configuration of 60 nodes: serial client vs pool of parallel channels on virtual time
+ *
+ * @file sim_sdo_pool.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 主站 (CO_SDOpool_t，port/CO_sdo_pool.c) 與 NODES 個 SDO 伺服器 (節點 1 ~ NODES，韌體設定) 在 CO_vbus_t 上
+ * 以虛擬時間執行，批次寫入 ITEMS 筆 (node, 0x2000, sub, u32)：
+ *  - 項目依節點分組 (一般的設定檔順序)，每個節點後面幾筆覆寫前面的子索引 - 檢查同一節點依序執行
+ *  - 一筆寫入不存在的物件 (伺服器中止)；另一個批次有一筆寫入不存在的節點 (逾時)，其他項目不等待該逾時
+ *  - 伺服器收到請求後 -l us 回應 (從站在主循環中處理 SDO)，主站收到訊框後 WAKE_NS 處理
+ * 1 個通道即目前逐一執行的方式 (CO_GTWA 一次一個 SDO 交易)，與 2 ~ 16 個通道比較總時間、項目/s 與匯流排負載。
+ * SDO 客戶端與其 CO_fifo 以 Makefile 的 SIM_CONFIG 啟用；虛擬匯流排沒有 MO，以 CO_CAN_RX_LIVE_SETUP=1 編譯。
+ *
+ * 使用方式: sim_sdo_pool [-l server latency us] [-b kbit/s]
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define OD_DEFINITION
+#include "301/CO_ODinterface.h"
+#include "301/CO_SDOserver.h"
+#include "301/CO_SDOclient.h"
+#include "CO_driver_host.h"
+#include "CO_sdo_pool.h"
+
+#define NODES                   60U
+#define NODE_MASTER             0x70U
+#define NODE_MISSING            100U
+#define PARAMS                  6U              /* 0x2000 sub 1 ~ PARAMS */
+#define ITEMS                   500U
+#define CHANNELS_MAX            16U
+#define SDO_TIMEOUT_MS          500U
+#define WAKE_NS                 10000ULL        /* 主站收到訊框到處理 */
+#define IDLE_NS                 1000ULL         /* timerNext 0：立即再次處理 */
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+/******************************************************************************/
+/* 從站：SDO 伺服器與 0x2000 ARRAY */
+typedef struct {
+    CO_CANmodule_t          CANmodule;
+    CO_CANrx_t              rxArray[1];
+    CO_CANtx_t              txArray[1];
+    CO_SDOserver_t          sdo;
+    uint8_t                 count;
+    uint32_t                param[PARAMS];
+    OD_obj_array_t          o_2000;
+    OD_entry_t              list[2];
+    OD_t                    od;
+    uint64_t                wakeNs;         /* 下一次 process()，UINT64_MAX = 等待訊框 */
+    uint64_t                lastNs;
+} simSlave_t;
+
+/* 主站：CHANNELS_MAX 個 SDO 客戶端 (0x1280 ~ 0x128F) */
+typedef struct {
+    uint8_t                 highestSub;
+    uint32_t                COB_IDClientToServer;
+    uint32_t                COB_IDServerToClient;
+    uint8_t                 nodeIdOfServer;
+} sim1280_t;
+
+typedef struct {
+    CO_CANmodule_t          CANmodule;
+    CO_CANrx_t              rxArray[CHANNELS_MAX];
+    CO_CANtx_t              txArray[CHANNELS_MAX];
+    CO_SDOclient_t          client[CHANNELS_MAX];
+    sim1280_t               x1280[CHANNELS_MAX];
+    OD_obj_record_t         o_1280[CHANNELS_MAX][4];
+    OD_entry_t              list[CHANNELS_MAX + 1U];
+    OD_t                    od;
+    CO_SDOpool_t            pool;
+    uint64_t                wakeNs;
+    uint64_t                lastNs;
+} simMaster_t;
+
+static CO_vbus_t bus;
+static simSlave_t slaves[NODES];
+static simMaster_t master;
+static CO_SDOpool_item_t items[ITEMS];
+static uint64_t latencyNs = 1000000ULL;
+
+static void slave_wake(void *object)
+{
+    simSlave_t *slave = (simSlave_t *)object;
+    if (slave->wakeNs > bus.nowNs + latencyNs) {
+        slave->wakeNs = bus.nowNs + latencyNs;
+    }
+}
+
+static void master_wake(void *object)
+{
+    (void)object;
+    if (master.wakeNs > bus.nowNs + WAKE_NS) {
+        master.wakeNs = bus.nowNs + WAKE_NS;
+    }
+}
+
+static int sim_setup(uint16_t kbps, uint8_t channels)
+{
+    uint32_t errInfo = 0;
+    CO_ReturnError_t err;
+
+    CO_vbus_init(&bus);
+    CO_vbus_setBitrate(&bus, kbps);
+    for (uint8_t n = 0; n < NODES; n++) {
+        simSlave_t *s = &slaves[n];
+        memset(s, 0, sizeof(*s));
+        s->count = PARAMS;
+        s->o_2000 = (OD_obj_array_t){ &s->count, &s->param[0], ODA_SDO_R, ODA_SDO_RW | ODA_MB, 4, 4 };
+        s->list[0] = (OD_entry_t){ 0x2000, PARAMS + 1U, ODT_ARR, &s->o_2000, NULL };
+        s->od = (OD_t){ 1, &s->list[0] };
+        err = CO_CANmodule_init(&s->CANmodule, &bus, s->rxArray, 1, s->txArray, 1, kbps);
+        if (err == CO_ERROR_NO) {
+            err = CO_SDOserver_init(&s->sdo, &s->od, NULL, (uint8_t)(n + 1U), SDO_TIMEOUT_MS, &s->CANmodule, 0,
+                                    &s->CANmodule, 0, &errInfo);
+        }
+        if (err != CO_ERROR_NO) {
+            printf("FAIL: slave %u setup %d (errInfo 0x%X)\n", n + 1U, err, errInfo);
+            return 1;
+        }
+        CO_SDOserver_initCallbackPre(&s->sdo, s, slave_wake);
+        CO_CANsetNormalMode(&s->CANmodule);
+        s->wakeNs = UINT64_MAX;
+    }
+
+    simMaster_t *m = &master;
+    memset(m, 0, sizeof(*m));
+    for (uint8_t i = 0; i < CHANNELS_MAX; i++) {
+        m->x1280[i] = (sim1280_t){ 3, 0x80000000UL, 0x80000000UL, 0 };
+        m->o_1280[i][0] = (OD_obj_record_t){ &m->x1280[i].highestSub, 0, ODA_SDO_R, 1 };
+        m->o_1280[i][1] = (OD_obj_record_t){ &m->x1280[i].COB_IDClientToServer, 1, ODA_SDO_RW | ODA_MB, 4 };
+        m->o_1280[i][2] = (OD_obj_record_t){ &m->x1280[i].COB_IDServerToClient, 2, ODA_SDO_RW | ODA_MB, 4 };
+        m->o_1280[i][3] = (OD_obj_record_t){ &m->x1280[i].nodeIdOfServer, 3, ODA_SDO_RW, 1 };
+        m->list[i] = (OD_entry_t){ (uint16_t)(0x1280U + i), 4, ODT_REC, &m->o_1280[i][0], NULL };
+    }
+    m->od = (OD_t){ CHANNELS_MAX, &m->list[0] };
+    err = CO_CANmodule_init(&m->CANmodule, &bus, m->rxArray, CHANNELS_MAX, m->txArray, CHANNELS_MAX, kbps);
+    for (uint8_t i = 0; i < channels && err == CO_ERROR_NO; i++) {
+        err = CO_SDOclient_init(&m->client[i], &m->od, &m->list[i], NODE_MASTER, &m->CANmodule, i, &m->CANmodule, i,
+                                &errInfo);
+        CO_SDOclient_initCallbackPre(&m->client[i], NULL, master_wake);
+    }
+    if (err == CO_ERROR_NO) {
+        err = CO_SDOpool_init(&m->pool, m->client, channels, SDO_TIMEOUT_MS);
+    }
+    if (err != CO_ERROR_NO) {
+        printf("FAIL: master setup %d (errInfo 0x%X)\n", err, errInfo);
+        return 1;
+    }
+    CO_CANsetNormalMode(&m->CANmodule);
+    m->wakeNs = UINT64_MAX;
+    return 0;
+}
+
+/* 經過的時間 (us)，lastNs 前進整數 us */
+static uint32_t elapsed_us(uint64_t *lastNs)
+{
+    uint32_t dt = (uint32_t)((bus.nowNs - *lastNs) / 1000U);
+    *lastNs += (uint64_t)dt * 1000U;
+    return dt;
+}
+
+static uint64_t next_wake(uint32_t timerNext_us)
+{
+    if (timerNext_us == UINT32_MAX) {
+        return UINT64_MAX;
+    }
+    return timerNext_us == 0U ? bus.nowNs + IDLE_NS : bus.nowNs + (uint64_t)timerNext_us * 1000U;
+}
+
+/* 執行批次，回傳虛擬時間 (ns) */
+static uint64_t sim_run(void)
+{
+    uint64_t t0 = bus.nowNs;
+
+    master.lastNs = bus.nowNs;
+    master.wakeNs = bus.nowNs;
+    for (;;) {
+        uint64_t t = CO_vbus_nextEvent(&bus);
+        if (master.wakeNs < t) {
+            t = master.wakeNs;
+        }
+        for (uint8_t n = 0; n < NODES; n++) {
+            if (slaves[n].wakeNs < t) {
+                t = slaves[n].wakeNs;
+            }
+        }
+        if (t == UINT64_MAX) {
+            break;
+        }
+        CO_vbus_advance(&bus, t);
+
+        for (uint8_t n = 0; n < NODES; n++) {
+            simSlave_t *s = &slaves[n];
+            if (bus.nowNs >= s->wakeNs) {
+                uint32_t timerNext = UINT32_MAX;
+                s->wakeNs = UINT64_MAX;
+                CO_SDOserver_process(&s->sdo, true, elapsed_us(&s->lastNs), &timerNext);
+                uint64_t w = next_wake(timerNext);
+                if (w < s->wakeNs) {
+                    s->wakeNs = w;
+                }
+            }
+        }
+        if (bus.nowNs >= master.wakeNs) {
+            uint32_t timerNext = UINT32_MAX;
+            master.wakeNs = UINT64_MAX;
+            uint32_t remaining = CO_SDOpool_process(&master.pool, elapsed_us(&master.lastNs), &timerNext);
+            uint64_t w = remaining > 0U ? next_wake(timerNext) : UINT64_MAX;
+            if (w < master.wakeNs) {
+                master.wakeNs = w;
+            }
+            if (remaining == 0U) {
+                return bus.nowNs - t0;
+            }
+        }
+    }
+    return bus.nowNs - t0;
+}
+
+/******************************************************************************/
+/* 依節點分組的批次：每個節點 k 筆，sub 1 ~ PARAMS 之後再從 sub 1 覆寫；missing：第一筆寫入不存在的節點 */
+static void make_items(bool_t missing)
+{
+    uint32_t writes = ITEMS - (missing ? 2U : 1U);
+    uint32_t perNode = (writes + NODES - 1U) / NODES;
+    uint32_t i = 0, w = 0;
+
+    if (missing) {
+        items[i++] = (CO_SDOpool_item_t){ NODE_MISSING, 1, 0x2000, 0, 4 };
+    }
+    for (uint32_t n = 0; n < NODES; n++) {
+        for (uint32_t k = 0; k < perNode && w < writes; k++, w++) {
+            uint8_t sub = (uint8_t)(1U + k % PARAMS);
+            items[i++] = (CO_SDOpool_item_t){ (uint8_t)(n + 1U), sub, 0x2000, ((n + 1U) << 24) | (k << 8) | sub, 4 };
+        }
+        if (n == NODES / 2U) {
+            items[i++] = (CO_SDOpool_item_t){ (uint8_t)(n + 1U), 0, 0x2001, 0, 4 };
+        }
+    }
+}
+
+static int verify(const char *name)
+{
+    int failures = 0;
+    uint32_t expected[NODES][PARAMS];
+    uint32_t errors = 0;
+
+    memset(expected, 0, sizeof(expected));
+    for (uint32_t i = 0; i < ITEMS; i++) {
+        const CO_SDOpool_item_t *item = &items[i];
+        if (item->nodeId == NODE_MISSING) {
+            CHECK(item->abortCode == CO_SDO_AB_TIMEOUT, "%s: missing node 0x%08X", name, (unsigned)item->abortCode);
+            errors++;
+        } else if (item->index != 0x2000U) {
+            CHECK(item->abortCode == CO_SDO_AB_NOT_EXIST, "%s: missing object 0x%08X", name,
+                  (unsigned)item->abortCode);
+            errors++;
+        } else {
+            CHECK(item->abortCode == CO_SDO_AB_NONE, "%s: item %u (node %u) 0x%08X", name, i, item->nodeId,
+                  (unsigned)item->abortCode);
+            expected[item->nodeId - 1U][item->subIndex - 1U] = item->value;
+        }
+    }
+    for (uint32_t n = 0; n < NODES; n++) {
+        if (memcmp(slaves[n].param, expected[n], sizeof(expected[n])) != 0) {
+            CHECK(false, "%s: node %u parameters (order)", name, n + 1U);
+            break;
+        }
+    }
+    CHECK(master.pool.done == ITEMS && master.pool.failed == errors, "%s: %u done, %u failed", name,
+          master.pool.done, master.pool.failed);
+    return failures;
+}
+
+/* 執行一個批次，回傳虛擬時間 (ns)，0 = 設定失敗 */
+static uint64_t run_batch(uint16_t kbps, uint8_t channels, bool_t missing)
+{
+    if (sim_setup(kbps, channels) != 0) {
+        return 0;
+    }
+    make_items(missing);
+    if (CO_SDOpool_start(&master.pool, items, ITEMS) != CO_ERROR_NO) {
+        printf("FAIL: start\n");
+        return 0;
+    }
+    return sim_run();
+}
+
+/* 批次 API 的參數檢查與 CO_SDOpool_abort() */
+static int test_api(void)
+{
+    int failures = 0;
+    CO_SDOpool_item_t bad[2] = { { 1, 1, 0x2000, 0, 4 }, { 1, 1, 0x2000, 0, 5 } };
+
+    if (sim_setup(500, 4) != 0) {
+        return 1;
+    }
+    CHECK(CO_SDOpool_init(&master.pool, master.client, 0, SDO_TIMEOUT_MS) == CO_ERROR_ILLEGAL_ARGUMENT,
+          "init with 0 channels");
+    CHECK(CO_SDOpool_init(&master.pool, master.client, 4, SDO_TIMEOUT_MS) == CO_ERROR_NO, "init");
+    CHECK(CO_SDOpool_start(&master.pool, bad, 2) == CO_ERROR_ILLEGAL_ARGUMENT, "start with size 5");
+    bad[1].size = 4;
+    bad[1].nodeId = 0;
+    CHECK(CO_SDOpool_start(&master.pool, bad, 2) == CO_ERROR_ILLEGAL_ARGUMENT, "start with node 0");
+    CHECK(CO_SDOpool_start(&master.pool, items, 0) == CO_ERROR_NO && CO_SDOpool_process(&master.pool, 0, NULL) == 0U,
+          "empty batch");
+
+    /* 開始後中止：進行中的交易送出中止訊框 */
+    make_items(false);
+    CHECK(CO_SDOpool_start(&master.pool, items, ITEMS) == CO_ERROR_NO, "start");
+    CHECK(CO_SDOpool_process(&master.pool, 0, NULL) == ITEMS, "first process");
+    CHECK(CO_SDOpool_start(&master.pool, items, ITEMS) == CO_ERROR_ILLEGAL_ARGUMENT, "start while busy");
+    uint32_t frames = bus.frameCount;
+    CO_SDOpool_abort(&master.pool);
+    CO_vbus_process(&bus);
+    CHECK(!CO_SDOpool_busy(&master.pool) && master.pool.failed == ITEMS, "abort: %u failed", master.pool.failed);
+    CHECK(bus.frameCount == frames + 2U * 4U, "abort: %u frames (4 requests, 4 aborts)", bus.frameCount - frames);
+    return failures;
+}
+
+int main(int argc, char *argv[])
+{
+    int failures = 0;
+    uint32_t latencyUs = 1000;
+    uint16_t kbps = 500;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "l:b:")) != -1) {
+        switch (opt) {
+            case 'l': latencyUs = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'b': kbps = (uint16_t)strtoul(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "usage: %s [-l server latency us] [-b kbit/s]\n", argv[0]);
+                return 2;
+        }
+    }
+    latencyNs = (uint64_t)latencyUs * 1000U;
+
+    printf("=== Batch of %u SDO writes to %u nodes at %u kbit/s, server latency %u us ===\n", ITEMS, NODES, kbps,
+           latencyUs);
+    static const uint8_t channels[] = {1, 2, 4, 8, 16};
+    double serialNs = 0.0, ns4 = 0.0;
+    for (uint32_t c = 0; c < sizeof(channels); c++) {
+        char name[16];
+        uint64_t ns = run_batch(kbps, channels[c], false);
+        if (ns == 0U) {
+            return 1;
+        }
+        snprintf(name, sizeof(name), "%u channels", channels[c]);
+        failures += verify(name);
+        if (channels[c] == 1U) {
+            serialNs = (double)ns;
+        } else if (channels[c] == 4U) {
+            ns4 = (double)ns;
+        }
+        printf("  %2u channel%s  %9.3f ms  %7.0f items/s  bus load %5.1f %%  %5u frames  %5.2fx\n", channels[c],
+               channels[c] == 1U ? " (serial)" : "s         ", (double)ns / 1e6, ITEMS * 1e9 / (double)ns,
+               100.0 * (double)bus.busyNs / (double)ns, bus.frameCount, serialNs / (double)ns);
+    }
+    CHECK(ns4 * 2.5 < serialNs, "4 channels %.3f ms, serial %.3f ms", ns4 / 1e6, serialNs / 1e6);
+
+    /* 不存在的節點：逐一執行時整個批次多等一個逾時，通道池中只佔用一個通道 */
+    uint64_t ns = run_batch(kbps, 4, true);
+    if (ns == 0U) {
+        return 1;
+    }
+    failures += verify("missing node");
+    printf("  missing node, 4 channels  %9.3f ms (SDO timeout %u ms)\n", (double)ns / 1e6, SDO_TIMEOUT_MS);
+    CHECK(ns < (uint64_t)SDO_TIMEOUT_MS * 1000000ULL + (uint64_t)ns4, "missing node: %.3f ms", (double)ns / 1e6);
+
+    failures += test_api();
+
+    printf("%s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,412 @@
+/**
+ * Host bus simulation for the MultiCAN TX FIFO mode
+ *
+ * @file sim_tx_fifo.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 以 xmc_can_mock.h 模擬 TX FIFO (CUR 依序送出、TXPND、MSPND)，與驅動相同的
+ * 「先入優先權佇列、再填入硬體 FIFO」流程：
+ *  1. 正確性：FIFO 忙碌時加入的訊框依 COB-ID 由小到大送出；被 CO_CANclearPendingSyncPDOs()
+ *     取消的緩衝區不送出；bufferFull 時回報 overflow
+ *  2. 仲裁失敗：被較高優先權訊框打斷的訊框由硬體重送，全部送出且 FIFO 不停住
+ *     (對照：slave 啟用 single transmit trial 時訊框被放棄，回收停在該 slave)
+ *  3. 500 kbit/s 下每 2 ms SYNC 送出 8 個 8 byte TPDO (約 90% 匯流排負載) 加上隨機 EMCY，
+ *     掃描 FIFO 深度，統計吞吐量、overflow 數與 EMCY 最大延遲 (優先權反轉)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CO_tx_fifo.h"
+#include "CO_tx_queue.h"
+
+CAN_GLOBAL_TypeDef mock_can_global;
+CAN_MO_TypeDef mock_can_mo[256];
+
+#define BIT_NS              2000U       /* 500 kbit/s */
+#define ISR_LATENCY_NS      3000U       /* TX 完成到 ISR 補充下一個訊框 */
+#define SYNC_PERIOD_NS      2000000U
+#define SIM_NS              2000000000ULL
+#define TPDO_COUNT          8U
+#define EMCY_INDEX          TPDO_COUNT
+#define TX_SIZE             (TPDO_COUNT + 1U)
+
+#define FIFO_BASE_MO        112U
+#define FIFO_MAX_DEPTH      16U
+
+static XMC_CAN_MO_t fifo_mo[FIFO_MAX_DEPTH];
+static CO_CANtxFifo_t fifo;
+static CO_CANtxQueue_t queue;
+static CO_CANtx_t txArray[TX_SIZE];
+static uint16_t txCount;
+static bool useQueue;
+
+/* 與 CO_driver_XMC4800.c canopen_tx_fifo_refill() 相同 */
+static void fifo_refill(void)
+{
+    while (!CO_CANtxFifo_isFull(&fifo)) {
+        CO_CANtx_t *buffer = CO_CANtxQueue_pop(&queue);
+        if (buffer == NULL) {
+            break;
+        }
+        CO_CANtxFifo_load(&fifo, buffer);
+        buffer->bufferFull = false;
+        txCount--;
+    }
+}
+
+/* 與 canopen_tx_fifo_send() 相同；useQueue=false 時 FIFO 滿即丟棄 (無軟體佇列) */
+static bool fifo_send(CO_CANtx_t *buffer)
+{
+    if (buffer->bufferFull) {
+        return false;
+    }
+    if (!useQueue) {
+        if (CO_CANtxFifo_isFull(&fifo)) {
+            return false;
+        }
+        CO_CANtxFifo_load(&fifo, buffer);
+        return true;
+    }
+    if (!CO_CANtxQueue_push(&queue, buffer)) {
+        return false;
+    }
+    buffer->bufferFull = true;
+    txCount++;
+    fifo_refill();
+    return true;
+}
+
+/* 與 canopen_tx_fifo_process() 相同 */
+static void fifo_isr(void)
+{
+    uint32_t bit = 1UL << (FIFO_BASE_MO % 32U);
+
+    mock_can_global.MSPND[FIFO_BASE_MO / 32U] &= ~bit;
+    CO_CANtxFifo_retire(&fifo);
+    fifo_refill();
+}
+
+static void fifo_setup(uint16_t depth)
+{
+    uint8_t top = (uint8_t)(FIFO_BASE_MO + depth - 1U);
+
+    mock_can_reset();
+    for (uint16_t i = 0; i < depth; i++) {
+        mock_can_mo_init(&fifo_mo[i], (uint8_t)(FIFO_BASE_MO + i), XMC_CAN_MO_TYPE_TRANSMSGOBJ);
+        mock_can_mo[FIFO_BASE_MO + i].MOIPR = (uint32_t)FIFO_BASE_MO << CAN_MO_MOIPR_MPN_Pos;
+        XMC_CAN_MO_DisableSingleTransmitTrial(&fifo_mo[i]);    /* 與 canopen_tx_fifo_setup() 相同 */
+    }
+    mock_can_mo[FIFO_BASE_MO].MOFGPR = ((uint32_t)FIFO_BASE_MO << CAN_MO_MOFGPR_BOT_Pos) |
+                                       ((uint32_t)top << CAN_MO_MOFGPR_TOP_Pos) |
+                                       ((uint32_t)FIFO_BASE_MO << CAN_MO_MOFGPR_CUR_Pos);
+    CO_CANtxFifo_init(&fifo, fifo_mo, depth);
+    CO_CANtxQueue_init(&queue);
+    memset(txArray, 0, sizeof(txArray));
+    txCount = 0;
+}
+
+static uint32_t frame_ns(uint8_t dlc)
+{
+    /* 標準資料框 44 + 8*DLC 位元 + 3 位元 IFS，不含填充位元 */
+    return (47U + 8U * dlc) * BIT_NS;
+}
+
+/******************************************************************************/
+static int test_priority_order(void)
+{
+    static const uint16_t idents[] = {0x70A, 0x48A, 0x18A, 0x58A, 0x38A, 0x08A, 0x28A, 0x60A,
+                                      0x20A, 0x10A, 0x30A, 0x50A};
+    enum { COUNT = sizeof(idents) / sizeof(idents[0]) };
+    static CO_CANtx_t buffers[COUNT];
+    uint16_t sent[COUNT];
+    uint16_t sentCount = 0;
+    int failures = 0;
+
+    useQueue = true;
+    fifo_setup(4U);
+    memset(buffers, 0, sizeof(buffers));
+
+    /* 匯流排停住：前 4 個直接進入 FIFO，其餘留在佇列 */
+    for (uint16_t i = 0; i < COUNT; i++) {
+        buffers[i].ident = idents[i];
+        buffers[i].DLC = 8U;
+        buffers[i].data[0] = (uint8_t)i;
+        if (!fifo_send(&buffers[i])) {
+            printf("FAIL: send 0x%03X rejected\n", idents[i]);
+            failures++;
+        }
+    }
+
+    /* 重複傳送尚在佇列中的緩衝區 → overflow */
+    if (fifo_send(&buffers[COUNT - 1U])) {
+        printf("FAIL: resend of queued buffer accepted\n");
+        failures++;
+    }
+
+    /* 模擬 CO_CANclearPendingSyncPDOs()：取消 0x20A */
+    buffers[8].bufferFull = false;
+    txCount--;
+
+    for (;;) {
+        uint16_t ident;
+        uint8_t dlc;
+        uint32_t data;
+        if (!mock_can_txfifo_complete(FIFO_BASE_MO, &ident, &dlc, &data)) {
+            break;
+        }
+        sent[sentCount++] = ident;
+        fifo_isr();
+    }
+
+    static const uint16_t expected[] = {0x70A, 0x48A, 0x18A, 0x58A,
+                                        0x08A, 0x10A, 0x28A, 0x30A, 0x38A, 0x50A, 0x60A};
+    enum { EXPECTED = sizeof(expected) / sizeof(expected[0]) };
+    if (sentCount != EXPECTED || memcmp(sent, expected, sizeof(expected)) != 0) {
+        printf("FAIL: transmit order:");
+        for (uint16_t i = 0; i < sentCount; i++) {
+            printf(" %03X", sent[i]);
+        }
+        printf("\n");
+        failures++;
+    }
+    if (txCount != 0U || fifo.inFlight != 0U || queue.count != 0U) {
+        printf("FAIL: txCount=%u inFlight=%u queue=%u after drain\n", txCount, fifo.inFlight, queue.count);
+        failures++;
+    }
+    for (uint16_t i = 0; i < COUNT; i++) {
+        if (buffers[i].bufferFull || buffers[i].queued) {
+            printf("FAIL: buffer 0x%03X still pending\n", idents[i]);
+            failures++;
+        }
+    }
+
+    printf("priority order: %u frames, cancelled 0x20A skipped, order %s\n",
+           sentCount, failures == 0 ? "OK" : "WRONG");
+    return failures;
+}
+
+/******************************************************************************/
+/* 共用匯流排：每個訊框第一次仲裁時輸給其他節點 (lost 次)，之後送出；回傳送出的訊框數 */
+static uint16_t run_lost_arbitration(bool stt, uint16_t *sent, uint16_t count, uint16_t lost)
+{
+    static CO_CANtx_t buffers[8];
+    uint16_t sentCount = 0;
+
+    useQueue = true;
+    fifo_setup(4U);
+    memset(buffers, 0, sizeof(buffers));
+    if (stt) {
+        for (uint16_t i = 0; i < 4U; i++) {
+            XMC_CAN_MO_EnableSingleTransmitTrial(&fifo_mo[i]);
+        }
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        buffers[i].ident = (uint16_t)(0x181U + i);
+        buffers[i].DLC = 8U;
+        (void)fifo_send(&buffers[i]);
+    }
+
+    for (uint32_t step = 0; step < 100U && mock_can_txfifo_ready(FIFO_BASE_MO); step++) {
+        uint16_t ident;
+        uint8_t dlc;
+        uint32_t data;
+        for (uint16_t l = 0; l < lost; l++) {
+            (void)mock_can_txfifo_lost(FIFO_BASE_MO);
+        }
+        if (mock_can_txfifo_complete(FIFO_BASE_MO, &ident, &dlc, &data)) {
+            sent[sentCount++] = ident;
+            fifo_isr();
+        }
+    }
+    return sentCount;
+}
+
+static int test_lost_arbitration(void)
+{
+    enum { COUNT = 8 };
+    uint16_t sent[COUNT * 2];
+    int failures = 0;
+
+    /* 驅動的設定 (STT=0)：每個訊框輸掉兩次仲裁後送出 */
+    uint16_t sentCount = run_lost_arbitration(false, sent, COUNT, 2U);
+    bool order = sentCount == COUNT;
+    for (uint16_t i = 0; order && i < COUNT; i++) {
+        order = sent[i] == 0x181U + i;
+    }
+    if (!order) {
+        printf("FAIL: lost arbitration: %u of %u frames sent or wrong order\n", sentCount, COUNT);
+        failures++;
+    }
+    if (txCount != 0U || fifo.inFlight != 0U || queue.count != 0U || fifo.frameCount != COUNT) {
+        printf("FAIL: lost arbitration: txCount=%u inFlight=%u queue=%u frameCount=%u\n", txCount, fifo.inFlight,
+               queue.count, fifo.frameCount);
+        failures++;
+    }
+    printf("lost arbitration (STT off): %u/%u frames sent after retries, inFlight %u %s\n", sentCount, COUNT,
+           fifo.inFlight, failures == 0 ? "OK" : "WRONG");
+
+    /* 對照：STT=1 時第一個訊框被放棄，回收停在該 slave，佇列中的訊框永遠不會載入 */
+    uint16_t sttSent = run_lost_arbitration(true, sent, COUNT, 1U);
+    bool stalled = fifo.inFlight != 0U && queue.count != 0U;
+    if (!stalled) {
+        printf("FAIL: STT model did not drop frames (inFlight=%u queue=%u)\n", fifo.inFlight, queue.count);
+        failures++;
+    }
+    printf("lost arbitration (STT on):  %u/%u frames sent, inFlight %u, queue %u -> stalled\n", sttSent, COUNT,
+           fifo.inFlight, queue.count);
+    return failures;
+}
+
+/******************************************************************************/
+typedef struct {
+    uint64_t frames;
+    uint64_t busyNs;
+    uint32_t overflow;
+    uint32_t emcySent;
+    uint64_t emcyMaxNs;
+} sim_result_t;
+
+static sim_result_t simulate(uint16_t depth, bool withQueue)
+{
+    sim_result_t r;
+    uint64_t now = 0;
+    uint64_t busEnd = 0;
+    bool busBusy = false;
+    uint64_t isrTime = 0;
+    bool isrPending = false;
+    uint64_t nextSync = 0;
+    uint64_t nextEmcy = 150000U;
+    uint64_t emcyQueuedAt = 0;
+    uint8_t curDlc = 0;
+
+    memset(&r, 0, sizeof(r));
+    useQueue = withQueue;
+    fifo_setup(depth);
+    srand(4U);
+
+    for (uint16_t i = 0; i < TPDO_COUNT; i++) {
+        txArray[i].ident = 0x180U + 0x100U * (i % 4U) + 0x0AU + (i / 4U);
+        txArray[i].DLC = 8U;
+    }
+    txArray[EMCY_INDEX].ident = 0x08AU;
+    txArray[EMCY_INDEX].DLC = 8U;
+
+    while (now < SIM_NS) {
+        /* 下一個事件：匯流排完成、ISR、SYNC、EMCY */
+        uint64_t next = nextSync < nextEmcy ? nextSync : nextEmcy;
+        if (busBusy && busEnd < next) {
+            next = busEnd;
+        }
+        if (isrPending && isrTime < next) {
+            next = isrTime;
+        }
+        now = next;
+
+        if (busBusy && now == busEnd) {
+            uint16_t ident = 0;
+            uint8_t dlc;
+            uint32_t data;
+            mock_can_txfifo_complete(FIFO_BASE_MO, &ident, &dlc, &data);
+            busBusy = false;
+            r.frames++;
+            r.busyNs += frame_ns(curDlc);
+            if (ident == txArray[EMCY_INDEX].ident) {
+                uint64_t latency = now - emcyQueuedAt;
+                r.emcySent++;
+                if (latency > r.emcyMaxNs) {
+                    r.emcyMaxNs = latency;
+                }
+            }
+            if (!isrPending) {
+                isrPending = true;
+                isrTime = now + ISR_LATENCY_NS;
+            }
+        }
+        if (isrPending && now == isrTime) {
+            isrPending = false;
+            fifo_isr();
+        }
+        if (now == nextSync) {
+            /* SYNC：TPDO 依 OD 順序送出，與 COB-ID 順序相反 */
+            for (int i = (int)TPDO_COUNT - 1; i >= 0; i--) {
+                txArray[i].data[0]++;
+                if (!fifo_send(&txArray[i])) {
+                    r.overflow++;
+                }
+            }
+            nextSync += SYNC_PERIOD_NS;
+        }
+        if (now == nextEmcy) {
+            emcyQueuedAt = now;
+            if (!fifo_send(&txArray[EMCY_INDEX])) {
+                r.overflow++;
+            }
+            nextEmcy += 3000000U + (uint64_t)(rand() % 997) * 1000U;
+        }
+
+        /* 匯流排閒置且 CUR 有 TXRQ：硬體立即開始下一個訊框 */
+        if (!busBusy && mock_can_txfifo_ready(FIFO_BASE_MO)) {
+            uint8_t cur = (uint8_t)((mock_can_mo[FIFO_BASE_MO].MOFGPR & CAN_MO_MOFGPR_CUR_Msk) >> CAN_MO_MOFGPR_CUR_Pos);
+            curDlc = (uint8_t)((mock_can_mo[cur].MOFCR & CAN_MO_MOFCR_DLC_Msk) >> CAN_MO_MOFCR_DLC_Pos);
+            busBusy = true;
+            busEnd = now + frame_ns(curDlc);
+        }
+    }
+
+    return r;
+}
+
+int main(void)
+{
+    int failures = test_priority_order();
+    failures += test_lost_arbitration();
+
+    printf("\n500 kbit/s, SYNC 2 ms x %u TPDO (8 byte) + EMCY every ~3.5 ms, %llu ms simulated\n",
+           TPDO_COUNT, (unsigned long long)(SIM_NS / 1000000U));
+    printf("%-22s %10s %9s %9s %14s\n", "mode", "frames/s", "bus load", "overflow", "EMCY max [us]");
+
+    static const uint16_t depths[] = {1U, 2U, 4U, 8U, 16U};
+    uint32_t overflowDepth4 = 0;
+    uint64_t emcyDepth4 = 0;
+    uint64_t emcyDepth16 = 0;
+
+    for (size_t i = 0; i < sizeof(depths) / sizeof(depths[0]); i++) {
+        sim_result_t r = simulate(depths[i], true);
+        char name[32];
+        snprintf(name, sizeof(name), "queue + FIFO depth %u", depths[i]);
+        printf("%-22s %10.0f %8.1f%% %9u %14.1f\n", name,
+               (double)r.frames * 1e9 / (double)SIM_NS, 100.0 * (double)r.busyNs / (double)SIM_NS,
+               r.overflow, (double)r.emcyMaxNs / 1000.0);
+        if (depths[i] == 4U) {
+            overflowDepth4 = r.overflow;
+            emcyDepth4 = r.emcyMaxNs;
+        }
+        if (depths[i] == 16U) {
+            emcyDepth16 = r.emcyMaxNs;
+        }
+    }
+
+    sim_result_t noQueue = simulate(4U, false);
+    printf("%-22s %10.0f %8.1f%% %9u %14.1f\n", "FIFO depth 4, no queue",
+           (double)noQueue.frames * 1e9 / (double)SIM_NS, 100.0 * (double)noQueue.busyNs / (double)SIM_NS,
+           noQueue.overflow, (double)noQueue.emcyMaxNs / 1000.0);
+
+    /* 深度 4：不丟訊框；EMCY 最多等待 FIFO 內的訊框加上正在傳送的一個 */
+    if (overflowDepth4 != 0U) {
+        printf("FAIL: depth 4 overflowed %u times\n", overflowDepth4);
+        failures++;
+    }
+    if (emcyDepth4 > (uint64_t)(4U + 1U) * frame_ns(8U) + ISR_LATENCY_NS) {
+        printf("FAIL: depth 4 EMCY latency %.1f us exceeds bound\n", (double)emcyDepth4 / 1000.0);
+        failures++;
+    }
+    if (emcyDepth16 <= emcyDepth4) {
+        printf("FAIL: deeper FIFO should show longer priority inversion\n");
+        failures++;
+    }
+
+    printf("\n%s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,193 @@
+/**
+ * Host test and main-loop stall simulation for the debug UART ring
+ *
+ * @file sim_uart_log.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ *  1. CO_uartRing_write()/claim()/sent() 的順序、環繞與兩種滿載策略
+ *  2. 以 115200 baud 模擬 UART：主循環每 1 ms 輸出一定量的除錯訊息，
+ *     比較原本 Debug_Printf_Raw() (等待 tx_busy) 與環形緩衝區的主循環停頓與丟棄量
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CO_uart_ring.h"
+
+#define BAUDRATE            115200U
+#define NS_PER_BYTE         (10UL * 1000000000UL / BAUDRATE)   /* 8N1 = 10 bit */
+#define SIM_MS              2000U
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+static CO_uartRing_t ring;
+
+/* 從環形緩衝區讀出所有資料 (模擬 UART 立即送完) */
+static uint32_t drain(uint8_t *out, uint32_t max)
+{
+    uint32_t total = 0;
+    uint8_t *data;
+    uint32_t len;
+
+    while ((len = CO_uartRing_claim(&ring, &data)) > 0U) {
+        if (total + len <= max) {
+            memcpy(&out[total], data, len);
+        }
+        total += len;
+        CO_uartRing_sent(&ring);
+    }
+    return total;
+}
+
+static int test_ring(void)
+{
+    int failures = 0;
+    static uint8_t msg[CO_UART_RING_SIZE * 2U];
+    static uint8_t out[CO_UART_RING_SIZE * 2U];
+    uint8_t *data;
+
+    for (uint32_t i = 0; i < sizeof(msg); i++) {
+        msg[i] = (uint8_t)(i * 7U + 3U);
+    }
+
+    /* 環繞：每次寫入 3/4 再全部送出 */
+    CO_uartRing_init(&ring, CO_UART_DROP_NEWEST);
+    CHECK(CO_uartRing_claim(&ring, &data) == 0U, "empty ring claimed data");
+    for (uint32_t round = 0; round < 8U; round++) {
+        uint32_t len = CO_UART_RING_SIZE * 3U / 4U;
+        CHECK(CO_uartRing_write(&ring, &msg[round], len) == len, "write %u rejected", round);
+        CHECK(drain(out, sizeof(out)) == len, "round %u length", round);
+        CHECK(memcmp(out, &msg[round], len) == 0, "round %u data corrupted", round);
+    }
+    CHECK(ring.droppedBytes == 0U, "dropped %u without overflow", ring.droppedBytes);
+
+    /* 未確認的傳送區會重複回傳 (UART 拒絕後重試) */
+    CO_uartRing_write(&ring, msg, 10U);
+    CHECK(CO_uartRing_claim(&ring, &data) == 10U, "claim length");
+    CO_uartRing_write(&ring, msg, 10U);
+    CHECK(CO_uartRing_claim(&ring, &data) == 10U, "unsent chunk replaced");
+    CO_uartRing_sent(&ring);
+    CHECK(CO_uartRing_pending(&ring) == 10U, "pending after sent");
+
+    /* DROP_NEWEST: 放不下的訊息整筆丟棄，已寫入的保留 */
+    CO_uartRing_init(&ring, CO_UART_DROP_NEWEST);
+    CO_uartRing_write(&ring, msg, CO_UART_RING_SIZE - 100U);
+    CHECK(CO_uartRing_write(&ring, &msg[4000], 101U) == 0U, "newest not dropped");
+    CHECK(ring.droppedBytes == 101U, "droppedBytes=%u, expected 101", ring.droppedBytes);
+    CHECK(CO_uartRing_write(&ring, &msg[5000], 100U) == 100U, "exact fit rejected");
+    CHECK(drain(out, sizeof(out)) == CO_UART_RING_SIZE, "newest: length");
+    CHECK(memcmp(out, msg, CO_UART_RING_SIZE - 100U) == 0
+          && memcmp(&out[CO_UART_RING_SIZE - 100U], &msg[5000], 100U) == 0, "newest: data");
+
+    /* DROP_OLDEST: 丟棄最舊的待送資料；已搬到傳送區的不受影響 */
+    CO_uartRing_init(&ring, CO_UART_DROP_OLDEST);
+    CO_uartRing_write(&ring, msg, CO_UART_RING_SIZE);
+    uint32_t chunk = CO_uartRing_claim(&ring, &data);
+    CHECK(chunk == CO_UART_RING_CHUNK_MAX, "chunk=%u", chunk);
+    CHECK(CO_uartRing_write(&ring, &msg[CO_UART_RING_SIZE], chunk + 50U) == chunk + 50U, "oldest: write");
+    CHECK(ring.droppedBytes == 50U, "droppedBytes=%u, expected 50", ring.droppedBytes);
+    CHECK(memcmp(data, msg, chunk) == 0, "in-flight chunk overwritten");
+    CO_uartRing_sent(&ring);
+    CHECK(drain(out, sizeof(out)) == CO_UART_RING_SIZE, "oldest: length");
+    CHECK(memcmp(out, &msg[chunk + 50U], CO_UART_RING_SIZE) == 0, "oldest: data not the newest bytes");
+
+    /* DROP_OLDEST: 比緩衝區還長的訊息只保留尾端 */
+    CO_uartRing_init(&ring, CO_UART_DROP_OLDEST);
+    CO_uartRing_write(&ring, msg, 10U);
+    CO_uartRing_write(&ring, msg, sizeof(msg));
+    CHECK(ring.droppedBytes == sizeof(msg) + 10U - CO_UART_RING_SIZE, "oversize drop count %u", ring.droppedBytes);
+    CHECK(drain(out, sizeof(out)) == CO_UART_RING_SIZE
+          && memcmp(out, &msg[sizeof(msg) - CO_UART_RING_SIZE], CO_UART_RING_SIZE) == 0, "oversize: data");
+
+    printf("ring: order, wrap, retry and drop policies %s\n", failures == 0 ? "OK" : "WRONG");
+    return failures;
+}
+
+/* 模擬的 UART：UART_Transmit() 交出一段，之後每 NS_PER_BYTE 送出 1 byte */
+typedef struct {
+    uint64_t                busyUntil;      /* tx_busy 清除時間 (ns) */
+    uint64_t                bytes;
+} sim_uart_t;
+
+typedef struct {
+    const char             *name;
+    uint32_t                bytesPerMs;     /* 主循環每 1 ms 輸出的位元組數 */
+} load_t;
+
+/* 原本的 Debug_Printf_Raw()：送出後等 tx_busy，再固定延遲約 1000 次迴圈 (~10 us) */
+static uint64_t legacy_stall_ns(uint32_t lineLen)
+{
+    return (uint64_t)lineLen * NS_PER_BYTE + 10000U;
+}
+
+static void run_load(const load_t *load, CO_uartDropPolicy_t policy)
+{
+    static char line[256];
+    const uint32_t lineLen = 64U;
+    sim_uart_t uart = { 0, 0 };
+    bool sending = false;
+    uint64_t legacyStall = 0, legacyMax = 0;
+    uint32_t credit = 0;
+
+    memset(line, 'x', sizeof(line));
+    CO_uartRing_init(&ring, policy);
+
+    for (uint32_t ms = 0; ms < SIM_MS; ms++) {
+        uint64_t now = (uint64_t)ms * 1000000U;
+        uint64_t loopStall = 0;
+
+        for (credit += load->bytesPerMs; credit >= lineLen; credit -= lineLen) {
+            CO_uartRing_write(&ring, (const uint8_t *)line, lineLen);
+            loopStall += legacy_stall_ns(lineLen);
+
+            /* Debug_UART_Kick() */
+            if (uart.busyUntil <= now) {
+                uint8_t *data;
+                if (sending) {
+                    CO_uartRing_sent(&ring);
+                    sending = false;
+                }
+                uint32_t len = CO_uartRing_claim(&ring, &data);
+                if (len > 0U) {
+                    uart.busyUntil = now + (uint64_t)len * NS_PER_BYTE;
+                    uart.bytes += len;
+                    sending = true;
+                }
+            }
+        }
+        legacyStall += loopStall;
+        if (loopStall > legacyMax) {
+            legacyMax = loopStall;
+        }
+    }
+
+    printf("  %-10s %-11s %6u B/ms  old stall %5.1f%% (max %6.2f ms/loop)  ring: sent %7llu B, dropped %7u B, max fill %4u\n",
+           load->name, policy == CO_UART_DROP_NEWEST ? "drop-newest" : "drop-oldest",
+           load->bytesPerMs, 100.0 * (double)legacyStall / ((double)SIM_MS * 1e6),
+           (double)legacyMax / 1e6, (unsigned long long)uart.bytes,
+           ring.droppedBytes, ring.maxFill);
+}
+
+int main(void)
+{
+    int failures = test_ring();
+
+    /* 115200 baud 約 11.5 byte/ms；DEBUG 接近、VERBOSE 遠超過 UART 頻寬 */
+    static const load_t loads[] = {
+        { "INFO",    2U },
+        { "DEBUG",   10U },
+        { "VERBOSE", 64U },
+    };
+
+    printf("\nMain loop at 1 kHz, UART %u baud (%lu ns/byte), %u ms\n", BAUDRATE, NS_PER_BYTE, SIM_MS);
+    for (size_t i = 0; i < sizeof(loads) / sizeof(loads[0]); i++) {
+        run_load(&loads[i], CO_UART_DROP_NEWEST);
+        run_load(&loads[i], CO_UART_DROP_OLDEST);
+    }
+    printf("  ring: main loop never waits for the UART (stall = copy only)\n");
+
+    printf("\n%s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}
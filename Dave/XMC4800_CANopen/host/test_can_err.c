@@ -0,0 +1,112 @@
+/**
+ * Host test: CAN overflow events reach CO_EM_process() as emergency messages
+ *
+ * @file test_can_err.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 一個節點 (完整堆疊) 掛在虛擬匯流排上。CO_CANerr_event() 與驅動的 ISR / CO_CANsend() 相同，
+ * 在兩次 CO_process() 之間記錄事件 (ISR 在主循環任何位置都可能插入)：
+ *  1. RX 溢位 (RX FIFO overrun、RX 環形緩衝區滿)：EMCY 0x8110、errorBit CO_EM_CAN_RXB_OVERFLOW
+ *  2. TX 溢位與 TPDO 逾時：errorBit CO_EM_CAN_TX_OVERFLOW / CO_EM_TPDO_OUTSIDE_WINDOW
+ *  3. 連續多次的事件只發出一次 emergency，事件停止後發出一次 error reset (錯誤碼 0)
+ * CO_CANmodule_process() 在 CO_EM_process() 之前調用，直接清除 CANerrorStatus 時事件不會被回報。
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "CANopen.h"
+#include "OD.h"
+#include "CO_host_node.h"
+#include "CO_can_err.h"
+
+#define NODE_ID                 5U
+#define LOG_MAX                 256U
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+static CO_vbus_t bus;
+static CO_t *co;
+static CO_CANrxMsg_t emcy[LOG_MAX];
+static uint32_t emcyCount;
+
+static void log_frame(void *object, const CO_vbusFrame_t *frame)
+{
+    (void)object;
+    if (frame->msg.ident == 0x80U + NODE_ID && emcyCount < LOG_MAX) {
+        emcy[emcyCount++] = frame->msg;
+    }
+}
+
+static void step_ms(uint32_t ms)
+{
+    for (uint32_t t = 0; t < ms; t++) {
+        CO_process(co, false, 1000U, NULL);
+        CO_hostNode_rt(co, 1000U);
+        CO_vbus_process(&bus);
+    }
+}
+
+static uint16_t emcy_code(uint32_t i)
+{
+    return (uint16_t)(emcy[i].data[0] | (emcy[i].data[1] << 8));
+}
+
+/* events 在 count 次連續的 1 ms 週期中各發生一次，之後沒有事件 */
+static int scenario(const char *name, uint16_t events, uint8_t errorBit, uint16_t code, uint32_t count)
+{
+    int failures = 0;
+    uint32_t from = emcyCount;
+
+    for (uint32_t i = 0; i < count; i++) {
+        CO_LOCK_CAN_SEND(co->CANmodule);
+        CO_CANerr_event(co->CANmodule, events);
+        CO_UNLOCK_CAN_SEND(co->CANmodule);
+        step_ms(1);
+    }
+    bool_t raised = CO_isError(co->em, errorBit);
+    step_ms(10);
+
+    CHECK(emcyCount - from == 2U, "%s: %u emergency messages, expected 2", name, emcyCount - from);
+    if (emcyCount - from >= 2U) {
+        CHECK(emcy_code(from) == code && emcy[from].data[3] == errorBit
+              && (emcy[from].data[2] & CO_ERR_REG_COMMUNICATION) != 0U,
+              "%s: emergency 0x%04X bit 0x%02X register 0x%02X", name, emcy_code(from), emcy[from].data[3],
+              emcy[from].data[2]);
+        CHECK(emcy_code(from + 1U) == 0U, "%s: error reset 0x%04X", name, emcy_code(from + 1U));
+    }
+    CHECK(raised, "%s: errorBit 0x%02X not set after the event", name, errorBit);
+    CHECK(!CO_isError(co->em, errorBit), "%s: errorBit 0x%02X still set", name, errorBit);
+    CHECK((co->CANmodule->CANerrorStatus & CO_CAN_ERR_EVENTS) == 0U, "%s: CANerrorStatus 0x%04X", name,
+          co->CANmodule->CANerrorStatus);
+    printf("%-24s x%-3u emergency 0x%04X, error reset %s\n", name, count,
+           emcyCount - from >= 1U ? emcy_code(from) : 0U, failures == 0 ? "ok" : "WRONG");
+    return failures;
+}
+
+int main(void)
+{
+    int failures = 0;
+
+    CO_vbus_init(&bus);
+    CO_vbus_setMonitor(&bus, log_frame, NULL);
+    co = CO_hostNode_new(&bus, NODE_ID, NULL);
+    if (co == NULL) {
+        printf("node init failed\n");
+        return 1;
+    }
+    step_ms(10);
+    CHECK(emcyCount == 0U, "%u emergency messages after boot-up", emcyCount);
+
+    printf("=== CAN error events -> CO_EM_process() ===\n");
+    failures += scenario("RX overflow", CO_CAN_ERRRX_OVERFLOW, CO_EM_CAN_RXB_OVERFLOW, CO_EMC_CAN_OVERRUN, 1);
+    failures += scenario("RX overflow (repeated)", CO_CAN_ERRRX_OVERFLOW, CO_EM_CAN_RXB_OVERFLOW, CO_EMC_CAN_OVERRUN,
+                         20);
+    failures += scenario("TX overflow", CO_CAN_ERRTX_OVERFLOW, CO_EM_CAN_TX_OVERFLOW, CO_EMC_CAN_OVERRUN, 1);
+    failures += scenario("TPDO outside window", CO_CAN_ERRTX_PDO_LATE, CO_EM_TPDO_OUTSIDE_WINDOW,
+                         CO_EMC_COMMUNICATION, 1);
+
+    CO_delete(co);
+    printf("%s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+/**
+ * Host test for the BASEPRI critical sections and lock profiler
+ *
+ * @file test_lock.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ *  1. 巢狀與跨類別使用時，只有最外層離開才還原 BASEPRI
+ *  2. 已有更高遮罩時不降低，離開後還原原值
+ *  3. CAN_SEND 遮罩 CAN 中斷；OD/EMCY 只遮罩 RT slot，CAN 接收仍可進入
+ *  4. 持有時間統計只計最外層
+ *  5. 對照原本的 __disable_irq()/__enable_irq() 巨集：巢狀時提早開啟中斷
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* 以手動遞增的計數器取代 CO_CAN_CYCLES()，持有時間可精確驗證 */
+static uint32_t fake_cycles;
+#define CO_LOCK_CYCLES()    (fake_cycles)
+
+#include "CO_driver_target.h"
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+/* NVIC 優先權 prio 的中斷此時能否進入 */
+static bool irq_allowed(uint32_t prio)
+{
+    uint32_t basepri = __get_BASEPRI();
+    return basepri == 0U || (prio << (8U - __NVIC_PRIO_BITS)) < basepri;
+}
+
+/* 原本的巨集：PRIMASK 以變數模擬 */
+static bool legacy_primask;
+#define LEGACY_LOCK()       do { legacy_primask = true; } while (0)
+#define LEGACY_UNLOCK()     do { legacy_primask = false; } while (0)
+
+int main(void)
+{
+    int failures = 0;
+
+    memset(CO_lockClass, 0, sizeof(CO_lockClass));
+    __set_BASEPRI(0U);
+
+    /* 巢狀：同類別與跨類別 */
+    CO_LOCK_OD(NULL);
+    CHECK(__get_BASEPRI() == CO_LOCK_BASEPRI(CO_LOCK_PRIORITY_RT), "BASEPRI=0x%02X after lock", __get_BASEPRI());
+    CO_LOCK_CAN_SEND();
+    CO_LOCK_CAN_SEND();
+    CHECK(__get_BASEPRI() == CO_LOCK_BASEPRI(CO_LOCK_PRIORITY_CAN_SEND), "CAN_SEND inside OD not raised");
+    CO_UNLOCK_CAN_SEND();
+    CHECK(__get_BASEPRI() == CO_LOCK_BASEPRI(CO_LOCK_PRIORITY_CAN_SEND), "inner CAN_SEND unlock released the mask");
+    CO_UNLOCK_CAN_SEND();
+    CHECK(__get_BASEPRI() == CO_LOCK_BASEPRI(CO_LOCK_PRIORITY_RT), "CAN_SEND unlock inside OD not restored");
+    CO_UNLOCK_OD(NULL);
+    CHECK(__get_BASEPRI() == 0U, "BASEPRI=0x%02X after outermost unlock", __get_BASEPRI());
+    CHECK(CO_lockClass[CO_LOCK_CLASS_CAN_SEND].count == 1U, "nested entries counted %u",
+          CO_lockClass[CO_LOCK_CLASS_CAN_SEND].count);
+
+    /* 已有更高的遮罩：不降低，離開後還原 */
+    __set_BASEPRI(0x40U);
+    CO_LOCK_EMCY();
+    CHECK(__get_BASEPRI() == 0x40U, "lock lowered an existing mask to 0x%02X", __get_BASEPRI());
+    CO_UNLOCK_EMCY();
+    CHECK(__get_BASEPRI() == 0x40U, "existing mask not restored (0x%02X)", __get_BASEPRI());
+    __set_BASEPRI(0U);
+
+    /* 鎖定期間的中斷：CAN_SEND 遮罩 CAN (62)，馬達/ADC (例如 10) 可以進入 */
+    CO_LOCK_CAN_SEND();
+    bool canBlocked = !irq_allowed(CO_CAN_IRQ_PRIORITY) && !irq_allowed(CO_RT_PRIORITY);
+    bool adcAllowed = irq_allowed(10U);
+    bool higherAllowed = irq_allowed(CO_CAN_IRQ_PRIORITY - 1U);
+    CO_UNLOCK_CAN_SEND();
+    CHECK(canBlocked, "CAN priority not masked by CAN_SEND");
+    CHECK(adcAllowed && higherAllowed, "higher priority IRQ masked");
+    CHECK(irq_allowed(CO_CAN_IRQ_PRIORITY), "CAN still masked after unlock");
+
+    /* OD/EMCY：只遮罩 RT slot (63)，CAN 接收 (62) 可以搶占 */
+    CO_LOCK_OD();
+    bool rtBlocked = !irq_allowed(CO_RT_PRIORITY);
+    bool canRxAllowed = irq_allowed(CO_CAN_IRQ_PRIORITY);
+    CO_UNLOCK_OD();
+    CHECK(rtBlocked, "RT slot not masked by OD lock");
+    CHECK(canRxAllowed, "CAN RX masked by OD lock");
+
+    /* 持有時間：只計最外層 */
+    CO_lock_resetStats();
+    fake_cycles = 1000U;
+    CO_LOCK_OD();
+    fake_cycles += 50U;
+    CO_LOCK_OD();
+    fake_cycles += 20U;
+    CO_UNLOCK_OD();
+    fake_cycles += 30U;
+    CO_UNLOCK_OD();
+    CO_LOCK_OD();
+    fake_cycles += 40U;
+    CO_UNLOCK_OD();
+    CHECK(CO_lockClass[CO_LOCK_CLASS_OD].holdCyclesMax == 100U, "OD hold max %u, expected 100",
+          CO_lockClass[CO_LOCK_CLASS_OD].holdCyclesMax);
+    CHECK(CO_lockClass[CO_LOCK_CLASS_OD].count == 2U, "OD count %u", CO_lockClass[CO_LOCK_CLASS_OD].count);
+    CHECK(CO_lockClass[CO_LOCK_CLASS_EMCY].holdCyclesMax == 0U, "EMCY stats not reset");
+
+    /* 原本的巨集：巢狀時內層解鎖就開啟中斷 */
+    LEGACY_LOCK();
+    LEGACY_LOCK();
+    LEGACY_UNLOCK();
+    bool legacyEarly = !legacy_primask;
+    LEGACY_UNLOCK();
+
+    printf("BASEPRI lock: CAN_SEND priority %u (BASEPRI 0x%02X), OD/EMCY priority %u (BASEPRI 0x%02X)\n",
+           CO_LOCK_PRIORITY_CAN_SEND, CO_LOCK_BASEPRI(CO_LOCK_PRIORITY_CAN_SEND),
+           CO_LOCK_PRIORITY_RT, CO_LOCK_BASEPRI(CO_LOCK_PRIORITY_RT));
+    printf("  nested lock keeps mask until outermost unlock: %s\n", failures == 0 ? "yes" : "no");
+    printf("  IRQ priority 10 (motor/ADC) while locked:      %s\n", adcAllowed ? "runs" : "blocked");
+    printf("  CAN RX while OD locked (RT slot running):      %s\n", canRxAllowed ? "runs" : "blocked");
+    printf("  old __disable_irq() lock, nested:              IRQs %s inside outer section\n",
+           legacyEarly ? "re-enabled" : "masked");
+
+    printf("\n%s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,143 @@
+/**
+ * Host test and cost benchmark for the deferred ISR log
+ *
+ * @file test_log.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ *  1. CO_log_write()/CO_log_read() 的順序、環繞、滿時丟棄與格式化
+ *  2. 每筆紀錄的寫入成本，與原本 Debug_Printf_ISR() (vsnprintf 到堆疊緩衝區再逐 byte
+ *     複製到 1024 byte 環形緩衝區) 比較
+ */
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* 韌體的時間戳記是讀取 DWT CYCCNT (單一 load)；主機端 clock_gettime 會主導量測結果 */
+static volatile uint32_t fake_cyccnt;
+#define CO_LOG_TIMESTAMP()  (fake_cyccnt)
+
+#include "CO_log.h"
+
+#define ITERATIONS      (1U << 20)
+
+static CO_logRing_t ring;
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+static int test_ring(void)
+{
+    int failures = 0;
+    CO_logEntry_t entry;
+    char line[128];
+
+    CO_log_init(&ring);
+    CHECK(!CO_log_read(&ring, &entry), "empty ring returned an entry");
+
+    /* 環繞數次：寫入 3/4 再讀出 */
+    uint32_t next = 0;
+    for (int round = 0; round < 10; round++) {
+        for (uint32_t i = 0; i < CO_LOG_RING_SIZE * 3U / 4U; i++) {
+            CO_log_write(&ring, CO_LOG_TX_IRQ, next + i, i, 0, 0);
+        }
+        for (uint32_t i = 0; i < CO_LOG_RING_SIZE * 3U / 4U; i++) {
+            CHECK(CO_log_read(&ring, &entry), "missing entry %u", next + i);
+            CHECK(entry.arg[0] == next + i && entry.seq == (uint16_t)(next + i),
+                  "entry %u out of order (arg %u seq %u)", next + i, entry.arg[0], entry.seq);
+        }
+        next += CO_LOG_RING_SIZE * 3U / 4U;
+    }
+    CHECK(ring.dropped == 0U, "dropped %u without overflow", ring.dropped);
+
+    /* 滿時丟棄新紀錄，保留舊紀錄 */
+    for (uint32_t i = 0; i < CO_LOG_RING_SIZE + 5U; i++) {
+        CO_log_write(&ring, CO_LOG_RX_FIFO_OVERRUN, i, 0, 0, 0);
+    }
+    CHECK(ring.dropped == 5U, "dropped=%u, expected 5", ring.dropped);
+    CHECK(CO_log_read(&ring, &entry) && entry.arg[0] == 0U, "oldest entry lost on overflow");
+
+    /* 格式化 */
+    CO_log_init(&ring);
+    CO_log_write(&ring, CO_LOG_RX_IRQ, 5, 4, 0, 0);
+    CO_log_read(&ring, &entry);
+    CO_log_format(&entry, line, sizeof(line));
+    CHECK(strcmp(line, "RX IRQ: LMO_05 (idx=4)") == 0, "format: '%s'", line);
+    entry.id = 0xFFFFU;
+    CO_log_format(&entry, line, sizeof(line));
+    CHECK(strncmp(line, "log id 65535:", 13) == 0, "unknown id: '%s'", line);
+
+    printf("ring: order, wrap, overflow and format %s\n", failures == 0 ? "OK" : "WRONG");
+    return failures;
+}
+
+/* 原本的 Debug_Printf_ISR() */
+#define ISR_DEBUG_BUFFER_SIZE 1024
+static volatile char isr_debug_buffer[ISR_DEBUG_BUFFER_SIZE];
+static volatile uint16_t isr_debug_write_index = 0;
+static volatile uint16_t isr_debug_read_index = 0;
+static volatile bool isr_debug_overflow = false;
+
+static void legacy_printf_isr(const char *format, ...)
+{
+    char temp_buffer[128];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(temp_buffer, sizeof(temp_buffer), format, args);
+    va_end(args);
+
+    if (len > 0) {
+        for (int i = 0; i < len && i < (int)(sizeof(temp_buffer) - 1); i++) {
+            uint16_t next_write = (isr_debug_write_index + 1) % ISR_DEBUG_BUFFER_SIZE;
+            if (next_write != isr_debug_read_index) {
+                isr_debug_buffer[isr_debug_write_index] = temp_buffer[i];
+                isr_debug_write_index = next_write;
+            } else {
+                isr_debug_overflow = true;
+                break;
+            }
+        }
+        uint16_t next_write = (isr_debug_write_index + 1) % ISR_DEBUG_BUFFER_SIZE;
+        if (next_write != isr_debug_read_index) {
+            isr_debug_buffer[isr_debug_write_index] = '\n';
+            isr_debug_write_index = next_write;
+        }
+    }
+}
+
+static double now_ns(void)
+{
+    return (double)host_cycles();
+}
+
+int main(void)
+{
+    int failures = test_ring();
+
+    /* 消費者持續清空，只量測生產者端 */
+    double t0 = now_ns();
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        legacy_printf_isr("RX IRQ: LMO_%02d (idx=%d)\r\n", (int)(i & 7U) + 1, (int)(i & 7U));
+        isr_debug_read_index = isr_debug_write_index;
+    }
+    double legacy_ns = (now_ns() - t0) / ITERATIONS;
+
+    CO_log_init(&ring);
+    t0 = now_ns();
+    for (uint32_t i = 0; i < ITERATIONS; i++) {
+        CO_log_write(&ring, CO_LOG_RX_IRQ, (i & 7U) + 1U, i & 7U, 0, 0);
+        ring.tail = ring.head;
+    }
+    double log_ns = (now_ns() - t0) / ITERATIONS;
+
+    printf("\nISR log cost per record (%u records)\n", ITERATIONS);
+    printf("  vsnprintf + byte copy (old): %7.1f ns\n", legacy_ns);
+    printf("  CO_log_write (binary):       %7.1f ns  (%.0fx)\n", log_ns, legacy_ns / log_ns);
+    printf("  record size: %zu bytes, ring %u records\n", sizeof(CO_logEntry_t), CO_LOG_RING_SIZE);
+
+    CHECK(log_ns * 5.0 < legacy_ns, "binary log not clearly cheaper (%.1f vs %.1f ns)", log_ns, legacy_ns);
+
+    printf("\n%s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}
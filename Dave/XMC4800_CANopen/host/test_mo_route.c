@@ -0,0 +1,216 @@
+/**
+ * Host test and micro-benchmark for MSPND pending routing
+ *
+ * @file test_mo_route.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 以 xmc_can_mock.h 模擬的 MultiCAN 暫存器測試 CO_MOroute_dispatch()：
+ *  1. 使用 DAVE 產生的真實 MO 編號，handler 必須收到正確的 LMO index 與 RX/TX 旗標
+ *  2. 處理後 MSPND 位元必須清除，未登記的 MO 不得被處理
+ *  3. 與原本輪詢全部 LMO 的做法比較 ISR 時間 (ns/IRQ)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "xmc_can_mock.h"
+#include "CO_mo_route.h"
+
+#define LMO_MAX         64U
+#define IRQ_COUNT       (1U << 18)
+
+CAN_GLOBAL_TypeDef mock_can_global;
+CAN_MO_TypeDef mock_can_mo[256];
+
+/* CAN_NODE_0 (can_node_conf.c) 的 LMO 配置：前 7 個 TX，後 5 個 RX */
+static const uint8_t dave_mo_numbers[] = {32, 31, 30, 39, 38, 37, 36, 60, 9, 33, 34, 35};
+#define DAVE_LMO_COUNT  (sizeof(dave_mo_numbers) / sizeof(dave_mo_numbers[0]))
+#define DAVE_TX_COUNT   7U
+
+static XMC_CAN_MO_t mo[LMO_MAX];
+static bool mo_is_rx[LMO_MAX];
+static uint8_t lmo_count;
+static CO_MOroute_t route;
+
+static uint32_t hit_count[LMO_MAX];
+static uint32_t hit_rx[LMO_MAX];
+static volatile uint32_t sink;
+
+/* 與 CO_CANinterrupt_Rx/Tx 相同：處理後清除 MOSTAT pending */
+static void test_handler(void *object, uint8_t lmoIndex, bool isRx)
+{
+    (void)object;
+    hit_count[lmoIndex]++;
+    hit_rx[lmoIndex] += isRx ? 1U : 0U;
+    XMC_CAN_MO_ResetStatus(&mo[lmoIndex], isRx ? XMC_CAN_MO_STATUS_RX_PENDING
+                                               : XMC_CAN_MO_STATUS_TX_PENDING);
+    sink += lmoIndex;
+}
+
+/* 配置 count 個 LMO，前 12 個使用 DAVE 的 MO 編號，其餘依序補上 */
+static void setup(uint8_t count)
+{
+    uint8_t next = 64;
+
+    mock_can_reset();
+    CO_MOroute_init(&route, CAN->MSPND);
+    lmo_count = count;
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t number = (i < DAVE_LMO_COUNT) ? dave_mo_numbers[i] : next++;
+        mo_is_rx[i] = (i >= DAVE_TX_COUNT);
+        mock_can_mo_init(&mo[i], number, mo_is_rx[i] ? XMC_CAN_MO_TYPE_RECMSGOBJ
+                                                      : XMC_CAN_MO_TYPE_TRANSMSGOBJ);
+        CO_MOroute_add(&route, number, i, mo_is_rx[i]);
+    }
+}
+
+/* 原本 canopen_can_interrupt_process() 的輪詢：每次中斷讀取全部 LMO 的 MOSTAT */
+static uint32_t legacy_poll(void)
+{
+    uint32_t events = 0;
+    for (uint8_t i = 0; i < lmo_count; i++) {
+        uint32_t status = XMC_CAN_MO_GetStatus(&mo[i]);
+        if (mo[i].can_mo_type == XMC_CAN_MO_TYPE_RECMSGOBJ) {
+            if (status & XMC_CAN_MO_STATUS_RX_PENDING) {
+                test_handler(NULL, i, true);
+                events++;
+            }
+        } else if (mo[i].can_mo_type == XMC_CAN_MO_TYPE_TRANSMSGOBJ) {
+            if (status & XMC_CAN_MO_STATUS_TX_PENDING) {
+                test_handler(NULL, i, false);
+                events++;
+            }
+        }
+    }
+    return events;
+}
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* 正確性：逐一觸發每個 LMO，再同時觸發全部 */
+static int test_routing(void)
+{
+    int errors = 0;
+
+    setup((uint8_t)DAVE_LMO_COUNT);
+    for (uint8_t i = 0; i < lmo_count; i++) {
+        memset(hit_count, 0, sizeof(hit_count));
+        memset(hit_rx, 0, sizeof(hit_rx));
+        mock_can_mo_event(&mo[i], mo_is_rx[i]);
+
+        uint32_t events = CO_MOroute_dispatch(&route, test_handler, NULL);
+        for (uint8_t j = 0; j < lmo_count; j++) {
+            uint32_t expect = (j == i) ? 1U : 0U;
+            if (hit_count[j] != expect || hit_rx[j] != (mo_is_rx[j] ? expect : 0U)) {
+                printf("  LMO %u (MO %u): hit=%u rx=%u, expected %u\n", j,
+                       (unsigned)(mo[j].can_mo_ptr - mock_can_mo), hit_count[j], hit_rx[j], expect);
+                errors++;
+            }
+        }
+        if (events != 1U) {
+            printf("  LMO %u: %u events\n", i, events);
+            errors++;
+        }
+    }
+
+    /* 全部同時 pending，外加一個不屬於 CAN_NODE_0 的 MO */
+    memset(hit_count, 0, sizeof(hit_count));
+    XMC_CAN_MO_t foreign;
+    mock_can_mo_init(&foreign, 100, XMC_CAN_MO_TYPE_RECMSGOBJ);
+    mock_can_mo_event(&foreign, true);
+    for (uint8_t i = 0; i < lmo_count; i++) {
+        mock_can_mo_event(&mo[i], mo_is_rx[i]);
+    }
+    if (CO_MOroute_dispatch(&route, test_handler, NULL) != lmo_count) {
+        printf("  burst: wrong event count\n");
+        errors++;
+    }
+    for (uint8_t i = 0; i < lmo_count; i++) {
+        if (hit_count[i] != 1U) {
+            printf("  burst: LMO %u hit %u times\n", i, hit_count[i]);
+            errors++;
+        }
+    }
+    for (uint32_t k = 0; k < CO_MO_ROUTE_REGS; k++) {
+        uint32_t expect = (k == 100U / 32U) ? (1UL << (100U % 32U)) : 0U;
+        if (CAN->MSPND[k] != expect) {
+            printf("  MSPND[%u] = 0x%08X, expected 0x%08X\n", k, CAN->MSPND[k], expect);
+            errors++;
+        }
+    }
+
+    /* 沒有事件時不得調用 handler */
+    CAN->MSPND[100U / 32U] = 0;
+    if (CO_MOroute_dispatch(&route, test_handler, NULL) != 0U) {
+        printf("  idle: spurious event\n");
+        errors++;
+    }
+
+    return errors;
+}
+
+/* 效能：每次 IRQ 觸發 events 個隨機 LMO */
+static void bench(uint8_t count, uint8_t events, bool report)
+{
+    double t0, t1, t2;
+    uint32_t i, e;
+    uint32_t seed = 12345;
+
+    setup(count);
+    uint8_t *order = malloc((size_t)IRQ_COUNT * events);
+    for (i = 0; i < IRQ_COUNT * events; i++) {
+        seed = seed * 1103515245U + 12345U;
+        order[i] = (uint8_t)((seed >> 16) % count);
+    }
+
+    t0 = now_ns();
+    for (i = 0; i < IRQ_COUNT; i++) {
+        for (e = 0; e < events; e++) {
+            uint8_t l = order[i * events + e];
+            mock_can_mo_event(&mo[l], mo_is_rx[l]);
+        }
+        sink += legacy_poll();
+        memset((void *)CAN->MSPND, 0, sizeof(CAN->MSPND));
+    }
+    t1 = now_ns();
+    for (i = 0; i < IRQ_COUNT; i++) {
+        for (e = 0; e < events; e++) {
+            uint8_t l = order[i * events + e];
+            mock_can_mo_event(&mo[l], mo_is_rx[l]);
+        }
+        sink += CO_MOroute_dispatch(&route, test_handler, NULL);
+    }
+    t2 = now_ns();
+
+    /* 兩個迴圈都包含相同的事件產生成本 */
+    if (report) {
+        printf("  LMO=%2u events/IRQ=%u: poll %6.1f ns/IRQ, MSPND %6.1f ns/IRQ\n",
+               count, events, (t1 - t0) / IRQ_COUNT, (t2 - t1) / IRQ_COUNT);
+    }
+    free(order);
+}
+
+int main(void)
+{
+    int errors;
+
+    printf("MSPND pending routing test\n");
+    errors = test_routing();
+    printf("  routing: %s\n", errors == 0 ? "OK" : "FAILED");
+
+    bench((uint8_t)DAVE_LMO_COUNT, 1, false);  /* 預熱快取 */
+    bench((uint8_t)DAVE_LMO_COUNT, 1, true);
+    bench((uint8_t)DAVE_LMO_COUNT, 4, true);
+    bench(32, 1, true);
+    bench(LMO_MAX, 1, true);
+
+    printf("%s\n", errors == 0 ? "PASS" : "FAIL");
+    return errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,253 @@
+/**
+ * Host test of the generated Object Dictionary (host/od_gen.c)
+ *
+ * @file test_od_gen.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * application/OD.c (od_gen 產生) 與 od_ref/OD.c (libedssharp 產生的原始檔案，以
+ * REF_OD / REF_PERSIST_COMM / REF_RAM 名稱編譯) 各自接上 SDO 伺服器，執行相同的 SDO 請求：
+ *  1. od_ref 的每個 index (加上不存在的 index) 的子索引 0 ~ 0x13：上傳、以相同值下載、下載修改後的值並讀回、
+ *     錯誤長度的下載 - 兩者匯流排上的訊框必須逐位元組相同
+ *  2. OD_find() 常數查表與二分搜尋結果一致；od_ref 之後加入 EDS 的只有量測 record (CO_prof_od.h)
+ *     與參數 flash (0x2200 DOMAIN)
+ *  3. 型別讀取函式 (OD_get_x1017_...) 與 OD_set_value() / SDO 寫入的資料相同，OD.h 沒有直接寫入的函式
+ *  4. OD_get_u16() (OD_find + OD_getSub + 讀取) 與讀取函式的每次呼叫時間
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "301/CO_ODinterface.h"
+#include "301/CO_SDOserver.h"
+#include "CO_driver_host.h"
+#include "OD.h"
+#include "CO_prof_od.h"
+
+#define NODE_ID                 1U
+#define SUB_MAX                 0x13U
+#define TRANSCRIPT_MAX          16384U
+#define BENCH_CALLS             1000000U
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+/* od_ref/OD.c - libedssharp */
+extern OD_t *REF_OD;
+
+typedef struct {
+    CO_CANrxMsg_t           msg[TRANSCRIPT_MAX];
+    uint32_t                count;
+    uint32_t                uploads;        /* 成功的快速上傳 */
+    uint32_t                downloads;      /* 成功的快速下載 */
+} transcript_t;
+
+/* od_ref 之後加入 EDS 的物件 */
+#define ADDED_COUNT             (CO_PROF_COUNT + 1U)
+
+static bool_t added_index(uint32_t index)
+{
+    return (index >= CO_PROF_OD_INDEX && index < CO_PROF_OD_INDEX + CO_PROF_COUNT) || index == 0x2200U;
+}
+
+static CO_vbus_t bus;
+static CO_CANmodule_t CANmodule;
+static CO_CANrx_t rxArray[1];
+static CO_CANtx_t txArray[1];
+static CO_SDOserver_t sdo;
+static transcript_t transcripts[2];
+static volatile uint32_t sink;
+
+static void record_frame(void *object, const CO_vbusFrame_t *frame)
+{
+    transcript_t *t = object;
+    if (t->count < TRANSCRIPT_MAX) {
+        t->msg[t->count++] = frame->msg;
+    }
+}
+
+/* 送出一個 SDO 請求並回傳伺服器的回應 */
+static const CO_CANrxMsg_t *sdo_request(transcript_t *t, const uint8_t req[8])
+{
+    uint32_t count = t->count;
+    CO_vbus_inject(&bus, 0x600U + NODE_ID, 8, req);
+    CO_vbus_process(&bus);
+    CO_SDOserver_process(&sdo, true, 0, NULL);
+    CO_vbus_process(&bus);
+    return (t->count == count + 2U) ? &t->msg[count + 1U] : NULL;
+}
+
+static const CO_CANrxMsg_t *sdo_upload(transcript_t *t, uint16_t index, uint8_t subIndex)
+{
+    uint8_t req[8] = {0x40, (uint8_t)index, (uint8_t)(index >> 8), subIndex, 0, 0, 0, 0};
+    return sdo_request(t, req);
+}
+
+static const CO_CANrxMsg_t *sdo_download(transcript_t *t, uint16_t index, uint8_t subIndex, const uint8_t *data,
+                                         uint8_t len)
+{
+    uint8_t req[8] = {(uint8_t)(0x23U | ((4U - len) << 2)), (uint8_t)index, (uint8_t)(index >> 8), subIndex, 0, 0, 0, 0};
+    memcpy(&req[4], data, len);
+    return sdo_request(t, req);
+}
+
+static int run_transcript(OD_t *od, transcript_t *t)
+{
+    static const uint16_t missing[] = {0x0000, 0x1002, 0x1FFF, 0x2000, 0x6000, 0xFFFF};
+    uint32_t errInfo = 0;
+
+    memset(t, 0, sizeof(*t));
+    CO_vbus_init(&bus);
+    CO_vbus_setMonitor(&bus, record_frame, t);
+    if (CO_CANmodule_init(&CANmodule, &bus, rxArray, 1, txArray, 1, 500) != CO_ERROR_NO
+        || CO_SDOserver_init(&sdo, od, NULL, NODE_ID, 1000, &CANmodule, 0, &CANmodule, 0, &errInfo) != CO_ERROR_NO) {
+        printf("FAIL: SDO server init (errInfo 0x%X)\n", errInfo);
+        return 1;
+    }
+    CO_CANsetNormalMode(&CANmodule);
+
+    for (uint32_t i = 0; i < REF_OD->size + sizeof(missing) / sizeof(missing[0]); i++) {
+        uint16_t index = (i < REF_OD->size) ? REF_OD->list[i].index : missing[i - REF_OD->size];
+        for (uint8_t sub = 0; sub <= SUB_MAX; sub++) {
+            const CO_CANrxMsg_t *rsp = sdo_upload(t, index, sub);
+            if (rsp == NULL || (rsp->data[0] & 0xF3U) != 0x43U) {
+                continue;
+            }
+            t->uploads++;
+            uint8_t len = (uint8_t)(4U - ((rsp->data[0] >> 2) & 0x3U));
+            uint8_t value[4], modified[4];
+            memcpy(value, &rsp->data[4], 4);
+            for (uint8_t b = 0; b < 4U; b++) {
+                modified[b] = (uint8_t)(value[b] ^ (0x5AU + b));
+            }
+
+            rsp = sdo_download(t, index, sub, value, len);
+            if (rsp != NULL && rsp->data[0] == 0x60U) {
+                t->downloads++;
+                (void)sdo_download(t, index, sub, modified, len);
+                (void)sdo_upload(t, index, sub);
+                (void)sdo_download(t, index, sub, value, len);
+            }
+            (void)sdo_download(t, index, sub, value, (len < 4U) ? (uint8_t)(len + 1U) : 2U);
+        }
+    }
+    return 0;
+}
+
+static int test_transcript(void)
+{
+    int failures = 0;
+
+    failures += run_transcript(OD, &transcripts[0]);
+    failures += run_transcript(REF_OD, &transcripts[1]);
+
+    transcript_t *gen = &transcripts[0], *ref = &transcripts[1];
+    CHECK(gen->count == ref->count, "transcript %u frames, reference %u frames", gen->count, ref->count);
+    CHECK(gen->count < TRANSCRIPT_MAX, "transcript overflow");
+    for (uint32_t i = 0; i < gen->count && i < ref->count; i++) {
+        if (gen->msg[i].ident != ref->msg[i].ident || gen->msg[i].DLC != ref->msg[i].DLC
+            || memcmp(gen->msg[i].data, ref->msg[i].data, 8) != 0) {
+            CHECK(false, "frame %u: 0x%03X %02X %02X %02X %02X, reference 0x%03X %02X %02X %02X %02X", i,
+                  gen->msg[i].ident, gen->msg[i].data[0], gen->msg[i].data[1], gen->msg[i].data[2],
+                  gen->msg[i].data[3], ref->msg[i].ident, ref->msg[i].data[0], ref->msg[i].data[1],
+                  ref->msg[i].data[2], ref->msg[i].data[3]);
+            break;
+        }
+    }
+    CHECK(gen->uploads > 100U && gen->downloads > 50U, "%u uploads, %u downloads", gen->uploads, gen->downloads);
+    printf("SDO transcript: %u frames, %u uploads, %u downloads - %s\n", gen->count, gen->uploads, gen->downloads,
+           failures == 0 ? "identical" : "DIFFERENT");
+    return failures;
+}
+
+static int test_lookup(void)
+{
+    int failures = 0;
+    OD_t binary = *OD;
+
+    binary.lookup = NULL;
+    CHECK(OD->lookup != NULL, "generated OD has no lookup table");
+    CHECK(OD->size == REF_OD->size + ADDED_COUNT, "OD size %u, reference %u", OD->size, REF_OD->size);
+    for (uint32_t index = 0; index < 0x10000U; index++) {
+        OD_entry_t *entry = OD_find(OD, (uint16_t)index);
+        OD_entry_t *refEntry = OD_find(REF_OD, (uint16_t)index);
+        if (entry != OD_find(&binary, (uint16_t)index)
+            || (entry == NULL) != (refEntry == NULL && !added_index(index))) {
+            CHECK(false, "OD_find(0x%04X)", index);
+            break;
+        }
+    }
+    return failures;
+}
+
+static int test_accessors(void)
+{
+    int failures = 0;
+    uint16_t hb = 0;
+    uint32_t cobId = 0;
+    transcript_t *t = &transcripts[0];
+
+    CHECK(OD_set_u16(OD_ENTRY_H1017, 0, 1234, true) == ODR_OK && OD_get_x1017_producerHeartbeatTime() == 1234U,
+          "OD_get_x1017_producerHeartbeatTime() = %u", OD_get_x1017_producerHeartbeatTime());
+    CHECK(OD_get_u16(OD_ENTRY_H1017, 0, &hb, true) == ODR_OK && hb == 1234U, "OD_get_u16(0x1017) = %u", hb);
+    CHECK(OD_set_u32(OD_ENTRY_H1400, 1, 0x80000211U, true) == ODR_OK
+              && OD_get_x1400_RPDOCommunicationParameter_COB_IDUsedByRPDO() == 0x80000211U,
+          "OD_get_x1400_..._COB_IDUsedByRPDO()");
+
+    /* SDO 伺服器看到 OD_set_u32() 寫入的值，讀取函式看到 SDO 寫入的值 */
+    run_transcript(OD, t);
+    (void)OD_set_u32(OD_ENTRY_H1018, 4, 0x12345678U, true);
+    const CO_CANrxMsg_t *rsp = sdo_upload(t, 0x1018, 4);
+    CHECK(rsp != NULL && rsp->data[0] == 0x43U && rsp->data[4] == 0x78U && rsp->data[7] == 0x12U,
+          "SDO upload 0x1018:04");
+    uint8_t data[2] = {0x34, 0x12};
+    rsp = sdo_download(t, 0x1015, 0, data, 2);
+    CHECK(rsp != NULL && rsp->data[0] == 0x60U && OD_get_x1015_inhibitTimeEMCY() == 0x1234U, "SDO download 0x1015");
+    (void)OD_get_u32(OD_ENTRY_H1014, 0, &cobId, true);
+    CHECK(OD_get_x1014_COB_ID_EMCY() == cobId, "OD_get_x1014_COB_ID_EMCY()");
+    return failures;
+}
+
+/* 每次呼叫的時間：OD_get_u16(OD_find()) (二分搜尋、查表) 與存取函式 */
+static double bench_get(OD_t *od, uint16_t index, uint8_t subIndex)
+{
+    uint32_t acc = 0;
+    uint32_t t0 = host_cycles();
+    for (uint32_t i = 0; i < BENCH_CALLS; i++) {
+        uint16_t value = 0;
+        (void)OD_get_u16(OD_find(od, index), subIndex, &value, true);
+        acc += value;
+    }
+    uint32_t ns = host_cycles() - t0;
+    sink = acc;
+    return (double)ns / BENCH_CALLS;
+}
+
+static void bench(void)
+{
+    uint32_t acc = 0;
+    uint32_t t0 = host_cycles();
+    for (uint32_t i = 0; i < BENCH_CALLS; i++) {
+        acc += OD_get_x1800_TPDOCommunicationParameter_eventTimer();
+        __asm__ volatile("" ::: "memory");
+    }
+    uint32_t ns = host_cycles() - t0;
+    sink = acc;
+
+    printf("OD_get_u16(0x1800:05): libedssharp OD %.1f ns, generated OD %.1f ns, getter %.2f ns\n",
+           bench_get(REF_OD, 0x1800, 5), bench_get(OD, 0x1800, 5), (double)ns / BENCH_CALLS);
+}
+
+int main(void)
+{
+    int failures = 0;
+
+    printf("=== Generated Object Dictionary vs libedssharp reference ===\n");
+    failures += test_transcript();
+    failures += test_lookup();
+    failures += test_accessors();
+    bench();
+
+    printf("%s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}
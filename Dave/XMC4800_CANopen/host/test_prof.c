@@ -0,0 +1,198 @@
+/**
+ * Host test of the CANopen processing profile (port/CO_prof.c, CO_prof_od.c)
+ *
+ * @file test_prof.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ *  1. 直方圖格位邊界、最小 / 最大 / 平均、清除請求在下一次記錄時生效
+ *  2. 一個節點 (CO_host_node.c) 在虛擬匯流排上執行 1 s，主循環與 RT slot 如同 main.c 量測，
+ *     以 SDO 讀出 0x2100 ~ 0x2107：次數、min <= avg <= max、直方圖總和等於次數
+ *  3. SDO 寫入次數 0 清除量測點，寫入其他值或唯讀子索引則中止
+ * CO_CAN_CYCLES() 在主機上是 clock_gettime() 奈秒 (host/DAVE.h)，輸出每個量測點的奈秒統計。
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CANopen.h"
+#include "OD.h"
+#include "CO_host_node.h"
+#include "CO_prof_od.h"
+
+#define NODE_ID                 5U
+#define RUN_MS                  1000U
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+static CO_vbus_t bus;
+static CO_t *co;
+static CO_CANrxMsg_t sdoResponse;
+static bool_t sdoResponded;
+
+static const char *const profNames[CO_PROF_COUNT] = {
+    "CO_process", "SYNC", "RPDO", "TPDO", "CAN RX", "CAN TX", "SDO server", "HB consumer"
+};
+
+static void monitor(void *object, const CO_vbusFrame_t *frame)
+{
+    (void)object;
+    if (frame->msg.ident == 0x580U + NODE_ID) {
+        sdoResponse = frame->msg;
+        sdoResponded = true;
+    }
+}
+
+/* 1 ms：與 main.c 相同量測 CO_process()，RT slot 在 CO_hostNode_rt() 中量測 */
+static void step_ms(uint32_t ms)
+{
+    for (uint32_t t = 0; t < ms; t++) {
+        CO_PROF_BEGIN(CO_PROF_PROCESS);
+        CO_process(co, false, 1000U, NULL);
+        CO_PROF_END(CO_PROF_PROCESS);
+        CO_hostNode_rt(co, 1000U);
+        CO_vbus_process(&bus);
+    }
+}
+
+/* 快速 SDO 請求，回傳回應的命令位元組 (0：沒有回應) */
+static uint8_t sdo_request(uint8_t command, uint16_t index, uint8_t subIndex, uint32_t value, uint32_t *response)
+{
+    uint8_t req[8] = {command, (uint8_t)index, (uint8_t)(index >> 8), subIndex};
+
+    CO_setUint32(&req[4], value);
+    sdoResponded = false;
+    CO_vbus_inject(&bus, 0x600U + NODE_ID, 8, req);
+    CO_vbus_process(&bus);
+    step_ms(2);
+    if (!sdoResponded) {
+        return 0;
+    }
+    *response = CO_getUint32(&sdoResponse.data[4]);   /* 中止碼與 CO_SDOclient.c 相同以 CO_SWAP_32() 還原 */
+    return sdoResponse.data[0];
+}
+
+static uint32_t sdo_read(uint16_t index, uint8_t subIndex, bool_t *ok)
+{
+    uint32_t value = 0;
+
+    if ((sdo_request(0x40, index, subIndex, 0, &value) & 0xF3U) != 0x43U) {
+        *ok = false;
+    }
+    return value;
+}
+
+static int test_record(void)
+{
+    int failures = 0;
+    CO_profStat_t stat;
+
+    CHECK(CO_prof_bucket(0) == 0U && CO_prof_bucket(255) == 0U && CO_prof_bucket(256) == 1U
+              && CO_prof_bucket(511) == 1U && CO_prof_bucket(512) == 2U && CO_prof_bucket(1U << 14) == 7U
+              && CO_prof_bucket(UINT32_MAX) == 7U,
+          "CO_prof_bucket()");
+
+    CO_prof_get(CO_PROF_CAN_RX, &stat);
+    CHECK(stat.count == 0U && stat.min == 0U && stat.max == 0U, "empty profile");
+
+    CO_prof_record(CO_PROF_CAN_RX, 100);
+    CO_prof_record(CO_PROF_CAN_RX, 300);
+    CO_prof_record(CO_PROF_CAN_RX, 1000);
+    CO_prof_get(CO_PROF_CAN_RX, &stat);
+    CHECK(stat.count == 3U && stat.min == 100U && stat.max == 1000U && stat.sum == 1400U, "count %u min %u max %u",
+          stat.count, stat.min, stat.max);
+    CHECK(stat.hist[0] == 1U && stat.hist[1] == 1U && stat.hist[2] == 1U, "histogram %u %u %u", stat.hist[0],
+          stat.hist[1], stat.hist[2]);
+
+    /* 清除請求：讀出立即為 0，下一次記錄才清除資料 */
+    CO_prof_reset(CO_PROF_CAN_RX);
+    CO_prof_get(CO_PROF_CAN_RX, &stat);
+    CHECK(stat.count == 0U && stat.max == 0U && stat.hist[2] == 0U, "reset pending");
+    CO_prof_record(CO_PROF_CAN_RX, 50);
+    CO_prof_get(CO_PROF_CAN_RX, &stat);
+    CHECK(stat.count == 1U && stat.min == 50U && stat.max == 50U && stat.hist[2] == 0U, "after reset: count %u",
+          stat.count);
+    CO_prof_reset(CO_PROF_CAN_RX);
+    return failures;
+}
+
+static int test_od(void)
+{
+    int failures = 0;
+    uint32_t errInfo = 0;
+    uint32_t value = 0;
+
+    CO_vbus_init(&bus);
+    CO_vbus_setMonitor(&bus, monitor, NULL);
+    co = CO_hostNode_new(&bus, NODE_ID, &errInfo);
+    if (co == NULL) {
+        printf("FAIL: node init (errInfo 0x%X)\n", errInfo);
+        return 1;
+    }
+    CHECK(CO_prof_initOD(OD) == CO_PROF_COUNT, "CO_prof_initOD()");
+
+    /* SYNC 生產者讓 RT slot 的 SYNC/RPDO/TPDO 都有量測 */
+    CHECK(sdo_request(0x23, 0x1006, 0, 10000, &value) == 0x60U, "SDO download 0x1006");
+    CHECK(sdo_request(0x23, 0x1005, 0, 0x40000080U, &value) == 0x60U, "SDO download 0x1005");
+    step_ms(RUN_MS);
+
+    printf("%-12s %8s %8s %8s %8s   histogram (< 256 ns, then x2)\n", "ns", "count", "min", "avg", "max");
+    for (uint32_t id = 0; id < CO_PROF_COUNT; id++) {
+        uint16_t index = (uint16_t)(CO_PROF_OD_INDEX + id);
+        bool_t ok = true;
+        uint32_t sub0 = sdo_read(index, 0, &ok);
+        uint32_t count = sdo_read(index, CO_PROF_OD_SUB_COUNT, &ok);
+        uint32_t min = sdo_read(index, CO_PROF_OD_SUB_MIN, &ok);
+        uint32_t max = sdo_read(index, CO_PROF_OD_SUB_MAX, &ok);
+        uint32_t avg = sdo_read(index, CO_PROF_OD_SUB_AVG, &ok);
+        uint32_t hist[CO_PROF_HIST_BUCKETS], histSum = 0;
+
+        for (uint8_t b = 0; b < CO_PROF_HIST_BUCKETS; b++) {
+            hist[b] = sdo_read(index, (uint8_t)(CO_PROF_OD_SUB_HIST + b), &ok);
+            histSum += hist[b];
+        }
+        CHECK(ok && sub0 == CO_PROF_OD_SUB_HIST + CO_PROF_HIST_BUCKETS - 1U, "SDO upload 0x%04X", index);
+
+        /* 量測在讀取之間繼續，只檢查彼此一致的部分 */
+        bool_t hostRx = (id == CO_PROF_CAN_RX || id == CO_PROF_CAN_TX);
+        if (!hostRx) {
+            CHECK(count >= RUN_MS / 10U && histSum >= count && min <= avg && avg <= max,
+                  "0x%04X %s: count %u (hist %u) min %u avg %u max %u", index, profNames[id], count, histSum, min,
+                  avg, max);
+        }
+        printf("%-12s %8u %8u %8u %8u  ", profNames[id], count, min, avg, max);
+        for (uint8_t b = 0; b < CO_PROF_HIST_BUCKETS; b++) {
+            printf(" %u", hist[b]);
+        }
+        printf("%s\n", hostRx ? "   (firmware ISR only)" : "");
+    }
+
+    /* 次數寫入 0 清除，其他值與唯讀子索引中止 */
+    uint16_t index = CO_PROF_OD_INDEX + CO_PROF_TPDO;
+    CHECK(sdo_request(0x23, index, CO_PROF_OD_SUB_COUNT, 0, &value) == 0x60U, "SDO reset 0x%04X", index);
+    bool_t ok = true;
+    uint32_t count = sdo_read(index, CO_PROF_OD_SUB_COUNT, &ok);
+    CHECK(ok && count <= 4U, "after reset: count %u", count);
+    CHECK(sdo_request(0x23, index, CO_PROF_OD_SUB_COUNT, 1, &value) == 0x80U
+              && CO_SWAP_32(value) == CO_SDO_AB_INVALID_VALUE,
+          "SDO write 1 to count: abort 0x%08X", (unsigned)CO_SWAP_32(value));
+    CHECK(sdo_request(0x23, index, CO_PROF_OD_SUB_MAX, 0, &value) == 0x80U && CO_SWAP_32(value) == CO_SDO_AB_READONLY,
+          "SDO write max: abort 0x%08X", (unsigned)CO_SWAP_32(value));
+
+    CO_delete(co);
+    return failures;
+}
+
+int main(void)
+{
+    int failures = 0;
+
+    printf("=== CANopen processing profile (CO_prof, OD 0x%04X ~ 0x%04X) ===\n", CO_PROF_OD_INDEX,
+           CO_PROF_OD_INDEX + CO_PROF_COUNT - 1U);
+    failures += test_record();
+    failures += test_od();
+
+    printf("%s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,213 @@
+/**
+ * Host test of the full CANopen stack over the virtual CAN bus
+ *
+ * @file test_vbus.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 兩個節點 (CANopen.c + 301/305 + application/OD.c) 掛在 CO_vbus_t 上，
+ * 以外部注入的訊框扮演 NMT 主站與 SDO 客戶端：
+ *  1. 開機訊息與 NMT 啟動/切換狀態
+ *  2. SDO 快速上傳/下載，寫入 0x1017 後的心跳週期
+ *     中止碼與分段下載的大小指示在匯流排上的位元組順序 (little endian)
+ *  3. 相同情境執行兩次，匯流排上的訊框序列完全相同
+ *  4. 模擬速度 (每秒可模擬的節點毫秒數)
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CANopen.h"
+#include "OD.h"
+#include "CO_host_node.h"
+
+#define NODES                   2U
+#define LOG_MAX                 4096U
+#define BENCH_MS                20000U
+
+#define CHECK(cond, ...) do { if (!(cond)) { printf("FAIL: " __VA_ARGS__); printf("\n"); failures++; } } while (0)
+
+/* 匯流排監看紀錄 */
+typedef struct {
+    CO_CANrxMsg_t           msg[LOG_MAX];
+    uint32_t                count;
+    uint32_t                hash;           /* FNV-1a，所有訊框 */
+} frameLog_t;
+
+static CO_vbus_t bus;
+static frameLog_t frameLog;
+static CO_t *node[NODES];
+
+static void log_frame(void *object, const CO_vbusFrame_t *frame)
+{
+    frameLog_t *log = (frameLog_t *)object;
+    const CO_CANrxMsg_t *msg = &frame->msg;
+    const uint8_t *p = (const uint8_t *)msg;
+
+    if (log->count < LOG_MAX) {
+        log->msg[log->count] = *msg;
+    }
+    log->count++;
+    for (size_t i = 0; i < sizeof(*msg); i++) {
+        log->hash = (log->hash ^ p[i]) * 16777619U;
+    }
+}
+
+/* 1 ms：每個節點的 CO_process() 與 RT slot 處理，再傳遞匯流排上的訊框 */
+static void step_ms(uint32_t ms)
+{
+    for (uint32_t t = 0; t < ms; t++) {
+        for (uint32_t n = 0; n < NODES; n++) {
+            CO_process(node[n], false, 1000U, NULL);
+            CO_hostNode_rt(node[n], 1000U);
+        }
+        CO_vbus_process(&bus);
+    }
+}
+
+static bool frame_is(const CO_CANrxMsg_t *msg, uint16_t ident, uint8_t DLC, const uint8_t *data, uint8_t len)
+{
+    return msg->ident == ident && msg->DLC == DLC && memcmp(msg->data, data, len) == 0;
+}
+
+/* 最後一個 COB-ID = ident 的訊框 */
+static const CO_CANrxMsg_t *last_frame(uint16_t ident)
+{
+    for (uint32_t i = frameLog.count; i > 0U; i--) {
+        if (frameLog.msg[i - 1U].ident == ident) {
+            return &frameLog.msg[i - 1U];
+        }
+    }
+    return NULL;
+}
+
+static uint32_t count_frames(uint16_t ident, uint32_t from)
+{
+    uint32_t n = 0;
+    for (uint32_t i = from; i < frameLog.count && i < LOG_MAX; i++) {
+        n += (frameLog.msg[i].ident == ident) ? 1U : 0U;
+    }
+    return n;
+}
+
+static int scenario(uint32_t *hash)
+{
+    int failures = 0;
+
+    OD_PERSIST_COMM.x1017_producerHeartbeatTime = 0;
+    CO_vbus_init(&bus);
+    memset(&frameLog, 0, sizeof(frameLog));
+    frameLog.hash = 2166136261U;
+    CO_vbus_setMonitor(&bus, log_frame, &frameLog);
+
+    for (uint32_t n = 0; n < NODES; n++) {
+        uint32_t errInfo = 0;
+        node[n] = CO_hostNode_new(&bus, (uint8_t)(n + 1U), &errInfo);
+        if (node[n] == NULL) {
+            printf("node %u init failed (errInfo 0x%X)\n", n + 1U, errInfo);
+            return 1;
+        }
+    }
+    CHECK(bus.nodeCount == NODES, "nodeCount=%u", bus.nodeCount);
+
+    /* 開機訊息，NMT_CONTROL 啟動後直接進入 operational */
+    step_ms(5);
+    static const uint8_t zero[8] = { 0 };
+    CHECK(count_frames(0x701, 0) == 1U && count_frames(0x702, 0) == 1U, "boot-up messages");
+    CHECK(frame_is(last_frame(0x701), 0x701, 1, zero, 1), "node 1 boot-up frame");
+    CHECK(node[0]->NMT->operatingState == CO_NMT_OPERATIONAL
+          && node[1]->NMT->operatingState == CO_NMT_OPERATIONAL, "not operational after boot-up");
+
+    /* NMT: 節點 2 進入 pre-operational */
+    static const uint8_t nmtPreop[2] = { CO_NMT_ENTER_PRE_OPERATIONAL, 2 };
+    CO_vbus_inject(&bus, 0x000, 2, nmtPreop);
+    step_ms(2);
+    CHECK(node[1]->NMT->operatingState == CO_NMT_PRE_OPERATIONAL, "node 2 ignored NMT");
+    CHECK(node[0]->NMT->operatingState == CO_NMT_OPERATIONAL, "node 1 followed NMT for node 2");
+
+    /* SDO 快速上傳 0x1018:00 (節點 1) */
+    static const uint8_t upReq[8] = { 0x40, 0x18, 0x10, 0x00, 0, 0, 0, 0 };
+    static const uint8_t upResp[8] = { 0x4F, 0x18, 0x10, 0x00, 0x04, 0, 0, 0 };
+    CO_vbus_inject(&bus, 0x601, 8, upReq);
+    step_ms(2);
+    CHECK(last_frame(0x581) != NULL && frame_is(last_frame(0x581), 0x581, 8, upResp, 8), "SDO upload 0x1018:00");
+    CHECK(last_frame(0x582) == NULL, "node 2 answered node 1's SDO");
+
+    /* SDO 快速下載 0x1017 = 10 ms (節點 2)，之後每 10 ms 一個心跳 */
+    static const uint8_t dnReq[8] = { 0x2B, 0x17, 0x10, 0x00, 10, 0, 0, 0 };
+    static const uint8_t dnResp[4] = { 0x60, 0x17, 0x10, 0x00 };
+    CO_vbus_inject(&bus, 0x602, 8, dnReq);
+    step_ms(2);
+    CHECK(last_frame(0x582) != NULL && frame_is(last_frame(0x582), 0x582, 8, dnResp, 4), "SDO download 0x1017");
+    uint32_t from = frameLog.count;
+    step_ms(100);
+    uint32_t hb = count_frames(0x702, from);
+    CHECK(hb == 10U, "%u heartbeats in 100 ms, expected 10", hb);
+    CHECK(last_frame(0x702)->data[0] == CO_NMT_PRE_OPERATIONAL, "heartbeat state 0x%02X", last_frame(0x702)->data[0]);
+
+    /* 多位元組欄位在匯流排上為 little endian (CO_SWAP_*)：中止碼 0x06020000 = 00 00 02 06 */
+    static const uint8_t noObjReq[8] = { 0x40, 0x34, 0x12, 0x00, 0, 0, 0, 0 };
+    static const uint8_t noObjAbort[8] = { 0x80, 0x34, 0x12, 0x00, 0x00, 0x00, 0x02, 0x06 };
+    CO_vbus_inject(&bus, 0x601, 8, noObjReq);
+    step_ms(2);
+    CHECK(frame_is(last_frame(0x581), 0x581, 8, noObjAbort, 8), "abort code bytes %02X %02X %02X %02X",
+          last_frame(0x581)->data[4], last_frame(0x581)->data[5], last_frame(0x581)->data[6],
+          last_frame(0x581)->data[7]);
+
+    /* 分段下載 0x1017 = 20 ms，大小指示 2 = 02 00 00 00 (反序時為 0x02000000，伺服器中止) */
+    static const uint8_t segInit[8] = { 0x21, 0x17, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00 };
+    static const uint8_t segInitResp[4] = { 0x60, 0x17, 0x10, 0x00 };
+    static const uint8_t segData[8] = { 0x0B, 20, 0, 0, 0, 0, 0, 0 };
+    static const uint8_t segDataResp[1] = { 0x20 };
+    CO_vbus_inject(&bus, 0x602, 8, segInit);
+    step_ms(2);
+    CHECK(frame_is(last_frame(0x582), 0x582, 8, segInitResp, 4), "size indication: segmented initiate 0x%02X",
+          last_frame(0x582)->data[0]);
+    CO_vbus_inject(&bus, 0x602, 8, segData);
+    step_ms(2);
+    CHECK(frame_is(last_frame(0x582), 0x582, 8, segDataResp, 1), "size indication: segment 0x%02X",
+          last_frame(0x582)->data[0]);
+    CHECK(OD_PERSIST_COMM.x1017_producerHeartbeatTime == 20U, "0x1017 = %u after segmented download",
+          OD_PERSIST_COMM.x1017_producerHeartbeatTime);
+
+    *hash = frameLog.hash;
+    for (uint32_t n = 0; n < NODES; n++) {
+        CO_delete(node[n]);
+        node[n] = NULL;
+    }
+    CHECK(bus.nodeCount == 0U, "CO_delete left %u nodes on the bus", bus.nodeCount);
+    return failures;
+}
+
+int main(void)
+{
+    uint32_t hash[2] = { 0, 0 };
+    int failures = scenario(&hash[0]);
+    uint32_t frames = frameLog.count;
+
+    printf("stack on virtual bus: boot-up, NMT, SDO upload/download, heartbeat %s (%u frames)\n",
+           failures == 0 ? "OK" : "WRONG", frames);
+
+    failures += scenario(&hash[1]);
+    CHECK(hash[0] == hash[1] && frameLog.count == frames, "second run differs (0x%08X / 0x%08X)", hash[0], hash[1]);
+    printf("repeat run: identical frame sequence %s\n", hash[0] == hash[1] ? "yes" : "no");
+
+    /* 模擬速度：兩個節點，心跳 10 ms */
+    for (uint32_t n = 0; n < NODES; n++) {
+        node[n] = CO_hostNode_new(&bus, (uint8_t)(n + 1U), NULL);
+    }
+    CO_vbus_setMonitor(&bus, NULL, NULL);
+    uint32_t framesBefore = bus.frameCount;
+    uint32_t t0 = host_cycles();
+    step_ms(BENCH_MS);
+    double sec = (double)(uint32_t)(host_cycles() - t0) / 1e9;
+    printf("\nSimulated %u ms x %u nodes in %.3f s: %.0f node-ms/s, %u frames\n",
+           BENCH_MS, NODES, sec, (double)BENCH_MS * NODES / sec, bus.frameCount - framesBefore);
+    for (uint32_t n = 0; n < NODES; n++) {
+        CO_delete(node[n]);
+    }
+
+    printf("\n%s\n", failures == 0 ? "PASS" : "FAIL");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,16 @@
+/**
+ * Host stub of xmc_can.h for building port/ modules on Linux
+ *
+ * @file xmc_can.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * host/ 在 include 路徑最前面，port/ 模組的 #include "xmc_can.h" 改用 mock 暫存器。
+ */
+
+#ifndef XMC_CAN_H
+#define XMC_CAN_H
+
+#include "xmc_can_mock.h"
+
+#endif /* XMC_CAN_H */
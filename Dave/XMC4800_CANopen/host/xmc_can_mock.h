@@ -0,0 +1,326 @@
+/**
+ * Register-level mock of the XMC4800 MultiCAN message objects
+ *
+ * @file xmc_can_mock.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 主機端模擬 CAN_MO_TypeDef / XMC_CAN_MO_t 與 CAN 全域 MSPND 暫存器，
+ * 欄位排列與 XMC4800.h / xmc_can.h 相同。mock_can_mo_event() 依照硬體行為：
+ * 設定 MOSTAT 的 RXPND/TXPND/NEWDAT，並依 MOIPR.MPN 設定 MSPND 位元。
+ * mock_can_mo_store() / mock_can_rxfifo_store() 模擬訊框寫入 MO 或 RX FIFO
+ * (NEWDAT 仍為 1 時設定 MSGLST，FIFO 的 CUR 由 BOT 循環到 TOP)。
+ * mock_can_txfifo_complete() 模擬 TX FIFO 由 CUR 指向的 slave 送出一個訊框；
+ * mock_can_txfifo_lost() 模擬 CUR 的訊框仲裁失敗或匯流排錯誤 (MOFCR.STT=1 時 TXRQ 已清除、不重送)。
+ */
+
+#ifndef XMC_CAN_MOCK_H
+#define XMC_CAN_MOCK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define __IO volatile
+#define __I  volatile const
+
+/* CAN_MO MOSTAT/MOIPR 位元 (XMC4800.h) */
+#define CAN_MO_MOSTAT_RXPND_Msk     (0x1UL)
+#define CAN_MO_MOSTAT_TXPND_Msk     (0x2UL)
+#define CAN_MO_MOSTAT_RXUPD_Msk     (0x4UL)
+#define CAN_MO_MOSTAT_NEWDAT_Msk    (0x8UL)
+#define CAN_MO_MOSTAT_MSGLST_Msk    (0x10UL)
+#define CAN_MO_MOSTAT_MSGVAL_Msk    (0x20UL)
+#define CAN_MO_MOSTAT_TXRQ_Msk      (0x100UL)
+#define CAN_MO_MOSTAT_DIR_Msk       (0x800UL)
+#define CAN_MO_MOIPR_MPN_Pos        (8UL)
+#define CAN_MO_MOIPR_MPN_Msk        (0xff00UL)
+#define CAN_MO_MOFCR_STT_Msk        (0x800000UL)
+#define CAN_MO_MOFCR_DLC_Pos        (24UL)
+#define CAN_MO_MOFCR_DLC_Msk        (0xf000000UL)
+#define CAN_MO_MOFGPR_BOT_Pos       (0UL)
+#define CAN_MO_MOFGPR_BOT_Msk       (0xffUL)
+#define CAN_MO_MOFGPR_TOP_Pos       (8UL)
+#define CAN_MO_MOFGPR_TOP_Msk       (0xff00UL)
+#define CAN_MO_MOFGPR_CUR_Pos       (16UL)
+#define CAN_MO_MOFGPR_CUR_Msk       (0xff0000UL)
+#define XMC_CAN_MO_MOAR_STDID_Pos   (18U)
+#define XMC_CAN_MO_MOAR_STDID_Msk   ((0x000007FFUL) << XMC_CAN_MO_MOAR_STDID_Pos)
+
+/* XMC_CAN_MO_STATUS_t 常用值 (xmc_can.h) */
+#define XMC_CAN_MO_STATUS_RX_PENDING    CAN_MO_MOSTAT_RXPND_Msk
+#define XMC_CAN_MO_STATUS_TX_PENDING    CAN_MO_MOSTAT_TXPND_Msk
+#define XMC_CAN_MO_STATUS_RX_UPDATING   CAN_MO_MOSTAT_RXUPD_Msk
+#define XMC_CAN_MO_STATUS_NEW_DATA      CAN_MO_MOSTAT_NEWDAT_Msk
+#define XMC_CAN_MO_STATUS_MESSAGE_LOST  CAN_MO_MOSTAT_MSGLST_Msk
+#define XMC_CAN_MO_STATUS_MESSAGE_VALID CAN_MO_MOSTAT_MSGVAL_Msk
+
+/* XMC_CAN_MO_RESET_STATUS_t - MOCTR 的 RESxxx 位元與 MOSTAT 位置相同 */
+#define XMC_CAN_MO_RESET_STATUS_RX_PENDING      CAN_MO_MOSTAT_RXPND_Msk
+#define XMC_CAN_MO_RESET_STATUS_TX_PENDING      CAN_MO_MOSTAT_TXPND_Msk
+#define XMC_CAN_MO_RESET_STATUS_NEW_DATA        CAN_MO_MOSTAT_NEWDAT_Msk
+#define XMC_CAN_MO_RESET_STATUS_MESSAGE_LOST    CAN_MO_MOSTAT_MSGLST_Msk
+#define XMC_CAN_MO_RESET_STATUS_TX_REQUEST      CAN_MO_MOSTAT_TXRQ_Msk
+
+/* XMC_CAN_MO_SET_STATUS_t - MOCTR 的 SETxxx 位元在高 16 位 */
+#define XMC_CAN_MO_SET_STATUS_MESSAGE_VALID     (CAN_MO_MOSTAT_MSGVAL_Msk << 16)
+#define XMC_CAN_MO_SET_STATUS_TX_REQUEST        (CAN_MO_MOSTAT_TXRQ_Msk << 16)
+#define XMC_CAN_MO_STATUS_TX_REQUEST            CAN_MO_MOSTAT_TXRQ_Msk
+
+typedef enum {
+    XMC_CAN_STATUS_SUCCESS,
+    XMC_CAN_STATUS_ERROR,
+    XMC_CAN_STATUS_BUSY,
+    XMC_CAN_STATUS_MO_NOT_ACCEPTABLE,
+    XMC_CAN_STATUS_MO_DISABLED
+} XMC_CAN_STATUS_t;
+
+typedef enum {
+    XMC_CAN_FRAME_TYPE_STANDARD_11BITS,
+    XMC_CAN_FRAME_TYPE_EXTENDED_29BITS
+} XMC_CAN_FRAME_TYPE_t;
+
+/* 單一訊息物件暫存器 - 與 XMC4800.h CAN_MO_TypeDef 相同排列 (MOSTAT/MOCTR 分開模擬) */
+typedef struct {
+    __IO uint32_t MOFCR;
+    __IO uint32_t MOFGPR;
+    __IO uint32_t MOIPR;
+    __IO uint32_t MOAMR;
+    __IO uint32_t MODATAL;
+    __IO uint32_t MODATAH;
+    __IO uint32_t MOAR;
+    __IO uint32_t MOSTAT;
+} CAN_MO_TypeDef;
+
+/* CAN 全域暫存器中與 pending 路由相關的部分 */
+typedef struct {
+    __IO uint32_t MSPND[8];
+} CAN_GLOBAL_TypeDef;
+
+typedef enum {
+    XMC_CAN_MO_TYPE_RECMSGOBJ,
+    XMC_CAN_MO_TYPE_TRANSMSGOBJ
+} XMC_CAN_MO_TYPE_t;
+
+/* 與 xmc_can.h XMC_CAN_MO_t 相同的軟體結構 */
+typedef struct XMC_CAN_MO {
+    CAN_MO_TypeDef *can_mo_ptr;
+    union {
+        struct {
+            uint32_t can_identifier: 29;
+            uint32_t can_id_mode: 1;
+            uint32_t can_priority: 2;
+        };
+        uint32_t mo_ar;
+    };
+    union {
+        struct {
+            uint32_t can_id_mask: 29;
+            uint32_t can_ide_mask: 1;
+        };
+        uint32_t mo_amr;
+    };
+    uint8_t can_data_length;
+    union {
+        uint8_t can_data_byte[8];
+        uint16_t can_data_word[4];
+        uint32_t can_data[2];
+        uint64_t can_data_long;
+    };
+    XMC_CAN_MO_TYPE_t can_mo_type;
+} XMC_CAN_MO_t;
+
+/* 模擬的 MultiCAN 模組 */
+extern CAN_GLOBAL_TypeDef mock_can_global;
+extern CAN_MO_TypeDef mock_can_mo[256];
+#define CAN     (&mock_can_global)
+
+static inline uint32_t XMC_CAN_MO_GetStatus(const XMC_CAN_MO_t *const can_mo)
+{
+    return can_mo->can_mo_ptr->MOSTAT;
+}
+
+/* MOCTR 寫入的 reset 部分：清除 MOSTAT 對應位元 */
+static inline void XMC_CAN_MO_ResetStatus(const XMC_CAN_MO_t *const can_mo, const uint32_t mask)
+{
+    can_mo->can_mo_ptr->MOSTAT &= ~mask;
+}
+
+static inline void XMC_CAN_MO_SetStatus(const XMC_CAN_MO_t *const can_mo, const uint32_t mask)
+{
+    can_mo->can_mo_ptr->MOSTAT |= mask >> 16;
+}
+
+static inline void XMC_CAN_MO_SetIdentifier(XMC_CAN_MO_t *const can_mo, const uint32_t can_identifier)
+{
+    can_mo->can_mo_ptr->MOAR = (can_mo->can_mo_ptr->MOAR & ~XMC_CAN_MO_MOAR_STDID_Msk) |
+                               ((can_identifier << XMC_CAN_MO_MOAR_STDID_Pos) & XMC_CAN_MO_MOAR_STDID_Msk);
+    can_mo->can_identifier = can_identifier;
+}
+
+static inline void XMC_CAN_MO_EnableSingleTransmitTrial(const XMC_CAN_MO_t *const can_mo)
+{
+    can_mo->can_mo_ptr->MOFCR |= (uint32_t)CAN_MO_MOFCR_STT_Msk;
+}
+
+static inline void XMC_CAN_MO_DisableSingleTransmitTrial(const XMC_CAN_MO_t *const can_mo)
+{
+    can_mo->can_mo_ptr->MOFCR &= ~(uint32_t)CAN_MO_MOFCR_STT_Msk;
+}
+
+/* 與 xmc_can.c XMC_CAN_MO_UpdateData() 相同：寫入 DLC 與資料 */
+static inline XMC_CAN_STATUS_t XMC_CAN_MO_UpdateData(const XMC_CAN_MO_t *const can_mo)
+{
+    CAN_MO_TypeDef *mo = can_mo->can_mo_ptr;
+
+    if (can_mo->can_mo_type != XMC_CAN_MO_TYPE_TRANSMSGOBJ) {
+        return XMC_CAN_STATUS_MO_NOT_ACCEPTABLE;
+    }
+    mo->MOFCR = (mo->MOFCR & ~CAN_MO_MOFCR_DLC_Msk) |
+                (((uint32_t)can_mo->can_data_length << CAN_MO_MOFCR_DLC_Pos) & CAN_MO_MOFCR_DLC_Msk);
+    mo->MODATAL = can_mo->can_data[0];
+    mo->MODATAH = can_mo->can_data[1];
+    mo->MOSTAT |= CAN_MO_MOSTAT_NEWDAT_Msk | CAN_MO_MOSTAT_MSGVAL_Msk;
+
+    return XMC_CAN_STATUS_SUCCESS;
+}
+
+/* 與 xmc_can.c XMC_CAN_MO_Receive() 相同的讀取流程 (只支援標準 11-bit 訊框) */
+static inline XMC_CAN_STATUS_t XMC_CAN_MO_Receive(XMC_CAN_MO_t *can_mo)
+{
+    CAN_MO_TypeDef *mo = can_mo->can_mo_ptr;
+
+    if (mo->MOSTAT & CAN_MO_MOSTAT_DIR_Msk) {
+        return XMC_CAN_STATUS_MO_NOT_ACCEPTABLE;
+    }
+    if (mo->MOSTAT & CAN_MO_MOSTAT_RXUPD_Msk) {
+        return XMC_CAN_STATUS_BUSY;
+    }
+    do {
+        mo->MOSTAT &= ~CAN_MO_MOSTAT_NEWDAT_Msk;
+        can_mo->can_id_mode = XMC_CAN_FRAME_TYPE_STANDARD_11BITS;
+        can_mo->can_identifier = (mo->MOAR & XMC_CAN_MO_MOAR_STDID_Msk) >> XMC_CAN_MO_MOAR_STDID_Pos;
+        can_mo->can_data_length = (uint8_t)((mo->MOFCR & CAN_MO_MOFCR_DLC_Msk) >> CAN_MO_MOFCR_DLC_Pos);
+        can_mo->can_data[0] = mo->MODATAL;
+        can_mo->can_data[1] = mo->MODATAH;
+    } while ((mo->MOSTAT & CAN_MO_MOSTAT_RXUPD_Msk) && (mo->MOSTAT & CAN_MO_MOSTAT_NEWDAT_Msk));
+    can_mo->can_mo_type = XMC_CAN_MO_TYPE_RECMSGOBJ;
+
+    return XMC_CAN_STATUS_SUCCESS;
+}
+
+/* 對應 XMC_CAN_MO_Config() 的 MPN 設定：MPN = MO 編號 */
+static inline void mock_can_mo_init(XMC_CAN_MO_t *can_mo, uint8_t number, XMC_CAN_MO_TYPE_t type)
+{
+    memset(can_mo, 0, sizeof(*can_mo));
+    can_mo->can_mo_ptr = &mock_can_mo[number];
+    can_mo->can_mo_type = type;
+    can_mo->can_mo_ptr->MOIPR = (uint32_t)number << CAN_MO_MOIPR_MPN_Pos;
+    can_mo->can_mo_ptr->MOSTAT = CAN_MO_MOSTAT_MSGVAL_Msk;
+}
+
+/* 模擬一個 RX/TX 完成事件 */
+static inline void mock_can_mo_event(const XMC_CAN_MO_t *can_mo, bool isRx)
+{
+    uint32_t mpn = (can_mo->can_mo_ptr->MOIPR & CAN_MO_MOIPR_MPN_Msk) >> CAN_MO_MOIPR_MPN_Pos;
+
+    can_mo->can_mo_ptr->MOSTAT |= isRx ? (CAN_MO_MOSTAT_RXPND_Msk | CAN_MO_MOSTAT_NEWDAT_Msk)
+                                       : CAN_MO_MOSTAT_TXPND_Msk;
+    mock_can_global.MSPND[mpn / 32U] |= 1UL << (mpn % 32U);
+}
+
+/* 模擬一個標準訊框寫入 MO：NEWDAT 未被讀取前再次寫入會設定 MSGLST */
+static inline void mock_can_mo_store(uint8_t number, uint16_t ident, uint8_t dlc,
+                                     uint32_t dataLow, uint32_t dataHigh)
+{
+    CAN_MO_TypeDef *mo = &mock_can_mo[number];
+    uint32_t mpn = (mo->MOIPR & CAN_MO_MOIPR_MPN_Msk) >> CAN_MO_MOIPR_MPN_Pos;
+
+    if (mo->MOSTAT & CAN_MO_MOSTAT_NEWDAT_Msk) {
+        mo->MOSTAT |= CAN_MO_MOSTAT_MSGLST_Msk;
+    }
+    mo->MOAR = ((uint32_t)ident << XMC_CAN_MO_MOAR_STDID_Pos) & XMC_CAN_MO_MOAR_STDID_Msk;
+    mo->MOFCR = (mo->MOFCR & ~CAN_MO_MOFCR_DLC_Msk) | ((uint32_t)dlc << CAN_MO_MOFCR_DLC_Pos);
+    mo->MODATAL = dataLow;
+    mo->MODATAH = dataHigh;
+    mo->MOSTAT |= CAN_MO_MOSTAT_NEWDAT_Msk | CAN_MO_MOSTAT_RXPND_Msk;
+    mock_can_global.MSPND[mpn / 32U] |= 1UL << (mpn % 32U);
+}
+
+/* 模擬 RX FIFO：基底物件接受訊框，寫入 CUR 指向的 slave 後 CUR 前進 (TOP 之後回到 BOT) */
+static inline void mock_can_rxfifo_store(uint8_t baseNumber, uint16_t ident, uint8_t dlc,
+                                         uint32_t dataLow, uint32_t dataHigh)
+{
+    CAN_MO_TypeDef *base = &mock_can_mo[baseNumber];
+    uint32_t fgpr = base->MOFGPR;
+    uint8_t bot = (uint8_t)((fgpr & CAN_MO_MOFGPR_BOT_Msk) >> CAN_MO_MOFGPR_BOT_Pos);
+    uint8_t top = (uint8_t)((fgpr & CAN_MO_MOFGPR_TOP_Msk) >> CAN_MO_MOFGPR_TOP_Pos);
+    uint8_t cur = (uint8_t)((fgpr & CAN_MO_MOFGPR_CUR_Msk) >> CAN_MO_MOFGPR_CUR_Pos);
+
+    mock_can_mo_store(cur, ident, dlc, dataLow, dataHigh);
+    cur = (cur == top) ? bot : (uint8_t)(cur + 1U);
+    base->MOFGPR = (fgpr & ~CAN_MO_MOFGPR_CUR_Msk) | ((uint32_t)cur << CAN_MO_MOFGPR_CUR_Pos);
+}
+
+/* 模擬 TX FIFO：CUR 指向的 slave 有 TXRQ 時送出，設定 TXPND 後 CUR 前進 */
+static inline bool mock_can_txfifo_ready(uint8_t baseNumber)
+{
+    uint32_t cur = (mock_can_mo[baseNumber].MOFGPR & CAN_MO_MOFGPR_CUR_Msk) >> CAN_MO_MOFGPR_CUR_Pos;
+    return (mock_can_mo[cur].MOSTAT & CAN_MO_MOSTAT_TXRQ_Msk) != 0U;
+}
+
+static inline bool mock_can_txfifo_complete(uint8_t baseNumber, uint16_t *ident, uint8_t *dlc, uint32_t *dataLow)
+{
+    CAN_MO_TypeDef *base = &mock_can_mo[baseNumber];
+    uint32_t fgpr = base->MOFGPR;
+    uint8_t bot = (uint8_t)((fgpr & CAN_MO_MOFGPR_BOT_Msk) >> CAN_MO_MOFGPR_BOT_Pos);
+    uint8_t top = (uint8_t)((fgpr & CAN_MO_MOFGPR_TOP_Msk) >> CAN_MO_MOFGPR_TOP_Pos);
+    uint8_t cur = (uint8_t)((fgpr & CAN_MO_MOFGPR_CUR_Msk) >> CAN_MO_MOFGPR_CUR_Pos);
+    CAN_MO_TypeDef *mo = &mock_can_mo[cur];
+    uint32_t mpn = (mo->MOIPR & CAN_MO_MOIPR_MPN_Msk) >> CAN_MO_MOIPR_MPN_Pos;
+
+    if ((mo->MOSTAT & CAN_MO_MOSTAT_TXRQ_Msk) == 0U) {
+        return false;
+    }
+    *ident = (uint16_t)((mo->MOAR & XMC_CAN_MO_MOAR_STDID_Msk) >> XMC_CAN_MO_MOAR_STDID_Pos);
+    *dlc = (uint8_t)((mo->MOFCR & CAN_MO_MOFCR_DLC_Msk) >> CAN_MO_MOFCR_DLC_Pos);
+    *dataLow = mo->MODATAL;
+
+    mo->MOSTAT = (mo->MOSTAT & ~(CAN_MO_MOSTAT_TXRQ_Msk | CAN_MO_MOSTAT_NEWDAT_Msk)) | CAN_MO_MOSTAT_TXPND_Msk;
+    mock_can_global.MSPND[mpn / 32U] |= 1UL << (mpn % 32U);
+    cur = (cur == top) ? bot : (uint8_t)(cur + 1U);
+    base->MOFGPR = (fgpr & ~CAN_MO_MOFGPR_CUR_Msk) | ((uint32_t)cur << CAN_MO_MOFGPR_CUR_Pos);
+
+    return true;
+}
+
+/* CUR 的訊框仲裁失敗或發生匯流排錯誤：STT=0 時 TXRQ 保留，硬體重送；
+ * STT=1 時 TXRQ 在開始傳送時已清除，訊框放棄 (沒有 TXPND)，CUR 前進到下一個 slave */
+static inline bool mock_can_txfifo_lost(uint8_t baseNumber)
+{
+    CAN_MO_TypeDef *base = &mock_can_mo[baseNumber];
+    uint32_t fgpr = base->MOFGPR;
+    uint8_t bot = (uint8_t)((fgpr & CAN_MO_MOFGPR_BOT_Msk) >> CAN_MO_MOFGPR_BOT_Pos);
+    uint8_t top = (uint8_t)((fgpr & CAN_MO_MOFGPR_TOP_Msk) >> CAN_MO_MOFGPR_TOP_Pos);
+    uint8_t cur = (uint8_t)((fgpr & CAN_MO_MOFGPR_CUR_Msk) >> CAN_MO_MOFGPR_CUR_Pos);
+    CAN_MO_TypeDef *mo = &mock_can_mo[cur];
+
+    if ((mo->MOSTAT & CAN_MO_MOSTAT_TXRQ_Msk) == 0U) {
+        return false;
+    }
+    if ((mo->MOFCR & CAN_MO_MOFCR_STT_Msk) != 0U) {
+        mo->MOSTAT &= ~CAN_MO_MOSTAT_TXRQ_Msk;
+        cur = (cur == top) ? bot : (uint8_t)(cur + 1U);
+        base->MOFGPR = (fgpr & ~CAN_MO_MOFGPR_CUR_Msk) | ((uint32_t)cur << CAN_MO_MOFGPR_CUR_Pos);
+    }
+    return true;
+}
+
+/* 清空所有模擬暫存器 */
+static inline void mock_can_reset(void)
+{
+    memset((void *)&mock_can_global, 0, sizeof(mock_can_global));
+    memset((void *)mock_can_mo, 0, sizeof(mock_can_mo));
+}
+
+#endif /* XMC_CAN_MOCK_H */
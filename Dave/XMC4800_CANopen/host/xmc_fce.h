@@ -0,0 +1,136 @@
+/**
+ * Host model of xmc_fce.h (CRC16 kernel) for building port/CO_crc16.c on Linux
+ *
+ * @file xmc_fce.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * host/ 在 include 路徑最前面，port/ 模組的 #include "xmc_fce.h" 改用這個模型。
+ * 只提供 CO_crc16.c 使用的 API，以逐位元計算模擬 FCE_KE2 (多項式 0x1021)：
+ *  - CFG 重置值 REFIN | REFOUT | XSEL (0x700)，與硬體相同，沒有 XMC_FCE_Init() 時結果錯誤
+ *  - XMC_FCE_CalculateCRC16Ex() 與 XMClib 相同，以 16 bit 讀取資料後 __REV16() 寫入 IR，結果讀 CRC 暫存器
+ * kernel 由使用的程式定義：XMC_FCE_Kernel_t host_fce_ke2 = { .CFG = 0x700U }；irWrites 統計 IR 寫入次數。
+ */
+
+#ifndef XMC_FCE_H
+#define XMC_FCE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define FCE_KE_CFG_REFIN_Msk        (0x100UL)
+#define FCE_KE_CFG_REFOUT_Msk       (0x200UL)
+#define FCE_KE_CFG_XSEL_Msk         (0x400UL)
+
+typedef enum {
+    XMC_FCE_STATUS_OK = 0U,
+    XMC_FCE_STATUS_BUSY,
+    XMC_FCE_STATUS_ERROR
+} XMC_FCE_STATUS_t;
+
+/* CRC kernel 暫存器 (XMC4800.h FCE_KE_TypeDef 的欄位) 與模型狀態 */
+typedef struct {
+    uint32_t                IR;
+    uint32_t                RES;
+    uint32_t                CFG;
+    uint32_t                STS;
+    uint32_t                LENGTH;
+    uint32_t                CHECK;
+    uint32_t                CRC;
+    uint32_t                CTR;
+    bool                    enabled;
+    uint32_t                irWrites;
+} XMC_FCE_Kernel_t;
+
+typedef struct {
+    union {
+        uint32_t regval;
+    };
+} XMC_FCE_CONFIG_t;
+
+typedef struct {
+    XMC_FCE_Kernel_t       *kernel_ptr;
+    XMC_FCE_CONFIG_t        fce_cfg_update;
+    uint32_t                seedvalue;
+} XMC_FCE_t;
+
+/* 模擬的 CRC16 kernel */
+extern XMC_FCE_Kernel_t host_fce_ke2;
+#define XMC_FCE_CRC16               (&host_fce_ke2)
+
+static inline void XMC_FCE_Enable(void)
+{
+    host_fce_ke2.enabled = true;
+}
+
+static inline XMC_FCE_STATUS_t XMC_FCE_Init(const XMC_FCE_t *const engine)
+{
+    engine->kernel_ptr->CFG = engine->fce_cfg_update.regval;
+    engine->kernel_ptr->CRC = engine->seedvalue;
+    return XMC_FCE_STATUS_OK;
+}
+
+static inline void XMC_FCE_InitializeSeedValue(const XMC_FCE_t *const engine, uint32_t seedvalue)
+{
+    engine->kernel_ptr->CRC = seedvalue;
+}
+
+/* IR 寫入：低 16 bit 依 CFG 更新 CRC 與 RES */
+static inline void host_fce_write(XMC_FCE_Kernel_t *kernel, uint32_t value)
+{
+    uint16_t word = (uint16_t)value;
+    uint16_t crc = (uint16_t)kernel->CRC;
+
+    if ((kernel->CFG & FCE_KE_CFG_REFIN_Msk) != 0U) {
+        uint16_t r = 0;
+        for (uint8_t b = 0; b < 16U; b++) {
+            /* 每個 byte 各自反射 */
+            if ((word & (1U << b)) != 0U) {
+                r |= (uint16_t)(1U << ((b & 8U) | (7U - (b & 7U))));
+            }
+        }
+        word = r;
+    }
+    for (uint8_t b = 0; b < 16U; b++) {
+        bool msb = ((crc ^ word) & 0x8000U) != 0U;
+        crc = (uint16_t)(crc << 1);
+        word = (uint16_t)(word << 1);
+        if (msb) {
+            crc ^= 0x1021U;
+        }
+    }
+    kernel->CRC = crc;
+    uint16_t res = crc;
+    if ((kernel->CFG & FCE_KE_CFG_REFOUT_Msk) != 0U) {
+        res = 0;
+        for (uint8_t b = 0; b < 16U; b++) {
+            if ((crc & (1U << b)) != 0U) {
+                res |= (uint16_t)(1U << (15U - b));
+            }
+        }
+    }
+    if ((kernel->CFG & FCE_KE_CFG_XSEL_Msk) != 0U) {
+        res ^= 0xFFFFU;
+    }
+    kernel->RES = res;
+    kernel->IR = value;
+    kernel->irWrites++;
+}
+
+static inline XMC_FCE_STATUS_t XMC_FCE_CalculateCRC16Ex(const XMC_FCE_t *const engine, const uint8_t *data,
+                                                         uint32_t length, uint16_t *const result)
+{
+    if (!engine->kernel_ptr->enabled || length == 0U || (length & 0x1U) != 0U) {
+        return XMC_FCE_STATUS_ERROR;
+    }
+    for (uint32_t i = 0; i < length; i += 2U) {
+        uint16_t w;
+        memcpy(&w, &data[i], sizeof(w));
+        host_fce_write(engine->kernel_ptr, __builtin_bswap16(w));
+    }
+    *result = (uint16_t)engine->kernel_ptr->CRC;
+    return XMC_FCE_STATUS_OK;
+}
+
+#endif /* XMC_FCE_H */
@@ -8,6 +8,11 @@
 #include "DAVE.h"                   // DAVE 所有硬體抽象層 (CAN_NODE, DIGITAL_IO, UART, TIMER)
 #include "CANopenNode/CANopen.h"     // CANopenNode 主頭檔 (正確路徑)
 #include "application/OD.h"          // 物件字典定義
+#include "CO_sched.h"                // 事件驅動 CO_process() 排程
+#include "CO_rx_ring.h"              // RX 環形緩衝區容量 (統計輸出)
+#include "CO_prof_od.h"              // 處理函數週期量測 (OD 0x2100 ~ 0x2107)
+#include "CO_flash_xmc4.h"           // 參數 flash (OD 0x2200，SDO 區塊傳輸)
+#include "CO_crc16.h"                // SDO 區塊 / 儲存 CRC (slice-by-8 或 FCE)
 #include <stdio.h>
 #include <stdarg.h>
 #include <stdint.h>
@@ -86,6 +91,13 @@ static uint32_t             emergency_count = 0;
 static uint32_t             heartbeat_count = 0;
 static bool                 canopen_ready = false;
 
+/* CO_process() 排程 - 接收回呼或 timerNext_us 到期時執行，其餘時間 WFI */
+static CO_sched_t           co_sched;
+
+/* 參數 flash - OD 0x2200 (DOMAIN) 經 SDO 下載時直接寫入 sector 8 */
+static CO_flashStream_t     param_flash;
+static bool                 param_flash_busy;   /* 參數 flash 還有待執行的命令 */
+
 
 static void CO_errExit(char* msg);
 static void app_updateLEDs(void);
@@ -94,6 +106,7 @@ static void send_test_can_message(void);
 /* 🎯 專業 CANopenNode 函數 - 參考 CanOpenSTM32 模式 */
 static int canopen_app_init(CANopenNodeXMC4800* canopenXMC4800);
 static int canopen_app_resetCommunication(void);
+static void canopen_app_sleep(void);
 
 /* **📋 Debug_Printf 函數聲明 - 使用 CO_driver_XMC4800.c 中的實現** */
 extern void Debug_Printf_Raw(const char* format, ...);     /* 原始輸出函數 */
@@ -110,6 +123,27 @@ extern void Debug_ProcessISRBuffer(void);
 extern volatile uint32_t g_interrupt_rx_count;
 extern volatile uint32_t g_interrupt_tx_count; 
 extern volatile uint32_t g_interrupt_total_count;
+#if CO_CAN_RX_FIFO_ENABLE
+extern volatile uint32_t g_rx_fifo_frame_count;
+extern volatile uint32_t g_rx_fifo_overrun_count;
+#endif
+extern volatile uint32_t g_tx_send_cycles_max;
+extern volatile uint32_t g_tx_isr_cycles_max;
+extern volatile uint32_t g_rx_frame_cycles_max;
+extern volatile uint32_t g_rx_ring_max_fill;
+extern volatile uint32_t g_rx_ring_drop_count;
+extern volatile uint32_t g_rx_batch_frames_max;
+extern volatile uint32_t g_rx_batch_cycles_max;
+extern volatile uint32_t g_rx_unmatched_count;
+#if CO_CAN_TX_FIFO_ENABLE
+extern volatile uint32_t g_tx_fifo_frame_count;
+extern volatile uint32_t g_tx_queue_max_depth;
+#endif
+extern volatile uint32_t g_debug_uart_dropped_bytes;
+extern volatile uint32_t g_debug_uart_max_fill;
+extern volatile uint32_t g_sync_tpdo_cycles_min;
+extern volatile uint32_t g_sync_tpdo_cycles_max;
+extern volatile uint32_t g_sync_tpdo_count;
 
 /* CANopen 專業功能函數 */
 static void process_canopen_communication(void);
@@ -145,6 +179,7 @@ int main(void)
         while(1U)
         {
             /* Error: DAVE initialization failed */
+            Debug_ProcessISRBuffer();   /* 繼續送出除錯 UART 緩衝區 */
         }
     }
 
@@ -163,16 +198,22 @@ int main(void)
     Debug_Printf("   - Baudrate: 10k-1000k bps\r\n");
     
     Debug_Printf("Starting CANopen init...\r\n");
+
+    /* CRC16 (CO_CRC16_FCE 時啟用 FCE) - 在 SDO 伺服器使用 crc16_ccitt() 之前 */
+    CO_crc16_init();
     
     // ✅ 專業 CANopen 初始化 (OD.h 已手動修正完成)
     Debug_Printf("Calling canopen_app_init...\r\n");
+    uint32_t rtMask = canopen_rt_suspend();     /* CO_new() 之後計時器即觸發 PendSV，初始化完成前不得執行 */
     int init_result = canopen_app_init(&canopenNodeXMC4800);
+    canopen_rt_resume(rtMask);
     Debug_Printf("canopen_app_init returned: %d\r\n", init_result);
     
     if (init_result != 0) {
         Debug_Printf("ERROR: CANopen init failed: %d\r\n", init_result);
         while(1) {
             /* 停留在錯誤狀態 */
+            Debug_ProcessISRBuffer();   /* 繼續送出除錯 UART 緩衝區 */
         }
     }
 
@@ -195,6 +236,9 @@ int main(void)
         
         /* 3. 處理除錯緩衝區 */
         Debug_ProcessISRBuffer();
+        
+        /* 4. 沒有待處理工作時睡眠，由 CAN/Timer/UART 中斷喚醒 */
+        canopen_app_sleep();
     }
 }
 
@@ -507,6 +551,31 @@ static void report_canopen_statistics(void)
     Debug_Printf("\r\n中斷統計:\r\n");
     Debug_Printf("總中斷: %lu, RX中斷: %lu, TX中斷: %lu\r\n",
                 g_interrupt_total_count, g_interrupt_rx_count, g_interrupt_tx_count);
+#if CO_CAN_RX_FIFO_ENABLE
+    Debug_Printf("RX FIFO 訊框: %lu, Overrun: %lu\r\n",
+                g_rx_fifo_frame_count, g_rx_fifo_overrun_count);
+#endif
+    Debug_Printf("TX 最長週期: CO_CANsend %lu, ISR %lu\r\n",
+                g_tx_send_cycles_max, g_tx_isr_cycles_max);
+    Debug_Printf("RX 最長週期: ISR 讀取 %lu, 分派批次 %lu (%lu 訊框)\r\n",
+                g_rx_frame_cycles_max, g_rx_batch_cycles_max, g_rx_batch_frames_max);
+    Debug_Printf("RX 環形緩衝區最高使用量: %lu/%u, 丟棄: %lu, 無匹配: %lu\r\n",
+                g_rx_ring_max_fill, CO_CAN_RX_RING_SIZE, g_rx_ring_drop_count, g_rx_unmatched_count);
+#if CO_CAN_TX_FIFO_ENABLE
+    Debug_Printf("TX FIFO 訊框: %lu, 佇列最大深度: %lu\r\n",
+                g_tx_fifo_frame_count, g_tx_queue_max_depth);
+#endif
+    Debug_Printf("鎖最長持有週期: CAN_SEND %lu, EMCY %lu, OD %lu\r\n",
+                CO_lockClass[CO_LOCK_CLASS_CAN_SEND].holdCyclesMax,
+                CO_lockClass[CO_LOCK_CLASS_EMCY].holdCyclesMax,
+                CO_lockClass[CO_LOCK_CLASS_OD].holdCyclesMax);
+    if (g_sync_tpdo_count > 0U) {
+        Debug_Printf("SYNC->TPDO 週期: min %lu, max %lu, 抖動 %lu (%lu 次)\r\n",
+                    g_sync_tpdo_cycles_min, g_sync_tpdo_cycles_max,
+                    g_sync_tpdo_cycles_max - g_sync_tpdo_cycles_min, g_sync_tpdo_count);
+    }
+    Debug_Printf("除錯 UART 最高使用量: %lu bytes, 丟棄: %lu bytes\r\n",
+                g_debug_uart_max_fill, g_debug_uart_dropped_bytes);
     
     if (CO != NULL && CO->em != NULL) {
         uint8_t err_reg = *(CO->em->errorRegister);
@@ -645,6 +714,13 @@ static int canopen_app_init(CANopenNodeXMC4800* canopenXMC4800)
     /* LSS 初始化 - 暫時跳過，專注於核心功能 */
     Debug_Printf("⚠️  LSS init skipped - focusing on core CANopen functionality\r\n");
 
+    /* **🎯 OD 直接索引查表** - host/od_gen 產生於 OD.c 的常數表 (flash)，不佔 RAM */
+    if (OD->lookup != NULL) {
+        Debug_Printf("SUCCESS: OD lookup table in flash, %u pages\r\n", OD_lookupPages(OD));
+    } else {
+        Debug_Printf("⚠️  OD lookup table missing, using binary search\r\n");
+    }
+
     /* CANopen 主要初始化 - 修正為 CANopenNode v4.0 正確 API */
     err = CO_CANopenInit(CO,                        /* CANopen 物件 */
                          NULL,                      /* alternate NMT */
@@ -668,6 +744,26 @@ static int canopen_app_init(CANopenNodeXMC4800* canopenXMC4800)
         return 3;
     }
 
+    /* 接收中斷回呼 - 有 NMT/HB/EMCY/SDO 訊框時立即喚醒主循環執行 CO_process() */
+    CO_sched_init(&co_sched, CO_timer1ms);
+#if ((CO_CONFIG_NMT) & CO_CONFIG_FLAG_CALLBACK_PRE)
+    CO_NMT_initCallbackPre(CO->NMT, &co_sched, CO_sched_signal);
+#endif
+#if ((CO_CONFIG_EM) & CO_CONFIG_FLAG_CALLBACK_PRE)
+    CO_EM_initCallbackPre(CO->em, &co_sched, CO_sched_signal);
+#endif
+#if ((CO_CONFIG_HB_CONS) & CO_CONFIG_HB_CONS_ENABLE) && ((CO_CONFIG_HB_CONS) & CO_CONFIG_FLAG_CALLBACK_PRE)
+    CO_HBconsumer_initCallbackPre(CO->HBcons, &co_sched, CO_sched_signal);
+#endif
+#if ((CO_CONFIG_TIME) & CO_CONFIG_TIME_ENABLE) && ((CO_CONFIG_TIME) & CO_CONFIG_FLAG_CALLBACK_PRE)
+    CO_TIME_initCallbackPre(CO->TIME, &co_sched, CO_sched_signal);
+#endif
+#if ((CO_CONFIG_SDO_SRV) & CO_CONFIG_FLAG_CALLBACK_PRE)
+    for (uint16_t i = 0; i < OD_CNT_SDO_SRV; i++) {
+        CO_SDOserver_initCallbackPre(&CO->SDOserver[i], &co_sched, CO_sched_signal);
+    }
+#endif
+
     /* PDO 初始化 - 使用標準模式 */
     err = CO_CANopenInitPDO(CO, CO->em, OD, canopenXMC4800->activeNodeID, &errInfo);
     if (err != CO_ERROR_NO && err != CO_ERROR_NODE_ID_UNCONFIGURED_LSS) {
@@ -679,6 +775,23 @@ static int canopen_app_init(CANopenNodeXMC4800* canopenXMC4800)
         return 4;
     }
 
+    /* **⏱️ RT slot：SYNC/RPDO/TPDO 改在 PendSV 處理，CAN 中斷優先權高於 RT slot** */
+    canopen_rt_setup(CO);
+    Debug_Printf("✅ RT slot: CAN IRQ prio %u, PendSV prio %u\r\n", CO_CAN_IRQ_PRIORITY, CO_RT_PRIORITY);
+
+    /* **⏱️ 處理函數週期量測：以 SDO 讀取 0x2100 ~ 0x2107** */
+    Debug_Printf("✅ Profile: %lu OD records\r\n", (unsigned long)CO_prof_initOD(OD));
+
+    /* **💾 參數 flash：OD 0x2200 以 SDO 區塊傳輸下載 / 上傳，資料直接串流到 flash** */
+    CO_flashStream_init(&param_flash, &CO_flashOps_XMC4, CO_FLASH_XMC4_PARAM_BASE, CO_FLASH_XMC4_PARAM_SIZE,
+                        CO_FLASH_XMC4_PARAM_SECTOR);
+    if (CO_flashStream_initOD(&param_flash, OD_ENTRY_H2200) == ODR_OK) {
+        uint32_t length;
+        (void)CO_flashStream_data(&param_flash, &length);
+        Debug_Printf("✅ Parameter flash: %lu / %lu bytes\r\n", (unsigned long)length,
+                     (unsigned long)CO_flashStream_capacity(&param_flash));
+    }
+
     /* 🎯 移除 XMC4800 SYSTIMER 管理 - 改用 DAVE UI TimerHandler() */
     /* DAVE UI TimerHandler() 已經處理 CANopen 1ms 定時功能 */
     Debug_Printf("✅ Using DAVE UI TimerHandler() for CANopen timing\r\n");
@@ -716,12 +829,17 @@ static int canopen_app_resetCommunication(void)
     /* 設置配置模式 */
     CO_CANsetConfigurationMode((void*)&canopenNodeXMC4800);
     
+    /* 刪除與重新初始化期間 PendSV (canopen_rt_process(CO)) 不得執行 */
+    uint32_t rtMask = canopen_rt_suspend();
+
     /* 刪除 CANopen 物件 */
     CO_delete(CO);
     CO = NULL;
     
     /* 重新初始化 */
-    return canopen_app_init(&canopenNodeXMC4800);
+    int ret = canopen_app_init(&canopenNodeXMC4800);
+    canopen_rt_resume(rtMask);
+    return ret;
 }
 
 /**
@@ -730,19 +848,16 @@ static int canopen_app_resetCommunication(void)
  */
 static void canopen_app_process(void)
 {
-    static uint32_t time_old = 0;
-    static uint32_t time_current = 0;
-    
-    /* 獲取時間差異 */
-    time_current = CO_timer1ms;
+    uint32_t timeDifference_us;
     
-    if ((time_current - time_old) >= 10) {  /* **🎯 修正：至少間隔 10ms，避免過度頻繁處理** */
+    /* **🎯 事件驅動：接收回呼或 timerNext_us 到期才執行，不再固定 10ms 週期** */
+    if (CO != NULL && CO_sched_due(&co_sched, CO_timer1ms, &timeDifference_us)) {
         /* CANopen 主處理 - 參考 STM32 模式 */
         CO_NMT_reset_cmd_t reset_status;
-        uint32_t timeDifference_us = (time_current - time_old) * 1000;
-        time_old = time_current;
         
-        reset_status = CO_process(CO, false, timeDifference_us, NULL);
+        CO_PROF_BEGIN(CO_PROF_PROCESS);
+        reset_status = CO_process(CO, false, timeDifference_us, &co_sched.timerNext_us);
+        CO_PROF_END(CO_PROF_PROCESS);
         
         /* **🎯 減少額外的 NMT 處理，避免重複發送** */
         /* CO_process 已經包含 NMT 處理，不需要額外調用 CO_NMT_process */
@@ -788,13 +903,21 @@ static void canopen_app_process(void)
             /* 2. 設置 CAN 配置模式 */
             CO_CANsetConfigurationMode((void*)&canopenNodeXMC4800);
             
-            /* 3. 刪除 CANopen 物件 */
+            /* 3. 寫完參數 flash 佇列 (canopen_app_init() 重新初始化串流) */
+            while (CO_flashStream_process(&param_flash)) {
+            }
+
+            /* 4. 遮罩 RT slot：PendSV 以 CO 執行，刪除到重新初始化完成之間不得進入 */
+            uint32_t rtMask = canopen_rt_suspend();
+
+            /* 5. 刪除 CANopen 物件 */
             CO_delete(CO);
             CO = NULL;
             
-            /* 4. 重新初始化 */
+            /* 6. 重新初始化，清除暫停期間的 PendSV 後恢復 RT slot */
             Debug_Printf("Reinitializing CANopen after communication reset...\r\n");
             canopen_app_init(&canopenNodeXMC4800);
+            canopen_rt_resume(rtMask);
             
         } else if (reset_status == CO_RESET_APP) {
             Debug_Printf("🔄 CANopen Application Reset requested\r\n");
@@ -802,6 +925,26 @@ static void canopen_app_process(void)
             NVIC_SystemReset();
         }
     }
+
+    /* **💾 參數 flash：每次一個擦除 / 寫頁命令，在 CO_LOCK_OD 之外執行，中斷與 RT slot 照常進入** */
+    param_flash_busy = CO_flashStream_process(&param_flash);
+}
+
+/**
+ * @brief 主循環睡眠 - 沒有待處理的 CANopen 工作時執行 WFI
+ *
+ * 在關閉中斷的情況下檢查並進入 WFI：檢查之後才到達的中斷仍會喚醒 CPU，
+ * 開啟中斷後立即執行其 ISR，不會遺失回呼。1 ms 計時器中斷保證至少每 1 ms 醒來一次。
+ */
+static void canopen_app_sleep(void)
+{
+#if CO_SCHED_WFI_ENABLE
+    __disable_irq();
+    if (CO == NULL || (CO_sched_idle(&co_sched) && !param_flash_busy)) {
+        __WFI();
+    }
+    __enable_irq();
+#endif
 }
 
 /******************************************************************************/
@@ -825,6 +968,17 @@ void TimerHandler(void)
     TIMER_ClearEvent(&TIMER_0);
 }
 
+/**
+ * @brief PendSV 中斷處理函數 - CANopen RT slot
+ * 
+ * ⏱️ 功能: RX 訊框分派與 SYNC/RPDO/TPDO 處理，由 TimerHandler()、CAN RX 中斷與 SYNC 接收觸發
+ * 📌 優先權由 canopen_rt_setup() 設定為 CO_RT_PRIORITY (低於 CAN 中斷)
+ */
+void PendSV_Handler(void)
+{
+    canopen_rt_process(CO);
+}
+
 /**
  * @brief DAVE UI CAN 中斷處理函數 - 專業中斷管理
  * 
@@ -0,0 +1,56 @@
+/**
+ * Latched CAN error events for CO_EM_process()
+ *
+ * @file CO_can_err.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * CO_process() 先調用 CO_CANmodule_process()，之後才由 CO_EM_process() 比較 CANerrorStatus 的變化。
+ * RX/TX 溢位與 TPDO 逾時是單次事件 (ISR、RT slot 或 CO_CANsend() 設定)，
+ * CO_CANmodule_process() 若直接清除 CANerrorStatus，事件在 EM 看到之前就消失。
+ * 事件同時記在 CANerrorEvents，CO_CANmodule_process() 以上次之後發生的事件重建這些位元：
+ *  - 事件至少經過一次完整的 CO_CANmodule_process() -> CO_EM_process()，EM 發出 emergency
+ *  - 之後沒有新事件時位元清除，EM 發出 error reset
+ * 其他位元 (warning / passive / bus off) 由驅動依節點狀態設定，不經過此處。
+ */
+
+#ifndef CO_CAN_ERR_H
+#define CO_CAN_ERR_H
+
+#include "CO_driver_target.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 以事件方式回報的 CANerrorStatus 位元 */
+#define CO_CAN_ERR_EVENTS               (CO_CAN_ERRTX_OVERFLOW | CO_CAN_ERRTX_PDO_LATE | CO_CAN_ERRRX_OVERFLOW)
+
+/**
+ * @brief 記錄事件 - 在 CO_LOCK_CAN_SEND 中或 CAN ISR 中調用
+ * @param CANmodule CAN 模組
+ * @param events CO_CAN_ERR_EVENTS 中的位元
+ */
+static inline void CO_CANerr_event(CO_CANmodule_t *CANmodule, uint16_t events)
+{
+    CANmodule->CANerrorEvents |= events;
+    CANmodule->CANerrorStatus |= events;
+}
+
+/**
+ * @brief 以上次調用之後的事件重建事件位元 - 在 CO_CANmodule_process() 中以 CO_LOCK_CAN_SEND 調用
+ * @param CANmodule CAN 模組
+ */
+static inline void CO_CANerr_process(CO_CANmodule_t *CANmodule)
+{
+    uint16_t events = CANmodule->CANerrorEvents;
+
+    CANmodule->CANerrorEvents = 0U;
+    CANmodule->CANerrorStatus = (uint16_t)((CANmodule->CANerrorStatus & ~CO_CAN_ERR_EVENTS) | events);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_CAN_ERR_H */
@@ -0,0 +1,79 @@
+/**
+ * CRC-16 CCITT with slice-by-N tables or the XMC4800 FCE
+ *
+ * @file CO_crc16.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * crc16-ccitt.c 每個 byte 查一次表，下一個 byte 的索引依賴前一次的結果，CPU 無法重疊執行。
+ * SDO 區塊傳輸 (CO_SDOserver.c、CO_fifo.c) 與儲存區塊的 CRC 都經過 crc16_ccitt()。
+ * CO_CONFIG_CRC16 包含 CO_CONFIG_CRC16_EXTERNAL 時，本模組提供 crc16_ccitt() / crc16_ccitt_single()：
+ *  - CO_CRC16_SLICE 8 (預設)：每次處理 8 byte，8 個 256 項的表彼此獨立 (4 KB flash)
+ *  - CO_CRC16_SLICE 4：每次處理 4 byte (2 KB flash)
+ *  - CO_CRC16_FCE 1：FCE (Flexible CRC Engine) 的 CRC16 kernel (FCE_KE2，多項式 0x1021)，每次寫入 16 bit；
+ *    少於 CO_CRC16_FCE_MIN byte 的區塊仍以查表計算 (暫存器存取的固定成本)
+ * 結果與 crc16-ccitt.c 逐位元相同 (XMODEM：初值由呼叫者提供，不反射、不反相)。
+ * FCE kernel 只有一組 CRC 暫存器：crc16_ccitt() 只能在一個執行緒 (主循環) 中調用，不可在中斷中調用。
+ */
+
+#ifndef CO_CRC16_H
+#define CO_CRC16_H
+
+#include "301/crc16-ccitt.h"
+
+#if ((CO_CONFIG_CRC16)&CO_CONFIG_CRC16_ENABLE) != 0
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 每次處理的 byte 數：4 或 8 */
+#ifndef CO_CRC16_SLICE
+#define CO_CRC16_SLICE                  8U
+#endif
+
+/* 1：crc16_ccitt() 使用 FCE */
+#ifndef CO_CRC16_FCE
+#define CO_CRC16_FCE                    0
+#endif
+
+/* 使用 FCE 的最小區塊長度 */
+#ifndef CO_CRC16_FCE_MIN
+#define CO_CRC16_FCE_MIN                16U
+#endif
+
+/**
+ * @brief 初始化 - CO_CRC16_FCE 時啟用 FCE 並設定 CRC16 kernel，在第一次 crc16_ccitt() 之前調用
+ */
+void CO_crc16_init(void);
+
+/**
+ * @brief slice-by-4 計算
+ * @param block 資料
+ * @param blockLength 長度 (byte)
+ * @param crc 初值 (XMODEM 為 0，分段計算時為前一段的結果)
+ * @return CRC
+ */
+uint16_t CO_crc16_slice4(const uint8_t block[], size_t blockLength, uint16_t crc);
+
+#if CO_CRC16_SLICE >= 8
+/**
+ * @brief slice-by-8 計算，參數同 CO_crc16_slice4()
+ */
+uint16_t CO_crc16_slice8(const uint8_t block[], size_t blockLength, uint16_t crc);
+#endif
+
+#if CO_CRC16_FCE
+/**
+ * @brief FCE 計算，參數同 CO_crc16_slice4()；奇數位址的第一個 byte 與最後的奇數 byte 以查表計算
+ */
+uint16_t CO_crc16_fce(const uint8_t block[], size_t blockLength, uint16_t crc);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* (CO_CONFIG_CRC16) & CO_CONFIG_CRC16_ENABLE */
+
+#endif /* CO_CRC16_H */
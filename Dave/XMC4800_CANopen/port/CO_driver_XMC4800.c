@@ -11,8 +11,21 @@
 #include "CO_driver_target.h"
 #include "301/CO_driver.h"
 #include "CANopen.h"  /* CANopen 主要標頭檔 - 包含 CO_t 定義 */
+#include "CO_rx_dispatch.h"  /* RX 分派索引 - O(1) COB-ID 查表 */
+#include "CO_mo_route.h"     /* MSPND pending 路由 - 只處理觸發的 LMO */
+#include "CO_rx_fifo.h"      /* RX FIFO 模式 - 批次讀出硬體 FIFO */
+#include "CO_rx_mo.h"        /* RX MO 直接讀取 - 兩個 32-bit 字複製 */
+#include "CO_rx_ring.h"      /* RX 環形緩衝區 - ISR 讀出，PendSV 分批分派 */
+#include "CO_tx_fifo.h"      /* TX FIFO 模式 - 連續傳送硬體 FIFO */
+#include "CO_tx_queue.h"     /* TX 優先權佇列 - 依 COB-ID 排序待送訊框 */
+#include "CO_tx_lmo.h"       /* TX LMO 狀態機 - 完成中斷接續傳送 */
+#include "CO_log.h"          /* ISR 延遲紀錄 - 只存格式 ID 與參數 */
+#include "CO_uart_ring.h"    /* 除錯 UART 環形緩衝區 - 輸出不阻塞 */
+#include "CO_rt.h"           /* RT slot - SYNC/RPDO/TPDO 在 PendSV 中處理 */
+#include "CO_can_err.h"      /* 溢位事件保留到 CO_EM_process() */
 #include <stdio.h>
 #include <stdarg.h>
+#include <string.h>
 
 /* XMC4800 specific includes for interrupt handling */
 #include "xmc_can.h"
@@ -77,10 +90,13 @@
 void Debug_Printf_Raw(const char* format, ...);         /* 原始輸出函數 - 外部可見 */
 static void Debug_Printf_Auto(const char* format, ...);  /* 自動分級函數 */
 static void Debug_Printf(const char* format, ...);       /* 主要 Debug_Printf 函數 */
-static void Debug_Printf_ISR(const char* format, ...);   /* 中斷安全版本 */
 void Debug_ProcessISRBuffer(void);                       /* ISR 緩衝區處理函數 - 外部可見 */
-static void CO_CANinterrupt_Rx(CO_CANmodule_t *CANmodule, uint32_t index);
+static void Debug_UART_Kick(void);                       /* 除錯 UART 接續傳送 */
+static uint32_t CO_CANinterrupt_Rx(CO_CANmodule_t *CANmodule, uint32_t index);
 static void CO_CANinterrupt_Tx(CO_CANmodule_t *CANmodule, uint32_t index);
+#if !CO_CAN_TX_FIFO_ENABLE
+static CO_ReturnError_t canopen_tx_lmo_send(CO_CANmodule_t *CANmodule, CO_CANtx_t *buffer);
+#endif
 
 /* **📋 動態 Node ID 管理 - 專業產品設計** */
 static uint8_t canopen_get_node_id(void);
@@ -285,12 +301,80 @@ static void canopen_configure_dynamic_ids(uint8_t node_id)
     Debug_Printf("📋 使用指南: canopen_set_node_id(新ID) 可動態變更\r\n");
 }
 
-/* 中斷除錯緩衝區 - 避免在中斷中阻塞 */
-#define ISR_DEBUG_BUFFER_SIZE 1024
-static volatile char isr_debug_buffer[ISR_DEBUG_BUFFER_SIZE];
-static volatile uint16_t isr_debug_write_index = 0;
-static volatile uint16_t isr_debug_read_index = 0;
-static volatile bool isr_debug_overflow = false;
+/* 中斷除錯紀錄 - ISR 只寫入格式 ID 與參數，由主循環格式化 (CO_log.c)。
+ * CO_log_write() 是單一生產者：每個中斷優先權等級使用自己的緩衝區，
+ * CAN ISR 可搶佔 PendSV (RX 軟體中斷 / RT slot)，兩者不可寫入同一個緩衝區 */
+static CO_logRing_t g_isr_log;      /* CAN ISR (CO_CAN_IRQ_PRIORITY) */
+static CO_logRing_t g_softirq_log;  /* PendSV (CO_RT_PRIORITY) */
+
+/* 中斷安全的除錯輸出 - 格式定義於 CO_log_fmt.h，未使用的參數傳 0。只能在 CAN ISR 中使用 */
+#define Debug_Log_ISR(id, a0, a1, a2, a3) \
+    CO_log_write(&g_isr_log, (id), (uint32_t)(a0), (uint32_t)(a1), (uint32_t)(a2), (uint32_t)(a3))
+
+/* 同上，只能在 PendSV (canopen_rt_process 及其調用的函數) 中使用 */
+#define Debug_Log_SOFTIRQ(id, a0, a1, a2, a3) \
+    CO_log_write(&g_softirq_log, (id), (uint32_t)(a0), (uint32_t)(a1), (uint32_t)(a2), (uint32_t)(a3))
+
+/* 除錯 UART 環形緩衝區 - Debug_Printf_Raw() 寫入，UART TX 中斷送出 */
+static CO_uartRing_t g_debug_uart = { .policy = CO_UART_RING_POLICY };
+static bool g_debug_uart_sending = false;
+
+/* 除錯 UART 統計 - 用於主循環監控（外部可見） */
+volatile uint32_t g_debug_uart_dropped_bytes = 0;
+volatile uint32_t g_debug_uart_max_fill = 0;
+
+/* MSPND pending 路由表 - 由 CO_CANmodule_init() 建立 */
+static CO_MOroute_t g_mo_route;
+
+#if CO_CAN_RX_FIFO_ENABLE
+/* RX FIFO 在路由表中使用的 LMO index (不對應 CAN_NODE_0.lmobj_ptr[]) */
+#define CANOPEN_RX_FIFO_ROUTE_INDEX     0xFEU
+
+/* RX FIFO - 基底 MO + CO_CAN_RX_FIFO_DEPTH 個 slave MO */
+static XMC_CAN_MO_t g_rx_fifo_base;
+static XMC_CAN_MO_t g_rx_fifo_slaves[CO_CAN_RX_FIFO_DEPTH];
+static CO_CANrxFifo_t g_rx_fifo;
+
+/* RX FIFO 統計 - 用於主循環監控（外部可見） */
+volatile uint32_t g_rx_fifo_frame_count = 0;
+volatile uint32_t g_rx_fifo_overrun_count = 0;
+#endif
+
+#if !CO_CAN_TX_FIFO_ENABLE
+/* TX LMO 狀態機 - slot 編號為 CAN_NODE_0 LMO index */
+static CO_CANtxLmo_t g_tx_lmo;
+#endif
+
+/* TX 週期量測 (CO_CAN_CYCLES) - 用於主循環監控（外部可見） */
+volatile uint32_t g_tx_send_cycles_max = 0;
+volatile uint32_t g_tx_isr_cycles_max = 0;
+
+/* RX LMO 每個訊框在 ISR 中的讀取 + 寫入環形緩衝區週期 - 用於主循環監控（外部可見） */
+volatile uint32_t g_rx_frame_cycles_max = 0;
+
+/* RX 環形緩衝區 - 生產者為 CAN ISR (與遮罩 CAN 中斷的輪詢)，消費者為 RT slot (PendSV) */
+static CO_CANrxRing_t g_rx_ring;
+
+/* RX 環形緩衝區統計 - 用於主循環監控（外部可見） */
+volatile uint32_t g_rx_ring_max_fill = 0;
+volatile uint32_t g_rx_ring_drop_count = 0;
+volatile uint32_t g_rx_batch_frames_max = 0;
+volatile uint32_t g_rx_batch_cycles_max = 0;
+volatile uint32_t g_rx_unmatched_count = 0;
+
+#if CO_CAN_TX_FIFO_ENABLE
+/* TX FIFO 在 MSPND 路由表中的虛擬 LMO index */
+#define CANOPEN_TX_FIFO_ROUTE_INDEX     0xFDU
+
+/* TX FIFO - 基底 MO (第一個元素) + 其後的 slave MO，加上軟體優先權佇列 */
+static XMC_CAN_MO_t g_tx_fifo_mo[CO_CAN_TX_FIFO_DEPTH];
+static CO_CANtxFifo_t g_tx_fifo;
+static CO_CANtxQueue_t g_tx_queue;
+
+/* TX FIFO 統計 - 用於主循環監控（外部可見） */
+volatile uint32_t g_tx_fifo_frame_count = 0;
+volatile uint32_t g_tx_queue_max_depth = 0;
+#endif
 
 /* 中斷計數器 - 用於主循環監控（外部可見） */
 volatile uint32_t g_interrupt_rx_count = 0;
@@ -298,10 +382,18 @@ volatile uint32_t g_interrupt_tx_count = 0;
 volatile uint32_t g_interrupt_total_count = 0;
 volatile uint32_t g_interrupt_other_count = 0;
 
+/* RT slot 狀態 - SYNC -> TPDO 延遲統計 */
+static CO_rt_t g_rt;
+
+/* SYNC -> TPDO 延遲 (CO_CAN_CYCLES) - 用於主循環監控（外部可見） */
+volatile uint32_t g_sync_tpdo_cycles_min = 0;
+volatile uint32_t g_sync_tpdo_cycles_max = 0;
+volatile uint32_t g_sync_tpdo_count = 0;
+
 /**
  * @brief CANopen Timer 處理函數 - 1ms 定時處理
  * 
- * 🎯 功能: CANopen 協議棧的定時處理邏輯
+ * 🎯 功能: 更新 CO_timer1ms 並觸發 RT slot，SYNC/RPDO/TPDO 不在此中斷中執行
  * ⏱️ 調用: 由 main.c 中的 TimerHandler() DAVE UI 中斷函數調用
  * 
  * @param CO_ptr CANopen 主物件指標 (void* 類型以避免 header 依賴)
@@ -312,28 +404,493 @@ void canopen_timer_process(void *CO_ptr)
     extern volatile uint32_t CO_timer1ms;
     CO_timer1ms++;
     
-    /* **🎯 CANopen 主要處理邏輯** */
-    CO_t *CO = (CO_t *)CO_ptr;  /* 型別轉換 */
-    if (CO != NULL) {
-        CO_LOCK_OD(CO->CANmodule);
-        if (!CO->nodeIdUnconfigured && CO->CANmodule->CANnormal) {
-            bool_t syncWas = false;
-            /* get time difference since last function call */
-            uint32_t timeDifference_us = 1000; // 1ms = 1000us
+    if (CO_ptr != NULL) {
+        CO_rt_timerTick();
+    }
+}
+
+/**
+ * @brief 設定 RT slot - 中斷優先權與 SYNC 接收回呼
+ *
+ * CAN 中斷必須能搶占 RT slot，啟動時以 CO_CAN_IRQ_PRIORITY / CO_RT_PRIORITY
+ * 覆寫 DAVE 設定的優先權 (DAVE UI 預設兩者皆為 63)。
+ * @param CO_ptr CANopen 主物件指標
+ */
+void canopen_rt_setup(void *CO_ptr)
+{
+    CO_t *CO = (CO_t *)CO_ptr;
+    uint32_t grouping = NVIC_GetPriorityGrouping();
+
+    CO_rt_init(&g_rt, CO_timer1ms);
+    NVIC_SetPriority(CAN_INTERRUPT_1.node, NVIC_EncodePriority(grouping, CO_CAN_IRQ_PRIORITY, 0U));
+    NVIC_SetPriority(PendSV_IRQn, NVIC_EncodePriority(grouping, CO_RT_PRIORITY, 0U));
+
+#if ((CO_CONFIG_SYNC) & CO_CONFIG_SYNC_ENABLE) && ((CO_CONFIG_SYNC) & CO_CONFIG_FLAG_CALLBACK_PRE)
+    if (CO != NULL && CO->SYNC != NULL) {
+        CO_SYNC_initCallbackPre(CO->SYNC, &g_rt, CO_rt_syncSignal);
+    }
+#else
+    (void)CO;
+#endif
+}
+
+/**
+ * @brief 暫停 RT slot - 開機與通訊重置時，CO_delete() / CO_new() 到 canopen_app_init() 完成之間調用
+ *
+ * PendSV_Handler() 以全域 CO 指標執行 canopen_rt_process()，刪除 / 重建期間不得進入。
+ * BASEPRI 提高到 CO_RT_PRIORITY (與 CO_LOCK_OD 相同)：CAN 中斷照常進入，
+ * RX 中斷與計時器只會把 PendSV 設為 pending。只能在主循環 (執行緒) 中調用。
+ * 開機時 canopen_rt_setup() 尚未執行，PendSV 仍是重置後的優先權 0，BASEPRI 遮罩不到，
+ * 所以先設定 PendSV 優先權。
+ * @return 先前的 BASEPRI，交給 canopen_rt_resume()
+ */
+uint32_t canopen_rt_suspend(void)
+{
+    uint32_t mask = CO_LOCK_MASK_GET();
+
+    NVIC_SetPriority(PendSV_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), CO_RT_PRIORITY, 0U));
+    CO_LOCK_MASK_RAISE(CO_LOCK_BASEPRI(CO_LOCK_PRIORITY_RT));
+    return mask;
+}
+
+/**
+ * @brief 恢復 RT slot - 先清除暫停期間設定的 PendSV，再還原 BASEPRI
+ *
+ * 暫停期間的觸發屬於已刪除的 CO；新 CO 的 RT 處理由下一個 1 ms 計時器或 RX 中斷觸發。
+ * @param mask canopen_rt_suspend() 的回傳值
+ */
+void canopen_rt_resume(uint32_t mask)
+{
+    SCB->ICSR = SCB_ICSR_PENDSVCLR_Msk;
+    CO_LOCK_MASK_SET(mask);
+}
+
+/**
+ * @brief 接收訊框分派 - 查表後交給 CANopen 接收函數 (RX 軟體中斷)
+ * @param object CO_CANmodule_t 指標
+ * @param msg 接收的訊框
+ */
+static void canopen_rx_frame(void *object, const CO_CANrxMsg_t *msg)
+{
+    CO_CANmodule_t *CANmodule = (CO_CANmodule_t *)object;
+
+    /* **⚡ O(1) 查表尋找匹配的接收緩衝區 (遮罩項走備用掃描)** */
+    CO_CANrx_t *buffer = CO_CANrxDispatch_find(CANmodule, (uint16_t)msg->ident);
+
+    if (buffer != NULL) {
+        buffer->CANrx_callback(buffer->object, (void*)msg);
+    } else {
+        g_rx_unmatched_count++;
+        if ((g_rx_unmatched_count % 10U) == 1U) {  /* 每 10 次紀錄一次 */
+            Debug_Log_SOFTIRQ(CO_LOG_RX_UNMATCHED, msg->ident, msg->DLC, g_rx_unmatched_count, 0);
+        }
+    }
+}
+
+/**
+ * @brief RX 軟體中斷 - 分派環形緩衝區中的訊框，每個 1 ms 週期最多 CO_CAN_RX_SOFTIRQ_BUDGET 個、
+ *        最多 CO_CAN_RX_SOFTIRQ_CYCLES 的時間
+ *
+ * 預算用完後訊框留在緩衝區 (backlog)，期間 RX 中斷不再觸發 PendSV，
+ * 由下一個 1 ms 計時器觸發接續；訊框持續湧入時主循環仍有執行時間。
+ * 只限制訊框數時，回呼較慢 (例如 150 us 的 RPDO 映射) 的 16 個訊框就佔滿整個週期。
+ * @param CANmodule CAN 模組
+ */
+static void canopen_rx_softirq(CO_CANmodule_t *CANmodule)
+{
+    static uint32_t credit;
+    static uint32_t creditCycles;
+    static uint32_t creditMs;
+
+    if (CO_timer1ms != creditMs) {
+        creditMs = CO_timer1ms;
+        credit = CO_CAN_RX_SOFTIRQ_BUDGET;
+        creditCycles = CO_CAN_RX_SOFTIRQ_CYCLES;
+    }
+
+    uint32_t count = CO_CANrxRing_dispatch(&g_rx_ring, credit, creditCycles, canopen_rx_frame, CANmodule);
+    credit -= count;
+    creditCycles = (g_rx_ring.batchCycles < creditCycles) ? (creditCycles - g_rx_ring.batchCycles) : 0U;
+    if (count > 0U) {
+        g_rx_batch_frames_max = g_rx_ring.batchFramesMax;
+        g_rx_batch_cycles_max = g_rx_ring.batchCyclesMax;
+    }
+}
+
+/**
+ * @brief RT slot 處理 - RX 分派與 SYNC/RPDO/TPDO
+ * 
+ * 🎯 功能: 由 PendSV_Handler() 調用 (計時器每 1 ms、RX 中斷或 SYNC 接收時觸發)
+ * ⏱️ CO_LOCK_OD 只遮罩 RT 優先權，處理期間 CAN 中斷仍可接收訊框
+ * 
+ * @param CO_ptr CANopen 主物件指標
+ */
+void canopen_rt_process(void *CO_ptr)
+{
+    CO_t *CO = (CO_t *)CO_ptr;
+    if (CO == NULL) {
+        return;
+    }
+
+    /* **📥 先分派已接收的訊框，本次的 SYNC/RPDO 處理即可看到** */
+    canopen_rx_softirq(CO->CANmodule);
+    if (!CO_rt_due(&g_rt, CO_timer1ms)) {
+        return;
+    }
+
+    uint32_t timeDifference_us = CO_rt_begin(&g_rt, CO_timer1ms);
+
+    CO_LOCK_OD(CO->CANmodule);
+    if (!CO->nodeIdUnconfigured && CO->CANmodule->CANnormal) {
+        bool_t syncWas = false;
 
 #if (CO_CONFIG_SYNC) & CO_CONFIG_SYNC_ENABLE
-            syncWas = CO_process_SYNC(CO, timeDifference_us, NULL);
+        CO_PROF_BEGIN(CO_PROF_SYNC);
+        syncWas = CO_process_SYNC(CO, timeDifference_us, NULL);
+        CO_PROF_END(CO_PROF_SYNC);
 #endif
 #if (CO_CONFIG_PDO) & CO_CONFIG_RPDO_ENABLE
-            CO_process_RPDO(CO, syncWas, timeDifference_us, NULL);
+        CO_PROF_BEGIN(CO_PROF_RPDO);
+        CO_process_RPDO(CO, syncWas, timeDifference_us, NULL);
+        CO_PROF_END(CO_PROF_RPDO);
 #endif
 #if (CO_CONFIG_PDO) & CO_CONFIG_TPDO_ENABLE
-            CO_process_TPDO(CO, syncWas, timeDifference_us, NULL);
+        CO_PROF_BEGIN(CO_PROF_TPDO);
+        CO_process_TPDO(CO, syncWas, timeDifference_us, NULL);
+        CO_PROF_END(CO_PROF_TPDO);
 #endif
 
-            /* Further I/O or nonblocking application code may go here. */
+        /* Further I/O or nonblocking application code may go here. */
+
+        CO_rt_end(&g_rt, syncWas);
+    }
+    CO_UNLOCK_OD(CO->CANmodule);
+
+    if (g_rt.syncCount != 0U) {
+        g_sync_tpdo_cycles_min = g_rt.latencyMin;
+        g_sync_tpdo_cycles_max = g_rt.latencyMax;
+        g_sync_tpdo_count = g_rt.syncCount;
+    }
+}
+
+#if CO_CAN_RX_FIFO_ENABLE
+/**
+ * @brief RX FIFO 訊框處理 - 寫入 RX 環形緩衝區，由 RX 軟體中斷分派
+ * @param object CO_CANmodule_t 指標
+ * @param msg 接收的訊框
+ */
+static void canopen_rx_fifo_frame(void *object, const CO_CANrxMsg_t *msg)
+{
+    (void)object;
+    (void)CO_CANrxRing_push(&g_rx_ring, msg);
+}
+
+/**
+ * @brief 讀出 RX FIFO 並更新統計 - 在 CAN ISR 中調用
+ * @param CANmodule CAN 模組
+ */
+static void canopen_rx_fifo_process(CO_CANmodule_t *CANmodule)
+{
+    uint32_t overrun_before = g_rx_fifo.overrunCount;
+
+    CO_CANrxFifo_drain(&g_rx_fifo, CO_CAN_RX_FIFO_DEPTH, canopen_rx_fifo_frame, CANmodule);
+
+    g_rx_fifo_frame_count = g_rx_fifo.frameCount;
+    if (g_rx_fifo.overrunCount != overrun_before) {
+        g_rx_fifo_overrun_count = g_rx_fifo.overrunCount;
+        CO_CANerr_event(CANmodule, CO_CAN_ERRRX_OVERFLOW);
+        Debug_Log_ISR(CO_LOG_RX_FIFO_OVERRUN, g_rx_fifo_overrun_count, 0, 0, 0);
+    }
+}
+
+/**
+ * @brief 建立 MultiCAN RX FIFO - 在 CO_CANmodule_init() 中調用
+ *
+ * 基底 MO 接受所有標準訊框 (遮罩 0)，slave MO 依序存放。slave 的 MPN 都指向基底 MO，
+ * 所以整批訊框只會在 MSPND 設定一個位元。DAVE 的 RX LMO 停用，避免搶先接受訊框。
+ * @param rx_sr 接收事件的 service request (與 DAVE RX LMO 相同)
+ */
+static void canopen_rx_fifo_setup(uint8_t rx_sr)
+{
+    XMC_CAN_t *can = CAN_NODE_0.global_ptr->canglobal_ptr;
+    const uint8_t base = (uint8_t)CO_CAN_RX_FIFO_BASE_MO;
+    const uint8_t bottom = (uint8_t)(base + 1U);
+    const uint8_t top = (uint8_t)(base + CO_CAN_RX_FIFO_DEPTH);
+
+    XMC_CAN_NODE_EnableConfigurationChange(CAN_NODE_0.node_ptr);
+    XMC_CAN_NODE_SetInitBit(CAN_NODE_0.node_ptr);
+
+    /* **🔧 依序加入節點串列 - FIFO 沿串列順序由 BOT 走到 TOP** */
+    for (uint8_t mo = base; mo <= top; mo++) {
+        XMC_CAN_AllocateMOtoNodeList(can, CAN_NODE_0.node_num, mo);
+    }
+
+    /* 基底 MO：接受所有標準訊框，軟體以 RX 分派索引過濾 */
+    memset(&g_rx_fifo_base, 0, sizeof(g_rx_fifo_base));
+    g_rx_fifo_base.can_mo_ptr = &CAN_MO->MO[base];
+    g_rx_fifo_base.can_mo_type = XMC_CAN_MO_TYPE_RECMSGOBJ;
+    g_rx_fifo_base.can_id_mode = (uint32_t)XMC_CAN_FRAME_TYPE_STANDARD_11BITS;
+    g_rx_fifo_base.can_identifier = 0U;
+    g_rx_fifo_base.can_id_mask = 0U;
+    g_rx_fifo_base.can_ide_mask = 1U;
+    XMC_CAN_MO_Config(&g_rx_fifo_base);
+
+    /* XMCLib 以 fifo_base 設定 CUR - 接收 FIFO 的 CUR 必須從第一個 slave 開始 */
+    XMC_CAN_FIFO_CONFIG_t fifo_config = {
+        .fifo_bottom = bottom,
+        .fifo_top = top,
+        .fifo_base = bottom
+    };
+    XMC_CAN_RXFIFO_ConfigMOBaseObject(&g_rx_fifo_base, fifo_config);
+
+    /* slave MO：不做接受過濾，接收事件共用基底 MO 的 pending 位元 */
+    for (uint8_t i = 0; i < CO_CAN_RX_FIFO_DEPTH; i++) {
+        XMC_CAN_MO_t *slave = &g_rx_fifo_slaves[i];
+
+        memset(slave, 0, sizeof(*slave));
+        slave->can_mo_ptr = &CAN_MO->MO[bottom + i];
+        slave->can_mo_type = XMC_CAN_MO_TYPE_RECMSGOBJ;
+        slave->can_id_mode = (uint32_t)XMC_CAN_FRAME_TYPE_STANDARD_11BITS;
+        XMC_CAN_MO_Config(slave);
+        XMC_CAN_RXFIFO_ConfigMOSlaveObject(slave);
+        XMC_CAN_MO_ResetStatus(slave, XMC_CAN_MO_RESET_STATUS_NEW_DATA |
+                                      XMC_CAN_MO_RESET_STATUS_MESSAGE_LOST |
+                                      XMC_CAN_MO_RESET_STATUS_RX_PENDING);
+
+        slave->can_mo_ptr->MOIPR = (slave->can_mo_ptr->MOIPR & ~(uint32_t)CAN_MO_MOIPR_MPN_Msk) |
+                                   ((uint32_t)base << CAN_MO_MOIPR_MPN_Pos);
+        XMC_CAN_MO_SetEventNodePointer(slave, XMC_CAN_MO_POINTER_EVENT_RECEIVE, rx_sr);
+        XMC_CAN_MO_EnableEvent(slave, XMC_CAN_MO_EVENT_RECEIVE);
+    }
+
+    CO_CANrxFifo_init(&g_rx_fifo, g_rx_fifo_slaves, CO_CAN_RX_FIFO_DEPTH);
+    CAN->MSPND[base / 32U] = ~(1UL << (base % 32U));
+    CO_MOroute_add(&g_mo_route, base, CANOPEN_RX_FIFO_ROUTE_INDEX, true);
+
+    XMC_CAN_NODE_ResetInitBit(CAN_NODE_0.node_ptr);
+    XMC_CAN_NODE_DisableConfigurationChange(CAN_NODE_0.node_ptr);
+
+    Debug_Printf("✅ RX FIFO 已配置: MO%d (base) + MO%d..MO%d\r\n", base, bottom, top);
+}
+#endif
+
+#if CO_CAN_TX_FIFO_ENABLE
+/**
+ * @brief 以佇列中 COB-ID 最小的訊框填滿 TX FIFO - 須在 CO_LOCK_CAN_SEND 內調用
+ * @param CANmodule CAN 模組
+ */
+static void canopen_tx_fifo_refill(CO_CANmodule_t *CANmodule)
+{
+    while (!CO_CANtxFifo_isFull(&g_tx_fifo)) {
+        CO_CANtx_t *buffer = CO_CANtxQueue_pop(&g_tx_queue);
+        if (buffer == NULL) {
+            break;
         }
-        CO_UNLOCK_OD(CO->CANmodule);
+        /* 資料已複製到 slave MO，緩衝區可立即重用 */
+        CO_CANtxFifo_load(&g_tx_fifo, buffer);
+        buffer->bufferFull = false;
+        CANmodule->CANtxCount--;
+    }
+}
+
+/**
+ * @brief 回收已送出的 slave 並由佇列補充 - 在 CAN ISR 中調用
+ * @param CANmodule CAN 模組
+ */
+static void canopen_tx_fifo_process(CO_CANmodule_t *CANmodule)
+{
+    uint32_t start = CO_CAN_CYCLES();
+
+    CO_LOCK_CAN_SEND(CANmodule);
+    if (CO_CANtxFifo_retire(&g_tx_fifo) != 0U) {
+        CANmodule->firstCANtxMessage = false;
+    }
+    canopen_tx_fifo_refill(CANmodule);
+    CO_UNLOCK_CAN_SEND(CANmodule);
+
+    g_tx_fifo_frame_count = g_tx_fifo.frameCount;
+    uint32_t cycles = CO_CAN_CYCLES() - start;
+    if (cycles > g_tx_isr_cycles_max) {
+        g_tx_isr_cycles_max = cycles;
+    }
+}
+
+/**
+ * @brief TX FIFO 模式的 CO_CANsend() - 不等待匯流排，不輸出除錯訊息
+ *
+ * 訊框一律先進入優先權佇列，再由 COB-ID 最小者填入硬體 FIFO。硬體 FIFO 依載入順序送出，
+ * 所以高優先權訊框最多等待 CO_CAN_TX_FIFO_DEPTH 個已載入的訊框。
+ * @param CANmodule CAN 模組
+ * @param buffer 傳送緩衝區
+ * @return CO_ERROR_NO, CO_ERROR_TX_OVERFLOW 或 CO_ERROR_ILLEGAL_ARGUMENT
+ */
+static CO_ReturnError_t canopen_tx_fifo_send(CO_CANmodule_t *CANmodule, CO_CANtx_t *buffer)
+{
+    CO_ReturnError_t err = CO_ERROR_NO;
+
+    if (buffer->ident > 0x7FFU || buffer->DLC > 8U) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    uint32_t start = CO_CAN_CYCLES();
+    CO_LOCK_CAN_SEND(CANmodule);
+    if (buffer->bufferFull) {
+        /* 仍在佇列中：送出時使用最新的資料 */
+        if (!CANmodule->firstCANtxMessage) {
+            /* Don't set error, if bootup message is still on buffers */
+            CO_CANerr_event(CANmodule, CO_CAN_ERRTX_OVERFLOW);
+        }
+        err = CO_ERROR_TX_OVERFLOW;
+    } else if (CO_CANtxQueue_push(&g_tx_queue, buffer)) {
+        buffer->bufferFull = true;
+        CANmodule->CANtxCount++;
+        canopen_tx_fifo_refill(CANmodule);
+    } else {
+        CO_CANerr_event(CANmodule, CO_CAN_ERRTX_OVERFLOW);
+        err = CO_ERROR_TX_OVERFLOW;
+    }
+    CO_UNLOCK_CAN_SEND(CANmodule);
+
+    g_tx_queue_max_depth = g_tx_queue.maxCount;
+    uint32_t cycles = CO_CAN_CYCLES() - start;
+    if (cycles > g_tx_send_cycles_max) {
+        g_tx_send_cycles_max = cycles;
+    }
+    return err;
+}
+
+/**
+ * @brief 建立 MultiCAN TX FIFO - 在 CO_CANmodule_init() 中調用
+ *
+ * 基底 MO 是 FIFO 的第一個元素，CUR 由它開始沿 BOT..TOP 循環。所有元素的 MPN 都指向
+ * 基底 MO，傳送完成事件只在 MSPND 設定一個位元。DAVE 的 TX LMO 保留但不再使用。
+ * @param tx_sr 傳送事件的 service request (與 DAVE TX LMO 相同)
+ */
+static void canopen_tx_fifo_setup(uint8_t tx_sr)
+{
+    XMC_CAN_t *can = CAN_NODE_0.global_ptr->canglobal_ptr;
+    const uint8_t base = (uint8_t)CO_CAN_TX_FIFO_BASE_MO;
+    const uint8_t top = (uint8_t)(base + CO_CAN_TX_FIFO_DEPTH - 1U);
+
+    XMC_CAN_NODE_EnableConfigurationChange(CAN_NODE_0.node_ptr);
+    XMC_CAN_NODE_SetInitBit(CAN_NODE_0.node_ptr);
+
+    for (uint8_t mo = base; mo <= top; mo++) {
+        XMC_CAN_AllocateMOtoNodeList(can, CAN_NODE_0.node_num, mo);
+    }
+
+    XMC_CAN_FIFO_CONFIG_t fifo_config = {
+        .fifo_bottom = base,
+        .fifo_top = top,
+        .fifo_base = base
+    };
+
+    for (uint8_t i = 0; i < CO_CAN_TX_FIFO_DEPTH; i++) {
+        XMC_CAN_MO_t *element = &g_tx_fifo_mo[i];
+
+        memset(element, 0, sizeof(*element));
+        element->can_mo_ptr = &CAN_MO->MO[base + i];
+        element->can_mo_type = XMC_CAN_MO_TYPE_TRANSMSGOBJ;
+        element->can_id_mode = (uint32_t)XMC_CAN_FRAME_TYPE_STANDARD_11BITS;
+        element->can_id_mask = 0x7FFU;
+        XMC_CAN_MO_Config(element);
+
+        if (i == 0U) {
+            XMC_CAN_TXFIFO_ConfigMOBaseObject(element, fifo_config);
+        } else {
+            XMC_CAN_TXFIFO_ConfigMOSlaveObject(element, fifo_config);
+        }
+        /* 不使用 single transmit trial：仲裁失敗或匯流排錯誤時硬體重送，每個訊框最後都有 TXPND，
+         * CO_CANtxFifo_retire() 依載入順序回收不會停住 */
+        XMC_CAN_MO_DisableSingleTransmitTrial(element);
+        XMC_CAN_MO_ResetStatus(element, XMC_CAN_MO_RESET_STATUS_TX_PENDING |
+                                        XMC_CAN_MO_RESET_STATUS_TX_REQUEST);
+
+        element->can_mo_ptr->MOIPR = (element->can_mo_ptr->MOIPR & ~(uint32_t)CAN_MO_MOIPR_MPN_Msk) |
+                                     ((uint32_t)base << CAN_MO_MOIPR_MPN_Pos);
+        XMC_CAN_MO_SetEventNodePointer(element, XMC_CAN_MO_POINTER_EVENT_TRANSMIT, tx_sr);
+        XMC_CAN_MO_EnableEvent(element, XMC_CAN_MO_EVENT_TRANSMIT);
+    }
+
+    CO_CANtxFifo_init(&g_tx_fifo, g_tx_fifo_mo, CO_CAN_TX_FIFO_DEPTH);
+    CO_CANtxQueue_init(&g_tx_queue);
+    CAN->MSPND[base / 32U] = ~(1UL << (base % 32U));
+    CO_MOroute_add(&g_mo_route, base, CANOPEN_TX_FIFO_ROUTE_INDEX, false);
+
+    XMC_CAN_NODE_ResetInitBit(CAN_NODE_0.node_ptr);
+    XMC_CAN_NODE_DisableConfigurationChange(CAN_NODE_0.node_ptr);
+
+    Debug_Printf("✅ TX FIFO 已配置: MO%d..MO%d\r\n", base, top);
+}
+#endif
+
+/**
+ * @brief 讀出訊框後更新 RX 環形緩衝區統計並觸發 RX 軟體中斷 (RT slot)
+ * @param CANmodule CAN 模組
+ * @param drops 讀出前的 dropCount
+ */
+static void canopen_rx_ring_signal(CO_CANmodule_t *CANmodule, uint32_t drops)
+{
+    g_rx_ring_max_fill = g_rx_ring.maxFill;
+    if (g_rx_ring.dropCount != drops) {
+        g_rx_ring_drop_count = g_rx_ring.dropCount;
+        CO_CANerr_event(CANmodule, CO_CAN_ERRRX_OVERFLOW);
+        Debug_Log_ISR(CO_LOG_RX_RING_DROP, g_rx_ring_drop_count, 0, 0, 0);
+    }
+    if (CO_CANrxRing_signalNeeded(&g_rx_ring)) {
+        CO_RT_TRIGGER();
+    }
+}
+
+/**
+ * @brief MSPND 路由事件處理 - 依 LMO 類型分派到 RX/TX 處理函數
+ * @param object CO_CANmodule_t 指標
+ * @param lmoIndex CAN_NODE_0.lmobj_ptr[] 索引
+ * @param isRx true: 接收事件, false: 傳送事件
+ */
+static void canopen_mo_event(void *object, uint8_t lmoIndex, bool isRx)
+{
+    CO_CANmodule_t *CANmodule = (CO_CANmodule_t *)object;
+
+#if CO_CAN_RX_FIFO_ENABLE
+    if (lmoIndex == CANOPEN_RX_FIFO_ROUTE_INDEX) {
+        /* **📥 RX FIFO：一次讀出所有已接收的訊框** */
+        g_interrupt_rx_count++;
+        CO_PROF_BEGIN(CO_PROF_CAN_RX);
+        canopen_rx_fifo_process(CANmodule);
+        CO_PROF_END(CO_PROF_CAN_RX);
+        return;
+    }
+#endif
+#if CO_CAN_TX_FIFO_ENABLE
+    if (lmoIndex == CANOPEN_TX_FIFO_ROUTE_INDEX) {
+        /* **📤 TX FIFO：回收已送出的訊框並補充下一批** */
+        g_interrupt_tx_count++;
+        CO_PROF_BEGIN(CO_PROF_CAN_TX);
+        canopen_tx_fifo_process(CANmodule);
+        CO_PROF_END(CO_PROF_CAN_TX);
+        return;
+    }
+#endif
+
+    if (isRx) {
+        /* **📥 RX LMO 處理** */
+        g_interrupt_rx_count++;
+        CO_PROF_BEGIN(CO_PROF_CAN_RX);
+        (void)CO_CANinterrupt_Rx(CANmodule, lmoIndex);
+        CO_PROF_END(CO_PROF_CAN_RX);
+        
+        /* 簡單的除錯輸出 */
+        Debug_Log_ISR(CO_LOG_RX_IRQ, lmoIndex + 1U, lmoIndex, 0, 0);
+    } else {
+        /* **📤 TX LMO 處理** */
+        g_interrupt_tx_count++;
+        CO_PROF_BEGIN(CO_PROF_CAN_TX);
+        CO_CANinterrupt_Tx(CANmodule, lmoIndex);
+        CO_PROF_END(CO_PROF_CAN_TX);
+        
+        /* 簡單的除錯輸出 */
+        Debug_Log_ISR(CO_LOG_TX_IRQ, lmoIndex + 1U, lmoIndex, 0, 0);
     }
 }
 
@@ -349,49 +906,16 @@ void canopen_can_interrupt_process(void)
     g_interrupt_total_count++;
     
     if (g_CANmodule != NULL) {
-        bool event_handled = false;
-        
-        /* **✅ 動態輪詢所有配置的 LMO，根據 can_mo_type 判斷 RX/TX** */
-        for (uint8_t lmo_idx = 0; lmo_idx < CAN_NODE_0.mo_count; lmo_idx++) {
-            if (CAN_NODE_0.lmobj_ptr[lmo_idx] != NULL) {
-                const CAN_NODE_LMO_t *lmo = CAN_NODE_0.lmobj_ptr[lmo_idx];
-                
-                if (lmo->mo_ptr != NULL) {
-                    /* **🔍 根據 MO 類型判斷是 RX 還是 TX** */
-                    uint32_t mo_type = lmo->mo_ptr->can_mo_type;
-                    uint32_t mo_status = CAN_NODE_MO_GetStatus(lmo);
-                    
-                    if (mo_type == XMC_CAN_MO_TYPE_RECMSGOBJ) {
-                        /* **📥 RX LMO 處理** */
-                        if (lmo->rx_event_enable && (mo_status & XMC_CAN_MO_STATUS_RX_PENDING)) {
-                            g_interrupt_rx_count++;
-                            CO_CANinterrupt_Rx(g_CANmodule, lmo_idx);
-                            event_handled = true;
-                            
-                            /* 簡單的除錯輸出 */
-                            Debug_Printf_ISR("RX IRQ: LMO_%02d (idx=%d)\r\n", lmo_idx + 1, lmo_idx);
-                        }
-                    }
-                    else if (mo_type == XMC_CAN_MO_TYPE_TRANSMSGOBJ) {
-                        /* **📤 TX LMO 處理** */
-                        if (lmo->tx_event_enable && (mo_status & XMC_CAN_MO_STATUS_TX_PENDING)) {
-                            g_interrupt_tx_count++;
-                            CO_CANinterrupt_Tx(g_CANmodule, lmo_idx);
-                            event_handled = true;
-                            
-                            /* 簡單的除錯輸出 */
-                            Debug_Printf_ISR("TX IRQ: LMO_%02d (idx=%d)\r\n", lmo_idx + 1, lmo_idx);
-                        }
-                    }
-                    /* 其他類型的 MO (FIFO, Gateway 等) 暫時忽略 */
-                }
-            }
-        }
+        /* **⚡ 讀取 MSPND，只處理真正觸發的 LMO (不再輪詢全部 mo_count)** */
+        uint32_t drops = g_rx_ring.dropCount;
+        uint32_t events = CO_MOroute_dispatch(&g_mo_route, canopen_mo_event, g_CANmodule);
         
         /* 用於除錯統計 */
-        if (!event_handled) {
+        if (events == 0U) {
             g_interrupt_other_count++;
         }
+
+        canopen_rx_ring_signal(g_CANmodule, drops);
     }
 }
 
@@ -412,6 +936,23 @@ CO_ReturnError_t CO_CANmodule_init(
         return CO_ERROR_ILLEGAL_ARGUMENT;
     }
 
+    /* RX 分派索引以 uint8_t 儲存 rxArray index */
+    if (rxSize >= CO_CAN_RX_DISPATCH_NONE) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+#if CO_CAN_TX_FIFO_ENABLE
+    /* 每個傳送緩衝區在優先權佇列中最多佔一個項目 */
+    if (txSize > CO_CAN_TX_QUEUE_SIZE) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+#else
+    /* TX 狀態機以 LMO index 作為 slot 編號 */
+    if (CAN_NODE_0.mo_count > CO_CAN_TX_LMO_MAX) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+#endif
+
     /* **🎯 驗證 DAVE 配置有效性** */
     if (!canopen_is_dave_config_valid()) {
         return CO_ERROR_ILLEGAL_ARGUMENT;
@@ -434,6 +975,7 @@ CO_ReturnError_t CO_CANmodule_init(
     CANmodule->txSize = txSize;
     
     CANmodule->CANerrorStatus = 0;
+    CANmodule->CANerrorEvents = 0;
     CANmodule->CANnormal = false;
     CANmodule->useCANrxFilters = false;
     CANmodule->bufferInhibitFlag = false;
@@ -451,6 +993,23 @@ CO_ReturnError_t CO_CANmodule_init(
     uint8_t rx_lmo_count = 0;
     uint8_t tx_lmo_count = 0;
     
+    /* **⚡ 建立 MSPND 路由表 - MPN 已由 XMC_CAN_MO_Config() 設為 MO 編號** */
+    CO_MOroute_init(&g_mo_route, (volatile uint32_t *)CAN->MSPND);
+#if !CO_CAN_TX_FIFO_ENABLE
+    CO_CANtxLmo_init(&g_tx_lmo);
+#endif
+
+    /* **⏱️ 啟用 DWT 週期計數器 - CO_CAN_CYCLES() 預設來源** */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    
+#if CO_CAN_RX_FIFO_ENABLE
+    uint8_t rx_fifo_sr = 0U;
+#endif
+#if CO_CAN_TX_FIFO_ENABLE
+    uint8_t tx_fifo_sr = 0U;
+#endif
+
     /* **✅ 遍歷所有 LMO，根據類型動態啟用事件** */
     for (uint8_t lmo_idx = 0; lmo_idx < CAN_NODE_0.mo_count; lmo_idx++) {
         if (CAN_NODE_0.lmobj_ptr[lmo_idx] != NULL) {
@@ -462,22 +1021,43 @@ CO_ReturnError_t CO_CANmodule_init(
                     /* **📥 RX LMO 處理** */
                     rx_lmo_count++;
                     
+#if CO_CAN_RX_FIFO_ENABLE
+                    /* FIFO 模式：RX LMO 停用，接收事件改由 FIFO 產生 */
+                    rx_fifo_sr = lmo->rx_sr;
+                    CAN_NODE_MO_DisableRxEvent(lmo);
+                    XMC_CAN_MO_ResetStatus(lmo->mo_ptr, XMC_CAN_MO_RESET_STATUS_MESSAGE_VALID);
+#else
                     if (lmo->rx_event_enable) {
                         CAN_NODE_MO_EnableRxEvent(lmo);
+                        CO_MOroute_add(&g_mo_route, lmo->number, lmo_idx, true);
                     }
+#endif
                 }
                 else if (lmo->mo_ptr->can_mo_type == XMC_CAN_MO_TYPE_TRANSMSGOBJ) {
                     /* **📤 TX LMO 處理** */
                     tx_lmo_count++;
                     
+#if CO_CAN_TX_FIFO_ENABLE
+                    tx_fifo_sr = lmo->tx_sr;
+#else
+                    CO_CANtxLmo_addSlot(&g_tx_lmo, lmo_idx, lmo->mo_ptr);
+#endif
                     if (lmo->tx_event_enable) {
                         CAN_NODE_MO_EnableTxEvent(lmo);
+                        CO_MOroute_add(&g_mo_route, lmo->number, lmo_idx, false);
                     }
                 }
             }
         }
     }
 
+#if CO_CAN_RX_FIFO_ENABLE
+    canopen_rx_fifo_setup(rx_fifo_sr);
+#endif
+#if CO_CAN_TX_FIFO_ENABLE
+    canopen_tx_fifo_setup(tx_fifo_sr);
+#endif
+
     /* Configure receive buffers */
     for (i = 0; i < rxSize; i++) {
         rxArray[i].ident = 0;
@@ -488,6 +1068,12 @@ CO_ReturnError_t CO_CANmodule_init(
         rxArray[i].lmo_index = i;
     }
 
+    /* **⚡ 清空 RX 分派索引 - 之後由 CO_CANrxBufferInit() 逐一登記** */
+    CO_CANrxDispatch_init(CANmodule);
+
+    /* 通訊重置時丟棄尚未分派的訊框 (接收緩衝區即將重新登記) */
+    CO_CANrxRing_init(&g_rx_ring);
+
     /* **🎯 使用 DAVE 配置驗證系統狀態** */
     if (!canopen_is_dave_config_valid()) {
         return CO_ERROR_ILLEGAL_ARGUMENT;
@@ -499,6 +1085,8 @@ CO_ReturnError_t CO_CANmodule_init(
         txArray[i].DLC = 0;
         txArray[i].bufferFull = false;
         txArray[i].syncFlag = false;
+        txArray[i].queued = false;
+        txArray[i].txState = CO_CAN_TX_IDLE;
         txArray[i].dave_lmo = NULL;
         txArray[i].lmo_index = i;
     }
@@ -517,7 +1105,9 @@ CO_ReturnError_t CO_CANmodule_init(
     
     /* **✅ 動態配置所有 LMO 的 Transfer Settings** */
     uint8_t tx_configured = 0;
+#if !CO_CAN_RX_FIFO_ENABLE
     uint8_t rx_configured = 0;
+#endif
     
     for (uint8_t lmo_idx = 0; lmo_idx < CAN_NODE_0.mo_count; lmo_idx++) {
         const CAN_NODE_LMO_t *lmo = CAN_NODE_0.lmobj_ptr[lmo_idx];
@@ -526,8 +1116,9 @@ CO_ReturnError_t CO_CANmodule_init(
             uint32_t mo_type = lmo->mo_ptr->can_mo_type;
             
             if (mo_type == XMC_CAN_MO_TYPE_TRANSMSGOBJ) {
-                /* **📤 TX LMO Transfer Settings** */
-                XMC_CAN_MO_EnableSingleTransmitTrial(lmo->mo_ptr);
+                /* **📤 TX LMO Transfer Settings** - 不使用 single transmit trial：仲裁失敗時硬體重送，
+                 * slot 只在 TXPND 時回收 (CO_tx_lmo.c) */
+                XMC_CAN_MO_DisableSingleTransmitTrial(lmo->mo_ptr);
                 
                 XMC_CAN_MO_ResetStatus(lmo->mo_ptr, 
                     XMC_CAN_MO_RESET_STATUS_TX_PENDING |
@@ -537,6 +1128,7 @@ CO_ReturnError_t CO_CANmodule_init(
                 
                 tx_configured++;
             }
+#if !CO_CAN_RX_FIFO_ENABLE
             else if (mo_type == XMC_CAN_MO_TYPE_RECMSGOBJ) {
                 /* **� RX LMO Transfer Settings** */
                 XMC_CAN_MO_ResetStatus(lmo->mo_ptr, 
@@ -547,6 +1139,7 @@ CO_ReturnError_t CO_CANmodule_init(
                 
                 rx_configured++;
             }
+#endif
         }
     }
     
@@ -582,12 +1175,20 @@ CO_ReturnError_t CO_CANrxBufferInit(
         }
         
         CO_CANrx_t *buffer = &CANmodule->rxArray[index];
+
+        /* 執行中重新設定 (例如 SDO 客戶端釋放 COB-ID) 時，RX 分派不可看到一半的設定 */
+        CO_LOCK_CAN_SEND(CANmodule);
+        uint16_t oldIdent = (uint16_t)buffer->ident;
         buffer->ident = ident;
         buffer->mask = mask;
         buffer->object = object;
         buffer->CANrx_callback = CANrx_callback;
         buffer->dave_lmo = NULL;  /* 不關聯硬體 LMO */
         buffer->lmo_index = index;
+
+        /* NMT (ID=0) 同樣需要登記到 RX 分派索引 */
+        CO_CANrxDispatch_update(CANmodule, index, oldIdent);
+        CO_UNLOCK_CAN_SEND(CANmodule);
         
         return CO_ERROR_NO;
     }
@@ -605,6 +1206,8 @@ CO_ReturnError_t CO_CANrxBufferInit(
     uint8_t matched_lmo_index = 0;
     bool lmo_configured = false;
     
+#if !CO_CAN_RX_FIFO_ENABLE  /* FIFO 模式：所有訊框經由 FIFO，不綁定 LMO */
+
     /* **✅ 第一階段：尋找完全匹配 ID 的 RX LMO** */
     for (uint8_t lmo_idx = 0; lmo_idx < CAN_NODE_0.mo_count; lmo_idx++) {
         const CAN_NODE_LMO_t *lmo = CAN_NODE_0.lmobj_ptr[lmo_idx];
@@ -649,6 +1252,7 @@ CO_ReturnError_t CO_CANrxBufferInit(
             }
         }
     }
+#endif
     
     if (lmo_configured && matched_rx_lmo != NULL) {
         /* **✅ 成功找到或配置了 RX LMO** */
@@ -661,11 +1265,18 @@ CO_ReturnError_t CO_CANrxBufferInit(
         buffer->lmo_index = index;
     }
 
-    /* Configure software buffer */
+    /* Configure software buffer - 匯流排運作中調用時 (CO_SDOclient_setup() 等)，
+     * RX 分派 (CAN ISR / RT slot) 不可看到一半的設定或重建中的分派表 */
+    CO_LOCK_CAN_SEND(CANmodule);
+    uint16_t oldIdent = (uint16_t)buffer->ident;
     buffer->ident = ident;
     buffer->mask = mask;
     buffer->object = object;
     buffer->CANrx_callback = CANrx_callback;
+
+    /* **⚡ 更新 RX 分派索引** */
+    CO_CANrxDispatch_update(CANmodule, index, oldIdent);
+    CO_UNLOCK_CAN_SEND(CANmodule);
     
     return CO_ERROR_NO;
 }
@@ -681,37 +1292,47 @@ CO_CANtx_t *CO_CANtxBufferInit(
 {
     CO_CANtx_t *buffer = NULL;
 
+    /* safety */
+    if (CANmodule == NULL || index >= CANmodule->txSize) {
+        return NULL;
+    }
+
+    /* get specific buffer */
+    buffer = &CANmodule->txArray[index];
+
+    /* 匯流排運作中調用時 (PDO/SDO 重新設定)，緩衝區可能仍在傳送：先釋放它的訊框，
+     * 傳送完成中斷與 CO_CANsend() 不可看到一半的設定 */
+    CO_LOCK_CAN_SEND(CANmodule);
+#if CO_CAN_TX_FIFO_ENABLE
+    if (buffer->bufferFull) {
+        /* 佇列中的項目在取出時略過 */
+        buffer->bufferFull = false;
+        CANmodule->CANtxCount--;
+    }
+#else
+    /* ACTIVE 的 slot 清除 TXRQ 並與緩衝區分離，TXPND 或逾時後才回收 */
+    (void)CO_CANtxLmo_release(&g_tx_lmo, CANmodule, buffer, CO_CAN_CYCLES());
+#endif
+
     /* **🚨 關鍵修正：防止 CANopen 堆疊用 ident=0 覆蓋已配置的 LMO** */
     if (ident == 0) {
         /* 只設定軟體緩衝區，不修改硬體 LMO */
-        if (CANmodule == NULL || index >= CANmodule->txSize) {
-            return NULL;
-        }
-        
-        buffer = &CANmodule->txArray[index];
         buffer->ident = ident;
         buffer->DLC = noOfBytes;
-        buffer->bufferFull = false;
         buffer->syncFlag = syncFlag;
         buffer->dave_lmo = NULL;  /* 不關聯硬體 LMO */
         buffer->lmo_index = index;
-        
-        return buffer;
-    }
+        CO_UNLOCK_CAN_SEND(CANmodule);
 
-    /* safety */
-    if (CANmodule == NULL || index >= CANmodule->txSize) {
-        return NULL;
+        return buffer;
     }
 
-    /* get specific buffer */
-    buffer = &CANmodule->txArray[index];
-
     /* **🎯 動態 TX LMO 配置：為每個 TX Buffer 預分配 TX LMO** */
     const CAN_NODE_LMO_t *tx_lmo = NULL;
     uint8_t tx_lmo_index = 0;
     bool lmo_assigned = false;
     
+#if !CO_CAN_TX_FIFO_ENABLE  /* FIFO 模式：所有訊框經由 FIFO，不綁定 LMO */
     /* **✅ 根據 index 動態分配可用的 TX LMO** */
     uint8_t tx_lmo_count = 0;
     for (uint8_t lmo_idx = 0; lmo_idx < CAN_NODE_0.mo_count; lmo_idx++) {
@@ -731,11 +1352,17 @@ CO_CANtx_t *CO_CANtxBufferInit(
             tx_lmo_count++;
         }
     }
+#endif
     
     if (lmo_assigned && tx_lmo != NULL) {
-        /* **🎯 預配置 TX LMO 的基本設定** */
-        XMC_CAN_MO_SetIdentifier(tx_lmo->mo_ptr, ident & 0x7FF);
-        tx_lmo->mo_ptr->can_data_length = noOfBytes;
+#if !CO_CAN_TX_FIFO_ENABLE
+        /* **🎯 預配置 TX LMO 的基本設定** - slot 仍有其他或已分離的訊框時不可改寫 MOAR，
+         * 傳送時 (tx_start) 一律重新寫入識別碼 */
+        if (tx_lmo_index >= CO_CAN_TX_LMO_MAX || (g_tx_lmo.idleMask & (1UL << tx_lmo_index)) != 0U) {
+            XMC_CAN_MO_SetIdentifier(tx_lmo->mo_ptr, ident & 0x7FF);
+            tx_lmo->mo_ptr->can_data_length = noOfBytes;
+        }
+#endif
         
         /* **儲存 LMO 參考給緩衝區** */
         buffer->dave_lmo = (void*)tx_lmo;
@@ -750,268 +1377,54 @@ CO_CANtx_t *CO_CANtxBufferInit(
     /* CAN identifier and rtr */
     buffer->ident = ident;
     buffer->DLC = noOfBytes;
-    buffer->bufferFull = false;
     buffer->syncFlag = syncFlag;
+    CO_UNLOCK_CAN_SEND(CANmodule);
 
     return buffer;
 }
 
 /******************************************************************************/
 CO_ReturnError_t CO_CANsend(CO_CANmodule_t *CANmodule, CO_CANtx_t *buffer)
+{
+#if CO_CAN_TX_FIFO_ENABLE
+    return canopen_tx_fifo_send(CANmodule, buffer);
+#else
+    return canopen_tx_lmo_send(CANmodule, buffer);
+#endif
+}
+
+#if !CO_CAN_TX_FIFO_ENABLE
+/**
+ * @brief 每個緩衝區一個 DAVE TX LMO 的 CO_CANsend() 實作
+ *
+ * 不等待傳送完成：訊框寫入空閒的 TX LMO，或標記為 PENDING 由傳送完成中斷接續送出
+ * (CO_tx_lmo.c)。bufferFull 與 CANtxCount 只在傳送完成時清除。
+ * @param CANmodule CAN 模組
+ * @param buffer 傳送緩衝區
+ * @return CO_ERROR_NO, CO_ERROR_TX_OVERFLOW 或 CO_ERROR_ILLEGAL_ARGUMENT
+ */
+static CO_ReturnError_t canopen_tx_lmo_send(CO_CANmodule_t *CANmodule, CO_CANtx_t *buffer)
 {
     CO_ReturnError_t err = CO_ERROR_NO;
-    
-    /* 強制輸出 - 確保函數被調用時我們能看到 */
-    Debug_Printf_Raw("CO_CANsend() CALLED - ID=0x%03X, DLC=%d\r\n", buffer->ident, buffer->DLC);
-    
-    /* Step 1: 詳細檢測傳入參數是否符合 DAVE 配置 */
-    Debug_Printf_Verbose("=== CO_CANsend 數值檢測 ===\r\n");
-    Debug_Printf_Verbose("檢測 CAN ID: 0x%03X\r\n", buffer->ident);
-    Debug_Printf_Verbose("檢測 DLC: %d\r\n", buffer->DLC);
-    
-    /* Step 0.5: 檢查 CAN 位元時序參數和暫存器狀態 */
-    Debug_Printf_Verbose("=== CAN 位元時序和暫存器檢查 ===\r\n");
-    
-    /* 分析 DAVE 配置問題 */
-    Debug_Printf("DAVE 配置問題分析:\r\n");
-    Debug_Printf("   當前設定: Synchronization jump width = 1\r\n");
-    Debug_Printf("   當前設定: Sample point = 80%%\r\n");
-    Debug_Printf("\r\n");
-    Debug_Printf("WARNING: 這些設定可能導致 stuff error!\r\n");
-    Debug_Printf("\r\n");
-    Debug_Printf("建議的正確設定 (DAVE 中修改):\r\n");
-    Debug_Printf("   Synchronization jump width: 改為 2 (提高抗干擾)\r\n");
-    Debug_Printf("   Sample point: 改為 75%% (避免 stuff error)\r\n");
-    Debug_Printf("   詳細建議: TSEG1=6, TSEG2=2, SJW=2\r\n");
-    Debug_Printf("\r\n");
-    Debug_Printf("修改步驟:\r\n");
-    Debug_Printf("   1. 開啟 DAVE IDE\r\n");
-    Debug_Printf("   2. 點選 CAN_NODE_0\r\n");
-    Debug_Printf("   3. Advanced Settings 頁籤\r\n");
-    Debug_Printf("   4. 修改 SJW=2, Sample Point=75%%\r\n");
-    Debug_Printf("   5. 重新產生程式碼並編譯\r\n");
-    Debug_Printf("\r\n");
-    
-    /* 檢測 1: CAN ID 範圍驗證 */
-    if (buffer->ident > 0x7FF) {
-        Debug_Printf("ERROR: CAN ID 0x%03X 超出 11-bit 範圍 (最大 0x7FF)\r\n", buffer->ident);
-        return CO_ERROR_ILLEGAL_ARGUMENT;
-    }
-    
-    /* 檢測 2: DLC 範圍驗證 */
-    if (buffer->DLC > 8) {
-        Debug_Printf("ERROR: DLC %d 超出範圍 (最大 8)\r\n", buffer->DLC);
+
+    if (buffer->ident > 0x7FFU || buffer->DLC > 8U) {
         return CO_ERROR_ILLEGAL_ARGUMENT;
     }
-    
-    /* 檢測 3: 與 DAVE 配置的 LMO 對照 */
-    Debug_Printf("檢查 DAVE 配置的 LMO 對應關係:\r\n");
-    Debug_Printf("   LMO_01 (0x8A)  -> Emergency + SDO TX\r\n");
-    Debug_Printf("   LMO_02 (0x18A) -> TPDO1\r\n"); 
-    Debug_Printf("   LMO_03 (0x28A) -> TPDO2\r\n");
-    Debug_Printf("   LMO_04 (0x38A) -> TPDO3\r\n");
-    Debug_Printf("   LMO_05 (0x48A) -> TPDO4\r\n");
-    Debug_Printf("   LMO_06 (0x58A) -> 備用 TX\r\n");
-    Debug_Printf("   LMO_07 (0x70A) -> Heartbeat\r\n");
-    Debug_Printf("   LMO_08 (0x60A) -> SDO RX (接收)\r\n");
-    
-    /* 檢測 4: 確認 ID 是否匹配 DAVE 預設值 */
-    bool id_matches_dave_config = false;
-    const char* lmo_description = "未知";
-    
-    switch (buffer->ident) {
-        case 0x08A: id_matches_dave_config = true; lmo_description = "Emergency (LMO_01)"; break;
-        case 0x18A: id_matches_dave_config = true; lmo_description = "TPDO1 (LMO_02)"; break;
-        case 0x28A: id_matches_dave_config = true; lmo_description = "TPDO2 (LMO_03)"; break;
-        case 0x38A: id_matches_dave_config = true; lmo_description = "TPDO3 (LMO_04)"; break;
-        case 0x48A: id_matches_dave_config = true; lmo_description = "TPDO4 (LMO_05)"; break;
-        case 0x58A: id_matches_dave_config = true; lmo_description = "備用 TX (LMO_06)"; break;
-        case 0x70A: id_matches_dave_config = true; lmo_description = "Heartbeat (LMO_07)"; break;
-        case 0x123: id_matches_dave_config = true; lmo_description = "測試訊息"; break;
-        default:
-            Debug_Printf("WARN: ID 0x%03X 不在 DAVE 預設配置中\r\n", buffer->ident);
-            break;
-    }
-    
-    if (id_matches_dave_config) {
-        Debug_Printf("PASS: ID 0x%03X 匹配 DAVE 配置 - %s\r\n", buffer->ident, lmo_description);
-    }
 
-    /* Verify overflow */
-    if (buffer->bufferFull) {
+    CO_LOCK_CAN_SEND(CANmodule);
+    if (!CO_CANtxLmo_send(&g_tx_lmo, CANmodule, buffer)) {
         if (!CANmodule->firstCANtxMessage) {
             /* Don't set error, if bootup message is still on buffers */
-            CANmodule->CANerrorStatus |= CO_CAN_ERRTX_OVERFLOW;
-        }
-        err = CO_ERROR_TX_OVERFLOW;
-    }
-
-    /* **🎯 優先使用緩衝區已預分配的 TX LMO** */
-    const CAN_NODE_LMO_t *tx_lmo = NULL;
-    uint8_t tx_lmo_index = 0;
-    
-    Debug_Printf("🔍 為 ID=0x%03X 尋找 TX LMO (優先使用預分配)\r\n", buffer->ident);
-    
-    /* **✅ 第一優先：使用緩衝區預分配的 TX LMO** */
-    if (buffer->dave_lmo != NULL) {
-        tx_lmo = (const CAN_NODE_LMO_t*)buffer->dave_lmo;
-        tx_lmo_index = buffer->lmo_index;
-        
-        /* **確認這個 LMO 確實是 TX 類型且可用** */
-        if (tx_lmo->mo_ptr != NULL && 
-            tx_lmo->mo_ptr->can_mo_type == XMC_CAN_MO_TYPE_TRANSMSGOBJ) {
-            
-            uint32_t mo_status = CAN_NODE_MO_GetStatus(tx_lmo);
-            if (!(mo_status & XMC_CAN_MO_STATUS_TX_PENDING)) {
-                Debug_Printf("✅ 使用預分配的 TX LMO_%02d (索引=%d)\r\n", 
-                           tx_lmo_index + 1, tx_lmo_index);
-            } else {
-                Debug_Printf("⚠️ 預分配的 LMO_%02d 忙碌，尋找替代方案\r\n", tx_lmo_index + 1);
-                tx_lmo = NULL;  /* 標記為無效，需要重新尋找 */
-            }
-        } else {
-            Debug_Printf("❌ 預分配的 LMO 無效或非 TX 類型\r\n");
-            tx_lmo = NULL;
-        }
-    }
-    
-    /* **🔧 第二優先：動態尋找任何可用的 TX LMO** */
-    if (tx_lmo == NULL) {
-        Debug_Printf("🔧 動態尋找可用的 TX LMO...\r\n");
-        
-        for (uint8_t lmo_idx = 0; lmo_idx < CAN_NODE_0.mo_count; lmo_idx++) {
-            const CAN_NODE_LMO_t *lmo = CAN_NODE_0.lmobj_ptr[lmo_idx];
-            
-            if (lmo != NULL && lmo->mo_ptr != NULL &&
-                lmo->mo_ptr->can_mo_type == XMC_CAN_MO_TYPE_TRANSMSGOBJ) {
-                
-                /* **🔍 檢查 LMO 是否可用 (不忙碌)** */
-                uint32_t mo_status = CAN_NODE_MO_GetStatus(lmo);
-                
-                if (!(mo_status & XMC_CAN_MO_STATUS_TX_PENDING)) {
-                    /* **✅ 找到可用的 TX LMO** */
-                    tx_lmo = lmo;
-                    tx_lmo_index = lmo_idx;
-                    Debug_Printf("✅ 動態選擇 TX LMO_%02d (索引=%d) for ID=0x%03X\r\n", 
-                               lmo_idx + 1, lmo_idx, buffer->ident);
-                    break;
-                } else {
-                    Debug_Printf("⚠️ LMO_%02d 忙碌中 (狀態=0x%08lX)，檢查下一個\r\n", lmo_idx + 1, mo_status);
-                }
-            }
-        }
-    }
-    
-    /* **檢測 5: LMO 有效性驗證** */
-    if (tx_lmo == NULL) {
-        Debug_Printf("❌ ERROR: 無法找到對應的 TX LMO for ID=0x%03X\r\n", buffer->ident);
-        return CO_ERROR_ILLEGAL_ARGUMENT;
-    }
-    
-    if (tx_lmo->mo_ptr == NULL) {
-        Debug_Printf("❌ ERROR: LMO MO 指標為 NULL (ID=0x%03X)\r\n", buffer->ident);
-        return CO_ERROR_ILLEGAL_ARGUMENT;
-    }
-    
-    Debug_Printf("✅ PASS: 找到有效的 TX LMO_%02d (MO%d, 索引=%d) for ID=0x%03X\r\n", 
-                tx_lmo_index + 1, tx_lmo->number, tx_lmo_index, buffer->ident);
-    
-    /* **檢測 6: 當前 LMO 狀態檢測** */
-    uint32_t mo_status = XMC_CAN_MO_GetStatus(tx_lmo->mo_ptr);
-    Debug_Printf("🔍 LMO 狀態檢測: 0x%08lX\r\n", mo_status);
-    
-    if (mo_status & XMC_CAN_MO_STATUS_TX_PENDING) {
-        Debug_Printf("⚠️ WARN: LMO 仍有傳輸待處理\r\n");
-    }
-    
-    if (mo_status & XMC_CAN_MO_STATUS_MESSAGE_VALID) {
-        Debug_Printf("✅ PASS: LMO 訊息有效位元已設定\r\n");
-    } else {
-        Debug_Printf("⚠️ WARN: LMO 訊息有效位元未設定\r\n");
-    }
-    
-    /* **檢測 7: 資料內容檢測 (前 4 bytes)** */
-    Debug_Printf("🔍 資料內容檢測 (DLC=%d): ", buffer->DLC);
-    for (int i = 0; i < buffer->DLC && i < 4; i++) {
-        Debug_Printf("0x%02X ", buffer->data[i]);
-    }
-    if (buffer->DLC > 4) {
-        Debug_Printf("...");
-    }
-    Debug_Printf("\r\n");
-    
-    if (tx_lmo != NULL && tx_lmo->mo_ptr != NULL) {
-        /* **🔧 完全使用 DAVE API 進行發送** */
-        Debug_Printf("=== 開始 DAVE API 傳送程序 ===\r\n");
-        
-        /* **✅ 優先使用 DAVE API 更新 ID** */
-        Debug_Printf("🔧 Step 1: 更新 CAN ID 到 LMO\r\n");
-        CAN_NODE_MO_UpdateID(tx_lmo, buffer->ident & 0x7FF);
-        Debug_Printf("✅ ID 0x%03X 已更新到 LMO\r\n", buffer->ident & 0x7FF);
-        
-        /* **⚠️ DLC 設定：DAVE 未提供 API，必須直接設定** */
-        Debug_Printf("🔧 Step 2: 設定 DLC\r\n");
-        tx_lmo->mo_ptr->can_data_length = buffer->DLC;
-        Debug_Printf("✅ DLC %d 已設定\r\n", buffer->DLC);
-        
-        /* **✅ 優先使用 DAVE API 更新數據** */
-        Debug_Printf("🔧 Step 3: 更新資料到 LMO\r\n");
-        CAN_NODE_STATUS_t update_status = CAN_NODE_MO_UpdateData(tx_lmo, buffer->data);
-        Debug_Printf("🔍 DAVE UpdateData 狀態: %d (0=SUCCESS)\r\n", update_status);
-        
-        if (update_status == CAN_NODE_STATUS_SUCCESS) {
-            /* **✅ 優先使用 DAVE API 發送** */
-            Debug_Printf("🔧 Step 4: 執行傳送\r\n");
-            CAN_NODE_STATUS_t tx_status = CAN_NODE_MO_Transmit(tx_lmo);
-            Debug_Printf("🔍 DAVE Transmit 狀態: %d (0=SUCCESS)\r\n", tx_status);
-            
-            if (tx_status == CAN_NODE_STATUS_SUCCESS) {
-                /* **🎯 關鍵修正：發送成功後立即釋放緩衝區，但加入發送節流** */
-                buffer->bufferFull = false;
-                CANmodule->CANtxCount++;
-                
-                /* **⚠️ 重要：加入發送延遲，避免過快重複發送** */
-                static uint32_t last_send_time = 0;
-                uint32_t current_time = CO_timer1ms;  /* 使用全域 1ms 計時器 */
-                
-                if (current_time > last_send_time) {
-                    last_send_time = current_time;
-                    Debug_Printf("✅ TX SUCCESS: ID=0x%03X via DAVE LMO_%02d (time=%lu)\r\n", 
-                                buffer->ident, (tx_lmo->number - 32) + 1, current_time);
-                } else {
-                    /* 避免在同一毫秒內重複輸出除錯訊息 */
-                    Debug_Printf("✅ TX SUCCESS: ID=0x%03X (同一毫秒)\r\n", buffer->ident);
-                }
-                
-                /* **🔧 額外檢查：確保訊息真的已發送完成** */
-                Debug_Printf("🔧 Step 5: 驗證傳送完成\r\n");
-                for (int retry = 0; retry < 10; retry++) {
-                    uint32_t mo_status = XMC_CAN_MO_GetStatus(tx_lmo->mo_ptr);
-                    if (!(mo_status & XMC_CAN_MO_STATUS_TX_PENDING)) {
-                        Debug_Printf("✅ 傳送完成確認 (重試 %d 次)\r\n", retry);
-                        break;  /* 發送完成 */
-                    }
-                    /* 短暫延遲 */
-                    for (volatile int i = 0; i < 100; i++);
-                }
-                Debug_Printf("=== DAVE API 傳送程序完成 ===\r\n");
-            } else {
-                buffer->bufferFull = true;
-                Debug_Printf("❌ TX ERROR: ID=0x%03X, DAVE transmit status=%d\r\n", buffer->ident, tx_status);
-                err = CO_ERROR_TX_OVERFLOW;
-            }
-        } else {
-            buffer->bufferFull = true;
-            Debug_Printf("❌ UPDATE ERROR: ID=0x%03X, DAVE update status=%d\r\n", buffer->ident, update_status);
-            err = CO_ERROR_TX_OVERFLOW;
+            CO_CANerr_event(CANmodule, CO_CAN_ERRTX_OVERFLOW);
         }
-    } else {
-        Debug_Printf("❌ CRITICAL ERROR: LMO 或 MO 指標無效 for ID=0x%03X\r\n", buffer->ident);
         err = CO_ERROR_TX_OVERFLOW;
     }
+    CO_UNLOCK_CAN_SEND(CANmodule);
 
+    g_tx_send_cycles_max = g_tx_lmo.sendCyclesMax;
     return err;
 }
+#endif
 
 /******************************************************************************/
 void CO_CANclearPendingSyncPDOs(CO_CANmodule_t *CANmodule)
@@ -1031,21 +1444,26 @@ void CO_CANclearPendingSyncPDOs(CO_CANmodule_t *CANmodule)
         uint16_t i;
         CO_CANtx_t *buffer = &CANmodule->txArray[0];
         for (i = CANmodule->txSize; i > 0U; i--) {
-            if (buffer->bufferFull) {
-                if (buffer->syncFlag) {
-                    buffer->bufferFull = false;
-                    CANmodule->CANtxCount--;
+            if (buffer->bufferFull && buffer->syncFlag) {
+#if CO_CAN_TX_FIFO_ENABLE
+                /* 佇列中的項目在取出時略過 */
+                buffer->bufferFull = false;
+                CANmodule->CANtxCount--;
+                tpdoDeleted = 2U;
+#else
+                /* 已寫入 TX LMO 的訊框不取消，只刪除 PENDING 的緩衝區 */
+                if (CO_CANtxLmo_cancel(&g_tx_lmo, CANmodule, buffer)) {
                     tpdoDeleted = 2U;
                 }
+#endif
             }
             buffer++;
         }
     }
-    CO_UNLOCK_CAN_SEND();
-
     if (tpdoDeleted != 0U) {
-        CANmodule->CANerrorStatus |= CO_CAN_ERRTX_PDO_LATE;
+        CO_CANerr_event(CANmodule, CO_CAN_ERRTX_PDO_LATE);
     }
+    CO_UNLOCK_CAN_SEND();
 }
 
 
@@ -1067,6 +1485,7 @@ void CO_CANmodule_process(CO_CANmodule_t *CANmodule)
     static uint32_t rx_found = 0;
     poll_counter++;
     
+#if !CO_CAN_RX_FIFO_ENABLE  /* FIFO 模式完全由中斷讀出，RX LMO 已停用 */
     /* **🔧 動態檢查所有 LMO 的 RX 狀態（不依賴中斷）** */
     for (uint8_t lmo_idx = 0; lmo_idx < CAN_NODE_0.mo_count; lmo_idx++) {
         const CAN_NODE_LMO_t *lmo = CAN_NODE_0.lmobj_ptr[lmo_idx];
@@ -1078,14 +1497,21 @@ void CO_CANmodule_process(CO_CANmodule_t *CANmodule)
             rx_checks++;
             
             /* **🎯 關鍵：檢查 NEWDAT 位而不是 RX_PENDING** */
-            uint32_t status = XMC_CAN_MO_GetStatus(lmo->mo_ptr);
-        
-            /* 檢查是否有新的接收數據 */
-            if (status & XMC_CAN_MO_STATUS_NEW_DATA) {
-                rx_found++;
-                
-                /* 調用接收處理函數 */
-                CO_CANinterrupt_Rx(CANmodule, lmo_idx);
+            if ((XMC_CAN_MO_GetStatus(lmo->mo_ptr) & XMC_CAN_MO_STATUS_NEW_DATA) == 0U) {
+                continue;
+            }
+
+            /* **🔒 遮罩 CAN 中斷後以 ISR 相同的路徑讀進 RX 環形緩衝區**
+             * NEWDAT 檢查與讀取不會被 ISR 插入，同一訊框不會處理兩次，
+             * 環形緩衝區也維持單一生產者 */
+            CO_LOCK_CAN_SEND(CANmodule);
+            uint32_t drops = g_rx_ring.dropCount;
+            uint32_t found = CO_CANinterrupt_Rx(CANmodule, lmo_idx);
+            canopen_rx_ring_signal(CANmodule, drops);
+            CO_UNLOCK_CAN_SEND(CANmodule);
+
+            if (found > 0U) {
+                rx_found += found;
                 
                 /* 簡化的除錯輸出（避免輸出過多） */
                 if ((rx_found % 10) == 1) {  /* 每 10 次輸出一次 */
@@ -1095,176 +1521,91 @@ void CO_CANmodule_process(CO_CANmodule_t *CANmodule)
             }
         }
     }
+#endif
+
+#if !CO_CAN_TX_FIFO_ENABLE
+    /* **📤 回收遺失的 TX 中斷，放棄逾時仍未送出的訊框** */
+    CO_LOCK_CAN_SEND(CANmodule);
+    CO_CANtxLmo_poll(&g_tx_lmo, CANmodule, CO_CAN_CYCLES());
+    CO_UNLOCK_CAN_SEND(CANmodule);
+#endif
 
     /* 定期報告系統狀態 */
     if ((poll_counter % 5000) == 0) {
         Debug_Printf("📊 RX 輪詢統計: 檢查 %lu 次，發現 %lu 次\r\n", rx_checks, rx_found);
     }
 
-    /* 簡化錯誤處理 - 避免複雜的 Emergency 依賴 */
+    /* 溢位與 TPDO 逾時事件保留到 CO_EM_process() 看過一次，之後才清除 */
+    CO_LOCK_CAN_SEND(CANmodule);
+    CO_CANerr_process(CANmodule);
+    CO_UNLOCK_CAN_SEND(CANmodule);
     CANmodule->errOld = 0;
-    CANmodule->CANerrorStatus = 0;
 }
 
 /******************************************************************************/
-/* CAN RX interrupt */
-static void CO_CANinterrupt_Rx(CO_CANmodule_t *CANmodule, uint32_t index)
+/* CAN RX interrupt - 讀出 RX LMO 的訊框到 RX 環形緩衝區，分派在 RX 軟體中斷中進行 */
+static uint32_t CO_CANinterrupt_Rx(CO_CANmodule_t *CANmodule, uint32_t index)
 {
+    (void)CANmodule;
+
     /* **🎯 根據 index 動態獲取對應的 RX LMO** */
     if (index >= CAN_NODE_0.mo_count) {
-        Debug_Printf("❌ RX index %d 超出範圍 (最大 %d)\r\n", index, CAN_NODE_0.mo_count - 1);
-        return;
+        return 0U;
     }
     
     CAN_NODE_LMO_t *rx_lmo = (CAN_NODE_LMO_t*)CAN_NODE_0.lmobj_ptr[index];
     
     /* **🔍 確保這個 LMO 確實是 RX 類型** */
-    if (rx_lmo != NULL && rx_lmo->mo_ptr != NULL &&
-        rx_lmo->mo_ptr->can_mo_type == XMC_CAN_MO_TYPE_RECMSGOBJ) {
-        
-        /* **🔧 關鍵修正：使用正確的 DAVE API 檢查和接收資料** */
-        uint32_t mo_status = CAN_NODE_MO_GetStatus(rx_lmo);
-        
-        /* 檢查是否有待處理的接收訊息 */
-        if (mo_status & XMC_CAN_MO_STATUS_RX_PENDING) {
-            
-            /* 清除接收 pending 狀態 */
-            XMC_CAN_MO_ResetStatus(rx_lmo->mo_ptr, XMC_CAN_MO_RESET_STATUS_RX_PENDING);
-            
-            /* 使用正確的 DAVE API 接收資料 */
-            CAN_NODE_STATUS_t rx_status = CAN_NODE_MO_Receive(rx_lmo);
+    if (rx_lmo == NULL || rx_lmo->mo_ptr == NULL ||
+        rx_lmo->mo_ptr->can_mo_type != XMC_CAN_MO_TYPE_RECMSGOBJ) {
+        return 0U;
+    }
 
-            if (rx_status == CAN_NODE_STATUS_SUCCESS) {
-                /* **📨 從 DAVE 接收結構中讀取 CAN 訊息** */
-                CO_CANrxMsg_t rcvMsg;
-                
-                /* **✅ 使用 DAVE 接收到的資料構建 CANopen 訊息** */
-                rcvMsg.ident = rx_lmo->mo_ptr->can_identifier & 0x07FFU;
-                rcvMsg.DLC = rx_lmo->mo_ptr->can_data_length & 0x0FU;  /* 確保 DLC 在有效範圍 */
-                
-                /* **🎯 特別處理 ID=0x000 (NMT) 的除錯輸出** */
-                if (rcvMsg.ident == 0x000) {
-                    Debug_Printf("🎯 NMT 訊息接收: ID=0x000, DLC=%d\r\n", rcvMsg.DLC);
-                }
-                
-                /* 複製數據 - 使用 DAVE 的資料格式 */
-                uint64_t received_data = ((uint64_t)rx_lmo->mo_ptr->can_data[1] << 32) | rx_lmo->mo_ptr->can_data[0];
-                for (int i = 0; i < rcvMsg.DLC && i < 8; i++) {
-                    rcvMsg.data[i] = (uint8_t)((received_data >> (i * 8)) & 0xFF);
-                }
-            
-                /* **🎯 資料有效性檢查 - 修正：允許 ID=0x000 (NMT 命令)** */
-                if (rcvMsg.ident >= 0x000 && rcvMsg.ident <= 0x7FF && rcvMsg.DLC <= 8) {
-                    
-                    /* **🔍 尋找匹配的接收緩衝區** */
-                    bool message_processed = false;
-                    for (uint16_t i = 0; i < CANmodule->rxSize; i++) {
-                        CO_CANrx_t *buffer = &CANmodule->rxArray[i];
-                        if (buffer != NULL && buffer->CANrx_callback != NULL) {
-                            /* 檢查 ID 和遮罩是否匹配 */
-                            if (((rcvMsg.ident ^ buffer->ident) & buffer->mask) == 0U) {
-                                /* **✅ 調用 CANopen 處理函數** */
-                                buffer->CANrx_callback(buffer->object, (void*)&rcvMsg);
-                                message_processed = true;
-                                
-                                /* 簡化的除錯輸出 */
-                                static uint32_t rx_msg_count = 0;
-                                rx_msg_count++;
-                                if ((rx_msg_count % 5) == 1) {  /* 每 5 次輸出一次 */
-                                    Debug_Printf("📨 RX: ID=0x%03X DLC=%d LMO_%02d (#%lu)\r\n", 
-                                               rcvMsg.ident, rcvMsg.DLC, index + 1, rx_msg_count);
-                                }
-                                break;
-                            }
-                        }
-                    }
-                    
-                    if (!message_processed) {
-                        static uint32_t unmatched_count = 0;
-                        unmatched_count++;
-                        
-                        /* **🎯 特別關注 NMT 訊息的處理失敗** */
-                        if (rcvMsg.ident == 0x000) {
-                            Debug_Printf("🚨 NMT 訊息無匹配接收緩衝區! ID=0x000 DLC=%d\r\n", rcvMsg.DLC);
-                            /* 顯示所有接收緩衝區的設定供診斷 */
-                            for (uint16_t j = 0; j < CANmodule->rxSize && j < 5; j++) {
-                                CO_CANrx_t *buf = &CANmodule->rxArray[j];
-                                if (buf->CANrx_callback != NULL) {
-                                    Debug_Printf("  RxBuf[%d]: ID=0x%03X Mask=0x%03X\r\n", 
-                                               j, buf->ident, buf->mask);
-                                }
-                            }
-                        } else if ((unmatched_count % 10) == 1) {  /* 其他訊息每 10 次輸出一次 */
-                            Debug_Printf("🚫 RX 無匹配: ID=0x%03X LMO_%02d (#%lu)\r\n", 
-                                       rcvMsg.ident, index + 1, unmatched_count);
-                        }
-                    }
-                } else {
-                    static uint32_t invalid_count = 0;
-                    invalid_count++;
-                    if ((invalid_count % 10) == 1) {  /* 每 10 次輸出一次 */
-                        Debug_Printf("❌ RX 無效資料: ID=0x%03X DLC=%d LMO_%02d (#%lu)\r\n", 
-                                   rcvMsg.ident, rcvMsg.DLC, index + 1, invalid_count);
-                    }
-                }
-            } else {
-                static uint32_t rx_error_count = 0;
-                rx_error_count++;
-                if ((rx_error_count % 20) == 1) {  /* 每 20 次輸出一次 */
-                    Debug_Printf("❌ DAVE Receive 失敗: %d LMO_%02d (#%lu)\r\n", 
-                               rx_status, index + 1, rx_error_count);
-                }
-            }
+    /* **⚡ 讀取期間到達的新訊框一併讀出，每次事件最多 CO_CAN_RX_IRQ_BUDGET 個** */
+    uint32_t count = 0U;
+    while (count < CO_CAN_RX_IRQ_BUDGET) {
+        uint32_t start = CO_CAN_CYCLES();
+
+        /* 只讀一次 MOSTAT：NEWDAT 表示有尚未讀取的訊框 (MSPND 路由或輪詢觸發) */
+        if ((XMC_CAN_MO_GetStatus(rx_lmo->mo_ptr) & XMC_CAN_MO_STATUS_NEW_DATA) == 0U) {
+            break;
+        }
+
+        /* **⚡ 由 MO 暫存器直接讀進環形緩衝區的空格** - 緩衝區滿時照常清除 MO，訊框丟棄 */
+        CO_CANrxMsg_t *slot = CO_CANrxRing_reserve(&g_rx_ring);
+        if (slot != NULL) {
+            CO_CANrxMo_read(rx_lmo->mo_ptr, slot);
+            CO_CANrxRing_commit(&g_rx_ring);
         } else {
-            /* 沒有 RX pending，正常情況 */
+            CO_CANrxMsg_t dropped;
+            CO_CANrxMo_read(rx_lmo->mo_ptr, &dropped);
+        }
+        count++;
+
+        uint32_t cycles = CO_CAN_CYCLES() - start;
+        if (cycles > g_rx_frame_cycles_max) {
+            g_rx_frame_cycles_max = cycles;
         }
-    } else {
-        /* 這個 LMO 不是 RX 類型，忽略 */
-        Debug_Printf("⚠️ LMO_%02d 不是 RX 類型，忽略中斷\r\n", index + 1);
     }
+    return count;
 }
 
 /******************************************************************************/
 /* CAN TX interrupt - 處理發送完成事件 */
 static void CO_CANinterrupt_Tx(CO_CANmodule_t *CANmodule, uint32_t index)
 {
-    /* **🎯 TX 中斷處理 - 基於 DAVE 配置動態檢查** */
-    if (index >= CAN_NODE_0.mo_count) {
-        Debug_Printf("❌ TX index %d 超出範圍 (最大 %d)\r\n", index, CAN_NODE_0.mo_count - 1);
-        return;
-    }
-    
-    const CAN_NODE_LMO_t *tx_lmo = CAN_NODE_0.lmobj_ptr[index];
-    
-    /* **🔍 確保這個 LMO 確實是 TX 類型** */
-    if (tx_lmo != NULL && tx_lmo->mo_ptr != NULL &&
-        tx_lmo->mo_ptr->can_mo_type == XMC_CAN_MO_TYPE_TRANSMSGOBJ) {
-        
-        if (CANmodule != NULL && index < CANmodule->txSize) {
-            /* 檢查對應的發送緩衝區 */
-            CO_CANtx_t *buffer = &CANmodule->txArray[index];
-            
-            if (buffer->bufferFull) {
-                /* 發送完成，清除 bufferFull 標誌 */
-                buffer->bufferFull = false;
-                CANmodule->CANtxCount--;
-                
-                /* 簡化的除錯輸出 */
-                static uint32_t tx_complete_count = 0;
-                tx_complete_count++;
-                if ((tx_complete_count % 10) == 1) {  /* 每 10 次輸出一次 */
-                    Debug_Printf("📤 TX Complete: LMO_%02d (#%lu)\r\n", 
-                               index + 1, tx_complete_count);
-                }
-            }
-        }
-        
-        /* 標記第一次發送完成 */
-        CANmodule->firstCANtxMessage = false;
-    } else {
-        /* 這個 LMO 不是 TX 類型，忽略 */
-        Debug_Printf("⚠️ LMO_%02d 不是 TX 類型，忽略中斷\r\n", index + 1);
-    }
+#if !CO_CAN_TX_FIFO_ENABLE
+    /* **📤 傳送完成：釋放緩衝區並接續下一個 PENDING 緩衝區** */
+    CO_LOCK_CAN_SEND(CANmodule);
+    (void)CO_CANtxLmo_service(&g_tx_lmo, CANmodule, (uint8_t)index);
+    CO_UNLOCK_CAN_SEND(CANmodule);
+
+    g_tx_isr_cycles_max = g_tx_lmo.serviceCyclesMax;
+#else
+    /* FIFO 模式不使用 DAVE TX LMO */
+    (void)CANmodule;
+    (void)index;
+#endif
 }
 
 /******************************************************************************/
@@ -1297,81 +1638,78 @@ void CO_CANsetNormalMode(CO_CANmodule_t *CANmodule)
 }
 
 /******************************************************************************/
-/* 中斷安全的除錯輸出函式 - 非阻塞版本 */
-static void Debug_Printf_ISR(const char* format, ...)
+/* 處理中斷除錯紀錄輸出 - 在主循環中調用 */
+void Debug_ProcessISRBuffer(void)
 {
-    /* 🎯 中斷中只將訊息放入緩衝區，不進行 UART 傳輸 */
-    char temp_buffer[128];
-    va_list args;
-    va_start(args, format);
-    int len = vsnprintf(temp_buffer, sizeof(temp_buffer), format, args);
-    va_end(args);
-    
-    if (len > 0) {
-        /* 將訊息放入環形緩衝區 */
-        for (int i = 0; i < len && i < (sizeof(temp_buffer) - 1); i++) {
-            uint16_t next_write = (isr_debug_write_index + 1) % ISR_DEBUG_BUFFER_SIZE;
-            
-            if (next_write != isr_debug_read_index) {
-                isr_debug_buffer[isr_debug_write_index] = temp_buffer[i];
-                isr_debug_write_index = next_write;
-            } else {
-                /* 緩衝區溢位 */
-                isr_debug_overflow = true;
-                break;
-            }
-        }
-        
-        /* 添加分隔符 */
-        uint16_t next_write = (isr_debug_write_index + 1) % ISR_DEBUG_BUFFER_SIZE;
-        if (next_write != isr_debug_read_index) {
-            isr_debug_buffer[isr_debug_write_index] = '\n';
-            isr_debug_write_index = next_write;
-        }
+    static uint32_t reported_drops = 0;
+    char line[128];
+    CO_logEntry_t entry;
+
+    /* 檢查是否有紀錄因緩衝區滿而遺失 */
+    uint32_t dropped = g_isr_log.dropped + g_softirq_log.dropped;
+    if (dropped != reported_drops) {
+        Debug_Printf("⚠️ ISR 除錯緩衝區溢位！遺失 %lu 筆\r\n", dropped - reported_drops);
+        reported_drops = dropped;
     }
-}
 
-/******************************************************************************/
-/* 處理中斷除錯緩衝區輸出 - 在主循環中調用 */
-void Debug_ProcessISRBuffer(void)
-{
-    static char output_buffer[256];
-    uint16_t output_index = 0;
-    
-    /* 檢查是否有緩衝區溢位 */
-    if (isr_debug_overflow) {
-        Debug_Printf("⚠️ ISR 除錯緩衝區溢位！\r\n");
-        isr_debug_overflow = false;
+    /* 每次最多輸出每個緩衝區一輪的紀錄，避免長時間佔用主循環 */
+    for (uint32_t n = 0; n < CO_LOG_RING_SIZE && CO_log_read(&g_isr_log, &entry); n++) {
+        CO_log_format(&entry, line, sizeof(line));
+        Debug_Printf("🎯 ISR: %s\r\n", line);
     }
-    
-    /* 從環形緩衝區讀取數據 */
-    while (isr_debug_read_index != isr_debug_write_index && output_index < (sizeof(output_buffer) - 1)) {
-        char ch = isr_debug_buffer[isr_debug_read_index];
-        isr_debug_read_index = (isr_debug_read_index + 1) % ISR_DEBUG_BUFFER_SIZE;
-        
-        output_buffer[output_index++] = ch;
-        
-        /* 遇到換行符或緩衝區快滿時，輸出一行 */
-        if (ch == '\n' || output_index >= (sizeof(output_buffer) - 10)) {
-            output_buffer[output_index] = '\0';
-            Debug_Printf("🎯 ISR: %s\r", output_buffer);  /* 使用 \r 避免雙換行 */
-            output_index = 0;
-        }
+    for (uint32_t n = 0; n < CO_LOG_RING_SIZE && CO_log_read(&g_softirq_log, &entry); n++) {
+        CO_log_format(&entry, line, sizeof(line));
+        Debug_Printf("🎯 RT: %s\r\n", line);
     }
-    
-    /* 輸出剩餘數據 */
-    if (output_index > 0) {
-        output_buffer[output_index] = '\0';
-        Debug_Printf("🎯 ISR: %s\r\n", output_buffer);
+
+    /* 除錯 UART 丟棄統計 - 等緩衝區有空間再提示，避免提示本身也被丟棄 */
+    static uint32_t reported_uart_drops = 0;
+    if (g_debug_uart.droppedBytes != reported_uart_drops
+        && CO_uartRing_pending(&g_debug_uart) + sizeof(line) <= CO_UART_RING_SIZE) {
+        reported_uart_drops = g_debug_uart.droppedBytes;
+        Debug_Printf("⚠️ 除錯 UART 緩衝區滿！累計丟棄 %lu bytes\r\n", reported_uart_drops);
     }
+
+    /* 即使沒有新訊息也要接續傳送 */
+    Debug_UART_Kick();
 }
 
 /******************************************************************************/
 /* **📋 Debug_Printf 統一實現系統** */
 /******************************************************************************/
 
+/**
+ * @brief 除錯 UART 接續傳送 - 前一段送完後把下一段交給 UART TX 中斷
+ *
+ * 不等待 tx_busy；由 Debug_Printf_Raw() 與主循環 (Debug_ProcessISRBuffer) 呼叫。
+ */
+static void Debug_UART_Kick(void)
+{
+    uint8_t *data;
+
+    if (UART_0.runtime->tx_busy) {
+        return;
+    }
+    if (g_debug_uart_sending) {
+        CO_uartRing_sent(&g_debug_uart);
+        g_debug_uart_sending = false;
+    }
+
+    uint32_t len = CO_uartRing_claim(&g_debug_uart, &data);
+    if (len > 0U && UART_Transmit(&UART_0, data, len) == UART_STATUS_SUCCESS) {
+        g_debug_uart_sending = true;
+    }
+
+    g_debug_uart_dropped_bytes = g_debug_uart.droppedBytes;
+    g_debug_uart_max_fill = g_debug_uart.maxFill;
+}
+
 /**
  * @brief 原始 Debug_Printf 實現 - 處理所有 UART 輸出
+ *
+ * 格式化後寫入 g_debug_uart 就返回，不等待 UART；緩衝區滿時依
+ * CO_UART_RING_POLICY 丟棄並累計 g_debug_uart_dropped_bytes。
+ * 只能在主循環 (執行緒) 中呼叫，中斷內請使用 Debug_Log_ISR()。
  * @param format 格式化字串
  * @param ... 可變參數
  */
@@ -1383,40 +1721,14 @@ void Debug_Printf_Raw(const char* format, ...)
     int len = vsnprintf(debug_buffer, sizeof(debug_buffer), format, args);
     va_end(args);
     
-    if (len > 0 && len < sizeof(debug_buffer)) {
-        /* 🎯 確保字串正確終止 */
-        debug_buffer[len] = '\0';
-        
-        /* 限制字串長度，避免緩衝區溢位 */
-        if (len > 200) {
-            len = 200;
-            debug_buffer[len] = '\0';
+    if (len > 0) {
+        /* 超過緩衝區的部分已被 vsnprintf 截斷 */
+        if (len >= (int)sizeof(debug_buffer)) {
+            len = sizeof(debug_buffer) - 1;
         }
         
-        UART_STATUS_t uart_status = UART_Transmit(&UART_0, (uint8_t*)debug_buffer, len);
-        if (uart_status == UART_STATUS_SUCCESS) {
-            /* 🔧 修正：必須等待 UART 傳輸完成，否則數據會被截斷 */
-            uint32_t timeout = 0;
-            const uint32_t MAX_TIMEOUT = 50000;  /* 增加超時時間 */
-            
-            while (UART_0.runtime->tx_busy == true && timeout < MAX_TIMEOUT) {
-                timeout++;
-                /* 小延遲，讓 UART 有時間處理 */
-                for (volatile int i = 0; i < 10; i++);
-            }
-            
-            /* 額外的小延遲，確保最後幾個字元完全傳輸 */
-            for (volatile int i = 0; i < 1000; i++);
-            
-            if (timeout >= MAX_TIMEOUT) {
-                /* 超時錯誤處理 - 但不要無限遞迴調用 Debug_Printf */
-                static volatile bool timeout_reported = false;
-                if (!timeout_reported) {
-                    timeout_reported = true;
-                    /* 簡單標記，避免遞迴 */
-                }
-            }
-        }
+        CO_uartRing_write(&g_debug_uart, (const uint8_t*)debug_buffer, (uint32_t)len);
+        Debug_UART_Kick();
     }
 }
 
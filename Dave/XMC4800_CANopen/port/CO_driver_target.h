@@ -49,15 +49,37 @@ typedef struct {
 #define CO_CONFIG_LSS       (CO_CONFIG_LSS_SLAVE)    /* 啟用 LSS Slave 功能 */
 #define CO_CONFIG_LEDS      0                        /* 禁用 LED 功能 (XMC4800 自訂實現) */
 
-/* Critical sections - 支援兩種調用方式 */
-#define CO_LOCK_CAN_SEND(...)               do { __disable_irq(); } while (0)
-#define CO_UNLOCK_CAN_SEND(...)             do { __enable_irq(); } while (0)
+/* **🎯 事件驅動主循環 (CO_sched.c)** - NMT/HB/EMCY/SDO 接收時以回呼喚醒主循環，
+ * 並由 CO_process() 回報下一次需要處理的時間；SYNC/PDO 在 1 ms 計時器中斷中處理，不需要 */
+#define CO_CONFIG_GLOBAL_FLAG_CALLBACK_PRE          CO_CONFIG_FLAG_CALLBACK_PRE
+#define CO_CONFIG_GLOBAL_FLAG_TIMERNEXT             CO_CONFIG_FLAG_TIMERNEXT
 
-#define CO_LOCK_EMCY(...)                   do { __disable_irq(); } while (0)
-#define CO_UNLOCK_EMCY(...)                 do { __enable_irq(); } while (0)
+/* **🎯 RT slot (CO_rt.c)** - SYNC 接收時以回呼立即觸發 SYNC/RPDO/TPDO 處理 */
+#define CO_CONFIG_GLOBAL_RT_FLAG_CALLBACK_PRE       CO_CONFIG_FLAG_CALLBACK_PRE
 
-#define CO_LOCK_OD(CAN_MODULE)              do { (CAN_MODULE)->primask_od = __get_PRIMASK(); __disable_irq(); } while (0)
-#define CO_UNLOCK_OD(CAN_MODULE)            __set_PRIMASK((CAN_MODULE)->primask_od)
+/* **🎯 狀態變化 TPDO** - 事件驅動 TPDO 在映射的 OD 變數與上次傳送的資料不同時自動傳送 (禁止時間後檢查)；
+ * 自訂 IO 的變數經由 OD_set_value() 寫入改變時呼叫 OD_requestTPDO() */
+#define CO_CONFIG_PDO                                                                                   \
+    (CO_CONFIG_RPDO_ENABLE | CO_CONFIG_TPDO_ENABLE | CO_CONFIG_RPDO_TIMERS_ENABLE                       \
+     | CO_CONFIG_TPDO_TIMERS_ENABLE | CO_CONFIG_PDO_SYNC_ENABLE | CO_CONFIG_PDO_OD_IO_ACCESS            \
+     | CO_CONFIG_TPDO_COS_ENABLE | CO_CONFIG_GLOBAL_RT_FLAG_CALLBACK_PRE                                \
+     | CO_CONFIG_GLOBAL_FLAG_TIMERNEXT | CO_CONFIG_GLOBAL_FLAG_OD_DYNAMIC)
+#define OD_SET_VALUE_REQUEST_TPDO                   1
+
+/* **🎯 SDO 區塊傳輸** - 大量參數 / 記錄 (例如 OD 0x2200 參數 flash) 以區塊下載 / 上傳，
+ * 每個區塊最多 127 個分段只確認一次；緩衝區 900 bytes 容納一個完整區塊 (127 x 7)，區塊 CRC 使用 CO_crc16.c
+ * (slice-by-8 或 FCE，取代 crc16-ccitt.c 的逐 byte 查表) */
+#ifndef CO_CONFIG_SDO_SRV
+#define CO_CONFIG_SDO_SRV                                                                               \
+    (CO_CONFIG_SDO_SRV_SEGMENTED | CO_CONFIG_SDO_SRV_BLOCK | CO_CONFIG_GLOBAL_FLAG_CALLBACK_PRE         \
+     | CO_CONFIG_GLOBAL_FLAG_TIMERNEXT | CO_CONFIG_GLOBAL_FLAG_OD_DYNAMIC)
+#endif
+#ifndef CO_CONFIG_SDO_SRV_BUFFER_SIZE
+#define CO_CONFIG_SDO_SRV_BUFFER_SIZE               900U
+#endif
+#ifndef CO_CONFIG_CRC16
+#define CO_CONFIG_CRC16                             (CO_CONFIG_CRC16_ENABLE | CO_CONFIG_CRC16_EXTERNAL)
+#endif
 
 /* Data types */
 typedef bool                    bool_t;
@@ -67,6 +89,95 @@ typedef char                    char_t;
 typedef unsigned char           oChar_t;
 typedef unsigned char           domain_t;
 
+/* **🎯 RX 分派索引 - 11-bit COB-ID 直接查表，取代 ISR 內的線性掃描** */
+#define CO_CAN_RX_DISPATCH_SIZE         2048U   /* 11-bit 標準識別碼數量 */
+#define CO_CAN_RX_DISPATCH_NONE         0xFFU   /* 此 COB-ID 無精確匹配的接收緩衝區 */
+#define CO_CAN_RX_MASKED_MAX            8U      /* 備用掃描清單容量，超過時掃描整個 rxArray */
+
+/* **🎯 RX FIFO 模式 - 以 MultiCAN 硬體 FIFO 取代每個 COB-ID 一個 RX LMO (CO_rx_fifo.c)** */
+#ifndef CO_CAN_RX_FIFO_ENABLE
+#define CO_CAN_RX_FIFO_ENABLE           0       /* 1: 所有接收訊框進入 FIFO，DAVE RX LMO 停用 */
+#endif
+#ifndef CO_CAN_RX_FIFO_BASE_MO
+#define CO_CAN_RX_FIFO_BASE_MO          64U     /* 基底 MO 編號，slave 為其後連續的 MO (DAVE 未使用) */
+#endif
+#ifndef CO_CAN_RX_FIFO_DEPTH
+#define CO_CAN_RX_FIFO_DEPTH            32U     /* slave 數量 - 500 kbit/s 下約 3 ms 的滿載訊框 */
+#endif
+/* CO_CANrxBufferInit() 可在匯流排運作中改變 COB-ID：RX FIFO 模式只更新分派表，
+ * LMO 模式會以 CAN_NODE_MO_Init() 重新初始化 DAVE 的 RX LMO，只能在初始化時調用 */
+#ifndef CO_CAN_RX_LIVE_SETUP
+#define CO_CAN_RX_LIVE_SETUP            CO_CAN_RX_FIFO_ENABLE
+#endif
+
+/* **🎯 RX 環形緩衝區 - ISR 只讀出訊框，查表與 CANopen 回呼在 RT slot 的 PendSV 中分批處理 (CO_rx_ring.c)** */
+#ifndef CO_CAN_RX_IRQ_BUDGET
+#define CO_CAN_RX_IRQ_BUDGET            4U      /* 每次 RX LMO 事件最多讀出的訊框數 (讀取期間到達的新訊框) */
+#endif
+#ifndef CO_CAN_RX_SOFTIRQ_BUDGET
+#define CO_CAN_RX_SOFTIRQ_BUDGET        16U     /* 每個 1 ms 週期最多分派的訊框數 (1 Mbit/s 滿載約 9 個 8-byte 訊框) */
+#endif
+#ifndef CO_CAN_RX_SOFTIRQ_CYCLES
+#define CO_CAN_RX_SOFTIRQ_CYCLES        (144000000U / 1000U * 4U / 10U) /* 每個 1 ms 週期最多的分派時間 (400 us) */
+#endif
+
+/* **🎯 TX FIFO 模式 - 以 MultiCAN 硬體 FIFO 連續傳送，待送訊框依 COB-ID 排序 (CO_tx_fifo.c)** */
+#ifndef CO_CAN_TX_FIFO_ENABLE
+#define CO_CAN_TX_FIFO_ENABLE           0       /* 1: 所有傳送訊框經由 FIFO，DAVE TX LMO 不使用 */
+#endif
+#ifndef CO_CAN_TX_FIFO_BASE_MO
+#define CO_CAN_TX_FIFO_BASE_MO          112U    /* 基底 MO 編號 (FIFO 第一個元素)，其後連續的 MO 為 slave */
+#endif
+#ifndef CO_CAN_TX_FIFO_DEPTH
+#define CO_CAN_TX_FIFO_DEPTH            4U      /* 硬體中的訊框數 - 越淺優先權反轉越短 (最多 DEPTH 個訊框) */
+#endif
+#ifndef CO_CAN_TX_QUEUE_SIZE
+#define CO_CAN_TX_QUEUE_SIZE            32U     /* 軟體優先權佇列容量，必須 >= txSize (CO_tx_queue.c) */
+#endif
+
+/* **🎯 TX LMO 狀態機 - 每個 DAVE TX LMO 一個 slot，完成中斷接續待送緩衝區 (CO_tx_lmo.c)** */
+#define CO_CAN_TX_LMO_MAX               16U     /* slot 數 (以 CAN_NODE_0 LMO index 編號)，>= mo_count */
+#ifndef CO_CAN_TX_LMO_TIMEOUT_CYCLES
+#define CO_CAN_TX_LMO_TIMEOUT_CYCLES    (144000000U / 10U)  /* 100 ms (144 MHz)：仍未送出的訊框清除 TXRQ 後放棄 */
+#endif
+
+/* 傳送緩衝區狀態 - bufferFull 在 PENDING 與 ACTIVE 時為 true */
+#define CO_CAN_TX_IDLE                  0U      /* 沒有待送訊框 */
+#define CO_CAN_TX_PENDING               1U      /* 等待空閒的 TX LMO */
+#define CO_CAN_TX_ACTIVE                2U      /* 已寫入 TX LMO，等待傳送完成中斷 */
+
+/* **⏱️ 週期量測 hook - 預設讀取 DWT CYCCNT (CO_CANmodule_init() 啟用)，可由編譯選項替換** */
+#ifndef CO_CAN_CYCLES
+#define CO_CAN_CYCLES()                 (DWT->CYCCNT)
+#endif
+
+/* **⏱️ 中斷優先權 (NVIC 數值，越小越優先) - canopen_rt_setup() 啟動時套用** */
+#ifndef CO_CAN_IRQ_PRIORITY
+#define CO_CAN_IRQ_PRIORITY             62U     /* CAN 收發中斷，必須高於 RT slot */
+#endif
+#ifndef CO_RT_PRIORITY
+#define CO_RT_PRIORITY                  63U     /* SYNC/RPDO/TPDO RT slot (PendSV) */
+#endif
+#if CO_CAN_IRQ_PRIORITY >= CO_RT_PRIORITY
+#error "CO_CAN_IRQ_PRIORITY must be numerically lower (more urgent) than CO_RT_PRIORITY"
+#endif
+
+/* **🔒 Critical sections - BASEPRI 只遮罩需要的優先權，支援巢狀與持有時間量測 (CO_lock.c)** */
+#include "CO_lock.h"
+
+/* 支援兩種調用方式 (有無 CANmodule 參數)，狀態存在 CO_lockClass[] */
+#define CO_LOCK_CAN_SEND(...)               CO_lock_enter(CO_LOCK_CLASS_CAN_SEND, CO_LOCK_BASEPRI(CO_LOCK_PRIORITY_CAN_SEND))
+#define CO_UNLOCK_CAN_SEND(...)             CO_lock_exit(CO_LOCK_CLASS_CAN_SEND)
+
+#define CO_LOCK_EMCY(...)                   CO_lock_enter(CO_LOCK_CLASS_EMCY, CO_LOCK_BASEPRI(CO_LOCK_PRIORITY_RT))
+#define CO_UNLOCK_EMCY(...)                 CO_lock_exit(CO_LOCK_CLASS_EMCY)
+
+#define CO_LOCK_OD(...)                     CO_lock_enter(CO_LOCK_CLASS_OD, CO_LOCK_BASEPRI(CO_LOCK_PRIORITY_RT))
+#define CO_UNLOCK_OD(...)                   CO_lock_exit(CO_LOCK_CLASS_OD)
+
+/* **⏱️ 處理函數週期量測 - CO_PROF_BEGIN/END，統計經由 OD 0x2100 讀出 (CO_prof.c)** */
+#include "CO_prof.h"
+
 /* Forward declarations */
 typedef struct CO_CANrx_t CO_CANrx_t;
 typedef struct CO_CANtx_t CO_CANtx_t;
@@ -85,11 +196,12 @@ typedef struct CO_CANmodule_t {
     volatile bool_t         firstCANtxMessage; /* First transmitted message flag */
     volatile uint16_t       CANtxCount;        /* Number of messages waiting */
     uint32_t                errOld;            /* Previous state of CAN errors */
-    
-    /* Critical section primask storage - 必要的關鍵段保護 */
-    uint32_t                primask_send;
-    uint32_t                primask_emcy;
-    uint32_t                primask_od;
+    volatile uint16_t       CANerrorEvents;    /* 上次 CO_CANmodule_process() 之後的溢位 / TPDO 逾時 (CO_can_err.h) */
+
+    /* RX 分派索引 - 由 CO_CANrxBufferInit() 維護 (CO_rx_dispatch.c) */
+    uint8_t                 rxDispatch[CO_CAN_RX_DISPATCH_SIZE]; /* COB-ID -> rxArray index */
+    uint16_t                rxMaskedCount;     /* 非完整遮罩的緩衝區數量 (備用掃描) */
+    uint8_t                 rxMasked[CO_CAN_RX_MASKED_MAX]; /* 非完整遮罩的緩衝區 index */
 } CO_CANmodule_t;
 
 /* Receive message buffer */
@@ -111,17 +223,19 @@ struct CO_CANtx_t {
     uint8_t data[8];            /* 8 data bytes */
     volatile bool_t bufferFull; /* Buffer full flag */
     volatile bool_t syncFlag;   /* Synchronous flag */
+    volatile bool_t queued;     /* 已在傳送優先權佇列中 (CO_tx_queue.c) */
+    volatile uint8_t txState;   /* CO_CAN_TX_IDLE / PENDING / ACTIVE (CO_tx_lmo.c) */
     
     /* XMC4800 specific - CAN_NODE 版本 */
     void *dave_lmo;             /* CAN_NODE LMO 配置指針 */
     uint8_t lmo_index;          /* LMO index */
 };
 
-/* CAN message object */
+/* CAN message object - data[] 緊接在 ident 之後 (4-byte 對齊)，CO_CANrxMo_read() 以兩個 32-bit 字寫入 */
 typedef struct {
     uint32_t ident;             /* CAN identifier */
-    uint8_t DLC;                /* Data Length Code */
     uint8_t data[8];            /* 8 data bytes */
+    uint8_t DLC;                /* Data Length Code */
 } CO_CANrxMsg_t;
 
 /* Access to received CAN message */
@@ -134,9 +248,13 @@ typedef struct {
 
 /* Flag macros for message flags */
 #define CO_FLAG_READ(rxNew) ((rxNew) != 0)
-#define CO_FLAG_SET(rxNew) do { (rxNew) = 1; } while (0)
+#define CO_FLAG_SET(rxNew) do { (rxNew) = (void *)1L; } while (0)
 #define CO_FLAG_CLEAR(rxNew) do { (rxNew) = 0; } while (0)
 
+/* Define endianness for XMC4800 (Cortex-M4 is little endian) - 必須在交換巨集之前定義，
+ * 否則 CO_SWAP_* 會反轉 SDO 中止碼、大小指示與 EMCY 等多位元組欄位 (host/test_vbus 檢查匯流排上的位元組) */
+#define CO_LITTLE_ENDIAN
+
 /* Endianness and swap macros */
 #ifdef CO_LITTLE_ENDIAN
     #define CO_SWAP_16(x) x
@@ -149,9 +267,6 @@ typedef struct {
                            (((uint32_t)(x) & 0x000000FFUL) << 24))
 #endif
 
-/* Define endianness for XMC4800 (Cortex-M4 is little endian) */
-#define CO_LITTLE_ENDIAN
-
 /* XMC4800 specific functions */
 void CO_CANsetConfigurationMode(void *CANptr);
 void CO_CANsetNormalMode(CO_CANmodule_t *CANmodule);
@@ -185,11 +300,35 @@ uint8_t canopen_get_current_node_id(void);
 
 /* **🎯 DAVE UI 中斷處理函數聲明** */
 /**
- * @brief CANopen Timer 處理函數 - 1ms 定時處理
+ * @brief CANopen Timer 處理函數 - 1ms 定時處理，觸發 RT slot
  * @param CO_ptr CANopen 主物件指標 (在 CANopen.h 中定義)
  */
 void canopen_timer_process(void *CO_ptr);
 
+/**
+ * @brief 設定 RT slot - 中斷優先權與 SYNC 接收回呼，CO_CANopenInit() 之後調用
+ * @param CO_ptr CANopen 主物件指標
+ */
+void canopen_rt_setup(void *CO_ptr);
+
+/**
+ * @brief 暫停 RT slot (遮罩 PendSV) - 開機與通訊重置建立 / 刪除 CO 期間調用
+ * @return 先前的中斷遮罩，交給 canopen_rt_resume()
+ */
+uint32_t canopen_rt_suspend(void);
+
+/**
+ * @brief 恢復 RT slot - 清除 pending 的 PendSV 後還原中斷遮罩
+ * @param mask canopen_rt_suspend() 的回傳值
+ */
+void canopen_rt_resume(uint32_t mask);
+
+/**
+ * @brief RT slot 處理 - SYNC/RPDO/TPDO，由 PendSV_Handler() 調用
+ * @param CO_ptr CANopen 主物件指標
+ */
+void canopen_rt_process(void *CO_ptr);
+
 /**
  * @brief CANopen CAN 中斷處理函數 - CAN 訊息處理
  */
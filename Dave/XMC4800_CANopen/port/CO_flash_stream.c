@@ -0,0 +1,237 @@
+/**
+ * Streaming Object Dictionary IO of a DOMAIN into a flash region
+ *
+ * @file CO_flash_stream.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+#include "CO_flash_stream.h"
+#include <string.h>
+
+/* 執行一個 flash 命令：offset 的頁尚未擦除時擦除下一個 sector，否則寫入 page
+ * 回傳 false：失敗；*done 為 true 時頁已寫入 */
+static bool_t CO_flashStream_command(CO_flashStream_t *fs, uint32_t offset, const uint32_t *page, bool_t *done)
+{
+    *done = false;
+    if (fs->erased < offset + CO_FLASH_PAGE_SIZE) {
+        if (!fs->ops->erase(fs->ops->object, fs->base + fs->erased)) {
+            return false;
+        }
+        fs->erased += fs->sectorSize;
+        fs->sectorCount++;
+        return true;
+    }
+    if (!fs->ops->program(fs->ops->object, fs->base + offset, page)) {
+        return false;
+    }
+    fs->pageCount++;
+    *done = true;
+    return true;
+}
+
+/* 一個 flash 命令：最舊的資料頁，資料頁寫完後是標頭頁 */
+static bool_t CO_flashStream_step(CO_flashStream_t *fs)
+{
+    bool_t done;
+
+    if (fs->error) {
+        return false;
+    }
+    if (fs->queueCount > 0U) {
+        if (!CO_flashStream_command(fs, CO_FLASH_PAGE_SIZE + fs->programmed, fs->queue[fs->queueHead], &done)) {
+            fs->error = true;
+            return false;
+        }
+        if (done) {
+            fs->queueHead = (fs->queueHead + 1U) % CO_FLASH_STREAM_QUEUE_PAGES;
+            fs->queueCount--;
+            fs->programmed += CO_FLASH_PAGE_SIZE;
+        }
+    } else if (fs->headerPending) {
+        uint32_t page[CO_FLASH_PAGE_SIZE / 4U] = {0};
+        CO_flashStreamHeader_t header = {CO_FLASH_STREAM_MAGIC, fs->length, ~fs->length};
+
+        memcpy(page, &header, sizeof(header));
+        if (!CO_flashStream_command(fs, 0, page, &done)) {
+            fs->error = true;
+            return false;
+        }
+        if (done) {
+            fs->headerPending = false;
+            fs->active = false;
+        }
+    } else if (fs->active && fs->erased == 0U) {
+        /* 還沒有完整的頁：仍先擦除第一個 sector，中止的下載不留下舊資料 */
+        if (!CO_flashStream_command(fs, 0, NULL, &done)) {
+            fs->error = true;
+            return false;
+        }
+    }
+    return true;
+}
+
+/* 還有待執行的 flash 命令 */
+static bool_t CO_flashStream_pending(const CO_flashStream_t *fs)
+{
+    return !fs->error && (fs->queueCount > 0U || fs->headerPending || (fs->active && fs->erased == 0U));
+}
+
+/* 組頁中的頁 (佇列最後一頁) */
+static uint8_t *CO_flashStream_fillPage(CO_flashStream_t *fs)
+{
+    uint32_t tail = (fs->queueHead + fs->queueCount) % CO_FLASH_STREAM_QUEUE_PAGES;
+    return (uint8_t *)fs->queue[tail];
+}
+
+/* 組頁中的頁排入佇列；佇列已滿時 (沒有下一個組頁位置) 在此寫出最舊的頁 */
+static bool_t CO_flashStream_push(CO_flashStream_t *fs)
+{
+    fs->queueCount++;
+    fs->pageFill = 0;
+    while (fs->queueCount >= CO_FLASH_STREAM_QUEUE_PAGES) {
+        uint32_t pages = fs->pageCount;
+        if (!CO_flashStream_step(fs)) {
+            return false;
+        }
+        fs->lockedPages += fs->pageCount - pages;
+    }
+    memset(CO_flashStream_fillPage(fs), 0, CO_FLASH_PAGE_SIZE);
+    return true;
+}
+
+/* SDO 下載：依序收到物件的資料，dataOffset 0 開始新的下載 */
+static ODR_t CO_flashStream_writeOD(OD_stream_t *stream, const void *buf, OD_size_t count, OD_size_t *countWritten)
+{
+    if (stream == NULL || buf == NULL || countWritten == NULL) {
+        return ODR_DEV_INCOMPAT;
+    }
+    CO_flashStream_t *fs = (CO_flashStream_t *)stream->object;
+    const uint8_t *data = (const uint8_t *)buf;
+
+    if (stream->dataOffset == 0U) {
+        /* 捨棄上一次下載未寫出的頁；第一個 sector 待擦除：舊的標頭失效 */
+        fs->queueHead = 0;
+        fs->queueCount = 0;
+        fs->pageFill = 0;
+        fs->programmed = 0;
+        fs->erased = 0;
+        fs->headerPending = false;
+        fs->error = false;
+        fs->active = true;
+        memset(CO_flashStream_fillPage(fs), 0, CO_FLASH_PAGE_SIZE);
+    }
+    if (fs->error) {
+        return ODR_HW;
+    }
+    if (count > CO_flashStream_capacity(fs) - stream->dataOffset) {
+        return ODR_DATA_LONG;
+    }
+
+    for (OD_size_t i = 0; i < count;) {
+        uint32_t n = CO_FLASH_PAGE_SIZE - fs->pageFill;
+        if (n > count - i) {
+            n = count - i;
+        }
+        memcpy(CO_flashStream_fillPage(fs) + fs->pageFill, &data[i], n);
+        fs->pageFill += n;
+        i += n;
+        if (fs->pageFill == CO_FLASH_PAGE_SIZE && !CO_flashStream_push(fs)) {
+            return ODR_HW;
+        }
+    }
+    stream->dataOffset += count;
+    *countWritten = count;
+
+    /* SDO 伺服器在最後一次寫入前設定 dataLength (物件的 dataLength 為 0) */
+    if (stream->dataLength == 0U || stream->dataOffset < stream->dataLength) {
+        return ODR_PARTIAL;
+    }
+    /* 不足一頁的資料補 0 排入佇列，標頭在所有資料頁之後寫入 */
+    if (fs->pageFill > 0U && !CO_flashStream_push(fs)) {
+        return ODR_HW;
+    }
+    fs->length = stream->dataOffset;
+    fs->headerPending = true;
+    stream->dataOffset = 0;
+    return ODR_OK;
+}
+
+/* SDO 上傳：由 flash 讀出，第一次讀取時告知物件大小 */
+static ODR_t CO_flashStream_readOD(OD_stream_t *stream, void *buf, OD_size_t count, OD_size_t *countRead)
+{
+    if (stream == NULL || buf == NULL || countRead == NULL) {
+        return ODR_DEV_INCOMPAT;
+    }
+    uint32_t length;
+    const uint8_t *data = CO_flashStream_data((const CO_flashStream_t *)stream->object, &length);
+
+    if (data == NULL) {
+        return ODR_NO_DATA;
+    }
+    if (stream->dataOffset == 0U) {
+        stream->dataLength = length;
+    }
+
+    uint32_t n = length - stream->dataOffset;
+    if (n > count) {
+        n = count;
+    }
+    memcpy(buf, &data[stream->dataOffset], n);
+    stream->dataOffset += n;
+    *countRead = n;
+
+    if (stream->dataOffset < length) {
+        return ODR_PARTIAL;
+    }
+    stream->dataOffset = 0;
+    return ODR_OK;
+}
+
+/******************************************************************************/
+void CO_flashStream_init(CO_flashStream_t *fs, const CO_flashOps_t *ops, uintptr_t base, uint32_t size,
+                         uint32_t sectorSize)
+{
+    memset(fs, 0, sizeof(*fs));
+    fs->ops = ops;
+    fs->base = base;
+    fs->size = size;
+    fs->sectorSize = sectorSize;
+}
+
+/******************************************************************************/
+ODR_t CO_flashStream_initOD(CO_flashStream_t *fs, OD_entry_t *entry)
+{
+    fs->extension.object = fs;
+    fs->extension.read = CO_flashStream_readOD;
+    fs->extension.write = CO_flashStream_writeOD;
+    return OD_extension_init(entry, &fs->extension);
+}
+
+/******************************************************************************/
+bool_t CO_flashStream_process(CO_flashStream_t *fs)
+{
+    if (fs->ops == NULL || !CO_flashStream_step(fs)) {
+        return false;
+    }
+    return CO_flashStream_pending(fs);
+}
+
+/******************************************************************************/
+const uint8_t *CO_flashStream_data(const CO_flashStream_t *fs, uint32_t *length)
+{
+    CO_flashStreamHeader_t header;
+
+    /* 下載開始後到標頭寫入前 (包括中止的下載) 沒有有效資料，即使舊的標頭尚未擦除 */
+    if (fs->active) {
+        *length = 0;
+        return NULL;
+    }
+    memcpy(&header, (const void *)fs->base, sizeof(header));
+    if (header.magic != CO_FLASH_STREAM_MAGIC || header.lengthInv != ~header.length
+        || header.length > CO_flashStream_capacity(fs)) {
+        *length = 0;
+        return NULL;
+    }
+    *length = header.length;
+    return (const uint8_t *)(fs->base + CO_FLASH_PAGE_SIZE);
+}
@@ -0,0 +1,138 @@
+/**
+ * Streaming Object Dictionary IO of a DOMAIN into a flash region
+ *
+ * @file CO_flash_stream.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 大量參數 / 記錄經由 SDO (區塊傳輸) 下載時，OD 擴充把 SDO 伺服器緩衝區的資料直接寫入 flash，
+ * 不在 RAM 中暫存整個物件，只有 CO_FLASH_STREAM_QUEUE_PAGES 頁的佇列：
+ *  - 區域第一頁是標頭 (長度與檢查值)，資料從第二頁開始
+ *  - 第一次寫入 (dataOffset 0) 使第一個 sector 待擦除 - 標頭失效，之後的 sector 在寫到時才擦除
+ *  - 最後一次寫入 (SDO 伺服器結束時設定 dataLength) 排入不足一頁的資料，最後寫入標頭
+ *  - 資料開始寫入後下載中止或斷電時沒有標頭，上傳回應 "No data available" (第一次寫入前中止則保留原有資料)
+ * SDO 伺服器在 CO_LOCK_OD (遮罩 RT slot) 內調用 OD 寫入，所以寫入只把資料排入佇列；
+ * 擦除與寫頁由主循環的 CO_flashStream_process() 在鎖外執行，每次一個 flash 命令，
+ * 命令之間 CO_process() 照常執行。只有佇列已滿時 OD 寫入才在鎖內寫出最舊的頁 (lockedPages)。
+ * sector 擦除延遲下一個子區塊的確認，SDO 客戶端逾時須大於擦除時間。
+ * 上傳直接由 flash 讀出 (記憶體映射)。flash 操作由 CO_flashOps_t 提供：
+ * XMC4800 為 CO_flash_xmc4.c，主機測試以 RAM 模擬 (host/sim_sdo_block.c)。
+ */
+
+#ifndef CO_FLASH_STREAM_H
+#define CO_FLASH_STREAM_H
+
+#include "301/CO_ODinterface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* flash 寫入單位 (XMC4800 PFLASH 頁) */
+#ifndef CO_FLASH_PAGE_SIZE
+#define CO_FLASH_PAGE_SIZE              256U
+#endif
+
+/* 佇列頁數 (含正在組頁的一頁) - 至少容納一個子區塊 (127 x 7 bytes) */
+#ifndef CO_FLASH_STREAM_QUEUE_PAGES
+#define CO_FLASH_STREAM_QUEUE_PAGES     8U
+#endif
+
+#define CO_FLASH_STREAM_MAGIC           0x53464F43UL    /* "COFS" */
+
+/* flash 操作 - address 為 (未快取的) flash 位址 */
+typedef struct {
+    /**
+     * @brief 擦除一個 sector
+     * @param object CO_flashOps_t.object
+     * @param address sector 起始位址
+     * @return false: 失敗
+     */
+    bool_t (*erase)(void *object, uintptr_t address);
+    /**
+     * @brief 寫入一頁 (已擦除)
+     * @param object CO_flashOps_t.object
+     * @param address 頁起始位址
+     * @param page CO_FLASH_PAGE_SIZE bytes
+     * @return false: 失敗
+     */
+    bool_t (*program)(void *object, uintptr_t address, const uint32_t *page);
+    void                   *object;
+} CO_flashOps_t;
+
+/* 區域第一頁的開頭 */
+typedef struct {
+    uint32_t                magic;          /* CO_FLASH_STREAM_MAGIC */
+    uint32_t                length;         /* 資料 bytes */
+    uint32_t                lengthInv;      /* ~length */
+} CO_flashStreamHeader_t;
+
+/* flash 串流 */
+typedef struct {
+    const CO_flashOps_t    *ops;
+    uintptr_t               base;           /* 區域起始 (sector 對齊) */
+    uint32_t                size;           /* 區域 bytes (sectorSize 的倍數) */
+    uint32_t                sectorSize;
+    uint32_t                queue[CO_FLASH_STREAM_QUEUE_PAGES][CO_FLASH_PAGE_SIZE / 4U]; /* 待寫入的頁 */
+    uint32_t                queueHead;      /* 最舊的完整頁 */
+    uint32_t                queueCount;     /* 完整頁數，之後一頁是組頁中的頁 */
+    uint32_t                pageFill;       /* 組頁中的 bytes */
+    uint32_t                programmed;     /* 已寫入 flash 的資料 bytes (頁的倍數) */
+    uint32_t                erased;         /* 已擦除的區域 bytes (由 base 起) */
+    uint32_t                length;         /* 標頭待寫入時的資料 bytes */
+    bool_t                  active;         /* 下載開始後到標頭寫入前 */
+    bool_t                  headerPending;  /* 資料頁寫完後寫入標頭 */
+    bool_t                  error;          /* flash 命令失敗，直到下一次下載 */
+    uint32_t                pageCount;      /* 統計：寫入的頁數 */
+    uint32_t                sectorCount;    /* 統計：擦除的 sector 數 */
+    uint32_t                lockedPages;    /* 統計：佇列滿時在 OD 寫入 (CO_LOCK_OD) 內寫出的頁數 */
+    OD_extension_t          extension;
+} CO_flashStream_t;
+
+/**
+ * @brief 初始化 - 不操作 flash，原有的資料 (有效標頭) 保留
+ * @param fs flash 串流
+ * @param ops flash 操作
+ * @param base 區域起始位址，sectorSize 對齊
+ * @param size 區域大小，sectorSize 的倍數
+ * @param sectorSize 擦除單位，CO_FLASH_PAGE_SIZE 的倍數
+ */
+void CO_flashStream_init(CO_flashStream_t *fs, const CO_flashOps_t *ops, uintptr_t base, uint32_t size,
+                         uint32_t sectorSize);
+
+/**
+ * @brief 為 DOMAIN 物件安裝 OD 擴充
+ * @param fs flash 串流
+ * @param entry OD 物件 (例如 OD_ENTRY_H2200)
+ * @return OD_extension_init() 的結果
+ */
+ODR_t CO_flashStream_initOD(CO_flashStream_t *fs, OD_entry_t *entry);
+
+/**
+ * @brief 執行一個待處理的 flash 命令 (擦除一個 sector 或寫入一頁) - 在主循環中、鎖外調用
+ * @param fs flash 串流
+ * @return true: 還有待處理的命令 (主循環不要睡眠)
+ */
+bool_t CO_flashStream_process(CO_flashStream_t *fs);
+
+/**
+ * @brief 可儲存的資料 bytes (區域減去標頭頁)
+ */
+static inline uint32_t CO_flashStream_capacity(const CO_flashStream_t *fs)
+{
+    return fs->size - CO_FLASH_PAGE_SIZE;
+}
+
+/**
+ * @brief 已完成下載的資料
+ * @param fs flash 串流
+ * @param length [out] 資料 bytes，沒有有效資料時為 0
+ * @return 資料位址 (flash)，沒有有效資料時為 NULL
+ */
+const uint8_t *CO_flashStream_data(const CO_flashStream_t *fs, uint32_t *length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_FLASH_STREAM_H */
@@ -0,0 +1,83 @@
+/**
+ * XMC4800 PFLASH operations for CO_flash_stream.c
+ *
+ * @file CO_flash_xmc4.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * XMC_FLASH_EraseSector() / XMC_FLASH_ProgramPage() 本身位於 PFLASH，在 PFLASH 中等待 PBUSY。
+ * 這裡的命令序列與等待迴圈放在 RAM (.ram_code，啟動時由 startup_XMC4800.S 複製)，
+ * 不關閉中斷：等待期間 CAN 接收、SysTick 與 PendSV (RT slot) 照常進入。
+ * 命令位址使用未快取的 0x0C000000 區域；頁資料 (CO_flashStream_t.page) 位於 RAM。
+ */
+#include "CO_flash_xmc4.h"
+#include "xmc_flash.h"
+
+/* RAM 函數 - 由 PFLASH 調用需要 long_call (距離超過 BL 範圍) */
+#if defined(__arm__)
+#define CO_FLASH_XMC4_RAMFUNC   __attribute__((section(".ram_code"), noinline, long_call))
+#else
+#define CO_FLASH_XMC4_RAMFUNC   __attribute__((section(".ram_code"), noinline))
+#endif
+
+/* 命令位址 */
+#define CO_FLASH_XMC4_CMD(offset)   (*(volatile uint32_t *)(XMC_FLASH_UNCACHED_BASE + (offset)))
+
+/* 命令失敗的狀態位元 */
+#define CO_FLASH_XMC4_ERRORS    (XMC_FLASH_STATUS_OPERATION_ERROR | XMC_FLASH_STATUS_COMMAND_SEQUENCE_ERROR \
+                                 | XMC_FLASH_STATUS_PROTECTION_ERROR | XMC_FLASH_STATUS_VERIFY_ERROR)
+
+/* 等待命令結束並回傳 FSR - 在 RAM 中輪詢，不讀取 PFLASH */
+static CO_FLASH_XMC4_RAMFUNC uint32_t CO_flash_xmc4_wait(void)
+{
+    while ((FLASH0->FSR & (uint32_t)FLASH_FSR_PBUSY_Msk) != 0U) {
+    }
+    return FLASH0->FSR;
+}
+
+/* Clear Status + Erase Sector (與 XMC_FLASH_lEraseSectorCommand() 相同的序列) */
+static CO_FLASH_XMC4_RAMFUNC uint32_t CO_flash_xmc4_eraseRam(uintptr_t address)
+{
+    CO_FLASH_XMC4_CMD(0x5554U) = 0xF5U;
+    CO_FLASH_XMC4_CMD(0x5554U) = 0xAAU;
+    CO_FLASH_XMC4_CMD(0xAAA8U) = 0x55U;
+    CO_FLASH_XMC4_CMD(0x5554U) = 0x80U;
+    CO_FLASH_XMC4_CMD(0x5554U) = 0xAAU;
+    CO_FLASH_XMC4_CMD(0xAAA8U) = 0x55U;
+    *(volatile uint32_t *)address = 0x30U;
+    return CO_flash_xmc4_wait();
+}
+
+/* Clear Status + Enter Page Mode + Load Page x 32 + Write Page (與 XMC_FLASH_ProgramPage() 相同的序列) */
+static CO_FLASH_XMC4_RAMFUNC uint32_t CO_flash_xmc4_programRam(uintptr_t address, const uint32_t *page)
+{
+    CO_FLASH_XMC4_CMD(0x5554U) = 0xF5U;
+    CO_FLASH_XMC4_CMD(0x5554U) = 0x50U;
+    for (uint32_t i = 0; i < XMC_FLASH_WORDS_PER_PAGE; i += 2U) {
+        CO_FLASH_XMC4_CMD(0x55F0U) = page[i];
+        CO_FLASH_XMC4_CMD(0x55F4U) = page[i + 1U];
+    }
+    CO_FLASH_XMC4_CMD(0x5554U) = 0xAAU;
+    CO_FLASH_XMC4_CMD(0xAAA8U) = 0x55U;
+    CO_FLASH_XMC4_CMD(0x5554U) = 0xA0U;
+    *(volatile uint32_t *)address = 0xAAU;
+    return CO_flash_xmc4_wait();
+}
+
+static bool_t CO_flash_xmc4_erase(void *object, uintptr_t address)
+{
+    (void)object;
+    return (CO_flash_xmc4_eraseRam(address) & (uint32_t)CO_FLASH_XMC4_ERRORS) == 0U;
+}
+
+static bool_t CO_flash_xmc4_program(void *object, uintptr_t address, const uint32_t *page)
+{
+    (void)object;
+    return (CO_flash_xmc4_programRam(address, page) & (uint32_t)CO_FLASH_XMC4_ERRORS) == 0U;
+}
+
+const CO_flashOps_t CO_flashOps_XMC4 = {
+    .erase = CO_flash_xmc4_erase,
+    .program = CO_flash_xmc4_program,
+    .object = NULL
+};
@@ -0,0 +1,29 @@
+/**
+ * XMC4800 PFLASH operations for CO_flash_stream.c
+ *
+ * @file CO_flash_xmc4.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+
+#ifndef CO_FLASH_XMC4_H
+#define CO_FLASH_XMC4_H
+
+#include "CO_flash_stream.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 參數 flash 區域：邏輯 sector 8 (128 KB)，linker_script.ld 確認程式映像在此之前結束 */
+#define CO_FLASH_XMC4_PARAM_BASE        0x0C020000UL
+#define CO_FLASH_XMC4_PARAM_SIZE        0x00020000UL
+#define CO_FLASH_XMC4_PARAM_SECTOR      0x00020000UL
+
+extern const CO_flashOps_t CO_flashOps_XMC4;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_FLASH_XMC4_H */
@@ -0,0 +1,19 @@
+/**
+ * BASEPRI critical sections with hold-time profiling
+ *
+ * @file CO_lock.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+#include "CO_driver_target.h"
+
+CO_lockClass_t CO_lockClass[CO_LOCK_CLASS_COUNT];
+
+/******************************************************************************/
+void CO_lock_resetStats(void)
+{
+    for (uint32_t i = 0; i < CO_LOCK_CLASS_COUNT; i++) {
+        CO_lockClass[i].holdCyclesMax = 0U;
+        CO_lockClass[i].count = 0U;
+    }
+}
@@ -0,0 +1,113 @@
+/**
+ * BASEPRI critical sections with hold-time profiling
+ *
+ * @file CO_lock.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * CO_LOCK_CAN_SEND / CO_LOCK_EMCY / CO_LOCK_OD 不再 __disable_irq()，而是把 BASEPRI
+ * 提高到各類別的優先權：CAN_SEND 遮罩 CAN 中斷 (CO_CAN_IRQ_PRIORITY)，
+ * OD/EMCY 只遮罩 RT slot (CO_RT_PRIORITY，見 CO_rt.h)，CAN 接收不受影響；
+ * 優先權數值更小的中斷 (馬達控制、ADC) 一律不受影響。
+ * 每個鎖類別有自己的儲存區與巢狀深度，最外層進入時保存 BASEPRI、離開時還原，
+ * 巢狀使用不會提早解除遮罩；同時記錄最外層持有的 CO_CAN_CYCLES() 最大值。
+ */
+
+#ifndef CO_LOCK_H
+#define CO_LOCK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 各類別鎖定的 NVIC 優先權 (數值)：此數值及更低優先權的中斷被遮罩 */
+#ifndef CO_LOCK_PRIORITY_CAN_SEND
+#define CO_LOCK_PRIORITY_CAN_SEND       CO_CAN_IRQ_PRIORITY
+#endif
+#ifndef CO_LOCK_PRIORITY_RT
+#define CO_LOCK_PRIORITY_RT             CO_RT_PRIORITY
+#endif
+
+/* BASEPRI 暫存器值 - 優先權放在高位元 */
+#define CO_LOCK_BASEPRI(prio)           ((prio) << (8U - (__NVIC_PRIO_BITS)))
+
+/* 中斷遮罩存取 - 可由編譯選項替換 (例如改回 PRIMASK) */
+#ifndef CO_LOCK_MASK_GET
+#define CO_LOCK_MASK_GET()              __get_BASEPRI()
+#define CO_LOCK_MASK_RAISE(mask)        __set_BASEPRI_MAX(mask)
+#define CO_LOCK_MASK_SET(mask)          __set_BASEPRI(mask)
+#endif
+
+/* 持有時間量測 - 預設與 TX 量測相同 (DWT CYCCNT) */
+#ifndef CO_LOCK_CYCLES
+#define CO_LOCK_CYCLES()                CO_CAN_CYCLES()
+#endif
+
+/* 鎖類別 */
+typedef enum {
+    CO_LOCK_CLASS_CAN_SEND = 0,
+    CO_LOCK_CLASS_EMCY,
+    CO_LOCK_CLASS_OD,
+    CO_LOCK_CLASS_COUNT
+} CO_lockClassId_t;
+
+/* 鎖狀態與統計 */
+typedef struct {
+    uint32_t                savedMask;      /* 最外層進入前的 BASEPRI */
+    uint32_t                depth;          /* 巢狀深度 */
+    uint32_t                enterCycles;    /* 最外層進入時間 */
+    uint32_t                holdCyclesMax;  /* 最長持有週期 */
+    uint32_t                count;          /* 最外層進入次數 */
+} CO_lockClass_t;
+
+extern CO_lockClass_t CO_lockClass[CO_LOCK_CLASS_COUNT];
+
+/**
+ * @brief 進入關鍵段
+ *
+ * 先讀取再提高遮罩：兩者之間被中斷時，ISR 返回前會還原 BASEPRI，讀到的值仍有效。
+ * @param id 鎖類別
+ * @param basepri CO_LOCK_BASEPRI(優先權)
+ */
+static inline void CO_lock_enter(CO_lockClassId_t id, uint32_t basepri)
+{
+    CO_lockClass_t *lock = &CO_lockClass[id];
+    uint32_t mask = CO_LOCK_MASK_GET();
+
+    CO_LOCK_MASK_RAISE(basepri);
+    if (lock->depth++ == 0U) {
+        lock->savedMask = mask;
+        lock->enterCycles = CO_LOCK_CYCLES();
+    }
+}
+
+/**
+ * @brief 離開關鍵段 - 最外層離開時記錄持有時間並還原 BASEPRI
+ * @param id 鎖類別
+ */
+static inline void CO_lock_exit(CO_lockClassId_t id)
+{
+    CO_lockClass_t *lock = &CO_lockClass[id];
+
+    if (--lock->depth == 0U) {
+        uint32_t hold = CO_LOCK_CYCLES() - lock->enterCycles;
+        if (hold > lock->holdCyclesMax) {
+            lock->holdCyclesMax = hold;
+        }
+        lock->count++;
+        CO_LOCK_MASK_SET(lock->savedMask);
+    }
+}
+
+/**
+ * @brief 清除統計 (不影響目前持有的鎖)
+ */
+void CO_lock_resetStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_LOCK_H */
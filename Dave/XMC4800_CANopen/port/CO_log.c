@@ -0,0 +1,53 @@
+/**
+ * Deferred binary log for interrupt context
+ *
+ * @file CO_log.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+#include "CO_log.h"
+#include <stdio.h>
+#include <string.h>
+
+#define CO_LOG_STRING(id, fmt) fmt,
+static const char *const CO_log_formats[CO_LOG_FORMAT_COUNT] = {
+    CO_LOG_FORMATS(CO_LOG_STRING)
+};
+#undef CO_LOG_STRING
+
+/******************************************************************************/
+void CO_log_init(CO_logRing_t *ring)
+{
+    memset(ring, 0, sizeof(*ring));
+}
+
+/******************************************************************************/
+bool CO_log_read(CO_logRing_t *ring, CO_logEntry_t *entry)
+{
+    uint32_t tail = ring->tail;
+
+    if (__atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) == tail) {
+        return false;
+    }
+
+    *entry = ring->entries[tail & (CO_LOG_RING_SIZE - 1U)];
+
+    /* 複製完成後才釋放這一格給生產者 */
+    __atomic_store_n(&ring->tail, tail + 1U, __ATOMIC_RELEASE);
+    return true;
+}
+
+/******************************************************************************/
+int CO_log_format(const CO_logEntry_t *entry, char *buf, size_t size)
+{
+    if (entry->id >= (uint16_t)CO_LOG_FORMAT_COUNT) {
+        return snprintf(buf, size, "log id %u: %08lx %08lx %08lx %08lx", entry->id,
+                        (unsigned long)entry->arg[0], (unsigned long)entry->arg[1],
+                        (unsigned long)entry->arg[2], (unsigned long)entry->arg[3]);
+    }
+
+    /* 多餘的參數由 printf 忽略 */
+    return snprintf(buf, size, CO_log_formats[entry->id],
+                    (unsigned long)entry->arg[0], (unsigned long)entry->arg[1],
+                    (unsigned long)entry->arg[2], (unsigned long)entry->arg[3]);
+}
@@ -0,0 +1,116 @@
+/**
+ * Deferred binary log for interrupt context
+ *
+ * @file CO_log.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * ISR 不做字串格式化：只寫入格式 ID、序號、時間戳記與最多 4 個 32-bit 參數
+ * (固定 24 byte 的紀錄) 到單一生產者 / 單一消費者的環形緩衝區，
+ * 由主循環 (Debug_ProcessISRBuffer) 依 CO_log_fmt.h 的格式表格式化輸出。
+ * 生產者只能是同一個中斷優先權等級 (head 以讀取後寫回的方式更新，可互相搶佔的
+ * 兩個中斷會寫入同一格)，不同優先權的中斷各自使用一個緩衝區；緩衝區滿時丟棄新紀錄並計數。
+ * 原始紀錄 (例如以除錯器匯出 entries[]) 可用 host/log_decode 解碼。
+ */
+
+#ifndef CO_LOG_H
+#define CO_LOG_H
+
+#include "CO_driver_target.h"
+#include "CO_log_fmt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 環形緩衝區紀錄數 - 必須是 2 的次方 */
+#ifndef CO_LOG_RING_SIZE
+#define CO_LOG_RING_SIZE                64U
+#endif
+
+/* 紀錄時間戳記來源 */
+#ifndef CO_LOG_TIMESTAMP
+#define CO_LOG_TIMESTAMP()              CO_CAN_CYCLES()
+#endif
+
+/* 格式 ID - 由 CO_log_fmt.h 產生 */
+#define CO_LOG_ENUM(id, fmt) id,
+typedef enum {
+    CO_LOG_FORMATS(CO_LOG_ENUM)
+    CO_LOG_FORMAT_COUNT
+} CO_logId_t;
+#undef CO_LOG_ENUM
+
+/* 一筆紀錄 (24 byte, little-endian) */
+typedef struct {
+    uint16_t                id;             /* CO_logId_t */
+    uint16_t                seq;            /* 寫入序號，解碼時排序並偵測遺失 */
+    uint32_t                timestamp;      /* CO_LOG_TIMESTAMP() */
+    uint32_t                arg[4];
+} CO_logEntry_t;
+
+/* 環形緩衝區 - head 只由生產者寫入，tail 只由消費者寫入 */
+typedef struct {
+    CO_logEntry_t           entries[CO_LOG_RING_SIZE];
+    volatile uint32_t       head;           /* 已寫入的紀錄數 */
+    volatile uint32_t       tail;           /* 已讀出的紀錄數 */
+    volatile uint32_t       dropped;        /* 緩衝區滿而丟棄的紀錄數 */
+} CO_logRing_t;
+
+/**
+ * @brief 初始化 (清空) 緩衝區
+ * @param ring 緩衝區
+ */
+void CO_log_init(CO_logRing_t *ring);
+
+/**
+ * @brief 寫入一筆紀錄 - 生產者 (ISR) 端，不格式化、不阻塞
+ * @param ring 緩衝區
+ * @param id 格式 ID
+ * @param a0 ~ a3 參數 (未使用者傳 0)
+ */
+static inline void CO_log_write(CO_logRing_t *ring, CO_logId_t id,
+                                uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    uint32_t head = ring->head;
+
+    if (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) >= CO_LOG_RING_SIZE) {
+        ring->dropped++;
+        return;
+    }
+
+    CO_logEntry_t *entry = &ring->entries[head & (CO_LOG_RING_SIZE - 1U)];
+    entry->id = (uint16_t)id;
+    entry->seq = (uint16_t)head;
+    entry->timestamp = CO_LOG_TIMESTAMP();
+    entry->arg[0] = a0;
+    entry->arg[1] = a1;
+    entry->arg[2] = a2;
+    entry->arg[3] = a3;
+
+    /* 紀錄內容寫完後才發布 head */
+    __atomic_store_n(&ring->head, head + 1U, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief 讀出一筆紀錄 - 消費者 (主循環) 端
+ * @param ring 緩衝區
+ * @param entry 輸出紀錄
+ * @return true: 已讀出, false: 緩衝區空
+ */
+bool CO_log_read(CO_logRing_t *ring, CO_logEntry_t *entry);
+
+/**
+ * @brief 依格式表格式化一筆紀錄
+ * @param entry 紀錄
+ * @param buf 輸出緩衝區
+ * @param size 輸出緩衝區大小
+ * @return snprintf() 的回傳值 (未知 ID 時輸出 ID 與原始參數)
+ */
+int CO_log_format(const CO_logEntry_t *entry, char *buf, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_LOG_H */
@@ -0,0 +1,23 @@
+/**
+ * Format string table for the deferred ISR log
+ *
+ * @file CO_log_fmt.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 每一列是 X(ID, "format")。韌體與 host/log_decode.c 共用同一張表，
+ * 紀錄中只存 ID，新增訊息時只能加在最後，避免舊紀錄解碼錯誤。
+ * 參數一律以 unsigned long 傳給 printf，格式只使用 %lu / %lx / %ld 系列。
+ */
+
+#ifndef CO_LOG_FMT_H
+#define CO_LOG_FMT_H
+
+#define CO_LOG_FORMATS(X) \
+    X(CO_LOG_RX_IRQ,            "RX IRQ: LMO_%02lu (idx=%lu)") \
+    X(CO_LOG_TX_IRQ,            "TX IRQ: LMO_%02lu (idx=%lu)") \
+    X(CO_LOG_RX_FIFO_OVERRUN,   "RX FIFO overrun: %lu") \
+    X(CO_LOG_RX_RING_DROP,      "RX ring full: %lu dropped") \
+    X(CO_LOG_RX_UNMATCHED,      "RX unmatched: ID=0x%03lx DLC=%lu (#%lu)")
+
+#endif /* CO_LOG_FMT_H */
@@ -0,0 +1,68 @@
+/**
+ * MultiCAN message pending routing for XMC4800 CANopen driver
+ *
+ * @file CO_mo_route.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+#include "CO_mo_route.h"
+#include <string.h>
+
+/******************************************************************************/
+void CO_MOroute_init(CO_MOroute_t *route, volatile uint32_t *mspnd)
+{
+    memset(route, 0, sizeof(*route));
+    memset(route->moToLmo, CO_MO_ROUTE_NONE, sizeof(route->moToLmo));
+    route->mspnd = mspnd;
+}
+
+/******************************************************************************/
+bool CO_MOroute_add(CO_MOroute_t *route, uint8_t moNumber, uint8_t lmoIndex, bool isRx)
+{
+    if (route == NULL || lmoIndex == CO_MO_ROUTE_NONE) {
+        return false;
+    }
+
+    uint32_t reg = (uint32_t)moNumber / 32U;
+    uint32_t bit = 1UL << ((uint32_t)moNumber % 32U);
+
+    route->moToLmo[moNumber] = lmoIndex;
+    route->pendingMask[reg] |= bit;
+    if (isRx) {
+        route->rxMask[reg] |= bit;
+    } else {
+        route->rxMask[reg] &= ~bit;
+    }
+    route->regsUsed |= (uint8_t)(1U << reg);
+
+    return true;
+}
+
+/******************************************************************************/
+uint32_t CO_MOroute_dispatch(CO_MOroute_t *route, CO_MOroute_handler_t handler, void *object)
+{
+    uint32_t events = 0;
+    uint8_t regs = route->regsUsed;
+
+    while (regs != 0U) {
+        uint32_t reg = (uint32_t)__builtin_ctz(regs);
+        regs &= (uint8_t)(regs - 1U);
+
+        /* 一次讀取 MSPND，只保留本節點 LMO 的位元 */
+        uint32_t pending = route->mspnd[reg] & route->pendingMask[reg];
+
+        while (pending != 0U) {
+            uint32_t bitPos = (uint32_t)__builtin_ctz(pending);  /* Cortex-M4: RBIT + CLZ */
+            uint32_t bit = 1UL << bitPos;
+            pending &= pending - 1U;
+
+            /* MSPND 寫 0 清除，寫 1 無效果 - 不會誤清其他位元 */
+            CO_MO_ROUTE_CLEAR_PENDING(&route->mspnd[reg], bit);
+
+            handler(object, route->moToLmo[reg * 32U + bitPos], (route->rxMask[reg] & bit) != 0U);
+            events++;
+        }
+    }
+
+    return events;
+}
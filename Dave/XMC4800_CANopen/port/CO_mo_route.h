@@ -0,0 +1,83 @@
+/**
+ * MultiCAN message pending routing for XMC4800 CANopen driver
+ *
+ * @file CO_mo_route.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * XMC_CAN_MO_Config() 把每個 MO 的 MOIPR.MPN 設為 MO 編號，所以 RX/TX 事件發生時
+ * CAN->MSPND[MO/32] 的第 (MO%32) 位元會被硬體設定。本模組只讀取 pending 暫存器，
+ * 直接跳到真正觸發的 LMO，ISR 時間只與事件數量有關，與配置的 LMO 數量無關。
+ * 不依賴 DAVE 硬體，可在 Linux 主機上以 mock 暫存器測試 (見 host/)。
+ */
+
+#ifndef CO_MO_ROUTE_H
+#define CO_MO_ROUTE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CO_MO_ROUTE_MO_COUNT    256U    /* MultiCAN 訊息物件總數 */
+#define CO_MO_ROUTE_REGS        8U      /* MSPND 暫存器數量 (每個 32 個 MO) */
+#define CO_MO_ROUTE_NONE        0xFFU   /* 此 MO 不屬於 CAN_NODE_0 */
+
+/* 清除一個 MSPND 位元：硬體寫 0 清除、寫 1 無效果，不可使用讀-改-寫 (會清掉期間新到的事件)。
+ * 主機端 mock 暫存器是一般記憶體，由 host/Makefile 改寫此巨集 */
+#ifndef CO_MO_ROUTE_CLEAR_PENDING
+#define CO_MO_ROUTE_CLEAR_PENDING(reg, bit)  (*(reg) = ~(bit))
+#endif
+
+/**
+ * @brief pending 事件處理函數
+ * @param object 由 CO_MOroute_dispatch() 傳入
+ * @param lmoIndex CAN_NODE_0.lmobj_ptr[] 索引
+ * @param isRx true: 接收事件, false: 傳送事件
+ */
+typedef void (*CO_MOroute_handler_t)(void *object, uint8_t lmoIndex, bool isRx);
+
+/* pending 路由表 */
+typedef struct {
+    volatile uint32_t *mspnd;                        /* CAN->MSPND (主機端為 mock 暫存器) */
+    uint32_t pendingMask[CO_MO_ROUTE_REGS];          /* 已登記 MO 的 pending 位元 */
+    uint32_t rxMask[CO_MO_ROUTE_REGS];               /* 其中屬於 RX 的位元 */
+    uint8_t  regsUsed;                               /* bit k: MSPND[k] 有已登記的 MO */
+    uint8_t  moToLmo[CO_MO_ROUTE_MO_COUNT];          /* MO 編號 -> LMO index */
+} CO_MOroute_t;
+
+/**
+ * @brief 清空路由表
+ * @param route 路由表
+ * @param mspnd MSPND[0] 位址
+ */
+void CO_MOroute_init(CO_MOroute_t *route, volatile uint32_t *mspnd);
+
+/**
+ * @brief 登記一個 LMO - 在 CO_CANmodule_init() 啟用 MO 事件時調用
+ * @param route 路由表
+ * @param moNumber 硬體 MO 編號 (CAN_NODE_LMO_t.number)
+ * @param lmoIndex CAN_NODE_0.lmobj_ptr[] 索引
+ * @param isRx true: RX LMO, false: TX LMO
+ * @return true: 成功, false: 參數無效
+ */
+bool CO_MOroute_add(CO_MOroute_t *route, uint8_t moNumber, uint8_t lmoIndex, bool isRx);
+
+/**
+ * @brief 處理所有 pending 的 MO 事件 - 在 CAN ISR 中調用
+ *
+ * 每個事件先清除 MSPND 位元再調用 handler，處理期間新到的事件會重新觸發中斷。
+ * @param route 路由表
+ * @param handler 事件處理函數
+ * @param object 傳給 handler
+ * @return 處理的事件數量
+ */
+uint32_t CO_MOroute_dispatch(CO_MOroute_t *route, CO_MOroute_handler_t handler, void *object);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_MO_ROUTE_H */
@@ -0,0 +1,22 @@
+/**
+ * Cycle-count profiling of the CANopen processing functions
+ *
+ * @file CO_prof.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+#include "CO_driver_target.h"
+#include "CO_prof.h"
+#include <string.h>
+
+CO_profStat_t CO_prof[CO_PROF_COUNT];
+
+/******************************************************************************/
+void CO_prof_get(CO_profId_t id, CO_profStat_t *out)
+{
+    /* 記錄的執行緒可能在複製期間更新，欄位之間不保證一致 (監控用途) */
+    *out = CO_prof[id];
+    if (out->resetRequest || out->count == 0U) {
+        memset(out, 0, sizeof(*out));
+    }
+}
@@ -0,0 +1,135 @@
+/**
+ * Cycle-count profiling of the CANopen processing functions
+ *
+ * @file CO_prof.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * CO_PROF_BEGIN(id) / CO_PROF_END(id) 包住 CO_process()、CO_process_SYNC/RPDO/TPDO、
+ * CAN RX/TX 中斷處理、CO_SDOserver_process()、CO_HBconsumer_process()，以 CO_CAN_CYCLES()
+ * 取樣 (XMC4800：DWT CYCCNT；主機：host/DAVE.h 的 clock_gettime() 奈秒)。
+ * 每個量測點記錄次數、最小 / 最大 / 平均與 CO_PROF_HIST_BUCKETS 個以 2 的次方分界的直方圖，
+ * 由 CO_prof_od.c 以製造商 OD 0x2100 起的 record 經 SDO 讀出。
+ * 每個量測點只在一個執行緒 (主循環、RT slot 或 CAN ISR) 中記錄；
+ * 清除 (SDO 寫入次數 0) 只設定請求旗標，由記錄的執行緒在下一次記錄時清除，不需要鎖。
+ */
+
+#ifndef CO_PROF_H
+#define CO_PROF_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 0: 量測巨集為空 */
+#ifndef CO_PROF_ENABLE
+#define CO_PROF_ENABLE                  1
+#endif
+
+/* 直方圖：第 0 格 < 2^SHIFT，第 n 格 [2^(SHIFT+n-1), 2^(SHIFT+n))，最後一格不設上限 */
+#define CO_PROF_HIST_BUCKETS            8U
+#ifndef CO_PROF_HIST_SHIFT
+#define CO_PROF_HIST_SHIFT              8U      /* 256 週期 (144 MHz 約 1.8 us) */
+#endif
+
+/* 量測點 - 順序即 OD index (CO_PROF_OD_INDEX + id) */
+typedef enum {
+    CO_PROF_PROCESS = 0,                /* CO_process() */
+    CO_PROF_SYNC,                       /* CO_process_SYNC() */
+    CO_PROF_RPDO,                       /* CO_process_RPDO() */
+    CO_PROF_TPDO,                       /* CO_process_TPDO() */
+    CO_PROF_CAN_RX,                     /* CO_CANinterrupt_Rx() */
+    CO_PROF_CAN_TX,                     /* CO_CANinterrupt_Tx() */
+    CO_PROF_SDO_SERVER,                 /* CO_SDOserver_process() */
+    CO_PROF_HB_CONSUMER,                /* CO_HBconsumer_process() */
+    CO_PROF_COUNT
+} CO_profId_t;
+
+/* 單一量測點的統計 */
+typedef struct {
+    uint32_t                count;
+    uint32_t                min;
+    uint32_t                max;
+    uint64_t                sum;
+    uint32_t                hist[CO_PROF_HIST_BUCKETS];
+    volatile bool           resetRequest;   /* 由 CO_prof_reset() 設定 */
+} CO_profStat_t;
+
+extern CO_profStat_t CO_prof[CO_PROF_COUNT];
+
+/**
+ * @brief 直方圖格位
+ * @param cycles 週期數
+ */
+static inline uint32_t CO_prof_bucket(uint32_t cycles)
+{
+    uint32_t v = cycles >> CO_PROF_HIST_SHIFT;
+    uint32_t bucket = (v == 0U) ? 0U : (32U - (uint32_t)__builtin_clz(v));
+
+    return bucket < CO_PROF_HIST_BUCKETS ? bucket : CO_PROF_HIST_BUCKETS - 1U;
+}
+
+/**
+ * @brief 記錄一次量測 - 只在該量測點的執行緒中調用
+ * @param id 量測點
+ * @param cycles CO_CAN_CYCLES() 差值
+ */
+static inline void CO_prof_record(CO_profId_t id, uint32_t cycles)
+{
+    CO_profStat_t *stat = &CO_prof[id];
+
+    if (stat->resetRequest || stat->count == 0U) {
+        for (uint32_t i = 0; i < CO_PROF_HIST_BUCKETS; i++) {
+            stat->hist[i] = 0U;
+        }
+        stat->count = 0U;
+        stat->sum = 0U;
+        stat->min = UINT32_MAX;
+        stat->max = 0U;
+        stat->resetRequest = false;
+    }
+
+    stat->count++;
+    stat->sum += cycles;
+    if (cycles < stat->min) {
+        stat->min = cycles;
+    }
+    if (cycles > stat->max) {
+        stat->max = cycles;
+    }
+    stat->hist[CO_prof_bucket(cycles)]++;
+}
+
+/**
+ * @brief 請求清除統計 - 可在任何執行緒中調用，下一次記錄時生效
+ * @param id 量測點
+ */
+static inline void CO_prof_reset(CO_profId_t id)
+{
+    CO_prof[id].resetRequest = true;
+}
+
+/**
+ * @brief 讀出統計 - 清除請求尚未生效時回傳 0
+ * @param id 量測點
+ * @param out [out] 統計副本 (min 在沒有量測時為 0)
+ */
+void CO_prof_get(CO_profId_t id, CO_profStat_t *out);
+
+/* 量測巨集 - BEGIN 宣告區域變數，END 必須在同一個區塊中 */
+#if CO_PROF_ENABLE
+#define CO_PROF_BEGIN(id)               uint32_t CO_profStart_##id = CO_CAN_CYCLES()
+#define CO_PROF_END(id)                 CO_prof_record((id), CO_CAN_CYCLES() - CO_profStart_##id)
+#else
+#define CO_PROF_BEGIN(id)
+#define CO_PROF_END(id)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_PROF_H */
@@ -0,0 +1,84 @@
+/**
+ * Object Dictionary access to the CANopen processing profile (0x2100 ~ 0x2107)
+ *
+ * @file CO_prof_od.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+#include "CO_prof_od.h"
+
+static OD_extension_t CO_prof_extension[CO_PROF_COUNT];
+
+/* 讀出 CO_prof[] 的即時值 - sub 0 使用 OD 中的原始值 */
+static ODR_t CO_prof_readOD(OD_stream_t *stream, void *buf, OD_size_t count, OD_size_t *countRead)
+{
+    CO_profStat_t stat;
+    uint32_t value;
+
+    if (stream == NULL || buf == NULL || countRead == NULL) {
+        return ODR_DEV_INCOMPAT;
+    }
+    if (stream->subIndex == 0U) {
+        return OD_readOriginal(stream, buf, count, countRead);
+    }
+    if (count < sizeof(value)) {
+        return ODR_DEV_INCOMPAT;
+    }
+
+    CO_prof_get((CO_profId_t)((CO_profStat_t *)stream->object - CO_prof), &stat);
+    switch (stream->subIndex) {
+        case CO_PROF_OD_SUB_COUNT: value = stat.count; break;
+        case CO_PROF_OD_SUB_MIN:   value = stat.min; break;
+        case CO_PROF_OD_SUB_MAX:   value = stat.max; break;
+        case CO_PROF_OD_SUB_AVG:   value = stat.count > 0U ? (uint32_t)(stat.sum / stat.count) : 0U; break;
+        default:
+            if (stream->subIndex >= CO_PROF_OD_SUB_HIST + CO_PROF_HIST_BUCKETS) {
+                return ODR_SUB_NOT_EXIST;
+            }
+            value = stat.hist[stream->subIndex - CO_PROF_OD_SUB_HIST];
+            break;
+    }
+
+    (void)CO_setUint32(buf, value);
+    *countRead = sizeof(value);
+    return ODR_OK;
+}
+
+/* 次數寫入 0 清除這個量測點，其他子索引唯讀 */
+static ODR_t CO_prof_writeOD(OD_stream_t *stream, const void *buf, OD_size_t count, OD_size_t *countWritten)
+{
+    if (stream == NULL || buf == NULL || countWritten == NULL) {
+        return ODR_DEV_INCOMPAT;
+    }
+    if (stream->subIndex != CO_PROF_OD_SUB_COUNT) {
+        return ODR_READONLY;
+    }
+    if (count != sizeof(uint32_t) || CO_getUint32(buf) != 0U) {
+        return ODR_INVALID_VALUE;
+    }
+
+    CO_prof_reset((CO_profId_t)((CO_profStat_t *)stream->object - CO_prof));
+    *countWritten = count;
+    return ODR_OK;
+}
+
+/******************************************************************************/
+uint32_t CO_prof_initOD(OD_t *od)
+{
+    uint32_t count = 0;
+
+    for (uint32_t id = 0; id < CO_PROF_COUNT; id++) {
+        OD_entry_t *entry = OD_find(od, (uint16_t)(CO_PROF_OD_INDEX + id));
+
+        if (entry == NULL) {
+            continue;
+        }
+        CO_prof_extension[id].object = &CO_prof[id];
+        CO_prof_extension[id].read = CO_prof_readOD;
+        CO_prof_extension[id].write = CO_prof_writeOD;
+        if (OD_extension_init(entry, &CO_prof_extension[id]) == ODR_OK) {
+            count++;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,48 @@
+/**
+ * Object Dictionary access to the CANopen processing profile (0x2100 ~ 0x2107)
+ *
+ * @file CO_prof_od.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 每個量測點 (CO_profId_t) 一個製造商 record，index = CO_PROF_OD_INDEX + id：
+ *  - sub 1：次數 (寫入 0 清除這個量測點)
+ *  - sub 2 / 3 / 4：最小 / 最大 / 平均 CO_CAN_CYCLES()
+ *  - sub 5 ~ 12：直方圖 (CO_PROF_HIST_SHIFT 起，每格上限加倍)
+ * 以 OD 擴充讀出 CO_prof[] 的即時值，OD_RAM 中的預設值不使用。
+ */
+
+#ifndef CO_PROF_OD_H
+#define CO_PROF_OD_H
+
+#include "301/CO_ODinterface.h"
+#include "CO_prof.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 第一個量測點的 OD index */
+#ifndef CO_PROF_OD_INDEX
+#define CO_PROF_OD_INDEX                0x2100U
+#endif
+
+/* record 的子索引 */
+#define CO_PROF_OD_SUB_COUNT            1U
+#define CO_PROF_OD_SUB_MIN              2U
+#define CO_PROF_OD_SUB_MAX              3U
+#define CO_PROF_OD_SUB_AVG              4U
+#define CO_PROF_OD_SUB_HIST             5U
+
+/**
+ * @brief 為 OD 中存在的量測點 record 安裝 OD 擴充
+ * @param od Object Dictionary
+ * @return 安裝的 record 數
+ */
+uint32_t CO_prof_initOD(OD_t *od);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_PROF_OD_H */
@@ -0,0 +1,59 @@
+/**
+ * Real-time slot for SYNC/RPDO/TPDO processing
+ *
+ * @file CO_rt.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+#include "CO_rt.h"
+#include <string.h>
+
+/******************************************************************************/
+void CO_rt_init(CO_rt_t *rt, uint32_t nowMs)
+{
+    memset(rt, 0, sizeof(*rt));
+    rt->lastMs = nowMs;
+    rt->latencyMin = UINT32_MAX;
+}
+
+/******************************************************************************/
+void CO_rt_syncSignal(void *object)
+{
+    CO_rt_t *rt = (CO_rt_t *)object;
+
+    if (rt != NULL) {
+        rt->syncCycles = CO_CAN_CYCLES();
+        rt->syncStamped = true;
+        CO_RT_TRIGGER();
+    }
+}
+
+/******************************************************************************/
+uint32_t CO_rt_begin(CO_rt_t *rt, uint32_t nowMs)
+{
+    uint32_t timeDifference_us = (nowMs - rt->lastMs) * 1000U;
+
+    rt->lastMs = nowMs;
+    rt->runCount++;
+    return timeDifference_us;
+}
+
+/******************************************************************************/
+void CO_rt_end(CO_rt_t *rt, bool_t syncWas)
+{
+    if (!syncWas || !rt->syncStamped) {
+        return;
+    }
+
+    uint32_t latency = CO_CAN_CYCLES() - rt->syncCycles;
+    rt->syncStamped = false;
+    rt->latencyLast = latency;
+    rt->latencySum += latency;
+    rt->syncCount++;
+    if (latency < rt->latencyMin) {
+        rt->latencyMin = latency;
+    }
+    if (latency > rt->latencyMax) {
+        rt->latencyMax = latency;
+    }
+}
@@ -0,0 +1,105 @@
+/**
+ * Real-time slot for SYNC/RPDO/TPDO processing
+ *
+ * @file CO_rt.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * CO_process_SYNC/RPDO/TPDO 不在 1 ms 計時器中斷中執行，而是在獨立的軟體中斷
+ * (PendSV，優先權 CO_RT_PRIORITY) 中執行。觸發來源：
+ *  - 1 ms 計時器中斷：CO_rt_timerTick()
+ *  - RX 中斷讀出訊框 (CO_rx_ring.h)：PendSV 先分派接收訊框，再處理 SYNC/RPDO/TPDO
+ *  - SYNC 接收 (分派時的 CALLBACK_PRE)：CO_rt_syncSignal()，同時記錄分派時間
+ * CAN 中斷優先權 (CO_CAN_IRQ_PRIORITY) 高於 RT slot，RT 處理期間仍可接收訊框；
+ * CO_LOCK_OD/EMCY 只遮罩到 RT slot 的優先權。
+ * 每次 SYNC 處理後記錄 SYNC 接收到 TPDO 送出請求的 CO_CAN_CYCLES() 延遲與抖動。
+ */
+
+#ifndef CO_RT_H
+#define CO_RT_H
+
+#include "CO_driver_target.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 觸發 RT slot - 預設為設定 PendSV pending，可由編譯選項替換 */
+#ifndef CO_RT_TRIGGER
+#define CO_RT_TRIGGER()                 do { SCB->ICSR = SCB_ICSR_PENDSVSET_Msk; } while (0)
+#endif
+
+/* RT slot 狀態與 SYNC -> TPDO 延遲統計 (CO_CAN_CYCLES) */
+typedef struct {
+    uint32_t                lastMs;         /* 上次處理時的 CO_timer1ms */
+    volatile uint32_t       syncCycles;     /* 最近一次 SYNC 接收時間 */
+    volatile bool_t         syncStamped;    /* syncCycles 尚未被處理 */
+    uint32_t                runCount;       /* RT slot 執行次數 */
+    uint32_t                syncCount;      /* 量測到的 SYNC 次數 */
+    uint32_t                latencyMin;
+    uint32_t                latencyMax;
+    uint32_t                latencyLast;
+    uint64_t                latencySum;
+} CO_rt_t;
+
+/**
+ * @brief 初始化
+ * @param rt RT slot 狀態
+ * @param nowMs 目前的 CO_timer1ms
+ */
+void CO_rt_init(CO_rt_t *rt, uint32_t nowMs);
+
+/**
+ * @brief 1 ms 計時器觸發
+ */
+static inline void CO_rt_timerTick(void)
+{
+    CO_RT_TRIGGER();
+}
+
+/**
+ * @brief SYNC 接收回呼 - 在 RT slot 的 RX 分派中調用 (CO_SYNC_initCallbackPre)
+ * @param object CO_rt_t 指標
+ */
+void CO_rt_syncSignal(void *object);
+
+/**
+ * @brief 是否需要執行 RT 處理 - 距上次處理已過 1 ms，或收到 SYNC
+ *
+ * 只為 RX 分派觸發的 PendSV 不重複執行 SYNC/RPDO/TPDO。
+ * @param rt RT slot 狀態
+ * @param nowMs 目前的 CO_timer1ms
+ */
+static inline bool_t CO_rt_due(const CO_rt_t *rt, uint32_t nowMs)
+{
+    return nowMs != rt->lastMs || rt->syncStamped;
+}
+
+/**
+ * @brief RT slot 開始 - 回傳距上次處理的時間 (1 ms 解析度，SYNC 觸發時可為 0)
+ * @param rt RT slot 狀態
+ * @param nowMs 目前的 CO_timer1ms
+ * @return timeDifference_us
+ */
+uint32_t CO_rt_begin(CO_rt_t *rt, uint32_t nowMs);
+
+/**
+ * @brief RT slot 結束 - 本次處理了 SYNC 時記錄 SYNC -> TPDO 延遲
+ * @param rt RT slot 狀態
+ * @param syncWas CO_process_SYNC() 的回傳值
+ */
+void CO_rt_end(CO_rt_t *rt, bool_t syncWas);
+
+/**
+ * @brief SYNC -> TPDO 抖動 (最大 - 最小延遲)
+ */
+static inline uint32_t CO_rt_jitter(const CO_rt_t *rt)
+{
+    return rt->syncCount > 0U ? rt->latencyMax - rt->latencyMin : 0U;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_RT_H */
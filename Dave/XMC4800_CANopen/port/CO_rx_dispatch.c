@@ -0,0 +1,90 @@
+/**
+ * RX dispatch index for XMC4800 CANopen driver
+ *
+ * @file CO_rx_dispatch.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+#include "CO_rx_dispatch.h"
+#include <string.h>
+
+/* 完整 11-bit 遮罩的緩衝區可以直接登記在查表中 */
+static bool_t CO_CANrxDispatch_isExact(const CO_CANrx_t *buffer)
+{
+    return (buffer->CANrx_callback != NULL) && ((buffer->mask & 0x7FFU) == 0x7FFU);
+}
+
+/******************************************************************************/
+void CO_CANrxDispatch_init(CO_CANmodule_t *CANmodule)
+{
+    memset(CANmodule->rxDispatch, CO_CAN_RX_DISPATCH_NONE, sizeof(CANmodule->rxDispatch));
+    CANmodule->rxMaskedCount = 0;
+}
+
+/******************************************************************************/
+void CO_CANrxDispatch_update(CO_CANmodule_t *CANmodule, uint16_t index, uint16_t oldIdent)
+{
+    uint8_t *table = CANmodule->rxDispatch;
+    const CO_CANrx_t *buffer = &CANmodule->rxArray[index];
+    uint16_t oldSlot = oldIdent & 0x7FFU;
+    uint16_t i;
+
+    /* **🔧 移除舊登記** - 同一 COB-ID 可能有多個緩衝區 (例如未使用的 HB consumer
+     * 與 NMT 都是 ID=0)，改由下一個最小 index 接手，與原本線性掃描的優先順序一致 */
+    if (table[oldSlot] == index) {
+        table[oldSlot] = CO_CAN_RX_DISPATCH_NONE;
+        for (i = 0; i < CANmodule->rxSize; i++) {
+            const CO_CANrx_t *other = &CANmodule->rxArray[i];
+            if (i != index && CO_CANrxDispatch_isExact(other) && (other->ident & 0x7FFU) == oldSlot) {
+                table[oldSlot] = (uint8_t)i;
+                break;
+            }
+        }
+    }
+
+    /* **✅ 登記新設定** - 最小 index 優先 */
+    if (CO_CANrxDispatch_isExact(buffer)) {
+        uint16_t slot = buffer->ident & 0x7FFU;
+        if (table[slot] == CO_CAN_RX_DISPATCH_NONE || table[slot] > index) {
+            table[slot] = (uint8_t)index;
+        }
+    }
+
+    /* 重新建立備用掃描清單 (依 index 排序) */
+    uint16_t maskedCount = 0;
+    for (i = 0; i < CANmodule->rxSize; i++) {
+        const CO_CANrx_t *other = &CANmodule->rxArray[i];
+        if (other->CANrx_callback != NULL && !CO_CANrxDispatch_isExact(other)) {
+            if (maskedCount < CO_CAN_RX_MASKED_MAX) {
+                CANmodule->rxMasked[maskedCount] = (uint8_t)i;
+            }
+            maskedCount++;
+        }
+    }
+    CANmodule->rxMaskedCount = maskedCount;
+}
+
+/******************************************************************************/
+CO_CANrx_t *CO_CANrxDispatch_findMasked(CO_CANmodule_t *CANmodule, uint16_t ident)
+{
+    /* 一般情況：只檢查清單中的遮罩項 */
+    if (CANmodule->rxMaskedCount <= CO_CAN_RX_MASKED_MAX) {
+        for (uint16_t i = 0; i < CANmodule->rxMaskedCount; i++) {
+            CO_CANrx_t *buffer = &CANmodule->rxArray[CANmodule->rxMasked[i]];
+            if (((ident ^ buffer->ident) & buffer->mask) == 0U) {
+                return buffer;
+            }
+        }
+        return NULL;
+    }
+
+    /* 遮罩項過多：退回完整掃描 */
+    for (uint16_t i = 0; i < CANmodule->rxSize; i++) {
+        CO_CANrx_t *buffer = &CANmodule->rxArray[i];
+        if (buffer->CANrx_callback != NULL && !CO_CANrxDispatch_isExact(buffer) &&
+            ((ident ^ buffer->ident) & buffer->mask) == 0U) {
+            return buffer;
+        }
+    }
+    return NULL;
+}
@@ -0,0 +1,67 @@
+/**
+ * RX dispatch index for XMC4800 CANopen driver
+ *
+ * @file CO_rx_dispatch.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 以 11-bit COB-ID 為索引的 2048 項查表，讓 CO_CANinterrupt_Rx() 以 O(1)
+ * 找到接收緩衝區。遮罩不完整 (mask != 0x7FF) 的緩衝區走備用線性掃描。
+ * 本模組不依賴 DAVE 硬體，可在 Linux 主機上編譯 (見 host/)。
+ */
+
+#ifndef CO_RX_DISPATCH_H
+#define CO_RX_DISPATCH_H
+
+#include "CO_driver_target.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 清空分派索引 - 在 CO_CANmodule_init() 設定 rxArray 之後調用
+ * @param CANmodule CAN 模組物件
+ */
+void CO_CANrxDispatch_init(CO_CANmodule_t *CANmodule);
+
+/**
+ * @brief 更新單一接收緩衝區的分派登記 - 在 CO_CANrxBufferInit() 寫入新設定後調用
+ * @param CANmodule CAN 模組物件
+ * @param index rxArray 索引
+ * @param oldIdent 該緩衝區更新前的 COB-ID
+ */
+void CO_CANrxDispatch_update(CO_CANmodule_t *CANmodule, uint16_t index, uint16_t oldIdent);
+
+/**
+ * @brief 備用路徑：線性掃描遮罩不完整的緩衝區
+ * @param CANmodule CAN 模組物件
+ * @param ident 接收到的 11-bit COB-ID
+ * @return 匹配的接收緩衝區，找不到則為 NULL
+ */
+CO_CANrx_t *CO_CANrxDispatch_findMasked(CO_CANmodule_t *CANmodule, uint16_t ident);
+
+/**
+ * @brief 依 COB-ID 尋找接收緩衝區 - ISR 使用
+ * @param CANmodule CAN 模組物件
+ * @param ident 接收到的 11-bit COB-ID
+ * @return 匹配的接收緩衝區，找不到則為 NULL
+ */
+static inline CO_CANrx_t *CO_CANrxDispatch_find(CO_CANmodule_t *CANmodule, uint16_t ident)
+{
+    uint8_t idx = CANmodule->rxDispatch[ident & 0x7FFU];
+
+    if (idx != CO_CAN_RX_DISPATCH_NONE) {
+        return &CANmodule->rxArray[idx];
+    }
+    if (CANmodule->rxMaskedCount != 0U) {
+        return CO_CANrxDispatch_findMasked(CANmodule, ident);
+    }
+    return NULL;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_RX_DISPATCH_H */
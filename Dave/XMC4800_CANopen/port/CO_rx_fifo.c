@@ -0,0 +1,56 @@
+/**
+ * MultiCAN receive FIFO drain for XMC4800 CANopen driver
+ *
+ * @file CO_rx_fifo.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+#include "CO_rx_fifo.h"
+#include "CO_rx_mo.h"
+#include <string.h>
+
+/******************************************************************************/
+void CO_CANrxFifo_init(CO_CANrxFifo_t *fifo, XMC_CAN_MO_t *slaves, uint16_t depth)
+{
+    memset(fifo, 0, sizeof(*fifo));
+    fifo->slaves = slaves;
+    fifo->depth = depth;
+}
+
+/******************************************************************************/
+uint16_t CO_CANrxFifo_drain(CO_CANrxFifo_t *fifo, uint16_t budget,
+                            CO_CANrxFifo_handler_t handler, void *object)
+{
+    uint16_t count = 0;
+
+    while (count < budget) {
+        XMC_CAN_MO_t *mo = &fifo->slaves[fifo->readIndex];
+        uint32_t status = XMC_CAN_MO_GetStatus(mo);
+
+        /* 硬體寫完才設定 NEWDAT - 沒有新資料表示已追上 CUR */
+        if ((status & XMC_CAN_MO_STATUS_NEW_DATA) == 0U) {
+            break;
+        }
+
+        /* **⚠️ 讀取前已被覆寫** - 舊訊框遺失，保留最新的內容 */
+        if (status & XMC_CAN_MO_STATUS_MESSAGE_LOST) {
+            XMC_CAN_MO_ResetStatus(mo, XMC_CAN_MO_RESET_STATUS_MESSAGE_LOST);
+            fifo->overrunCount++;
+        }
+
+        CO_CANrxMsg_t msg;
+        CO_CANrxMo_read(mo, &msg);
+
+        handler(object, &msg);
+
+        fifo->readIndex = (uint16_t)((fifo->readIndex + 1U) % fifo->depth);
+        count++;
+    }
+
+    fifo->frameCount += count;
+    if (count > fifo->maxBatch) {
+        fifo->maxBatch = count;
+    }
+
+    return count;
+}
@@ -0,0 +1,64 @@
+/**
+ * MultiCAN receive FIFO drain for XMC4800 CANopen driver
+ *
+ * @file CO_rx_fifo.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * RX FIFO 模式 (CO_CAN_RX_FIFO_ENABLE) 下，基底 MO 接受所有標準訊框，硬體依序寫入
+ * BOT..TOP 的 slave MO。本模組依相同順序讀出 slave，一次中斷處理一批訊框；
+ * slave 被覆寫前未讀取時硬體設定 MSGLST，記為 overrun。
+ * 只使用 xmc_can.h 的 MO API，可在 Linux 主機上以 mock 暫存器測試 (見 host/)。
+ */
+
+#ifndef CO_RX_FIFO_H
+#define CO_RX_FIFO_H
+
+#include "CO_driver_target.h"
+#include "xmc_can.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 訊框處理函數
+ * @param object 由 CO_CANrxFifo_drain() 傳入
+ * @param msg 接收的訊框 (只在調用期間有效)
+ */
+typedef void (*CO_CANrxFifo_handler_t)(void *object, const CO_CANrxMsg_t *msg);
+
+/* RX FIFO 軟體狀態 */
+typedef struct {
+    XMC_CAN_MO_t            *slaves;        /* slave MO，依 FIFO 順序 (BOT 到 TOP) */
+    uint16_t                depth;          /* slave 數量 */
+    uint16_t                readIndex;      /* 下一個要讀取的 slave */
+    uint16_t                maxBatch;       /* 單次 drain 處理的最大訊框數 */
+    volatile uint32_t       frameCount;     /* 已讀出的訊框數 */
+    volatile uint32_t       overrunCount;   /* 被覆寫而遺失的訊框數 (MSGLST) */
+} CO_CANrxFifo_t;
+
+/**
+ * @brief 初始化軟體狀態 - 硬體 CUR 必須同時設為 BOT
+ * @param fifo FIFO 物件
+ * @param slaves slave MO 陣列 (依 FIFO 順序)
+ * @param depth slave 數量
+ */
+void CO_CANrxFifo_init(CO_CANrxFifo_t *fifo, XMC_CAN_MO_t *slaves, uint16_t depth);
+
+/**
+ * @brief 依序讀出已接收的訊框 - 在 CAN ISR 中調用
+ * @param fifo FIFO 物件
+ * @param budget 本次最多處理的訊框數
+ * @param handler 訊框處理函數
+ * @param object 傳給 handler
+ * @return 處理的訊框數
+ */
+uint16_t CO_CANrxFifo_drain(CO_CANrxFifo_t *fifo, uint16_t budget,
+                            CO_CANrxFifo_handler_t handler, void *object);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_RX_FIFO_H */
@@ -0,0 +1,53 @@
+/**
+ * Direct receive of a MultiCAN message object for XMC4800 CANopen driver
+ *
+ * @file CO_rx_mo.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 由 MO 暫存器直接建立 CO_CANrxMsg_t，取代 CAN_NODE_MO_Receive() + 逐位元組複製：
+ *  - 一次 MOCTR 寫入同時清除 NEWDAT 與 RXPND (原本 ResetStatus 與 Receive 各一次)
+ *  - MOAR / MOFCR 各讀一次，資料以 MODATAL / MODATAH 兩個 32-bit 字寫入 4-byte 對齊的 data[]
+ *  - 不經過 XMC_CAN_MO_t 的軟體副本 (can_identifier / can_data[])
+ * 讀取後 NEWDAT 或 RXUPD 再次設定 (讀取期間硬體寫入新訊框) 時重讀，與 XMC_CAN_MO_Receive() 相同。
+ * 只使用 xmc_can.h 的 MO API 與暫存器，可在 Linux 主機上以 mock 暫存器測試 (見 host/)。
+ */
+
+#ifndef CO_RX_MO_H
+#define CO_RX_MO_H
+
+#include <string.h>
+
+#include "CO_driver_target.h"
+#include "xmc_can.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief 讀出 RX MO 的訊框 - 呼叫前 MOSTAT.NEWDAT 必須為 1 (由呼叫者以 XMC_CAN_MO_GetStatus() 檢查)
+ * @param mo RX MO (標準 11-bit 訊框)
+ * @param msg 接收的訊框，DLC 9~15 視為 8
+ */
+static inline void CO_CANrxMo_read(const XMC_CAN_MO_t *mo, CO_CANrxMsg_t *msg)
+{
+    CAN_MO_TypeDef *reg = mo->can_mo_ptr;
+    uint32_t status;
+
+    do {
+        XMC_CAN_MO_ResetStatus(mo, XMC_CAN_MO_RESET_STATUS_NEW_DATA | XMC_CAN_MO_RESET_STATUS_RX_PENDING);
+        uint32_t data[2] = { reg->MODATAL, reg->MODATAH };
+        uint32_t dlc = (reg->MOFCR & CAN_MO_MOFCR_DLC_Msk) >> CAN_MO_MOFCR_DLC_Pos;
+        msg->ident = (reg->MOAR & XMC_CAN_MO_MOAR_STDID_Msk) >> XMC_CAN_MO_MOAR_STDID_Pos;
+        msg->DLC = (uint8_t)(dlc > 8U ? 8U : dlc);
+        memcpy(msg->data, data, sizeof(msg->data));
+        status = XMC_CAN_MO_GetStatus(mo);
+    } while ((status & (XMC_CAN_MO_STATUS_NEW_DATA | XMC_CAN_MO_STATUS_RX_UPDATING)) != 0U);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_RX_MO_H */
@@ -0,0 +1,53 @@
+/**
+ * Received frame ring between the CAN ISR and the RX softirq
+ *
+ * @file CO_rx_ring.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+#include "CO_rx_ring.h"
+#include <string.h>
+
+/******************************************************************************/
+void CO_CANrxRing_init(CO_CANrxRing_t *ring)
+{
+    memset(ring, 0, sizeof(*ring));
+}
+
+/******************************************************************************/
+uint32_t CO_CANrxRing_dispatch(CO_CANrxRing_t *ring, uint32_t budget, uint32_t cycles,
+                               CO_CANrxRing_handler_t handler, void *object)
+{
+    uint32_t start = CO_CAN_CYCLES();
+    uint32_t tail = ring->tail;
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    uint32_t pending = head - tail;
+    uint32_t count = 0U;
+
+    if (pending > budget) {
+        pending = budget;
+    }
+
+    while (count < pending && (CO_CAN_CYCLES() - start) < cycles) {
+        handler(object, &ring->frames[tail & (CO_CAN_RX_RING_SIZE - 1U)]);
+
+        /* handler 返回後才釋放這一格給生產者 */
+        tail++;
+        count++;
+        __atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+    }
+
+    ring->backlog = (__atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) != tail);
+    ring->batchCycles = CO_CAN_CYCLES() - start;
+
+    if (count > 0U) {
+        ring->batchCount++;
+        if (count > ring->batchFramesMax) {
+            ring->batchFramesMax = count;
+        }
+        if (ring->batchCycles > ring->batchCyclesMax) {
+            ring->batchCyclesMax = ring->batchCycles;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,154 @@
+/**
+ * Received frame ring between the CAN ISR and the RX softirq
+ *
+ * @file CO_rx_ring.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * CAN ISR 只把訊框由 MO 讀進環形緩衝區 (生產者)，查表與 CANopen 接收回呼改在
+ * 軟體中斷 (RT slot 的 PendSV) 中以 CO_CANrxRing_dispatch() 分批處理 (消費者)：
+ *  - ISR 以 CO_CANrxRing_reserve() / commit() 直接讀進緩衝區的格子，不經過區域變數
+ *  - 緩衝區滿時丟棄新訊框並計數，MO 照常清除 (否則硬體會持續覆寫並設定 MSGLST)
+ *  - 每次 dispatch 最多處理 budget 個訊框、最多使用 cycles 個 CO_CAN_CYCLES() (回呼時間不固定，
+ *    只限制訊框數時 16 個 150 us 的回呼就超過 1 ms 週期)，記錄最高使用量、丟棄數與每批的時間
+ *  - 用完預算仍有訊框時設定 backlog，ISR 不再觸發軟體中斷，由週期觸發 (1 ms 計時器) 接續，
+ *    訊框持續湧入時每個週期的分派時間有上限，其餘時間留給主循環
+ * head 只由生產者寫入，tail 只由消費者寫入，單一生產者 / 單一消費者時不需要鎖。
+ * 只使用 CO_driver_target.h 的型別，可在 Linux 主機上測試 (見 host/)。
+ */
+
+#ifndef CO_RX_RING_H
+#define CO_RX_RING_H
+
+#include "CO_driver_target.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 緩衝區訊框數 - 必須是 2 的次方 */
+#ifndef CO_CAN_RX_RING_SIZE
+#define CO_CAN_RX_RING_SIZE             64U
+#endif
+
+#if (CO_CAN_RX_RING_SIZE & (CO_CAN_RX_RING_SIZE - 1U)) != 0U
+#error "CO_CAN_RX_RING_SIZE must be a power of 2"
+#endif
+
+/**
+ * @brief 訊框處理函數
+ * @param object 由 CO_CANrxRing_dispatch() 傳入
+ * @param msg 接收的訊框 (只在調用期間有效)
+ */
+typedef void (*CO_CANrxRing_handler_t)(void *object, const CO_CANrxMsg_t *msg);
+
+/* 環形緩衝區 - head / tail 為自由遞增的訊框數，待處理訊框為 [tail, head) */
+typedef struct {
+    CO_CANrxMsg_t           frames[CO_CAN_RX_RING_SIZE];
+    volatile uint32_t       head;           /* 已寫入的訊框數 (生產者) */
+    volatile uint32_t       tail;           /* 已分派的訊框數 (消費者) */
+    volatile uint32_t       dropCount;      /* 緩衝區滿而丟棄的訊框數 (生產者) */
+    volatile uint32_t       maxFill;        /* 最高使用量 (生產者) */
+    volatile bool_t         backlog;        /* 上次 dispatch 用完預算仍有訊框 (消費者) */
+    uint32_t                batchCycles;    /* 上次 dispatch 的 CO_CAN_CYCLES() */
+    uint32_t                batchCount;     /* 處理過訊框的 dispatch 次數 */
+    uint32_t                batchFramesMax; /* 單次 dispatch 的最多訊框數 */
+    uint32_t                batchCyclesMax; /* 單次 dispatch 的最長 CO_CAN_CYCLES() */
+} CO_CANrxRing_t;
+
+/**
+ * @brief 初始化 (清空) 緩衝區
+ * @param ring 緩衝區
+ */
+void CO_CANrxRing_init(CO_CANrxRing_t *ring);
+
+/**
+ * @brief 取得下一個空格 - 生產者 (ISR) 端
+ *
+ * 寫入後以 CO_CANrxRing_commit() 交給消費者；緩衝區滿時計入 dropCount。
+ * @param ring 緩衝區
+ * @return 空格；NULL 表示緩衝區已滿
+ */
+static inline CO_CANrxMsg_t *CO_CANrxRing_reserve(CO_CANrxRing_t *ring)
+{
+    uint32_t head = ring->head;
+
+    if (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) >= CO_CAN_RX_RING_SIZE) {
+        ring->dropCount++;
+        return NULL;
+    }
+    return &ring->frames[head & (CO_CAN_RX_RING_SIZE - 1U)];
+}
+
+/**
+ * @brief 交出 CO_CANrxRing_reserve() 取得的格子 - 生產者 (ISR) 端
+ * @param ring 緩衝區
+ */
+static inline void CO_CANrxRing_commit(CO_CANrxRing_t *ring)
+{
+    uint32_t head = ring->head + 1U;
+
+    /* 訊框寫完後才讓消費者看到 */
+    __atomic_store_n(&ring->head, head, __ATOMIC_RELEASE);
+
+    uint32_t fill = head - ring->tail;
+    if (fill > ring->maxFill) {
+        ring->maxFill = fill;
+    }
+}
+
+/**
+ * @brief 複製一個訊框到緩衝區 - 生產者 (ISR) 端
+ * @param ring 緩衝區
+ * @param msg 訊框
+ * @return false: 緩衝區已滿，訊框丟棄
+ */
+static inline bool_t CO_CANrxRing_push(CO_CANrxRing_t *ring, const CO_CANrxMsg_t *msg)
+{
+    CO_CANrxMsg_t *slot = CO_CANrxRing_reserve(ring);
+
+    if (slot == NULL) {
+        return false;
+    }
+    *slot = *msg;
+    CO_CANrxRing_commit(ring);
+    return true;
+}
+
+/**
+ * @brief 待分派的訊框數
+ */
+static inline uint32_t CO_CANrxRing_pending(const CO_CANrxRing_t *ring)
+{
+    return ring->head - ring->tail;
+}
+
+/**
+ * @brief 生產者是否需要觸發軟體中斷 - 有待分派訊框且消費者沒有積壓
+ *
+ * 積壓時由週期觸發接續，避免每個 RX 中斷都讓軟體中斷再處理一批。
+ */
+static inline bool_t CO_CANrxRing_signalNeeded(const CO_CANrxRing_t *ring)
+{
+    return CO_CANrxRing_pending(ring) != 0U && !ring->backlog;
+}
+
+/**
+ * @brief 依序分派待處理的訊框 - 消費者 (軟體中斷) 端
+ *
+ * 已用時間達到 cycles 後不再開始下一個訊框 (最後一個回呼可能超過 cycles)；cycles 為 0 時不處理。
+ * @param ring 緩衝區
+ * @param budget 本次最多處理的訊框數
+ * @param cycles 本次最多使用的 CO_CAN_CYCLES()
+ * @param handler 訊框處理函數
+ * @param object 傳給 handler
+ * @return 處理的訊框數
+ */
+uint32_t CO_CANrxRing_dispatch(CO_CANrxRing_t *ring, uint32_t budget, uint32_t cycles,
+                               CO_CANrxRing_handler_t handler, void *object);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_RX_RING_H */
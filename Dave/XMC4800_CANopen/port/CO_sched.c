@@ -0,0 +1,47 @@
+/**
+ * Event-driven scheduling of CO_process() for the main loop
+ *
+ * @file CO_sched.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+#include "CO_sched.h"
+
+/******************************************************************************/
+void CO_sched_init(CO_sched_t *sched, uint32_t nowMs)
+{
+    sched->signal = true;           /* 初始化後立即執行一次 */
+    sched->lastMs = nowMs;
+    sched->timerNext_us = 0U;
+    sched->runCount = 0U;
+    sched->signalCount = 0U;
+}
+
+/******************************************************************************/
+void CO_sched_signal(void *object)
+{
+    CO_sched_t *sched = (CO_sched_t *)object;
+
+    if (sched != NULL) {
+        sched->signal = true;
+        sched->signalCount++;
+    }
+}
+
+/******************************************************************************/
+bool_t CO_sched_due(CO_sched_t *sched, uint32_t nowMs, uint32_t *timeDifference_us)
+{
+    uint32_t elapsed_us = (nowMs - sched->lastMs) * 1000U;
+
+    if (!sched->signal && elapsed_us < sched->timerNext_us) {
+        return false;
+    }
+
+    /* 先清除旗標再處理：處理期間到達的訊框會再次設定 */
+    sched->signal = false;
+    sched->lastMs = nowMs;
+    sched->timerNext_us = CO_SCHED_MAX_INTERVAL_US;
+    sched->runCount++;
+    *timeDifference_us = elapsed_us;
+    return true;
+}
@@ -0,0 +1,82 @@
+/**
+ * Event-driven scheduling of CO_process() for the main loop
+ *
+ * @file CO_sched.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 主循環不再固定每 10 ms 呼叫 CO_process()，而是在下列情況立即執行：
+ *  - 接收中斷的 CALLBACK_PRE (CO_CONFIG_FLAG_CALLBACK_PRE) 呼叫 CO_sched_signal()
+ *  - 上次 CO_process() 回報的 timerNext_us (CO_CONFIG_FLAG_TIMERNEXT) 已到期
+ * 其餘時間 CO_sched_idle() 為 true，主循環可以 WFI 睡眠，由下一個中斷喚醒。
+ * 時間基準為 CO_timer1ms，所以到期判斷的解析度為 1 ms。
+ */
+
+#ifndef CO_SCHED_H
+#define CO_SCHED_H
+
+#include "CO_driver_target.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 兩次 CO_process() 之間的最長間隔 (沒有任何物件要求更早喚醒時) */
+#ifndef CO_SCHED_MAX_INTERVAL_US
+#define CO_SCHED_MAX_INTERVAL_US        100000U
+#endif
+
+/* 主循環閒置時以 WFI 睡眠 (除錯器單步時可設為 0) */
+#ifndef CO_SCHED_WFI_ENABLE
+#define CO_SCHED_WFI_ENABLE             1
+#endif
+
+/* 排程狀態 */
+typedef struct {
+    volatile bool_t         signal;         /* 接收中斷要求處理 */
+    uint32_t                lastMs;         /* 上次 CO_process() 的 CO_timer1ms */
+    uint32_t                timerNext_us;   /* 傳給 CO_process() 的 timerNext_us */
+    uint32_t                runCount;       /* CO_process() 執行次數 */
+    uint32_t                signalCount;    /* 由接收中斷觸發的次數 */
+} CO_sched_t;
+
+/**
+ * @brief 初始化
+ * @param sched 排程狀態
+ * @param nowMs 目前的 CO_timer1ms
+ */
+void CO_sched_init(CO_sched_t *sched, uint32_t nowMs);
+
+/**
+ * @brief CALLBACK_PRE 回呼 - 在中斷中調用，只設定旗標
+ * @param object CO_sched_t 指標 (xxx_initCallbackPre() 的 object 參數)
+ */
+void CO_sched_signal(void *object);
+
+/**
+ * @brief 判斷此時是否要執行 CO_process()
+ *
+ * 回傳 true 時清除旗標、更新 lastMs，並把 timerNext_us 重設為
+ * CO_SCHED_MAX_INTERVAL_US；呼叫端接著以 &sched->timerNext_us 呼叫 CO_process()。
+ * @param sched 排程狀態
+ * @param nowMs 目前的 CO_timer1ms
+ * @param timeDifference_us [out] 距上次執行的時間
+ * @return true: 執行 CO_process()
+ */
+bool_t CO_sched_due(CO_sched_t *sched, uint32_t nowMs, uint32_t *timeDifference_us);
+
+/**
+ * @brief 沒有待處理的工作 - 主循環可以睡眠到下一個中斷
+ * @param sched 排程狀態
+ * @return true: 可以睡眠
+ */
+static inline bool_t CO_sched_idle(const CO_sched_t *sched)
+{
+    return !sched->signal && sched->timerNext_us != 0U;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_SCHED_H */
@@ -0,0 +1,195 @@
+/**
+ * Pool of SDO client channels for batch configuration of many nodes (host / gateway builds)
+ *
+ * @file CO_sdo_pool.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+#include "CO_sdo_pool.h"
+#include <string.h>
+
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ENABLE) != 0
+
+/* 項目狀態 */
+#define CO_SDO_POOL_PENDING             0U
+#define CO_SDO_POOL_ACTIVE              1U
+#define CO_SDO_POOL_DONE                2U
+
+static inline bool_t CO_SDOpool_nodeBusy(const CO_SDOpool_t *pool, uint8_t nodeId)
+{
+    return (pool->busy[nodeId >> 5] & (1UL << (nodeId & 0x1FU))) != 0U;
+}
+
+static inline void CO_SDOpool_setBusy(CO_SDOpool_t *pool, uint8_t nodeId, bool_t busy)
+{
+    if (busy) {
+        pool->busy[nodeId >> 5] |= 1UL << (nodeId & 0x1FU);
+    } else {
+        pool->busy[nodeId >> 5] &= ~(1UL << (nodeId & 0x1FU));
+    }
+}
+
+static void CO_SDOpool_finish(CO_SDOpool_t *pool, CO_SDOpool_channel_t *ch, CO_SDO_abortCode_t abortCode)
+{
+    CO_SDOpool_item_t *item = ch->item;
+
+    item->abortCode = abortCode;
+    item->state = CO_SDO_POOL_DONE;
+    CO_SDOpool_setBusy(pool, item->nodeId, false);
+    ch->item = NULL;
+    pool->done++;
+    if (abortCode != CO_SDO_AB_NONE) {
+        pool->failed++;
+    }
+}
+
+/* 釋放閒置通道的 COB-ID */
+static void CO_SDOpool_release(CO_SDOpool_channel_t *ch)
+{
+    if (ch->nodeId != 0U) {
+        (void)CO_SDOclient_setup(ch->client, 0x80000000UL, 0x80000000UL, 0);
+        ch->nodeId = 0;
+    }
+}
+
+/* 閒置的通道取下一筆節點空閒的項目，回傳 false：沒有可開始的項目 */
+static bool_t CO_SDOpool_assign(CO_SDOpool_t *pool, CO_SDOpool_channel_t *ch)
+{
+    while (pool->next < pool->itemCount && pool->items[pool->next].state != CO_SDO_POOL_PENDING) {
+        pool->next++;
+    }
+    for (uint32_t i = pool->next; i < pool->itemCount; i++) {
+        CO_SDOpool_item_t *item = &pool->items[i];
+        if (item->state != CO_SDO_POOL_PENDING || CO_SDOpool_nodeBusy(pool, item->nodeId)) {
+            continue;
+        }
+
+        uint8_t data[4];
+        for (uint8_t b = 0; b < item->size; b++) {
+            data[b] = (uint8_t)(item->value >> (8U * b));
+        }
+        item->state = CO_SDO_POOL_ACTIVE;
+        CO_SDOpool_setBusy(pool, item->nodeId, true);
+        ch->item = item;
+        ch->nodeId = item->nodeId;
+        if (CO_SDOclient_setup(ch->client, 0x600U + item->nodeId, 0x580U + item->nodeId, item->nodeId)
+                != CO_SDO_RT_ok_communicationEnd
+            || CO_SDOclientDownloadInitiate(ch->client, item->index, item->subIndex, item->size, pool->timeout_ms,
+                                            false) != CO_SDO_RT_ok_communicationEnd
+            || CO_SDOclientDownloadBufWrite(ch->client, data, item->size) != item->size) {
+            CO_SDOpool_finish(pool, ch, CO_SDO_AB_GENERAL);
+            continue;
+        }
+        return true;
+    }
+    CO_SDOpool_release(ch);
+    return false;
+}
+
+/* 處理一個通道，交易結束時立即開始下一筆 */
+static void CO_SDOpool_run(CO_SDOpool_t *pool, CO_SDOpool_channel_t *ch, uint32_t timeDifference_us,
+                           uint32_t *timerNext_us)
+{
+    while (ch->item != NULL) {
+        CO_SDO_abortCode_t abortCode = CO_SDO_AB_NONE;
+        size_t sizeTransferred = 0;
+        CO_SDO_return_t ret = CO_SDOclientDownload(ch->client, timeDifference_us, false, false, &abortCode,
+                                                   &sizeTransferred, timerNext_us);
+        if (ret > 0) {
+            break;
+        }
+        CO_SDOpool_finish(pool, ch, ret == CO_SDO_RT_ok_communicationEnd ? CO_SDO_AB_NONE : abortCode);
+        if (!CO_SDOpool_assign(pool, ch)) {
+            break;
+        }
+        timeDifference_us = 0;
+    }
+}
+
+/******************************************************************************/
+CO_ReturnError_t CO_SDOpool_init(CO_SDOpool_t *pool, CO_SDOclient_t clients[], uint8_t count, uint16_t timeout_ms)
+{
+    if (pool == NULL || clients == NULL || count == 0U || count > CO_SDO_POOL_CHANNELS_MAX) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+#if !CO_CAN_RX_LIVE_SETUP
+    /* CO_SDOclient_setup() 會重新初始化正在使用的 RX LMO */
+    return CO_ERROR_INVALID_STATE;
+#endif
+    memset(pool, 0, sizeof(*pool));
+    for (uint8_t i = 0; i < count; i++) {
+        pool->channel[i].client = &clients[i];
+    }
+    pool->channelCount = count;
+    pool->timeout_ms = timeout_ms;
+    return CO_ERROR_NO;
+}
+
+/******************************************************************************/
+CO_ReturnError_t CO_SDOpool_start(CO_SDOpool_t *pool, CO_SDOpool_item_t items[], uint32_t count)
+{
+    if (pool == NULL || CO_SDOpool_busy(pool) || (items == NULL && count > 0U)) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (items[i].nodeId == 0U || items[i].nodeId > 127U || items[i].size == 0U || items[i].size > 4U) {
+            return CO_ERROR_ILLEGAL_ARGUMENT;
+        }
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        items[i].state = CO_SDO_POOL_PENDING;
+        items[i].abortCode = CO_SDO_AB_NONE;
+    }
+    pool->items = items;
+    pool->itemCount = count;
+    pool->next = 0;
+    pool->done = 0;
+    pool->failed = 0;
+    memset(pool->busy, 0, sizeof(pool->busy));
+    return CO_ERROR_NO;
+}
+
+/******************************************************************************/
+uint32_t CO_SDOpool_process(CO_SDOpool_t *pool, uint32_t timeDifference_us, uint32_t *timerNext_us)
+{
+    for (uint8_t k = 0; k < pool->channelCount; k++) {
+        CO_SDOpool_channel_t *ch = &pool->channel[(pool->rr + k) % pool->channelCount];
+        uint32_t dt = timeDifference_us;
+
+        if (ch->item == NULL) {
+            if (!CO_SDOpool_assign(pool, ch)) {
+                continue;
+            }
+            dt = 0;     /* 新的交易：逾時從現在開始 */
+        }
+        CO_SDOpool_run(pool, ch, dt, timerNext_us);
+    }
+    pool->rr = (uint8_t)((pool->rr + 1U) % pool->channelCount);
+    return pool->itemCount - pool->done;
+}
+
+/******************************************************************************/
+void CO_SDOpool_abort(CO_SDOpool_t *pool)
+{
+    for (uint8_t i = 0; i < pool->channelCount; i++) {
+        CO_SDOpool_channel_t *ch = &pool->channel[i];
+        if (ch->item != NULL) {
+            CO_SDO_abortCode_t abortCode = CO_SDO_AB_GENERAL;
+            size_t sizeTransferred = 0;
+            (void)CO_SDOclientDownload(ch->client, 0, true, false, &abortCode, &sizeTransferred, NULL);
+            CO_SDOpool_finish(pool, ch, CO_SDO_AB_GENERAL);
+        }
+        CO_SDOpool_release(ch);
+    }
+    for (uint32_t i = pool->next; i < pool->itemCount; i++) {
+        if (pool->items[i].state == CO_SDO_POOL_PENDING) {
+            pool->items[i].state = CO_SDO_POOL_DONE;
+            pool->items[i].abortCode = CO_SDO_AB_GENERAL;
+            pool->done++;
+            pool->failed++;
+        }
+    }
+    pool->next = pool->itemCount;
+}
+
+#endif /* (CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_ENABLE */
@@ -0,0 +1,133 @@
+/**
+ * Pool of SDO client channels for batch configuration of many nodes (host / gateway builds)
+ *
+ * @file CO_sdo_pool.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 網路設定 (commissioning) 時對許多節點寫入參數：每個 SDO 交易大部分時間在等待伺服器回應，
+ * 一次只執行一個交易時匯流排幾乎閒置。CO_SDOpool_t 以 N 個 SDO 客戶端 (OD 0x1280 ~ 0x1280+N-1，
+ * CO->SDOclient[]) 同時對不同的節點執行交易：
+ *  - 批次 API：CO_SDOpool_start() 傳入 (node, index, sub, value) 陣列，結果 (中止碼) 寫回每一筆
+ *  - 閒置的通道依陣列順序取下一筆「節點沒有進行中交易」的項目，同一節點的項目依序執行
+ *    (SDO 伺服器一次只處理一個交易，參數常有順序關係，例如 PDO 映射)
+ *  - 一個 CO_SDOpool_process() 輪流處理所有通道 (起點每次輪替)，結束的通道立即取下一筆，
+ *    各通道的訊框交錯送出，匯流排保持忙碌
+ * 通道的客戶端由 CO_SDOclient_setup() 改為目標節點的預設 SDO COB-ID (0x600 / 0x580 + node)，
+ * 通道閒置時釋放 (COB-ID 無效)：接收查表中同一 COB-ID 由最小 index 的緩衝區接收，閒置的通道
+ * 若保留舊的設定，會搶走之後由其他通道對同一節點送出的交易的回應。
+ * 重新設定發生在匯流排運作中，需要 CO_CAN_RX_LIVE_SETUP (RX FIFO 模式)：LMO 模式的 CO_CANrxBufferInit()
+ * 會重新初始化正在接收的 RX LMO，CO_SDOpool_init() 回傳 CO_ERROR_INVALID_STATE。
+ * 只支援 1 ~ 4 byte 的快速 (expedited) 下載；較大的物件使用 CO_SDOclientDownload()。
+ * CO_SDOpool_process() 與 CO_process() 在同一個執行緒中調用；客戶端的 CALLBACK_PRE 可接到
+ * CO_sched_signal() (port/CO_sched.h)，收到回應時立即處理。
+ *
+ * **只用於主機 / 閘道器的建置，目前的 XMC4800 韌體不使用：** 韌體關閉 SDO 客戶端
+ * (CO_CONFIG_SDO_CLI 未設定，本檔案的內容不編譯)、OD 只有一個 0x1280 (OD_CNT_SDO_CLI = 1)，
+ * 而且使用 LMO 模式 (CO_CAN_RX_FIFO_ENABLE = 0，所以 CO_CAN_RX_LIVE_SETUP = 0)。
+ * 測試與量測在 host/sim_sdo_pool (虛擬匯流排，-DCO_CAN_RX_LIVE_SETUP=1)。
+ * 韌體要作為設定主站時需同時：CO_CAN_RX_FIFO_ENABLE=1、啟用 CO_CONFIG_SDO_CLI 與 CO_CONFIG_FIFO、
+ * EDS 加入 0x1281 ~ 0x1280+N-1 並重新產生 OD (host/od_gen)。
+ */
+
+#ifndef CO_SDO_POOL_H
+#define CO_SDO_POOL_H
+
+#include "301/CO_SDOclient.h"
+
+#if ((CO_CONFIG_SDO_CLI)&CO_CONFIG_SDO_CLI_ENABLE) != 0
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 通道數上限 */
+#ifndef CO_SDO_POOL_CHANNELS_MAX
+#define CO_SDO_POOL_CHANNELS_MAX        16U
+#endif
+
+/* 批次中的一筆寫入 */
+typedef struct {
+    uint8_t                 nodeId;         /* 1 ~ 127 */
+    uint8_t                 subIndex;
+    uint16_t                index;
+    uint32_t                value;
+    uint8_t                 size;           /* 1 ~ 4 byte */
+    uint8_t                 state;          /* CO_SDOpool_start() 清除 */
+    CO_SDO_abortCode_t      abortCode;      /* 結果：CO_SDO_AB_NONE = 成功 */
+} CO_SDOpool_item_t;
+
+/* 通道 - 一個 SDO 客戶端 */
+typedef struct {
+    CO_SDOclient_t         *client;
+    CO_SDOpool_item_t      *item;           /* 進行中的項目，NULL = 閒置 */
+    uint8_t                 nodeId;         /* 客戶端目前設定的伺服器，0 = 已釋放 */
+} CO_SDOpool_channel_t;
+
+/* 通道池 */
+typedef struct {
+    CO_SDOpool_channel_t    channel[CO_SDO_POOL_CHANNELS_MAX];
+    uint8_t                 channelCount;
+    uint8_t                 rr;             /* 下一次 process() 的第一個通道 */
+    uint16_t                timeout_ms;     /* 每個 SDO 交易的逾時 */
+    CO_SDOpool_item_t      *items;
+    uint32_t                itemCount;
+    uint32_t                next;           /* 第一個還沒開始的項目 */
+    uint32_t                done;           /* 結束的項目 (含失敗) */
+    uint32_t                failed;         /* 中止的項目 */
+    uint32_t                busy[4];        /* 有進行中交易的節點 (bit = node ID) */
+} CO_SDOpool_t;
+
+/**
+ * @brief 初始化
+ * @param pool 通道池
+ * @param clients 已初始化的 SDO 客戶端 (例如 CO->SDOclient)
+ * @param count 客戶端數，1 ~ CO_SDO_POOL_CHANNELS_MAX
+ * @param timeout_ms 每個 SDO 交易的逾時
+ * @return CO_ERROR_NO、CO_ERROR_ILLEGAL_ARGUMENT；驅動不支援執行中重新設定 RX 時 CO_ERROR_INVALID_STATE
+ */
+CO_ReturnError_t CO_SDOpool_init(CO_SDOpool_t *pool, CO_SDOclient_t clients[], uint8_t count, uint16_t timeout_ms);
+
+/**
+ * @brief 開始一個批次 - 前一個批次必須已結束 (CO_SDOpool_busy() 為 false)
+ *
+ * items 在批次結束前必須保持有效，結果寫回 items[].abortCode。
+ * @param pool 通道池
+ * @param items 項目陣列
+ * @param count 項目數
+ * @return CO_ERROR_NO；批次進行中、項目的 nodeId 或 size 錯誤時 CO_ERROR_ILLEGAL_ARGUMENT
+ */
+CO_ReturnError_t CO_SDOpool_start(CO_SDOpool_t *pool, CO_SDOpool_item_t items[], uint32_t count);
+
+/**
+ * @brief 處理所有通道 - 在主循環中與 CO_process() 一起調用
+ * @param pool 通道池
+ * @param timeDifference_us 距上次調用的時間
+ * @param [in,out] timerNext_us 下一次需要調用的時間 (可為 NULL)，只會被減小
+ * @return 尚未結束的項目數，0 = 批次結束
+ */
+uint32_t CO_SDOpool_process(CO_SDOpool_t *pool, uint32_t timeDifference_us, uint32_t *timerNext_us);
+
+/**
+ * @brief 中止批次 - 進行中的交易送出中止，還沒開始的項目以 CO_SDO_AB_GENERAL 結束
+ * @param pool 通道池
+ */
+void CO_SDOpool_abort(CO_SDOpool_t *pool);
+
+/**
+ * @brief 批次進行中
+ * @param pool 通道池
+ * @return true: 還有沒結束的項目
+ */
+static inline bool_t CO_SDOpool_busy(const CO_SDOpool_t *pool)
+{
+    return pool->done < pool->itemCount;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* (CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_ENABLE */
+
+#endif /* CO_SDO_POOL_H */
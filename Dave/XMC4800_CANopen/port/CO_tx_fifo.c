@@ -0,0 +1,57 @@
+/**
+ * MultiCAN transmit FIFO loading for XMC4800 CANopen driver
+ *
+ * @file CO_tx_fifo.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+#include "CO_tx_fifo.h"
+#include <string.h>
+
+/******************************************************************************/
+void CO_CANtxFifo_init(CO_CANtxFifo_t *fifo, XMC_CAN_MO_t *slaves, uint16_t depth)
+{
+    memset(fifo, 0, sizeof(*fifo));
+    fifo->slaves = slaves;
+    fifo->depth = depth;
+}
+
+/******************************************************************************/
+void CO_CANtxFifo_load(CO_CANtxFifo_t *fifo, const CO_CANtx_t *buffer)
+{
+    XMC_CAN_MO_t *mo = &fifo->slaves[fifo->loadIndex];
+
+    mo->can_data_length = (uint8_t)(buffer->DLC > 8U ? 8U : buffer->DLC);
+    memcpy(mo->can_data_byte, buffer->data, sizeof(buffer->data));
+    XMC_CAN_MO_SetIdentifier(mo, buffer->ident & 0x07FFU);
+    (void)XMC_CAN_MO_UpdateData(mo);
+
+    /* 非 CUR 的 slave 由硬體擋住 (TXEN1)，輪到時才開始仲裁 */
+    XMC_CAN_MO_SetStatus(mo, XMC_CAN_MO_SET_STATUS_TX_REQUEST);
+
+    fifo->loadIndex = (uint16_t)((fifo->loadIndex + 1U) % fifo->depth);
+    fifo->inFlight++;
+}
+
+/******************************************************************************/
+uint16_t CO_CANtxFifo_retire(CO_CANtxFifo_t *fifo)
+{
+    uint16_t count = 0;
+
+    /* slave 依載入順序送出，遇到第一個未完成者即停止 */
+    while (fifo->inFlight > 0U) {
+        XMC_CAN_MO_t *mo = &fifo->slaves[fifo->doneIndex];
+
+        if ((XMC_CAN_MO_GetStatus(mo) & XMC_CAN_MO_STATUS_TX_PENDING) == 0U) {
+            break;
+        }
+        XMC_CAN_MO_ResetStatus(mo, XMC_CAN_MO_RESET_STATUS_TX_PENDING);
+
+        fifo->doneIndex = (uint16_t)((fifo->doneIndex + 1U) % fifo->depth);
+        fifo->inFlight--;
+        count++;
+    }
+
+    fifo->frameCount += count;
+    return count;
+}
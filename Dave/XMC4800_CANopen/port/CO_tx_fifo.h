@@ -0,0 +1,71 @@
+/**
+ * MultiCAN transmit FIFO loading for XMC4800 CANopen driver
+ *
+ * @file CO_tx_fifo.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * TX FIFO 模式 (CO_CAN_TX_FIFO_ENABLE) 下，訊框依序寫入 BOT..TOP 的 slave MO 並設定
+ * TXRQ；硬體只讓 CUR 指向的 slave 參與仲裁，送出後 CUR 前進，下一個訊框無需 CPU
+ * 介入即可緊接著送出。本模組記錄已載入與已完成的 slave，在 TX 中斷中依序回收。
+ * slave 不可啟用 single transmit trial：仲裁失敗的訊框被放棄且沒有 TXPND，回收會永久停在該 slave。
+ * 只使用 xmc_can.h 的 MO API，可在 Linux 主機上以 mock 暫存器測試 (見 host/)。
+ */
+
+#ifndef CO_TX_FIFO_H
+#define CO_TX_FIFO_H
+
+#include "CO_driver_target.h"
+#include "xmc_can.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* TX FIFO 軟體狀態 */
+typedef struct {
+    XMC_CAN_MO_t            *slaves;        /* slave MO，依 FIFO 順序 (BOT 到 TOP) */
+    uint16_t                depth;          /* slave 數量 */
+    uint16_t                loadIndex;      /* 下一個要載入的 slave */
+    uint16_t                doneIndex;      /* 下一個要回收的 slave (最早載入者) */
+    volatile uint16_t       inFlight;       /* 已載入但尚未送出的訊框數 */
+    volatile uint32_t       frameCount;     /* 已送出的訊框數 */
+} CO_CANtxFifo_t;
+
+/**
+ * @brief 初始化軟體狀態 - 硬體 CUR 必須同時設為 BOT
+ * @param fifo FIFO 物件
+ * @param slaves slave MO 陣列 (依 FIFO 順序)
+ * @param depth slave 數量
+ */
+void CO_CANtxFifo_init(CO_CANtxFifo_t *fifo, XMC_CAN_MO_t *slaves, uint16_t depth);
+
+/**
+ * @brief FIFO 是否沒有空的 slave
+ * @param fifo FIFO 物件
+ * @return true: 已滿
+ */
+static inline bool CO_CANtxFifo_isFull(const CO_CANtxFifo_t *fifo)
+{
+    return fifo->inFlight >= fifo->depth;
+}
+
+/**
+ * @brief 將訊框複製到下一個 slave 並請求傳送 - FIFO 不可為滿
+ * @param fifo FIFO 物件
+ * @param buffer 傳送緩衝區 (複製後即可重用)
+ */
+void CO_CANtxFifo_load(CO_CANtxFifo_t *fifo, const CO_CANtx_t *buffer);
+
+/**
+ * @brief 回收已送出的 slave (TXPND) - 在 CAN TX 中斷中調用
+ * @param fifo FIFO 物件
+ * @return 回收的訊框數
+ */
+uint16_t CO_CANtxFifo_retire(CO_CANtxFifo_t *fifo);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_TX_FIFO_H */
@@ -0,0 +1,218 @@
+/**
+ * Interrupt-driven transmit state machine for XMC4800 CANopen driver
+ *
+ * @file CO_tx_lmo.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+#include "CO_tx_lmo.h"
+#include <string.h>
+
+/* 將緩衝區寫入 slot 並請求傳送 */
+static void tx_start(CO_CANtxLmo_t *tx, uint8_t slot, CO_CANtx_t *buffer)
+{
+    XMC_CAN_MO_t *mo = tx->mo[slot];
+
+    mo->can_data_length = (uint8_t)(buffer->DLC > 8U ? 8U : buffer->DLC);
+    memcpy(mo->can_data_byte, buffer->data, sizeof(buffer->data));
+    XMC_CAN_MO_SetIdentifier(mo, buffer->ident & 0x07FFU);
+    (void)XMC_CAN_MO_UpdateData(mo);
+    XMC_CAN_MO_SetStatus(mo, XMC_CAN_MO_SET_STATUS_TX_REQUEST);
+
+    tx->active[slot] = buffer;
+    tx->idleMask &= ~(1UL << slot);
+    tx->waitMask &= ~(1UL << slot);
+    tx->abortMask &= ~(1UL << slot);
+    buffer->txState = CO_CAN_TX_ACTIVE;
+}
+
+/* 傳送結束：釋放 slot 與緩衝區 (CO_CANtxLmo_release() 已分離的 slot 沒有緩衝區) */
+static void tx_finish(CO_CANtxLmo_t *tx, CO_CANmodule_t *CANmodule, uint8_t slot)
+{
+    CO_CANtx_t *buffer = tx->active[slot];
+
+    tx->active[slot] = NULL;
+    tx->idleMask |= 1UL << slot;
+    tx->waitMask &= ~(1UL << slot);
+    tx->abortMask &= ~(1UL << slot);
+    if (buffer == NULL) {
+        return;
+    }
+    buffer->txState = CO_CAN_TX_IDLE;
+    buffer->bufferFull = false;
+    CANmodule->CANtxCount--;
+}
+
+/* 依 txArray 順序 (CANopenNode 優先順序) 取出第一個 PENDING 緩衝區 */
+static CO_CANtx_t *tx_next_pending(CO_CANtxLmo_t *tx, CO_CANmodule_t *CANmodule)
+{
+    for (uint16_t i = 0; i < CANmodule->txSize; i++) {
+        CO_CANtx_t *buffer = &CANmodule->txArray[i];
+        if (buffer->txState == CO_CAN_TX_PENDING) {
+            tx->pendingCount--;
+            return buffer;
+        }
+    }
+    return NULL;
+}
+
+/* slot 空出後接續下一個 PENDING 緩衝區 - 同一個 slot 立即再次參與仲裁 */
+static void tx_chain(CO_CANtxLmo_t *tx, CO_CANmodule_t *CANmodule, uint8_t slot)
+{
+    if (tx->pendingCount != 0U) {
+        CO_CANtx_t *next = tx_next_pending(tx, CANmodule);
+        if (next != NULL) {
+            tx_start(tx, slot, next);
+        }
+    }
+}
+
+/******************************************************************************/
+void CO_CANtxLmo_init(CO_CANtxLmo_t *tx)
+{
+    memset(tx, 0, sizeof(*tx));
+}
+
+/******************************************************************************/
+bool CO_CANtxLmo_addSlot(CO_CANtxLmo_t *tx, uint8_t slot, XMC_CAN_MO_t *mo)
+{
+    if (slot >= CO_CAN_TX_LMO_MAX || mo == NULL) {
+        return false;
+    }
+    tx->mo[slot] = mo;
+    tx->active[slot] = NULL;
+    tx->idleMask |= 1UL << slot;
+    return true;
+}
+
+/******************************************************************************/
+bool CO_CANtxLmo_send(CO_CANtxLmo_t *tx, CO_CANmodule_t *CANmodule, CO_CANtx_t *buffer)
+{
+    uint32_t start = CO_CAN_CYCLES();
+    bool accepted = true;
+
+    if (buffer->bufferFull) {
+        /* PENDING 時送出最新的資料；ACTIVE 時這一筆已在硬體中 */
+        accepted = false;
+    } else {
+        uint32_t idle = tx->idleMask;
+
+        buffer->bufferFull = true;
+        CANmodule->CANtxCount++;
+
+        if (buffer->dave_lmo != NULL && buffer->lmo_index < CO_CAN_TX_LMO_MAX &&
+            (idle & (1UL << buffer->lmo_index)) != 0U) {
+            tx_start(tx, buffer->lmo_index, buffer);
+        } else if (idle != 0U) {
+            tx_start(tx, (uint8_t)__builtin_ctz(idle), buffer);
+        } else {
+            buffer->txState = CO_CAN_TX_PENDING;
+            tx->pendingCount++;
+        }
+    }
+
+    uint32_t cycles = CO_CAN_CYCLES() - start;
+    if (cycles > tx->sendCyclesMax) {
+        tx->sendCyclesMax = cycles;
+    }
+    return accepted;
+}
+
+/******************************************************************************/
+bool CO_CANtxLmo_service(CO_CANtxLmo_t *tx, CO_CANmodule_t *CANmodule, uint8_t slot)
+{
+    if (slot >= CO_CAN_TX_LMO_MAX || tx->mo[slot] == NULL || (tx->idleMask & (1UL << slot)) != 0U) {
+        return false;
+    }
+
+    uint32_t start = CO_CAN_CYCLES();
+    XMC_CAN_MO_t *mo = tx->mo[slot];
+
+    /* 只有 TXPND 表示訊框已送出；TXRQ 為 0 而沒有 TXPND 時訊框可能正在匯流排上 */
+    if ((XMC_CAN_MO_GetStatus(mo) & XMC_CAN_MO_STATUS_TX_PENDING) == 0U) {
+        return false;
+    }
+    XMC_CAN_MO_ResetStatus(mo, XMC_CAN_MO_RESET_STATUS_TX_PENDING);
+    tx->frameCount++;
+    tx_finish(tx, CANmodule, slot);
+    CANmodule->firstCANtxMessage = false;
+
+    /* **⚡ 接續下一個 PENDING 緩衝區** */
+    tx_chain(tx, CANmodule, slot);
+
+    uint32_t cycles = CO_CAN_CYCLES() - start;
+    if (cycles > tx->serviceCyclesMax) {
+        tx->serviceCyclesMax = cycles;
+    }
+    return true;
+}
+
+/******************************************************************************/
+void CO_CANtxLmo_poll(CO_CANtxLmo_t *tx, CO_CANmodule_t *CANmodule, uint32_t now)
+{
+    for (uint8_t slot = 0; slot < CO_CAN_TX_LMO_MAX; slot++) {
+        uint32_t bit = 1UL << slot;
+
+        if (tx->mo[slot] == NULL || (tx->idleMask & bit) != 0U || CO_CANtxLmo_service(tx, CANmodule, slot)) {
+            continue;
+        }
+        if ((tx->waitMask & bit) == 0U) {
+            tx->waitMask |= bit;
+            tx->waitStart[slot] = now;
+        } else if ((uint32_t)(now - tx->waitStart[slot]) >= CO_CAN_TX_LMO_TIMEOUT_CYCLES) {
+            if ((tx->abortMask & bit) == 0U) {
+                /* 停止重送；已開始的訊框仍會完成並設定 TXPND，再等一個逾時 */
+                XMC_CAN_MO_ResetStatus(tx->mo[slot], XMC_CAN_MO_RESET_STATUS_TX_REQUEST);
+                tx->abortMask |= bit;
+                tx->waitStart[slot] = now;
+            } else {
+                /* 訊框放棄，與 bus-off 後相同由上層重送 */
+                tx->abortCount++;
+                tx_finish(tx, CANmodule, slot);
+                tx_chain(tx, CANmodule, slot);
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+bool CO_CANtxLmo_cancel(CO_CANtxLmo_t *tx, CO_CANmodule_t *CANmodule, CO_CANtx_t *buffer)
+{
+    if (buffer->txState != CO_CAN_TX_PENDING) {
+        return false;
+    }
+    buffer->txState = CO_CAN_TX_IDLE;
+    buffer->bufferFull = false;
+    CANmodule->CANtxCount--;
+    tx->pendingCount--;
+    return true;
+}
+
+/******************************************************************************/
+bool CO_CANtxLmo_release(CO_CANtxLmo_t *tx, CO_CANmodule_t *CANmodule, CO_CANtx_t *buffer, uint32_t now)
+{
+    if (buffer->txState == CO_CAN_TX_PENDING) {
+        return CO_CANtxLmo_cancel(tx, CANmodule, buffer);
+    }
+    if (buffer->txState != CO_CAN_TX_ACTIVE) {
+        return false;
+    }
+
+    for (uint8_t slot = 0; slot < CO_CAN_TX_LMO_MAX; slot++) {
+        if (tx->active[slot] == buffer) {
+            uint32_t bit = 1UL << slot;
+
+            /* 停止重送；slot 保持忙碌，直到 TXPND 或一個逾時後由 poll 回收 */
+            XMC_CAN_MO_ResetStatus(tx->mo[slot], XMC_CAN_MO_RESET_STATUS_TX_REQUEST);
+            tx->active[slot] = NULL;
+            tx->waitMask |= bit;
+            tx->abortMask |= bit;
+            tx->waitStart[slot] = now;
+            break;
+        }
+    }
+    buffer->txState = CO_CAN_TX_IDLE;
+    buffer->bufferFull = false;
+    CANmodule->CANtxCount--;
+    return true;
+}
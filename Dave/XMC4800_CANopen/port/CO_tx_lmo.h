@@ -0,0 +1,119 @@
+/**
+ * Interrupt-driven transmit state machine for XMC4800 CANopen driver
+ *
+ * @file CO_tx_lmo.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 每個 DAVE TX LMO 是一個 slot (編號 = CAN_NODE_0 LMO index)。CO_CANsend() 只把訊框寫入
+ * 空閒的 slot 或標記為 PENDING，不等待匯流排；bufferFull 與 CANtxCount 只在傳送完成時
+ * (CO_CANtxLmo_service) 清除，並立即把下一個 PENDING 緩衝區寫入同一個 slot。
+ * slot 只在 TXPND 時回收：single transmit trial 在訊框「開始」傳送時就清除 TXRQ，
+ * TXRQ 為 0 不代表失敗，因此 TX LMO 不使用 STT，仲裁失敗或匯流排錯誤由硬體重送。
+ * 無法送出的訊框 (沒有 ACK、bus off) 由 CO_CANtxLmo_poll() 以逾時處理：超過
+ * CO_CAN_TX_LMO_TIMEOUT_CYCLES 仍未完成時清除 TXRQ，再等待一個逾時 (期間 TXPND 仍算成功)
+ * 後才放棄並釋放 slot，已在匯流排上的訊框不會被記到下一個緩衝區。
+ * 匯流排運作中重新初始化緩衝區 (CO_CANtxBufferInit) 時以 CO_CANtxLmo_release() 分離
+ * 傳送中的緩衝區：slot 以同樣的方式停止重送並等待回收，但不再屬於任何緩衝區。
+ * 只使用 xmc_can.h 的 MO API，可在 Linux 主機上以 mock 暫存器測試 (見 host/)。
+ */
+
+#ifndef CO_TX_LMO_H
+#define CO_TX_LMO_H
+
+#include "CO_driver_target.h"
+#include "xmc_can.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* TX 狀態機 */
+typedef struct {
+    XMC_CAN_MO_t            *mo[CO_CAN_TX_LMO_MAX];     /* slot 的 MO，NULL: 非 TX LMO */
+    CO_CANtx_t              *active[CO_CAN_TX_LMO_MAX]; /* slot 正在傳送的緩衝區，NULL: 空閒或已分離 */
+    uint32_t                idleMask;       /* 空閒 slot 位元 */
+    uint16_t                pendingCount;   /* PENDING 緩衝區數量 */
+    uint32_t                waitMask;       /* poll 已開始計時的 slot */
+    uint32_t                abortMask;      /* 已清除 TXRQ，等待可能仍在匯流排上的訊框結束 */
+    uint32_t                waitStart[CO_CAN_TX_LMO_MAX]; /* 計時開始 (CO_CAN_CYCLES) */
+    volatile uint32_t       frameCount;     /* 傳送完成的訊框數 */
+    volatile uint32_t       abortCount;     /* 逾時放棄的訊框數 */
+    volatile uint32_t       sendCyclesMax;  /* CO_CANtxLmo_send() 最長執行週期 */
+    volatile uint32_t       serviceCyclesMax; /* CO_CANtxLmo_service() 最長執行週期 */
+} CO_CANtxLmo_t;
+
+/**
+ * @brief 初始化 (所有 slot 未使用)
+ * @param tx 狀態機物件
+ */
+void CO_CANtxLmo_init(CO_CANtxLmo_t *tx);
+
+/**
+ * @brief 登記 TX LMO 為可用 slot
+ * @param tx 狀態機物件
+ * @param slot CAN_NODE_0 LMO index
+ * @param mo TX LMO 的 MO 物件
+ * @return true: 成功, false: slot 超出 CO_CAN_TX_LMO_MAX
+ */
+bool CO_CANtxLmo_addSlot(CO_CANtxLmo_t *tx, uint8_t slot, XMC_CAN_MO_t *mo);
+
+/**
+ * @brief 傳送緩衝區 - 須在 CO_LOCK_CAN_SEND 內調用，執行時間與匯流排狀態無關
+ *
+ * 緩衝區已綁定 LMO (dave_lmo) 時優先使用該 slot，否則使用任一空閒 slot；
+ * 沒有空閒 slot 時維持 PENDING，由傳送完成中斷送出。
+ * @param tx 狀態機物件
+ * @param CANmodule CAN 模組 (txArray, CANtxCount)
+ * @param buffer 傳送緩衝區
+ * @return true: 已送出或排隊, false: 緩衝區仍有未送出的訊框 (overflow)
+ */
+bool CO_CANtxLmo_send(CO_CANtxLmo_t *tx, CO_CANmodule_t *CANmodule, CO_CANtx_t *buffer);
+
+/**
+ * @brief 處理 slot 的傳送完成 (TXPND)，並接續下一個 PENDING 緩衝區
+ *
+ * 重複調用無副作用：沒有 TXPND 時不做任何事。須在 CO_LOCK_CAN_SEND 內或 CAN ISR 中調用。
+ * @param tx 狀態機物件
+ * @param CANmodule CAN 模組
+ * @param slot CAN_NODE_0 LMO index
+ * @return true: 傳送成功完成
+ */
+bool CO_CANtxLmo_service(CO_CANtxLmo_t *tx, CO_CANmodule_t *CANmodule, uint8_t slot);
+
+/**
+ * @brief 檢查所有傳送中的 slot - 在 CO_CANmodule_process() 中以 CO_LOCK_CAN_SEND 調用，
+ *        回收遺失的完成中斷，放棄逾時的訊框
+ * @param tx 狀態機物件
+ * @param CANmodule CAN 模組
+ * @param now 目前時間 (CO_CAN_CYCLES())
+ */
+void CO_CANtxLmo_poll(CO_CANtxLmo_t *tx, CO_CANmodule_t *CANmodule, uint32_t now);
+
+/**
+ * @brief 取消尚未寫入 LMO 的緩衝區 (CO_CANclearPendingSyncPDOs)
+ * @param tx 狀態機物件
+ * @param CANmodule CAN 模組
+ * @param buffer 傳送緩衝區
+ * @return true: 已取消, false: 不是 PENDING (已在匯流排上或沒有訊框)
+ */
+bool CO_CANtxLmo_cancel(CO_CANtxLmo_t *tx, CO_CANmodule_t *CANmodule, CO_CANtx_t *buffer);
+
+/**
+ * @brief 釋放緩衝區的訊框 (CO_CANtxBufferInit 重新初始化) - 須在 CO_LOCK_CAN_SEND 內調用
+ *
+ * PENDING 時與 CO_CANtxLmo_cancel() 相同；ACTIVE 時清除 slot 的 TXRQ 並把 slot 與緩衝區分離，
+ * 緩衝區立即可重用，slot 在 TXPND 或逾時後才回到空閒 (期間不會載入其他緩衝區)。
+ * @param tx 狀態機物件
+ * @param CANmodule CAN 模組
+ * @param buffer 傳送緩衝區
+ * @param now 目前時間 (CO_CAN_CYCLES())，分離的 slot 由此開始計時
+ * @return true: 已釋放, false: 緩衝區沒有訊框
+ */
+bool CO_CANtxLmo_release(CO_CANtxLmo_t *tx, CO_CANmodule_t *CANmodule, CO_CANtx_t *buffer, uint32_t now);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_TX_LMO_H */
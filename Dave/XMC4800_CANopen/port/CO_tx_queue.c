@@ -0,0 +1,82 @@
+/**
+ * Priority-ordered CAN transmit queue for XMC4800 CANopen driver
+ *
+ * @file CO_tx_queue.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+#include "CO_tx_queue.h"
+
+/******************************************************************************/
+void CO_CANtxQueue_init(CO_CANtxQueue_t *queue)
+{
+    queue->count = 0;
+    queue->maxCount = 0;
+}
+
+/******************************************************************************/
+bool CO_CANtxQueue_push(CO_CANtxQueue_t *queue, CO_CANtx_t *buffer)
+{
+    if (buffer->queued) {
+        return true;
+    }
+    if (queue->count >= CO_CAN_TX_QUEUE_SIZE) {
+        return false;
+    }
+
+    uint16_t ident = (uint16_t)(buffer->ident & 0x07FFU);
+    uint16_t i = queue->count++;
+
+    /* 上浮：父節點 COB-ID 較大時往下移 */
+    while (i > 0U) {
+        uint16_t parent = (uint16_t)((i - 1U) / 2U);
+        if (queue->heap[parent].ident <= ident) {
+            break;
+        }
+        queue->heap[i] = queue->heap[parent];
+        i = parent;
+    }
+    queue->heap[i].buffer = buffer;
+    queue->heap[i].ident = ident;
+    buffer->queued = true;
+
+    if (queue->count > queue->maxCount) {
+        queue->maxCount = queue->count;
+    }
+    return true;
+}
+
+/******************************************************************************/
+CO_CANtx_t *CO_CANtxQueue_pop(CO_CANtxQueue_t *queue)
+{
+    while (queue->count > 0U) {
+        CO_CANtx_t *buffer = queue->heap[0].buffer;
+        CO_CANtxQueueEntry_t last = queue->heap[--queue->count];
+        uint16_t i = 0;
+
+        /* 下沉：以最後一個項目填補根節點 */
+        for (;;) {
+            uint16_t child = (uint16_t)(2U * i + 1U);
+            if (child >= queue->count) {
+                break;
+            }
+            if (child + 1U < queue->count && queue->heap[child + 1U].ident < queue->heap[child].ident) {
+                child++;
+            }
+            if (last.ident <= queue->heap[child].ident) {
+                break;
+            }
+            queue->heap[i] = queue->heap[child];
+            i = child;
+        }
+        queue->heap[i] = last;
+
+        buffer->queued = false;
+        /* 加入後已被取消 (bufferFull 清除) 的緩衝區直接丟棄 */
+        if (buffer->bufferFull) {
+            return buffer;
+        }
+    }
+
+    return NULL;
+}
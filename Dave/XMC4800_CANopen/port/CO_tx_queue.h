@@ -0,0 +1,61 @@
+/**
+ * Priority-ordered CAN transmit queue for XMC4800 CANopen driver
+ *
+ * @file CO_tx_queue.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * 硬體 TX FIFO 滿時，待送的 CO_CANtx_t 進入以 COB-ID 為鍵的二元最小堆積，
+ * 每次取出 COB-ID 最小 (匯流排優先權最高) 的緩衝區，與 CAN 仲裁順序一致。
+ * 每個緩衝區只佔一個項目 (queued 旗標)；bufferFull 被外部清除的緩衝區
+ * (例如 CO_CANclearPendingSyncPDOs) 不會從堆積刪除，而是在取出時略過。
+ */
+
+#ifndef CO_TX_QUEUE_H
+#define CO_TX_QUEUE_H
+
+#include "CO_driver_target.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 堆積項目 - 鍵值在加入時複製，比較時不需存取緩衝區 */
+typedef struct {
+    CO_CANtx_t              *buffer;
+    uint16_t                ident;
+} CO_CANtxQueueEntry_t;
+
+/* 傳送佇列 */
+typedef struct {
+    CO_CANtxQueueEntry_t    heap[CO_CAN_TX_QUEUE_SIZE];
+    uint16_t                count;          /* 堆積中的項目數 (含已失效項目) */
+    uint16_t                maxCount;       /* count 的最大值 */
+} CO_CANtxQueue_t;
+
+/**
+ * @brief 初始化 (清空) 佇列
+ * @param queue 佇列物件
+ */
+void CO_CANtxQueue_init(CO_CANtxQueue_t *queue);
+
+/**
+ * @brief 加入緩衝區 - 已在佇列中時不重複加入
+ * @param queue 佇列物件
+ * @param buffer 傳送緩衝區
+ * @return true: 已在佇列中, false: 佇列已滿
+ */
+bool CO_CANtxQueue_push(CO_CANtxQueue_t *queue, CO_CANtx_t *buffer);
+
+/**
+ * @brief 取出 COB-ID 最小且 bufferFull 仍為 true 的緩衝區
+ * @param queue 佇列物件
+ * @return 緩衝區，佇列中沒有待送緩衝區時為 NULL
+ */
+CO_CANtx_t *CO_CANtxQueue_pop(CO_CANtxQueue_t *queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_TX_QUEUE_H */
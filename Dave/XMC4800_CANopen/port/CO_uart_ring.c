@@ -0,0 +1,82 @@
+/**
+ * Non-blocking byte ring for the debug UART
+ *
+ * @file CO_uart_ring.c
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ */
+#include "CO_uart_ring.h"
+#include <string.h>
+
+#define CO_UART_RING_MASK               (CO_UART_RING_SIZE - 1U)
+
+/******************************************************************************/
+void CO_uartRing_init(CO_uartRing_t *ring, CO_uartDropPolicy_t policy)
+{
+    memset(ring, 0, sizeof(*ring));
+    ring->policy = policy;
+}
+
+/******************************************************************************/
+uint32_t CO_uartRing_write(CO_uartRing_t *ring, const uint8_t *data, uint32_t len)
+{
+    uint32_t space = CO_UART_RING_SIZE - (ring->head - ring->tail);
+
+    if (len > space) {
+        if (ring->policy == CO_UART_DROP_NEWEST) {
+            /* 整筆丟棄，避免輸出半行 */
+            ring->droppedBytes += len;
+            return 0U;
+        }
+
+        /* DROP_OLDEST: 比緩衝區還長的訊息只保留尾端 */
+        if (len > CO_UART_RING_SIZE) {
+            ring->droppedBytes += len - CO_UART_RING_SIZE;
+            data += len - CO_UART_RING_SIZE;
+            len = CO_UART_RING_SIZE;
+        }
+        uint32_t drop = len - space;
+        ring->tail += drop;
+        ring->droppedBytes += drop;
+    }
+
+    /* 最多分兩段複製 (跨越緩衝區尾端) */
+    uint32_t pos = ring->head & CO_UART_RING_MASK;
+    uint32_t first = CO_UART_RING_SIZE - pos;
+    if (first > len) {
+        first = len;
+    }
+    memcpy(&ring->buf[pos], data, first);
+    memcpy(&ring->buf[0], data + first, len - first);
+    ring->head += len;
+
+    uint32_t fill = ring->head - ring->tail;
+    if (fill > ring->maxFill) {
+        ring->maxFill = fill;
+    }
+    return len;
+}
+
+/******************************************************************************/
+uint32_t CO_uartRing_claim(CO_uartRing_t *ring, uint8_t **data)
+{
+    if (ring->txLen == 0U) {
+        uint32_t len = ring->head - ring->tail;
+        if (len > CO_UART_RING_CHUNK_MAX) {
+            len = CO_UART_RING_CHUNK_MAX;
+        }
+
+        uint32_t pos = ring->tail & CO_UART_RING_MASK;
+        uint32_t first = CO_UART_RING_SIZE - pos;
+        if (first > len) {
+            first = len;
+        }
+        memcpy(&ring->txBuf[0], &ring->buf[pos], first);
+        memcpy(&ring->txBuf[first], &ring->buf[0], len - first);
+        ring->tail += len;
+        ring->txLen = len;
+    }
+
+    *data = ring->txBuf;
+    return ring->txLen;
+}
@@ -0,0 +1,106 @@
+/**
+ * Non-blocking byte ring for the debug UART
+ *
+ * @file CO_uart_ring.h
+ * @author XMC4800 CANopen Team
+ * @copyright 2025
+ *
+ * Debug_Printf_Raw() 只把格式化後的字串複製進環形緩衝區就返回；
+ * 送出由 UART APP 的 TX FIFO 中斷完成：每次把最多 CO_UART_RING_CHUNK_MAX
+ * 位元組從環形緩衝區搬到獨立的傳送區 (claim) 交給 UART_Transmit()，
+ * 傳送完成 (tx_busy 清除) 後呼叫 CO_uartRing_sent() 接續下一段。
+ * 傳送中的資料不在環形緩衝區內，所以滿載時可以直接丟棄最舊的待送資料。
+ * 寫入、claim、sent 都在同一個執行緒 (主循環) 中呼叫。
+ */
+
+#ifndef CO_UART_RING_H
+#define CO_UART_RING_H
+
+#include "CO_driver_target.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 緩衝區位元組數 - 必須是 2 的次方 */
+#ifndef CO_UART_RING_SIZE
+#define CO_UART_RING_SIZE               4096U
+#endif
+
+/* 單次交給 UART 的最大位元組數 */
+#ifndef CO_UART_RING_CHUNK_MAX
+#define CO_UART_RING_CHUNK_MAX          512U
+#endif
+
+/* 預設滿載策略 */
+#ifndef CO_UART_RING_POLICY
+#define CO_UART_RING_POLICY             CO_UART_DROP_NEWEST
+#endif
+
+/* 緩衝區滿時的丟棄策略 */
+typedef enum {
+    CO_UART_DROP_NEWEST = 0,            /* 丟棄放不下的新訊息 (保留開機訊息) */
+    CO_UART_DROP_OLDEST = 1             /* 丟棄尚未送出的最舊資料 (保留最新狀態) */
+} CO_uartDropPolicy_t;
+
+/* head / tail 為自由遞增的位元組數，待送資料為 [tail, head) */
+typedef struct {
+    uint8_t                 buf[CO_UART_RING_SIZE];
+    uint32_t                head;           /* 已寫入位元組數 */
+    uint32_t                tail;           /* 已搬到傳送區的位元組數 */
+    uint8_t                 txBuf[CO_UART_RING_CHUNK_MAX];
+    uint32_t                txLen;          /* 傳送區位元組數，0 = 空 */
+    CO_uartDropPolicy_t     policy;
+    uint32_t                droppedBytes;   /* 累計丟棄位元組數 */
+    uint32_t                maxFill;        /* 最高使用量 */
+} CO_uartRing_t;
+
+/**
+ * @brief 初始化 (清空) 緩衝區
+ * @param ring 緩衝區
+ * @param policy 滿載策略
+ */
+void CO_uartRing_init(CO_uartRing_t *ring, CO_uartDropPolicy_t policy);
+
+/**
+ * @brief 寫入資料 - 不阻塞，放不下的部分依 policy 丟棄
+ * @param ring 緩衝區
+ * @param data 資料
+ * @param len 位元組數
+ * @return 實際寫入的位元組數
+ */
+uint32_t CO_uartRing_write(CO_uartRing_t *ring, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief 取得要交給 UART 的傳送區
+ *
+ * 傳送區為空時從環形緩衝區搬入下一段；上一段尚未以 CO_uartRing_sent()
+ * 確認時回傳同一段 (UART 拒絕後可重試)。
+ * @param ring 緩衝區
+ * @param data [out] 傳送區起點
+ * @return 位元組數；0 表示沒有待送資料
+ */
+uint32_t CO_uartRing_claim(CO_uartRing_t *ring, uint8_t **data);
+
+/**
+ * @brief 確認傳送區已送出
+ * @param ring 緩衝區
+ */
+static inline void CO_uartRing_sent(CO_uartRing_t *ring)
+{
+    ring->txLen = 0U;
+}
+
+/**
+ * @brief 尚未送出的位元組數 (含傳送區)
+ */
+static inline uint32_t CO_uartRing_pending(const CO_uartRing_t *ring)
+{
+    return (ring->head - ring->tail) + ring->txLen;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CO_UART_RING_H */